@@ -20,6 +20,16 @@ AC_DEFUN([AX_LIBEVTX_CHECK_LOCAL],
   dnl Check for internationalization functions in libevtx/libevtx_i18n.c
   AC_CHECK_FUNCS([bindtextdomain])
 
+  dnl Headers and functions included in libevtx/libevtx_statistics.c
+  dnl and evtxtools/evtxtools_profile.c
+  AC_CHECK_HEADERS([sys/resource.h sys/time.h time.h])
+
+  AC_SEARCH_LIBS(
+    [clock_gettime],
+    [rt])
+
+  AC_CHECK_FUNCS([clock_gettime getrusage gettimeofday])
+
   dnl Check if library should be build with verbose output
   AX_COMMON_CHECK_ENABLE_VERBOSE_OUTPUT
 
@@ -0,0 +1,1698 @@
+/*
+ * Bench handle
+ *
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#include "bench_handle.h"
+#include "bench_memory.h"
+#include "evtxtools_libbfio.h"
+#include "evtxtools_libcerror.h"
+#include "evtxtools_libclocale.h"
+#include "evtxtools_libevtx.h"
+#include "evtxtools_profile.h"
+
+#define BENCH_HANDLE_NOTIFY_STREAM	stdout
+
+const char *bench_handle_phase_names[ BENCH_HANDLE_NUMBER_OF_PHASES ] = {
+	"open",
+	"record_retrieval",
+	"cached_record_retrieval",
+	"system_getters",
+	"xml_rendering",
+	"event_strings" };
+
+/* Creates a bench handle
+ * Make sure the value bench_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_initialize(
+     bench_handle_t **bench_handle,
+     libcerror_error_t **error )
+{
+	static char *function          = "bench_handle_initialize";
+	uint64_t number_of_allocations = 0;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *bench_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid bench handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*bench_handle = memory_allocate_structure(
+	                 bench_handle_t );
+
+	if( *bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create bench handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *bench_handle,
+	     0,
+	     sizeof( bench_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear bench handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_file_initialize(
+	     &( ( *bench_handle )->input_file ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize input file.",
+		 function );
+
+		goto on_error;
+	}
+	( *bench_handle )->have_number_of_allocations = bench_memory_get_number_of_allocations(
+	                                                 &number_of_allocations );
+
+	( *bench_handle )->ascii_codepage = LIBEVTX_CODEPAGE_WINDOWS_1252;
+	( *bench_handle )->output_format  = BENCH_HANDLE_OUTPUT_FORMAT_TEXT;
+	( *bench_handle )->notify_stream  = BENCH_HANDLE_NOTIFY_STREAM;
+
+	return( 1 );
+
+on_error:
+	if( *bench_handle != NULL )
+	{
+		memory_free(
+		 *bench_handle );
+
+		*bench_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a bench handle
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_free(
+     bench_handle_t **bench_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_handle_free";
+	int result            = 1;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *bench_handle != NULL )
+	{
+		if( ( *bench_handle )->input_file != NULL )
+		{
+			if( libevtx_file_free(
+			     &( ( *bench_handle )->input_file ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free input file.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *bench_handle )->file_io_handle != NULL )
+		{
+			if( libbfio_handle_free(
+			     &( ( *bench_handle )->file_io_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *bench_handle )->string != NULL )
+		{
+			memory_free(
+			 ( *bench_handle )->string );
+		}
+		if( ( *bench_handle )->string_offsets != NULL )
+		{
+			memory_free(
+			 ( *bench_handle )->string_offsets );
+		}
+		if( ( *bench_handle )->xml_string != NULL )
+		{
+			memory_free(
+			 ( *bench_handle )->xml_string );
+		}
+		memory_free(
+		 *bench_handle );
+
+		*bench_handle = NULL;
+	}
+	return( result );
+}
+
+/* Signals the bench handle to abort
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_signal_abort(
+     bench_handle_t *bench_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_handle_signal_abort";
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	bench_handle->abort = 1;
+
+	if( bench_handle->input_file != NULL )
+	{
+		if( libevtx_file_signal_abort(
+		     bench_handle->input_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to signal input file to abort.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Sets the ascii codepage
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_set_ascii_codepage(
+     bench_handle_t *bench_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function  = "bench_handle_set_ascii_codepage";
+	size_t string_length   = 0;
+	uint32_t feature_flags = 0;
+	int result             = 0;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	feature_flags = LIBCLOCALE_CODEPAGE_FEATURE_FLAG_HAVE_KOI8
+	              | LIBCLOCALE_CODEPAGE_FEATURE_FLAG_HAVE_WINDOWS;
+
+	string_length = system_string_length(
+	                 string );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libclocale_codepage_copy_from_string_wide(
+	          &( bench_handle->ascii_codepage ),
+	          string,
+	          string_length,
+	          feature_flags,
+	          error );
+#else
+	result = libclocale_codepage_copy_from_string(
+	          &( bench_handle->ascii_codepage ),
+	          string,
+	          string_length,
+	          feature_flags,
+	          error );
+#endif
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine ASCII codepage.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Sets the output format
+ * Returns 1 if successful, 0 if unsupported values or -1 on error
+ */
+int bench_handle_set_output_format(
+     bench_handle_t *bench_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_handle_set_output_format";
+	size_t string_length  = 0;
+	int result            = 0;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( string_length == 4 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "json" ),
+		     4 ) == 0 )
+		{
+			bench_handle->output_format = BENCH_HANDLE_OUTPUT_FORMAT_JSON;
+			result                      = 1;
+		}
+		else if( system_string_compare(
+		          string,
+		          _SYSTEM_STRING( "text" ),
+		          4 ) == 0 )
+		{
+			bench_handle->output_format = BENCH_HANDLE_OUTPUT_FORMAT_TEXT;
+			result                      = 1;
+		}
+	}
+	return( result );
+}
+
+/* Starts timing a phase
+ */
+void bench_handle_phase_start(
+      uint64_t *start_time,
+      uint64_t *start_number_of_allocations )
+{
+	bench_memory_get_number_of_allocations(
+	 start_number_of_allocations );
+
+	*start_time = evtxtools_profile_get_time();
+}
+
+/* Stops timing a phase and adds the measurements to the phase totals
+ */
+void bench_handle_phase_stop(
+      bench_handle_t *bench_handle,
+      int phase_index,
+      uint64_t start_time,
+      uint64_t start_number_of_allocations,
+      uint64_t number_of_bytes )
+{
+	bench_phase_t *phase           = NULL;
+	uint64_t number_of_allocations = 0;
+	uint64_t stop_time             = 0;
+
+	stop_time = evtxtools_profile_get_time();
+
+	bench_memory_get_number_of_allocations(
+	 &number_of_allocations );
+
+	phase = &( bench_handle->phases[ phase_index ] );
+
+	if( stop_time > start_time )
+	{
+		phase->elapsed_time += stop_time - start_time;
+	}
+	phase->number_of_items       += 1;
+	phase->number_of_bytes       += number_of_bytes;
+	phase->number_of_allocations += number_of_allocations - start_number_of_allocations;
+}
+
+/* Resizes the string buffer if it is too small
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_resize_string(
+     bench_handle_t *bench_handle,
+     size_t string_size,
+     libcerror_error_t **error )
+{
+	uint8_t *reallocation = NULL;
+	static char *function = "bench_handle_resize_string";
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size > bench_handle->string_size )
+	{
+		reallocation = (uint8_t *) memory_reallocate(
+		                            bench_handle->string,
+		                            sizeof( uint8_t ) * string_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize string.",
+			 function );
+
+			return( -1 );
+		}
+		bench_handle->string      = reallocation;
+		bench_handle->string_size = string_size;
+	}
+	return( 1 );
+}
+
+/* Opens the input of the bench handle
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_open_input(
+     bench_handle_t *bench_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function                = "bench_handle_open_input";
+	size_t filename_length               = 0;
+	uint64_t start_number_of_allocations = 0;
+	uint64_t start_time                  = 0;
+	int result                           = 0;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( bench_handle->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid bench handle - file IO handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &( bench_handle->file_io_handle ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = system_string_length(
+	                   filename );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libbfio_file_set_name_wide(
+	          bench_handle->file_io_handle,
+	          filename,
+	          filename_length,
+	          error );
+#else
+	result = libbfio_file_set_name(
+	          bench_handle->file_io_handle,
+	          filename,
+	          filename_length,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set file IO handle name.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_file_set_ascii_codepage(
+	     bench_handle->input_file,
+	     bench_handle->ascii_codepage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set ASCII codepage in input file.",
+		 function );
+
+		goto on_error;
+	}
+	bench_handle_phase_start(
+	 &start_time,
+	 &start_number_of_allocations );
+
+	result = libevtx_file_open_file_io_handle(
+	          bench_handle->input_file,
+	          bench_handle->file_io_handle,
+	          LIBEVTX_OPEN_READ,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_get_size(
+	     bench_handle->file_io_handle,
+	     &( bench_handle->file_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	bench_handle_phase_stop(
+	 bench_handle,
+	 BENCH_HANDLE_PHASE_OPEN,
+	 start_time,
+	 start_number_of_allocations,
+	 (uint64_t) bench_handle->file_size );
+
+	if( libevtx_file_get_number_of_records(
+	     bench_handle->input_file,
+	     &( bench_handle->number_of_records ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( bench_handle->file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &( bench_handle->file_io_handle ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes the input of the bench handle
+ * Returns the 0 if succesful or -1 on error
+ */
+int bench_handle_close_input(
+     bench_handle_t *bench_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_handle_close_input";
+	int result            = 0;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_file_close(
+	     bench_handle->input_file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close input file.",
+		 function );
+
+		result = -1;
+	}
+	if( bench_handle->file_io_handle != NULL )
+	{
+		if( libbfio_handle_free(
+		     &( bench_handle->file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO handle.",
+			 function );
+
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Retrieves an UTF-8 encoded string value of a record into the string buffer
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int bench_handle_get_record_utf8_string_value(
+     bench_handle_t *bench_handle,
+     libevtx_record_t *record,
+     int (*get_utf8_string_size)(
+            libevtx_record_t *record,
+            size_t *utf8_string_size,
+            libevtx_error_t **error ),
+     int (*get_utf8_string)(
+            libevtx_record_t *record,
+            uint8_t *utf8_string,
+            size_t utf8_string_size,
+            libevtx_error_t **error ),
+     size_t *number_of_bytes,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_handle_get_record_utf8_string_value";
+	size_t string_size    = 0;
+	int result            = 0;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_bytes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of bytes.",
+		 function );
+
+		return( -1 );
+	}
+	result = get_utf8_string_size(
+	          record,
+	          &string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( result == 0 )
+	 || ( string_size == 0 ) )
+	{
+		return( 0 );
+	}
+	if( bench_handle_resize_string(
+	     bench_handle,
+	     string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize string.",
+		 function );
+
+		return( -1 );
+	}
+	result = get_utf8_string(
+	          record,
+	          bench_handle->string,
+	          string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string.",
+		 function );
+
+		return( -1 );
+	}
+	if( result != 0 )
+	{
+		*number_of_bytes += string_size;
+	}
+	return( result );
+}
+
+/* Retrieves the system values of a record
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_get_record_system_values(
+     bench_handle_t *bench_handle,
+     libevtx_record_t *record,
+     size_t *number_of_bytes,
+     libcerror_error_t **error )
+{
+	static char *function      = "bench_handle_get_record_system_values";
+	uint64_t value_64bit       = 0;
+	uint32_t event_identifier  = 0;
+	uint32_t qualifiers        = 0;
+	uint32_t record_identifier = 0;
+	uint8_t event_level        = 0;
+
+	if( number_of_bytes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of bytes.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_record_get_identifier(
+	     record,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve identifier.",
+		 function );
+
+		return( -1 );
+	}
+	record_identifier = (uint32_t) value_64bit;
+
+	if( libevtx_record_get_written_time(
+	     record,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve written time of record: %" PRIu32 ".",
+		 function,
+		 record_identifier );
+
+		return( -1 );
+	}
+	if( libevtx_record_get_event_identifier(
+	     record,
+	     &event_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event identifier of record: %" PRIu32 ".",
+		 function,
+		 record_identifier );
+
+		return( -1 );
+	}
+	if( libevtx_record_get_event_identifier_qualifiers(
+	     record,
+	     &qualifiers,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event identifier qualifiers of record: %" PRIu32 ".",
+		 function,
+		 record_identifier );
+
+		return( -1 );
+	}
+	if( libevtx_record_get_event_level(
+	     record,
+	     &event_level,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event level of record: %" PRIu32 ".",
+		 function,
+		 record_identifier );
+
+		return( -1 );
+	}
+	if( bench_handle_get_record_utf8_string_value(
+	     bench_handle,
+	     record,
+	     &libevtx_record_get_utf8_provider_identifier_size,
+	     &libevtx_record_get_utf8_provider_identifier,
+	     number_of_bytes,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve provider identifier of record: %" PRIu32 ".",
+		 function,
+		 record_identifier );
+
+		return( -1 );
+	}
+	if( bench_handle_get_record_utf8_string_value(
+	     bench_handle,
+	     record,
+	     &libevtx_record_get_utf8_source_name_size,
+	     &libevtx_record_get_utf8_source_name,
+	     number_of_bytes,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve source name of record: %" PRIu32 ".",
+		 function,
+		 record_identifier );
+
+		return( -1 );
+	}
+	if( bench_handle_get_record_utf8_string_value(
+	     bench_handle,
+	     record,
+	     &libevtx_record_get_utf8_computer_name_size,
+	     &libevtx_record_get_utf8_computer_name,
+	     number_of_bytes,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve computer name of record: %" PRIu32 ".",
+		 function,
+		 record_identifier );
+
+		return( -1 );
+	}
+	if( bench_handle_get_record_utf8_string_value(
+	     bench_handle,
+	     record,
+	     &libevtx_record_get_utf8_user_security_identifier_size,
+	     &libevtx_record_get_utf8_user_security_identifier,
+	     number_of_bytes,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve user security identifier of record: %" PRIu32 ".",
+		 function,
+		 record_identifier );
+
+		return( -1 );
+	}
+	*number_of_bytes += 8 + 4 + 4 + 1;
+
+	return( 1 );
+}
+
+/* Renders the XML string of a record
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_get_record_xml_string(
+     bench_handle_t *bench_handle,
+     libevtx_record_t *record,
+     size_t *number_of_bytes,
+     libcerror_error_t **error )
+{
+	static char *function    = "bench_handle_get_record_xml_string";
+	size_t xml_string_length = 0;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_bytes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of bytes.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_record_get_utf8_xml_string_buffer(
+	     record,
+	     &( bench_handle->xml_string ),
+	     &( bench_handle->xml_string_size ),
+	     &xml_string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve XML string.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_bytes += xml_string_length;
+
+	return( 1 );
+}
+
+/* Retrieves the event strings of a record
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_get_record_strings(
+     bench_handle_t *bench_handle,
+     libevtx_record_t *record,
+     size_t *number_of_bytes,
+     libcerror_error_t **error )
+{
+	size_t *reallocation  = NULL;
+	static char *function = "bench_handle_get_record_strings";
+	size_t strings_size   = 0;
+	int number_of_strings = 0;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_bytes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of bytes.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_record_get_number_of_strings(
+	     record,
+	     &number_of_strings,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of strings in record.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_strings <= 0 )
+	{
+		return( 1 );
+	}
+	if( libevtx_record_get_utf8_strings_size(
+	     record,
+	     &strings_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve strings size.",
+		 function );
+
+		return( -1 );
+	}
+	if( bench_handle_resize_string(
+	     bench_handle,
+	     strings_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize string.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_strings > bench_handle->number_of_string_offsets )
+	{
+		if( (size_t) number_of_strings > (size_t) ( SSIZE_MAX / sizeof( size_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of strings value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = (size_t *) memory_reallocate(
+		                           bench_handle->string_offsets,
+		                           sizeof( size_t ) * number_of_strings );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize string offsets.",
+			 function );
+
+			return( -1 );
+		}
+		bench_handle->string_offsets           = reallocation;
+		bench_handle->number_of_string_offsets = number_of_strings;
+	}
+	if( libevtx_record_get_utf8_strings(
+	     record,
+	     bench_handle->string,
+	     strings_size,
+	     bench_handle->string_offsets,
+	     number_of_strings,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve strings.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_bytes += strings_size;
+
+	return( 1 );
+}
+
+/* Benchmarks a specific record
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_benchmark_record(
+     bench_handle_t *bench_handle,
+     int record_index,
+     libcerror_error_t **error )
+{
+	libevtx_record_t *record             = NULL;
+	static char *function                = "bench_handle_benchmark_record";
+	size_t number_of_bytes               = 0;
+	size_t record_data_size              = 0;
+	uint64_t start_number_of_allocations = 0;
+	uint64_t start_time                  = 0;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* The record is read from its chunk and its XML document is parsed
+	 * when the record is retrieved
+	 */
+	bench_handle_phase_start(
+	 &start_time,
+	 &start_number_of_allocations );
+
+	if( libevtx_file_get_record_by_index(
+	     bench_handle->input_file,
+	     record_index,
+	     &record,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record: %d.",
+		 function,
+		 record_index );
+
+		goto on_error;
+	}
+	if( libevtx_record_get_data_size(
+	     record,
+	     &record_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record: %d data size.",
+		 function,
+		 record_index );
+
+		goto on_error;
+	}
+	bench_handle_phase_stop(
+	 bench_handle,
+	 BENCH_HANDLE_PHASE_RECORD_RETRIEVAL,
+	 start_time,
+	 start_number_of_allocations,
+	 (uint64_t) record_data_size );
+
+	if( libevtx_record_free(
+	     &record,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free record: %d.",
+		 function,
+		 record_index );
+
+		goto on_error;
+	}
+	/* Retrieving the same record again measures the cost of a record
+	 * that is already cached by the file
+	 */
+	bench_handle_phase_start(
+	 &start_time,
+	 &start_number_of_allocations );
+
+	if( libevtx_file_get_record_by_index(
+	     bench_handle->input_file,
+	     record_index,
+	     &record,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cached record: %d.",
+		 function,
+		 record_index );
+
+		goto on_error;
+	}
+	bench_handle_phase_stop(
+	 bench_handle,
+	 BENCH_HANDLE_PHASE_CACHED_RECORD_RETRIEVAL,
+	 start_time,
+	 start_number_of_allocations,
+	 (uint64_t) record_data_size );
+
+	number_of_bytes = 0;
+
+	bench_handle_phase_start(
+	 &start_time,
+	 &start_number_of_allocations );
+
+	if( bench_handle_get_record_system_values(
+	     bench_handle,
+	     record,
+	     &number_of_bytes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve system values of record: %d.",
+		 function,
+		 record_index );
+
+		goto on_error;
+	}
+	bench_handle_phase_stop(
+	 bench_handle,
+	 BENCH_HANDLE_PHASE_SYSTEM_GETTERS,
+	 start_time,
+	 start_number_of_allocations,
+	 (uint64_t) number_of_bytes );
+
+	number_of_bytes = 0;
+
+	bench_handle_phase_start(
+	 &start_time,
+	 &start_number_of_allocations );
+
+	if( bench_handle_get_record_xml_string(
+	     bench_handle,
+	     record,
+	     &number_of_bytes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to render XML string of record: %d.",
+		 function,
+		 record_index );
+
+		goto on_error;
+	}
+	bench_handle_phase_stop(
+	 bench_handle,
+	 BENCH_HANDLE_PHASE_XML_RENDERING,
+	 start_time,
+	 start_number_of_allocations,
+	 (uint64_t) number_of_bytes );
+
+	number_of_bytes = 0;
+
+	bench_handle_phase_start(
+	 &start_time,
+	 &start_number_of_allocations );
+
+	if( bench_handle_get_record_strings(
+	     bench_handle,
+	     record,
+	     &number_of_bytes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve strings of record: %d.",
+		 function,
+		 record_index );
+
+		goto on_error;
+	}
+	bench_handle_phase_stop(
+	 bench_handle,
+	 BENCH_HANDLE_PHASE_EVENT_STRINGS,
+	 start_time,
+	 start_number_of_allocations,
+	 (uint64_t) number_of_bytes );
+
+	if( libevtx_record_free(
+	     &record,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free record: %d.",
+		 function,
+		 record_index );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( record != NULL )
+	{
+		libevtx_record_free(
+		 &record,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Benchmarks the records
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int bench_handle_benchmark_records(
+     bench_handle_t *bench_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_handle_benchmark_records";
+	int record_index      = 0;
+	int result            = 0;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	for( record_index = 0;
+	     record_index < bench_handle->number_of_records;
+	     record_index++ )
+	{
+		if( bench_handle->abort != 0 )
+		{
+			return( 0 );
+		}
+		if( bench_handle_benchmark_record(
+		     bench_handle,
+		     record_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to benchmark record: %d.",
+			 function,
+			 record_index );
+
+			return( -1 );
+		}
+	}
+	result = evtxtools_profile_get_peak_memory_usage(
+	          &( bench_handle->peak_memory_usage ),
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve peak memory usage.",
+		 function );
+
+		return( -1 );
+	}
+	bench_handle->have_peak_memory_usage = result;
+
+	return( 1 );
+}
+
+/* Prints a string as a JSON string to a stream
+ */
+void bench_handle_json_string_fprint(
+      FILE *stream,
+      const system_character_t *string )
+{
+	size_t string_index = 0;
+
+	fprintf(
+	 stream,
+	 "\"" );
+
+	if( string != NULL )
+	{
+		for( string_index = 0;
+		     string[ string_index ] != 0;
+		     string_index++ )
+		{
+			if( ( string[ string_index ] == (system_character_t) '"' )
+			 || ( string[ string_index ] == (system_character_t) '\\' ) )
+			{
+				fprintf(
+				 stream,
+				 "\\%" PRIc_SYSTEM "",
+				 string[ string_index ] );
+			}
+			else if( (unsigned int) string[ string_index ] < 0x20 )
+			{
+				fprintf(
+				 stream,
+				 "\\u%04x",
+				 (unsigned int) string[ string_index ] );
+			}
+			else
+			{
+				fprintf(
+				 stream,
+				 "%" PRIc_SYSTEM "",
+				 string[ string_index ] );
+			}
+		}
+	}
+	fprintf(
+	 stream,
+	 "\"" );
+}
+
+/* Prints the benchmark results
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_results_fprint(
+     bench_handle_t *bench_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	bench_phase_t *phase        = NULL;
+	static char *function       = "bench_handle_results_fprint";
+	double elapsed_seconds      = 0.0;
+	double items_per_second     = 0.0;
+	double megabytes_per_second = 0.0;
+	int phase_index             = 0;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( bench_handle->output_format == BENCH_HANDLE_OUTPUT_FORMAT_JSON )
+	{
+		fprintf(
+		 bench_handle->notify_stream,
+		 "{\n\t\"file\": " );
+
+		bench_handle_json_string_fprint(
+		 bench_handle->notify_stream,
+		 filename );
+
+		fprintf(
+		 bench_handle->notify_stream,
+		 ",\n\t\"file_size\": %" PRIu64 ",\n",
+		 bench_handle->file_size );
+
+		fprintf(
+		 bench_handle->notify_stream,
+		 "\t\"number_of_records\": %d,\n",
+		 bench_handle->number_of_records );
+
+		if( bench_handle->have_peak_memory_usage != 0 )
+		{
+			fprintf(
+			 bench_handle->notify_stream,
+			 "\t\"peak_memory_usage\": %" PRIu64 ",\n",
+			 bench_handle->peak_memory_usage );
+		}
+		else
+		{
+			fprintf(
+			 bench_handle->notify_stream,
+			 "\t\"peak_memory_usage\": null,\n" );
+		}
+		fprintf(
+		 bench_handle->notify_stream,
+		 "\t\"phases\": {\n" );
+	}
+	else
+	{
+		fprintf(
+		 bench_handle->notify_stream,
+		 "Benchmark results:\n" );
+
+		fprintf(
+		 bench_handle->notify_stream,
+		 "\tFile\t\t\t\t: %" PRIs_SYSTEM "\n",
+		 filename );
+
+		fprintf(
+		 bench_handle->notify_stream,
+		 "\tFile size\t\t\t: %" PRIu64 " bytes\n",
+		 bench_handle->file_size );
+
+		fprintf(
+		 bench_handle->notify_stream,
+		 "\tNumber of records\t\t: %d\n",
+		 bench_handle->number_of_records );
+
+		if( bench_handle->have_peak_memory_usage != 0 )
+		{
+			fprintf(
+			 bench_handle->notify_stream,
+			 "\tPeak memory usage\t\t: %" PRIu64 " bytes\n",
+			 bench_handle->peak_memory_usage );
+		}
+		fprintf(
+		 bench_handle->notify_stream,
+		 "\n" );
+	}
+	for( phase_index = 0;
+	     phase_index < BENCH_HANDLE_NUMBER_OF_PHASES;
+	     phase_index++ )
+	{
+		phase = &( bench_handle->phases[ phase_index ] );
+
+		elapsed_seconds      = (double) phase->elapsed_time / 1000000000.0;
+		items_per_second     = 0.0;
+		megabytes_per_second = 0.0;
+
+		if( elapsed_seconds > 0.0 )
+		{
+			items_per_second     = (double) phase->number_of_items / elapsed_seconds;
+			megabytes_per_second = ( (double) phase->number_of_bytes / ( 1024.0 * 1024.0 ) ) / elapsed_seconds;
+		}
+		if( bench_handle->output_format == BENCH_HANDLE_OUTPUT_FORMAT_JSON )
+		{
+			fprintf(
+			 bench_handle->notify_stream,
+			 "\t\t\"%s\": {\n",
+			 bench_handle_phase_names[ phase_index ] );
+
+			fprintf(
+			 bench_handle->notify_stream,
+			 "\t\t\t\"elapsed_time\": %" PRIu64 ",\n",
+			 phase->elapsed_time );
+
+			fprintf(
+			 bench_handle->notify_stream,
+			 "\t\t\t\"number_of_items\": %" PRIu64 ",\n",
+			 phase->number_of_items );
+
+			fprintf(
+			 bench_handle->notify_stream,
+			 "\t\t\t\"number_of_bytes\": %" PRIu64 ",\n",
+			 phase->number_of_bytes );
+
+			fprintf(
+			 bench_handle->notify_stream,
+			 "\t\t\t\"items_per_second\": %.3f,\n",
+			 items_per_second );
+
+			fprintf(
+			 bench_handle->notify_stream,
+			 "\t\t\t\"megabytes_per_second\": %.3f,\n",
+			 megabytes_per_second );
+
+			if( bench_handle->have_number_of_allocations != 0 )
+			{
+				fprintf(
+				 bench_handle->notify_stream,
+				 "\t\t\t\"number_of_allocations\": %" PRIu64 "\n",
+				 phase->number_of_allocations );
+			}
+			else
+			{
+				fprintf(
+				 bench_handle->notify_stream,
+				 "\t\t\t\"number_of_allocations\": null\n" );
+			}
+			fprintf(
+			 bench_handle->notify_stream,
+			 "\t\t}%s\n",
+			 ( phase_index < ( BENCH_HANDLE_NUMBER_OF_PHASES - 1 ) ) ? "," : "" );
+		}
+		else
+		{
+			fprintf(
+			 bench_handle->notify_stream,
+			 "Phase: %s\n",
+			 bench_handle_phase_names[ phase_index ] );
+
+			fprintf(
+			 bench_handle->notify_stream,
+			 "\tElapsed time\t\t\t: %.3f ms\n",
+			 (double) phase->elapsed_time / 1000000.0 );
+
+			fprintf(
+			 bench_handle->notify_stream,
+			 "\tNumber of items\t\t\t: %" PRIu64 "\n",
+			 phase->number_of_items );
+
+			fprintf(
+			 bench_handle->notify_stream,
+			 "\tItems per second\t\t: %.1f\n",
+			 items_per_second );
+
+			fprintf(
+			 bench_handle->notify_stream,
+			 "\tThroughput\t\t\t: %.3f MiB/s\n",
+			 megabytes_per_second );
+
+			if( bench_handle->have_number_of_allocations != 0 )
+			{
+				fprintf(
+				 bench_handle->notify_stream,
+				 "\tNumber of allocations\t\t: %" PRIu64 "\n",
+				 phase->number_of_allocations );
+			}
+			fprintf(
+			 bench_handle->notify_stream,
+			 "\n" );
+		}
+	}
+	if( bench_handle->output_format == BENCH_HANDLE_OUTPUT_FORMAT_JSON )
+	{
+		fprintf(
+		 bench_handle->notify_stream,
+		 "\t}\n}\n" );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,259 @@
+/*
+ * Bench handle
+ *
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _BENCH_HANDLE_H )
+#define _BENCH_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "evtxtools_libbfio.h"
+#include "evtxtools_libcerror.h"
+#include "evtxtools_libevtx.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+enum BENCH_HANDLE_OUTPUT_FORMATS
+{
+	BENCH_HANDLE_OUTPUT_FORMAT_JSON		= (int) 'j',
+	BENCH_HANDLE_OUTPUT_FORMAT_TEXT		= (int) 't'
+};
+
+enum BENCH_HANDLE_PHASES
+{
+	BENCH_HANDLE_PHASE_OPEN,
+	BENCH_HANDLE_PHASE_RECORD_RETRIEVAL,
+	BENCH_HANDLE_PHASE_CACHED_RECORD_RETRIEVAL,
+	BENCH_HANDLE_PHASE_SYSTEM_GETTERS,
+	BENCH_HANDLE_PHASE_XML_RENDERING,
+	BENCH_HANDLE_PHASE_EVENT_STRINGS,
+
+	/* The number of phases
+	 */
+	BENCH_HANDLE_NUMBER_OF_PHASES
+};
+
+typedef struct bench_phase bench_phase_t;
+
+struct bench_phase
+{
+	/* The elapsed time in nanoseconds
+	 */
+	uint64_t elapsed_time;
+
+	/* The number of items (records) processed
+	 */
+	uint64_t number_of_items;
+
+	/* The number of bytes processed
+	 */
+	uint64_t number_of_bytes;
+
+	/* The number of memory allocations
+	 */
+	uint64_t number_of_allocations;
+};
+
+typedef struct bench_handle bench_handle_t;
+
+struct bench_handle
+{
+	/* The libevtx input file
+	 */
+	libevtx_file_t *input_file;
+
+	/* The libbfio input file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The input file size
+	 */
+	size64_t file_size;
+
+	/* The ascii codepage
+	 */
+	int ascii_codepage;
+
+	/* The output format
+	 */
+	int output_format;
+
+	/* The number of records
+	 */
+	int number_of_records;
+
+	/* The phases
+	 */
+	bench_phase_t phases[ BENCH_HANDLE_NUMBER_OF_PHASES ];
+
+	/* Value to indicate if the number of allocations is available
+	 */
+	int have_number_of_allocations;
+
+	/* The peak memory usage after the benchmark
+	 */
+	uint64_t peak_memory_usage;
+
+	/* Value to indicate if the peak memory usage is available
+	 */
+	int have_peak_memory_usage;
+
+	/* The string buffer, which is reused for every record
+	 */
+	uint8_t *string;
+
+	/* The string buffer size
+	 */
+	size_t string_size;
+
+	/* The string offsets, which are reused for every record
+	 */
+	size_t *string_offsets;
+
+	/* The number of string offsets
+	 */
+	int number_of_string_offsets;
+
+	/* The XML string buffer, which is reused for every record
+	 */
+	uint8_t *xml_string;
+
+	/* The XML string buffer size
+	 */
+	size_t xml_string_size;
+
+	/* The notification output stream
+	 */
+	FILE *notify_stream;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+int bench_handle_initialize(
+     bench_handle_t **bench_handle,
+     libcerror_error_t **error );
+
+int bench_handle_free(
+     bench_handle_t **bench_handle,
+     libcerror_error_t **error );
+
+int bench_handle_signal_abort(
+     bench_handle_t *bench_handle,
+     libcerror_error_t **error );
+
+int bench_handle_set_ascii_codepage(
+     bench_handle_t *bench_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int bench_handle_set_output_format(
+     bench_handle_t *bench_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+void bench_handle_phase_start(
+      uint64_t *start_time,
+      uint64_t *start_number_of_allocations );
+
+void bench_handle_phase_stop(
+      bench_handle_t *bench_handle,
+      int phase_index,
+      uint64_t start_time,
+      uint64_t start_number_of_allocations,
+      uint64_t number_of_bytes );
+
+int bench_handle_resize_string(
+     bench_handle_t *bench_handle,
+     size_t string_size,
+     libcerror_error_t **error );
+
+int bench_handle_open_input(
+     bench_handle_t *bench_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int bench_handle_close_input(
+     bench_handle_t *bench_handle,
+     libcerror_error_t **error );
+
+int bench_handle_get_record_utf8_string_value(
+     bench_handle_t *bench_handle,
+     libevtx_record_t *record,
+     int (*get_utf8_string_size)(
+            libevtx_record_t *record,
+            size_t *utf8_string_size,
+            libevtx_error_t **error ),
+     int (*get_utf8_string)(
+            libevtx_record_t *record,
+            uint8_t *utf8_string,
+            size_t utf8_string_size,
+            libevtx_error_t **error ),
+     size_t *number_of_bytes,
+     libcerror_error_t **error );
+
+int bench_handle_get_record_system_values(
+     bench_handle_t *bench_handle,
+     libevtx_record_t *record,
+     size_t *number_of_bytes,
+     libcerror_error_t **error );
+
+int bench_handle_get_record_xml_string(
+     bench_handle_t *bench_handle,
+     libevtx_record_t *record,
+     size_t *number_of_bytes,
+     libcerror_error_t **error );
+
+int bench_handle_get_record_strings(
+     bench_handle_t *bench_handle,
+     libevtx_record_t *record,
+     size_t *number_of_bytes,
+     libcerror_error_t **error );
+
+int bench_handle_benchmark_record(
+     bench_handle_t *bench_handle,
+     int record_index,
+     libcerror_error_t **error );
+
+int bench_handle_benchmark_records(
+     bench_handle_t *bench_handle,
+     libcerror_error_t **error );
+
+void bench_handle_json_string_fprint(
+      FILE *stream,
+      const system_character_t *string );
+
+int bench_handle_results_fprint(
+     bench_handle_t *bench_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _BENCH_HANDLE_H ) */
+
@@ -0,0 +1,124 @@
+/*
+ * Memory allocation counting for evtxbench
+ *
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "bench_memory.h"
+#include "evtxtools_profile.h"
+
+#if defined( HAVE_BENCH_MEMORY )
+
+/* The allocation functions of the C library, these are called directly
+ * instead of being looked up with dlsym, since dlsym can allocate memory
+ * itself and would then recurse into the custom malloc
+ */
+extern void *__libc_malloc(
+              size_t size );
+
+extern void *__libc_calloc(
+              size_t number_of_elements,
+              size_t element_size );
+
+extern void *__libc_realloc(
+              void *ptr,
+              size_t size );
+
+/* The number of allocations, the libraries can allocate from multiple threads
+ * hence the counter is updated atomically
+ */
+static uint64_t bench_memory_number_of_allocations = 0;
+
+/* Custom malloc that counts the allocations
+ * Returns a pointer to newly allocated data or NULL
+ */
+void *malloc(
+       size_t size )
+{
+	evtxtools_profile_counter_add(
+	 bench_memory_number_of_allocations,
+	 1 );
+
+	return( __libc_malloc(
+	         size ) );
+}
+
+/* Custom calloc that counts the allocations
+ * Returns a pointer to newly allocated data or NULL
+ */
+void *calloc(
+       size_t number_of_elements,
+       size_t element_size )
+{
+	evtxtools_profile_counter_add(
+	 bench_memory_number_of_allocations,
+	 1 );
+
+	return( __libc_calloc(
+	         number_of_elements,
+	         element_size ) );
+}
+
+/* Custom realloc that counts the allocations
+ * Returns a pointer to reallocated data or NULL
+ */
+void *realloc(
+       void *ptr,
+       size_t size )
+{
+	evtxtools_profile_counter_add(
+	 bench_memory_number_of_allocations,
+	 1 );
+
+	return( __libc_realloc(
+	         ptr,
+	         size ) );
+}
+
+#endif /* defined( HAVE_BENCH_MEMORY ) */
+
+/* Retrieves the number of allocations
+ * Returns 1 if successful or 0 if not available
+ */
+int bench_memory_get_number_of_allocations(
+     uint64_t *number_of_allocations )
+{
+	if( number_of_allocations == NULL )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_BENCH_MEMORY )
+	*number_of_allocations = evtxtools_profile_counter_get(
+	                          bench_memory_number_of_allocations );
+
+	return( 1 );
+#else
+	*number_of_allocations = 0;
+
+	return( 0 );
+#endif
+}
+
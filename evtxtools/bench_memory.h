@@ -0,0 +1,48 @@
+/*
+ * Memory allocation counting for evtxbench
+ *
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _BENCH_MEMORY_H )
+#define _BENCH_MEMORY_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The allocations are counted by overriding malloc, calloc and realloc, which is
+ * only possible with the GNU C library and a library that is not a DLL
+ */
+#if defined( __GLIBC__ ) && defined( __GNUC__ ) && defined( __ATOMIC_RELAXED ) && !defined( LIBEVTX_DLL_IMPORT ) && !defined( __arm__ ) && !defined( __clang__ ) && !defined( __CYGWIN__ ) && !defined( __hppa__ ) && !defined( __mips__ ) && !defined( __sparc__ ) && !defined( HAVE_ASAN )
+#define HAVE_BENCH_MEMORY		1
+#endif
+
+int bench_memory_get_number_of_allocations(
+     uint64_t *number_of_allocations );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _BENCH_MEMORY_H ) */
+
@@ -0,0 +1,2078 @@
+/*
+ * Compile handle
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#include "compile_handle.h"
+#include "evtxinput.h"
+#include "evtxtools_libcerror.h"
+#include "evtxtools_libfguid.h"
+#include "evtxtools_libwrc.h"
+#include "evtxtools_system_split_string.h"
+#include "message_catalog.h"
+#include "message_handle.h"
+#include "message_string.h"
+#include "registry_key_table.h"
+#include "resource_file.h"
+
+#define COMPILE_HANDLE_NOTIFY_STREAM		stdout
+
+/* Creates a compile handle
+ * Make sure the value compile_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int compile_handle_initialize(
+     compile_handle_t **compile_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "compile_handle_initialize";
+
+	if( compile_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compile handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compile_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid compile handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*compile_handle = memory_allocate_structure(
+	                   compile_handle_t );
+
+	if( *compile_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create compile handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *compile_handle,
+	     0,
+	     sizeof( compile_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear compile handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( message_handle_initialize(
+	     &( ( *compile_handle )->message_handle ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create message handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( message_catalog_initialize(
+	     &( ( *compile_handle )->message_catalog ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create message catalog.",
+		 function );
+
+		goto on_error;
+	}
+	( *compile_handle )->event_log_type = EVTXTOOLS_EVENT_LOG_TYPE_APPLICATION;
+	( *compile_handle )->notify_stream  = COMPILE_HANDLE_NOTIFY_STREAM;
+
+	return( 1 );
+
+on_error:
+	if( *compile_handle != NULL )
+	{
+		if( ( *compile_handle )->message_handle != NULL )
+		{
+			message_handle_free(
+			 &( ( *compile_handle )->message_handle ),
+			 NULL );
+		}
+		memory_free(
+		 *compile_handle );
+
+		*compile_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a compile handle
+ * Returns 1 if successful or -1 on error
+ */
+int compile_handle_free(
+     compile_handle_t **compile_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "compile_handle_free";
+	int result            = 1;
+
+	if( compile_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compile handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compile_handle != NULL )
+	{
+		if( message_catalog_free(
+		     &( ( *compile_handle )->message_catalog ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free message catalog.",
+			 function );
+
+			result = -1;
+		}
+		if( message_handle_free(
+		     &( ( *compile_handle )->message_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free message handle.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *compile_handle );
+
+		*compile_handle = NULL;
+	}
+	return( result );
+}
+
+/* Signals the compile handle to abort
+ * Returns 1 if successful or -1 on error
+ */
+int compile_handle_signal_abort(
+     compile_handle_t *compile_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "compile_handle_signal_abort";
+
+	if( compile_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compile handle.",
+		 function );
+
+		return( -1 );
+	}
+	compile_handle->abort = 1;
+
+	if( compile_handle->message_handle != NULL )
+	{
+		if( message_handle_signal_abort(
+		     compile_handle->message_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to signal message handle to abort.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Sets the event log type
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int compile_handle_set_event_log_type(
+     compile_handle_t *compile_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "compile_handle_set_event_log_type";
+	int result            = 0;
+
+	if( compile_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compile handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = evtxinput_determine_event_log_type(
+	          string,
+	          &( compile_handle->event_log_type ),
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine event log type.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Sets the name of the software registry file
+ * Returns 1 if successful or -1 error
+ */
+int compile_handle_set_software_registry_filename(
+     compile_handle_t *compile_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "compile_handle_set_software_registry_filename";
+
+	if( compile_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compile handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_handle_set_software_registry_filename(
+	     compile_handle->message_handle,
+	     filename,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set software registry filename in message handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the name of the system registry file
+ * Returns 1 if successful or -1 error
+ */
+int compile_handle_set_system_registry_filename(
+     compile_handle_t *compile_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "compile_handle_set_system_registry_filename";
+
+	if( compile_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compile handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_handle_set_system_registry_filename(
+	     compile_handle->message_handle,
+	     filename,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set system registry filename in message handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the name of the directory containing the software and system registry file
+ * Returns 1 if successful or -1 error
+ */
+int compile_handle_set_registry_directory_name(
+     compile_handle_t *compile_handle,
+     const system_character_t *name,
+     libcerror_error_t **error )
+{
+	static char *function = "compile_handle_set_registry_directory_name";
+
+	if( compile_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compile handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_handle_set_registry_directory_name(
+	     compile_handle->message_handle,
+	     name,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set registry directory name in message handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the path of the resource files
+ * Returns 1 if successful or -1 error
+ */
+int compile_handle_set_resource_files_path(
+     compile_handle_t *compile_handle,
+     const system_character_t *path,
+     libcerror_error_t **error )
+{
+	static char *function = "compile_handle_set_resource_files_path";
+
+	if( compile_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compile handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_handle_set_resource_files_path(
+	     compile_handle->message_handle,
+	     path,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set resource files path in message handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Opens the input
+ * The publisher and event source keys are preloaded so that they can be enumerated
+ * Returns 1 if successful or -1 on error
+ */
+int compile_handle_open_input(
+     compile_handle_t *compile_handle,
+     libcerror_error_t **error )
+{
+	const char *eventlog_key_name = NULL;
+	static char *function         = "compile_handle_open_input";
+
+	if( compile_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compile handle.",
+		 function );
+
+		return( -1 );
+	}
+	eventlog_key_name = evtxinput_get_event_log_key_name(
+	                     compile_handle->event_log_type );
+
+	if( message_handle_set_preload_registry_keys(
+	     compile_handle->message_handle,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set preload registry keys in message handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_handle_open_input(
+	     compile_handle->message_handle,
+	     eventlog_key_name,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input of message handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_catalog_set_eventlog_key_name(
+	     compile_handle->message_catalog,
+	     eventlog_key_name,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set eventlog key name in message catalog.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Closes the input
+ * Returns the 0 if succesful or -1 on error
+ */
+int compile_handle_close_input(
+     compile_handle_t *compile_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "compile_handle_close_input";
+
+	if( compile_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compile handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_handle_close_input(
+	     compile_handle->message_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close input of message handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 0 );
+}
+
+/* Copies the GUID string to a byte stream
+ * Returns 1 if successful or -1 on error
+ */
+int compile_handle_guid_string_copy_to_byte_stream(
+     compile_handle_t *compile_handle,
+     const system_character_t *string,
+     size_t string_length,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error )
+{
+	libfguid_identifier_t *guid = NULL;
+	static char *function       = "compile_handle_guid_string_copy_to_byte_stream";
+	int result                  = 0;
+
+	if( compile_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compile handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfguid_identifier_initialize(
+	     &guid,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create GUID.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libfguid_identifier_copy_from_utf16_string(
+		  guid,
+		  (uint16_t *) string,
+		  string_length,
+		  LIBFGUID_STRING_FORMAT_FLAG_USE_MIXED_CASE | LIBFGUID_STRING_FORMAT_FLAG_USE_SURROUNDING_BRACES,
+		  error );
+#else
+	result = libfguid_identifier_copy_from_utf8_string(
+		  guid,
+		  (uint8_t *) string,
+		  string_length,
+		  LIBFGUID_STRING_FORMAT_FLAG_USE_MIXED_CASE | LIBFGUID_STRING_FORMAT_FLAG_USE_SURROUNDING_BRACES,
+		  error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to copy GUID from string.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfguid_identifier_copy_to_byte_stream(
+	     guid,
+	     byte_stream,
+	     byte_stream_size,
+	     LIBFGUID_ENDIAN_LITTLE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to copy GUID to byte stream.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfguid_identifier_free(
+	     &guid,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free GUID.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( guid != NULL )
+	{
+		libfguid_identifier_free(
+		 &guid,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves a specific resource file or MUI resource file
+ * The resource file is owned by the resource file cache of the message handle
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int compile_handle_get_resource_file(
+     compile_handle_t *compile_handle,
+     const system_character_t *resource_filename,
+     size_t resource_filename_length,
+     uint8_t is_mui_resource_file,
+     resource_file_t **resource_file,
+     libcerror_error_t **error )
+{
+	system_character_t *resource_file_path = NULL;
+	static char *function                  = "compile_handle_get_resource_file";
+	size_t resource_file_path_size         = 0;
+	int result                             = 0;
+
+	if( compile_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compile handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file.",
+		 function );
+
+		return( -1 );
+	}
+	*resource_file = NULL;
+
+	if( is_mui_resource_file == 0 )
+	{
+		result = message_handle_get_resource_file_from_cache(
+			  compile_handle->message_handle,
+			  resource_filename,
+			  resource_filename_length,
+			  resource_file,
+			  error );
+	}
+	else
+	{
+		result = message_handle_get_mui_resource_file_from_cache(
+			  compile_handle->message_handle,
+			  resource_filename,
+			  resource_filename_length,
+			  resource_file,
+			  error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve resource file from cache.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		return( 1 );
+	}
+	/* The MUI resource file path is: %PATH%/%LANGUAGE%/%FILENAME%.mui
+	 */
+	if( is_mui_resource_file == 0 )
+	{
+		result = message_handle_get_resource_file_path(
+		          compile_handle->message_handle,
+		          resource_filename,
+		          resource_filename_length,
+		          NULL,
+		          0,
+		          &resource_file_path,
+		          &resource_file_path_size,
+		          error );
+	}
+	else
+	{
+		result = message_handle_get_resource_file_path(
+		          compile_handle->message_handle,
+		          resource_filename,
+		          resource_filename_length,
+		          _SYSTEM_STRING( "en-US" ),
+		          5,
+		          &resource_file_path,
+		          &resource_file_path_size,
+		          error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve resource file path.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( is_mui_resource_file == 0 )
+	{
+		result = message_handle_get_resource_file(
+		          compile_handle->message_handle,
+		          resource_filename,
+		          resource_filename_length,
+		          resource_file_path,
+		          resource_file,
+		          error );
+	}
+	else
+	{
+		result = message_handle_get_mui_resource_file(
+		          compile_handle->message_handle,
+		          resource_filename,
+		          resource_filename_length,
+		          resource_file_path,
+		          resource_file,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve resource file: %" PRIs_SYSTEM ".",
+		 function,
+		 resource_file_path );
+
+		goto on_error;
+	}
+	memory_free(
+	 resource_file_path );
+
+	if( *resource_file == NULL )
+	{
+		return( 0 );
+	}
+	return( 1 );
+
+on_error:
+	if( resource_file_path != NULL )
+	{
+		memory_free(
+		 resource_file_path );
+	}
+	return( -1 );
+}
+
+/* Appends the identifiers of the message strings in a resource file
+ * Returns 1 if successful, 0 if the resource file has no message table or -1 on error
+ */
+int compile_handle_append_message_identifiers(
+     compile_handle_t *compile_handle,
+     resource_file_t *resource_file,
+     uint32_t **message_identifiers,
+     int *number_of_message_identifiers,
+     int *maximum_number_of_message_identifiers,
+     libcerror_error_t **error )
+{
+	uint32_t *reallocation            = NULL;
+	static char *function             = "compile_handle_append_message_identifiers";
+	int maximum_number_of_identifiers = 0;
+	int message_string_index          = 0;
+	int number_of_message_strings     = 0;
+	int result                        = 0;
+
+	if( compile_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compile handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_identifiers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message identifiers.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_message_identifiers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of message identifiers.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_message_identifiers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum number of message identifiers.",
+		 function );
+
+		return( -1 );
+	}
+	result = resource_file_get_number_of_message_strings(
+	          resource_file,
+	          &number_of_message_strings,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of message strings.",
+		 function );
+
+		return( -1 );
+	}
+	else if( ( result == 0 )
+	      || ( number_of_message_strings <= 0 ) )
+	{
+		return( 0 );
+	}
+	if( number_of_message_strings > ( ( INT_MAX / (int) sizeof( uint32_t ) ) - *number_of_message_identifiers ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of message strings value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	maximum_number_of_identifiers = *number_of_message_identifiers + number_of_message_strings;
+
+	if( maximum_number_of_identifiers > *maximum_number_of_message_identifiers )
+	{
+		reallocation = (uint32_t *) memory_reallocate(
+		                             *message_identifiers,
+		                             sizeof( uint32_t ) * maximum_number_of_identifiers );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize message identifiers.",
+			 function );
+
+			return( -1 );
+		}
+		*message_identifiers                   = reallocation;
+		*maximum_number_of_message_identifiers = maximum_number_of_identifiers;
+	}
+	for( message_string_index = 0;
+	     message_string_index < number_of_message_strings;
+	     message_string_index++ )
+	{
+		if( resource_file_get_message_string_identifier(
+		     resource_file,
+		     message_string_index,
+		     &( ( *message_identifiers )[ *number_of_message_identifiers ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve message string: %d identifier.",
+			 function,
+			 message_string_index );
+
+			return( -1 );
+		}
+		*number_of_message_identifiers += 1;
+	}
+	return( 1 );
+}
+
+/* Compiles the message strings of specific message filename(s)
+ * The message strings are resolved the same way evtxexport resolves them,
+ * the message identifiers are collected from the resource files before they are resolved
+ * since resolving a message string can close a resource file that is not cached
+ * Returns 1 if successful or -1 on error
+ */
+int compile_handle_compile_message_file(
+     compile_handle_t *compile_handle,
+     const system_character_t *message_filename,
+     size_t message_filename_length,
+     libcerror_error_t **error )
+{
+	message_string_t *message_string                      = NULL;
+	resource_file_t *resource_file                        = NULL;
+	system_character_t *resource_filename_string_segment  = NULL;
+	system_split_string_t *resource_filename_split_string = NULL;
+	uint32_t *message_identifiers                         = NULL;
+	static char *function                                 = "compile_handle_compile_message_file";
+	size_t resource_filename_string_segment_size          = 0;
+	uint32_t entry_index                                  = 0;
+	uint32_t mui_file_type                                = 0;
+	int maximum_number_of_message_identifiers             = 0;
+	int message_identifier_index                          = 0;
+	int number_of_message_identifiers                     = 0;
+	int resource_filename_number_of_segments              = 0;
+	int resource_filename_segment_index                   = 0;
+	int result                                            = 0;
+
+	if( compile_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compile handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = message_catalog_get_entry_by_key(
+	          compile_handle->message_catalog,
+	          MESSAGE_CATALOG_ENTRY_TYPE_MESSAGE_FILE,
+	          message_filename,
+	          message_filename_length,
+	          0,
+	          &entry_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve message file entry.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		return( 1 );
+	}
+	if( compile_handle->verbose != 0 )
+	{
+		fprintf(
+		 compile_handle->notify_stream,
+		 "Compiling message file(s): %" PRIs_SYSTEM "\n",
+		 message_filename );
+	}
+	/* The message filename can contain multiple file names separated by ;
+	 */
+	if( system_string_split(
+	     message_filename,
+	     message_filename_length + 1,
+	     (system_character_t) ';',
+	     &resource_filename_split_string,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to split message filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_split_string_get_number_of_segments(
+	     resource_filename_split_string,
+	     &resource_filename_number_of_segments,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of message filename string segments.",
+		 function );
+
+		goto on_error;
+	}
+	for( resource_filename_segment_index = 0;
+	     resource_filename_segment_index < resource_filename_number_of_segments;
+	     resource_filename_segment_index++ )
+	{
+		if( system_split_string_get_segment_by_index(
+		     resource_filename_split_string,
+		     resource_filename_segment_index,
+		     &resource_filename_string_segment,
+		     &resource_filename_string_segment_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve message filename string segment: %d.",
+			 function,
+			 resource_filename_segment_index );
+
+			goto on_error;
+		}
+		if( ( resource_filename_string_segment == NULL )
+		 || ( resource_filename_string_segment_size <= 1 ) )
+		{
+			continue;
+		}
+		result = compile_handle_get_resource_file(
+		          compile_handle,
+		          resource_filename_string_segment,
+		          resource_filename_string_segment_size - 1,
+		          0,
+		          &resource_file,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve resource file: %" PRIs_SYSTEM ".",
+			 function,
+			 resource_filename_string_segment );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			continue;
+		}
+		if( compile_handle_append_message_identifiers(
+		     compile_handle,
+		     resource_file,
+		     &message_identifiers,
+		     &number_of_message_identifiers,
+		     &maximum_number_of_message_identifiers,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append message identifiers of resource file: %" PRIs_SYSTEM ".",
+			 function,
+			 resource_filename_string_segment );
+
+			goto on_error;
+		}
+		result = resource_file_get_mui_file_type(
+		          resource_file,
+		          &mui_file_type,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve MUI file type.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			continue;
+		}
+		resource_file = NULL;
+
+		result = compile_handle_get_resource_file(
+		          compile_handle,
+		          resource_filename_string_segment,
+		          resource_filename_string_segment_size - 1,
+		          1,
+		          &resource_file,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve MUI resource file: %" PRIs_SYSTEM ".",
+			 function,
+			 resource_filename_string_segment );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			continue;
+		}
+		if( compile_handle_append_message_identifiers(
+		     compile_handle,
+		     resource_file,
+		     &message_identifiers,
+		     &number_of_message_identifiers,
+		     &maximum_number_of_message_identifiers,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append message identifiers of MUI resource file: %" PRIs_SYSTEM ".",
+			 function,
+			 resource_filename_string_segment );
+
+			goto on_error;
+		}
+	}
+	resource_file = NULL;
+
+	if( system_split_string_free(
+	     &resource_filename_split_string,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free message filename split string.",
+		 function );
+
+		goto on_error;
+	}
+	for( message_identifier_index = 0;
+	     message_identifier_index < number_of_message_identifiers;
+	     message_identifier_index++ )
+	{
+		if( compile_handle->abort != 0 )
+		{
+			break;
+		}
+		/* The message string is owned by the message string cache of the resource file
+		 */
+		message_string = NULL;
+
+		result = message_handle_get_message_string(
+		          compile_handle->message_handle,
+		          message_filename,
+		          message_filename_length,
+		          message_identifiers[ message_identifier_index ],
+		          &message_string,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve message string: 0x%08" PRIx32 ".",
+			 function,
+			 message_identifiers[ message_identifier_index ] );
+
+			goto on_error;
+		}
+		else if( ( result == 0 )
+		      || ( message_string == NULL )
+		      || ( message_string->string == NULL ) )
+		{
+			continue;
+		}
+		result = message_catalog_append_entry(
+		          compile_handle->message_catalog,
+		          MESSAGE_CATALOG_ENTRY_TYPE_MESSAGE,
+		          message_filename,
+		          message_filename_length,
+		          message_identifiers[ message_identifier_index ],
+		          0,
+		          (uint8_t *) message_string->string,
+		          sizeof( system_character_t ) * message_string->string_size,
+		          NULL,
+		          0,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append message string: 0x%08" PRIx32 " to catalog.",
+			 function,
+			 message_identifiers[ message_identifier_index ] );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			compile_handle->number_of_message_strings += 1;
+		}
+	}
+	if( message_identifiers != NULL )
+	{
+		memory_free(
+		 message_identifiers );
+
+		message_identifiers = NULL;
+	}
+	if( message_catalog_append_entry(
+	     compile_handle->message_catalog,
+	     MESSAGE_CATALOG_ENTRY_TYPE_MESSAGE_FILE,
+	     message_filename,
+	     message_filename_length,
+	     0,
+	     0,
+	     NULL,
+	     0,
+	     NULL,
+	     0,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append message file entry to catalog.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( message_identifiers != NULL )
+	{
+		memory_free(
+		 message_identifiers );
+	}
+	if( resource_filename_split_string != NULL )
+	{
+		system_split_string_free(
+		 &resource_filename_split_string,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Compiles the events of a specific event provider
+ * Returns 1 if successful, 0 if the event provider has no events or -1 on error
+ */
+int compile_handle_compile_events(
+     compile_handle_t *compile_handle,
+     const system_character_t *provider_identifier,
+     size_t provider_identifier_length,
+     libcerror_error_t **error )
+{
+	uint8_t template_data_offset_data[ 4 ];
+	uint8_t provider_identifier_data[ 16 ];
+
+	event_provider_t *event_provider                            = NULL;
+	libwrc_wevt_event_t *wevt_event                             = NULL;
+	libwrc_wevt_provider_t *wevt_provider                       = NULL;
+	libwrc_wevt_template_definition_t *wevt_template_definition = NULL;
+	resource_file_t *resource_file                              = NULL;
+	uint8_t *template_data                                      = NULL;
+	static char *function                                       = "compile_handle_compile_events";
+	size_t template_data_size                                   = 0;
+	uint32_t event_identifier                                   = 0;
+	uint32_t message_identifier                                 = 0;
+	uint32_t template_data_offset                               = 0;
+	int event_index                                             = 0;
+	int number_of_events                                        = 0;
+	int result                                                  = 0;
+
+	if( compile_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compile handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( compile_handle_guid_string_copy_to_byte_stream(
+	     compile_handle,
+	     provider_identifier,
+	     provider_identifier_length,
+	     provider_identifier_data,
+	     16,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to copy GUID from string.",
+		 function );
+
+		goto on_error;
+	}
+	/* The event provider is owned by the message handle
+	 */
+	if( message_handle_get_event_provider(
+	     compile_handle->message_handle,
+	     provider_identifier,
+	     provider_identifier_length,
+	     NULL,
+	     0,
+	     &event_provider,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event provider.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( event_provider == NULL )
+	 || ( event_provider->resource_filename == NULL ) )
+	{
+		return( 0 );
+	}
+	result = message_handle_get_resource_file_by_event_provider(
+		  compile_handle->message_handle,
+		  event_provider,
+		  provider_identifier_data,
+		  16,
+		  &resource_file,
+		  error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve resource file.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	result = resource_file_get_provider(
+		  resource_file,
+		  provider_identifier_data,
+		  16,
+		  &wevt_provider,
+		  error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve WEVT provider.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libwrc_wevt_provider_get_number_of_events(
+	     wevt_provider,
+	     &number_of_events,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of events.",
+		 function );
+
+		goto on_error;
+	}
+	for( event_index = 0;
+	     event_index < number_of_events;
+	     event_index++ )
+	{
+		if( compile_handle->abort != 0 )
+		{
+			break;
+		}
+		if( libwrc_wevt_provider_get_event(
+		     wevt_provider,
+		     event_index,
+		     &wevt_event,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve event: %d.",
+			 function,
+			 event_index );
+
+			goto on_error;
+		}
+		if( libwrc_wevt_event_get_identifier(
+		     wevt_event,
+		     &event_identifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve event: %d identifier.",
+			 function,
+			 event_index );
+
+			goto on_error;
+		}
+		if( libwrc_wevt_event_get_message_identifier(
+		     wevt_event,
+		     &message_identifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve event: %d message identifier.",
+			 function,
+			 event_index );
+
+			goto on_error;
+		}
+		result = libwrc_wevt_event_get_template_definition(
+			  wevt_event,
+			  &wevt_template_definition,
+			  error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve event: %d template definition.",
+			 function,
+			 event_index );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			if( libwrc_wevt_template_definition_get_offset(
+			     wevt_template_definition,
+			     &template_data_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve template offset.",
+				 function );
+
+				goto on_error;
+			}
+			if( libwrc_wevt_template_definition_get_size(
+			     wevt_template_definition,
+			     &template_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve template size.",
+				 function );
+
+				goto on_error;
+			}
+			if( ( template_data_size == 0 )
+			 || ( template_data_size > (size_t) SSIZE_MAX ) )
+			{
+				template_data_size = 0;
+			}
+			else
+			{
+				template_data = (uint8_t *) memory_allocate(
+				                             sizeof( uint8_t ) * template_data_size );
+
+				if( template_data == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to create template data.",
+					 function );
+
+					goto on_error;
+				}
+				if( libwrc_wevt_template_definition_get_data(
+				     wevt_template_definition,
+				     template_data,
+				     template_data_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve template data.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			if( libwrc_wevt_template_definition_free(
+			     &wevt_template_definition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free WEVT template definition.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		byte_stream_copy_from_uint32_little_endian(
+		 template_data_offset_data,
+		 template_data_offset );
+
+		result = message_catalog_append_entry(
+		          compile_handle->message_catalog,
+		          MESSAGE_CATALOG_ENTRY_TYPE_EVENT,
+		          provider_identifier,
+		          provider_identifier_length,
+		          event_identifier,
+		          message_identifier,
+		          template_data,
+		          template_data_size,
+		          ( template_data != NULL ) ? template_data_offset_data : NULL,
+		          ( template_data != NULL ) ? 4 : 0,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append event: %" PRIu32 " to catalog.",
+			 function,
+			 event_identifier );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			compile_handle->number_of_events += 1;
+		}
+		if( template_data != NULL )
+		{
+			memory_free(
+			 template_data );
+
+			template_data = NULL;
+		}
+		template_data_size   = 0;
+		template_data_offset = 0;
+
+		if( libwrc_wevt_event_free(
+		     &wevt_event,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free WEVT event.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libwrc_wevt_provider_free(
+	     &wevt_provider,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free WEVT provider.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( template_data != NULL )
+	{
+		memory_free(
+		 template_data );
+	}
+	if( wevt_template_definition != NULL )
+	{
+		libwrc_wevt_template_definition_free(
+		 &wevt_template_definition,
+		 NULL );
+	}
+	if( wevt_event != NULL )
+	{
+		libwrc_wevt_event_free(
+		 &wevt_event,
+		 NULL );
+	}
+	if( wevt_provider != NULL )
+	{
+		libwrc_wevt_provider_free(
+		 &wevt_provider,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Compiles the publishers and event sources into the message catalog
+ * Returns 1 if successful or -1 on error
+ */
+int compile_handle_compile(
+     compile_handle_t *compile_handle,
+     libcerror_error_t **error )
+{
+	const system_character_t *value1_string = NULL;
+	const system_character_t *value2_string = NULL;
+	registry_key_table_entry_t *entry       = NULL;
+	registry_key_table_t *key_table         = NULL;
+	static char *function                   = "compile_handle_compile";
+	size_t value1_string_size               = 0;
+	size_t value2_string_size               = 0;
+	uint32_t bucket_index                   = 0;
+	int result                              = 0;
+
+	if( compile_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compile handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( compile_handle->message_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid compile handle - missing message handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* The publishers are stored in: WINEVT\Publishers\%GUID%
+	 */
+	key_table = compile_handle->message_handle->winevt_publishers_table;
+
+	if( key_table != NULL )
+	{
+		for( bucket_index = 0;
+		     bucket_index < key_table->number_of_buckets;
+		     bucket_index++ )
+		{
+			for( entry = key_table->buckets[ bucket_index ];
+			     entry != NULL;
+			     entry = entry->next_bucket_entry )
+			{
+				if( compile_handle->abort != 0 )
+				{
+					return( 1 );
+				}
+				if( ( entry->name == NULL )
+				 || ( entry->name_size <= 1 ) )
+				{
+					continue;
+				}
+				if( registry_key_table_get_value_string(
+				     key_table,
+				     entry->name,
+				     entry->name_size - 1,
+				     _SYSTEM_STRING( "ResourceFileName" ),
+				     16,
+				     &value1_string,
+				     &value1_string_size,
+				     error ) == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve publisher: %" PRIs_SYSTEM " resource filename.",
+					 function,
+					 entry->name );
+
+					return( -1 );
+				}
+				if( registry_key_table_get_value_string(
+				     key_table,
+				     entry->name,
+				     entry->name_size - 1,
+				     _SYSTEM_STRING( "MessageFileName" ),
+				     15,
+				     &value2_string,
+				     &value2_string_size,
+				     error ) == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve publisher: %" PRIs_SYSTEM " message filename.",
+					 function,
+					 entry->name );
+
+					return( -1 );
+				}
+				result = message_catalog_append_entry(
+				          compile_handle->message_catalog,
+				          MESSAGE_CATALOG_ENTRY_TYPE_PUBLISHER,
+				          entry->name,
+				          entry->name_size - 1,
+				          0,
+				          0,
+				          (uint8_t *) value1_string,
+				          sizeof( system_character_t ) * value1_string_size,
+				          (uint8_t *) value2_string,
+				          sizeof( system_character_t ) * value2_string_size,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append publisher: %" PRIs_SYSTEM " to catalog.",
+					 function,
+					 entry->name );
+
+					return( -1 );
+				}
+				else if( result == 0 )
+				{
+					continue;
+				}
+				compile_handle->number_of_publishers += 1;
+
+				if( value1_string != NULL )
+				{
+					if( compile_handle_compile_events(
+					     compile_handle,
+					     entry->name,
+					     entry->name_size - 1,
+					     error ) == -1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GENERIC,
+						 "%s: unable to compile events of publisher: %" PRIs_SYSTEM ".",
+						 function,
+						 entry->name );
+
+						return( -1 );
+					}
+				}
+				if( ( value2_string != NULL )
+				 && ( value2_string_size > 1 ) )
+				{
+					if( compile_handle_compile_message_file(
+					     compile_handle,
+					     value2_string,
+					     value2_string_size - 1,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GENERIC,
+						 "%s: unable to compile message file: %" PRIs_SYSTEM ".",
+						 function,
+						 value2_string );
+
+						return( -1 );
+					}
+				}
+			}
+		}
+	}
+	/* The event sources are stored in: Services\Eventlog\%EVENT_LOG_TYPE%\%EVENT_SOURCE%
+	 */
+	key_table = compile_handle->message_handle->eventlog_services_table;
+
+	if( key_table != NULL )
+	{
+		for( bucket_index = 0;
+		     bucket_index < key_table->number_of_buckets;
+		     bucket_index++ )
+		{
+			for( entry = key_table->buckets[ bucket_index ];
+			     entry != NULL;
+			     entry = entry->next_bucket_entry )
+			{
+				if( compile_handle->abort != 0 )
+				{
+					return( 1 );
+				}
+				if( ( entry->name == NULL )
+				 || ( entry->name_size <= 1 ) )
+				{
+					continue;
+				}
+				if( registry_key_table_get_value_string(
+				     key_table,
+				     entry->name,
+				     entry->name_size - 1,
+				     _SYSTEM_STRING( "EventMessageFile" ),
+				     16,
+				     &value1_string,
+				     &value1_string_size,
+				     error ) == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve event source: %" PRIs_SYSTEM " event message filename.",
+					 function,
+					 entry->name );
+
+					return( -1 );
+				}
+				result = message_catalog_append_entry(
+				          compile_handle->message_catalog,
+				          MESSAGE_CATALOG_ENTRY_TYPE_EVENT_SOURCE,
+				          entry->name,
+				          entry->name_size - 1,
+				          0,
+				          0,
+				          (uint8_t *) value1_string,
+				          sizeof( system_character_t ) * value1_string_size,
+				          NULL,
+				          0,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append event source: %" PRIs_SYSTEM " to catalog.",
+					 function,
+					 entry->name );
+
+					return( -1 );
+				}
+				else if( result == 0 )
+				{
+					continue;
+				}
+				compile_handle->number_of_event_sources += 1;
+
+				if( ( value1_string != NULL )
+				 && ( value1_string_size > 1 ) )
+				{
+					if( compile_handle_compile_message_file(
+					     compile_handle,
+					     value1_string,
+					     value1_string_size - 1,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GENERIC,
+						 "%s: unable to compile message file: %" PRIs_SYSTEM ".",
+						 function,
+						 value1_string );
+
+						return( -1 );
+					}
+				}
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Writes the message catalog to a file
+ * Returns 1 if successful or -1 on error
+ */
+int compile_handle_write_message_catalog(
+     compile_handle_t *compile_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "compile_handle_write_message_catalog";
+
+	if( compile_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compile handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_catalog_write(
+	     compile_handle->message_catalog,
+	     filename,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write message catalog.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Prints the compile statistics
+ * Returns 1 if successful or -1 on error
+ */
+int compile_handle_compile_statistics_fprint(
+     compile_handle_t *compile_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "compile_handle_compile_statistics_fprint";
+
+	if( compile_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compile handle.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 compile_handle->notify_stream,
+	 "Compiled:\n" );
+
+	fprintf(
+	 compile_handle->notify_stream,
+	 "\tnumber of publishers\t\t: %d\n",
+	 compile_handle->number_of_publishers );
+
+	fprintf(
+	 compile_handle->notify_stream,
+	 "\tnumber of event sources\t\t: %d\n",
+	 compile_handle->number_of_event_sources );
+
+	fprintf(
+	 compile_handle->notify_stream,
+	 "\tnumber of events\t\t: %d\n",
+	 compile_handle->number_of_events );
+
+	fprintf(
+	 compile_handle->notify_stream,
+	 "\tnumber of message strings\t: %d\n",
+	 compile_handle->number_of_message_strings );
+
+	fprintf(
+	 compile_handle->notify_stream,
+	 "\n" );
+
+	return( 1 );
+}
+
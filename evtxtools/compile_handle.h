@@ -0,0 +1,182 @@
+/*
+ * Compile handle
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _COMPILE_HANDLE_H )
+#define _COMPILE_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+#include "message_catalog.h"
+#include "message_handle.h"
+#include "resource_file.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct compile_handle compile_handle_t;
+
+struct compile_handle
+{
+	/* The message handle
+	 */
+	message_handle_t *message_handle;
+
+	/* The message catalog
+	 */
+	message_catalog_t *message_catalog;
+
+	/* The event log type
+	 */
+	int event_log_type;
+
+	/* The number of compiled publishers
+	 */
+	int number_of_publishers;
+
+	/* The number of compiled event sources
+	 */
+	int number_of_event_sources;
+
+	/* The number of compiled events
+	 */
+	int number_of_events;
+
+	/* The number of compiled message strings
+	 */
+	int number_of_message_strings;
+
+	/* The notification output stream
+	 */
+	FILE *notify_stream;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+
+	/* Value to indicate if the output should be verbose
+	 */
+	int verbose;
+};
+
+int compile_handle_initialize(
+     compile_handle_t **compile_handle,
+     libcerror_error_t **error );
+
+int compile_handle_free(
+     compile_handle_t **compile_handle,
+     libcerror_error_t **error );
+
+int compile_handle_signal_abort(
+     compile_handle_t *compile_handle,
+     libcerror_error_t **error );
+
+int compile_handle_set_event_log_type(
+     compile_handle_t *compile_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int compile_handle_set_software_registry_filename(
+     compile_handle_t *compile_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int compile_handle_set_system_registry_filename(
+     compile_handle_t *compile_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int compile_handle_set_registry_directory_name(
+     compile_handle_t *compile_handle,
+     const system_character_t *name,
+     libcerror_error_t **error );
+
+int compile_handle_set_resource_files_path(
+     compile_handle_t *compile_handle,
+     const system_character_t *path,
+     libcerror_error_t **error );
+
+int compile_handle_open_input(
+     compile_handle_t *compile_handle,
+     libcerror_error_t **error );
+
+int compile_handle_close_input(
+     compile_handle_t *compile_handle,
+     libcerror_error_t **error );
+
+int compile_handle_guid_string_copy_to_byte_stream(
+     compile_handle_t *compile_handle,
+     const system_character_t *string,
+     size_t string_length,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error );
+
+int compile_handle_get_resource_file(
+     compile_handle_t *compile_handle,
+     const system_character_t *resource_filename,
+     size_t resource_filename_length,
+     uint8_t is_mui_resource_file,
+     resource_file_t **resource_file,
+     libcerror_error_t **error );
+
+int compile_handle_append_message_identifiers(
+     compile_handle_t *compile_handle,
+     resource_file_t *resource_file,
+     uint32_t **message_identifiers,
+     int *number_of_message_identifiers,
+     int *maximum_number_of_message_identifiers,
+     libcerror_error_t **error );
+
+int compile_handle_compile_message_file(
+     compile_handle_t *compile_handle,
+     const system_character_t *message_filename,
+     size_t message_filename_length,
+     libcerror_error_t **error );
+
+int compile_handle_compile_events(
+     compile_handle_t *compile_handle,
+     const system_character_t *provider_identifier,
+     size_t provider_identifier_length,
+     libcerror_error_t **error );
+
+int compile_handle_compile(
+     compile_handle_t *compile_handle,
+     libcerror_error_t **error );
+
+int compile_handle_write_message_catalog(
+     compile_handle_t *compile_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int compile_handle_compile_statistics_fprint(
+     compile_handle_t *compile_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _COMPILE_HANDLE_H ) */
+
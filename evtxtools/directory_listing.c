@@ -0,0 +1,788 @@
+/*
+ * Directory listing
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#include "directory_listing.h"
+#include "evtxtools_libcdirectory.h"
+#include "evtxtools_libcerror.h"
+
+/* Calculates the hash of a string
+ * If fold_case is set ASCII upper case characters are hashed as their lower case equivalent
+ * Returns the FNV-1a hash of the string
+ */
+uint32_t directory_listing_calculate_hash(
+          const system_character_t *string,
+          size_t string_length,
+          uint8_t fold_case )
+{
+	size_t string_index          = 0;
+	uint32_t hash                = 0x811c9dc5UL;
+	system_character_t character = 0;
+
+	if( string == NULL )
+	{
+		return( hash );
+	}
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		character = string[ string_index ];
+
+		if( ( fold_case != 0 )
+		 && ( character >= (system_character_t) 'A' )
+		 && ( character <= (system_character_t) 'Z' ) )
+		{
+			character = character - (system_character_t) 'A' + (system_character_t) 'a';
+		}
+		hash ^= (uint32_t) character;
+		hash *= 0x01000193UL;
+	}
+	return( hash );
+}
+
+/* Creates a directory listing
+ * Make sure the value directory_listing is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int directory_listing_initialize(
+     directory_listing_t **directory_listing,
+     const system_character_t *path,
+     size_t path_length,
+     libcerror_error_t **error )
+{
+	static char *function = "directory_listing_initialize";
+
+	if( directory_listing == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory listing.",
+		 function );
+
+		return( -1 );
+	}
+	if( *directory_listing != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid directory listing value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length > (size_t) ( SSIZE_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*directory_listing = memory_allocate_structure(
+	                      directory_listing_t );
+
+	if( *directory_listing == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create directory listing.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *directory_listing,
+	     0,
+	     sizeof( directory_listing_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear directory listing.",
+		 function );
+
+		memory_free(
+		 *directory_listing );
+
+		*directory_listing = NULL;
+
+		return( -1 );
+	}
+	( *directory_listing )->path_size = path_length + 1;
+
+	( *directory_listing )->path = system_string_allocate(
+	                                ( *directory_listing )->path_size );
+
+	if( ( *directory_listing )->path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     ( *directory_listing )->path,
+	     path,
+	     path_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy path.",
+		 function );
+
+		goto on_error;
+	}
+	( ( *directory_listing )->path )[ path_length ] = 0;
+
+	( *directory_listing )->path_hash = directory_listing_calculate_hash(
+	                                     path,
+	                                     path_length,
+	                                     0 );
+
+	( *directory_listing )->number_of_buckets = DIRECTORY_LISTING_INITIAL_NUMBER_OF_BUCKETS;
+
+	( *directory_listing )->buckets = (directory_listing_entry_t **) memory_allocate(
+	                                   sizeof( directory_listing_entry_t * ) * DIRECTORY_LISTING_INITIAL_NUMBER_OF_BUCKETS );
+
+	if( ( *directory_listing )->buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buckets.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *directory_listing )->buckets,
+	     0,
+	     sizeof( directory_listing_entry_t * ) * DIRECTORY_LISTING_INITIAL_NUMBER_OF_BUCKETS ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buckets.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *directory_listing != NULL )
+	{
+		directory_listing_free(
+		 directory_listing,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a directory listing
+ * Returns 1 if successful or -1 on error
+ */
+int directory_listing_free(
+     directory_listing_t **directory_listing,
+     libcerror_error_t **error )
+{
+	directory_listing_entry_t *entry = NULL;
+	static char *function            = "directory_listing_free";
+	uint32_t bucket_index            = 0;
+
+	if( directory_listing == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory listing.",
+		 function );
+
+		return( -1 );
+	}
+	if( *directory_listing != NULL )
+	{
+		if( ( *directory_listing )->buckets != NULL )
+		{
+			for( bucket_index = 0;
+			     bucket_index < ( *directory_listing )->number_of_buckets;
+			     bucket_index++ )
+			{
+				while( ( *directory_listing )->buckets[ bucket_index ] != NULL )
+				{
+					entry = ( *directory_listing )->buckets[ bucket_index ];
+
+					( *directory_listing )->buckets[ bucket_index ] = entry->next_bucket_entry;
+
+					if( entry->name != NULL )
+					{
+						memory_free(
+						 entry->name );
+					}
+					memory_free(
+					 entry );
+				}
+			}
+			memory_free(
+			 ( *directory_listing )->buckets );
+		}
+		if( ( *directory_listing )->path != NULL )
+		{
+			memory_free(
+			 ( *directory_listing )->path );
+		}
+		memory_free(
+		 *directory_listing );
+
+		*directory_listing = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends an entry to a directory listing
+ * Returns 1 if successful or -1 on error
+ */
+int directory_listing_append_entry(
+     directory_listing_t *directory_listing,
+     const system_character_t *name,
+     size_t name_length,
+     uint8_t type,
+     libcerror_error_t **error )
+{
+	directory_listing_entry_t **buckets   = NULL;
+	directory_listing_entry_t *entry      = NULL;
+	directory_listing_entry_t *next_entry = NULL;
+	static char *function                 = "directory_listing_append_entry";
+	uint32_t bucket_index                 = 0;
+	uint32_t number_of_buckets            = 0;
+	uint32_t old_bucket_index             = 0;
+
+	if( directory_listing == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory listing.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_length > (size_t) ( SSIZE_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid name length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* Keep the average number of entries per bucket below 2
+	 */
+	if( (uint32_t) directory_listing->number_of_entries >= ( 2 * directory_listing->number_of_buckets ) )
+	{
+		number_of_buckets = 2 * directory_listing->number_of_buckets;
+
+		buckets = (directory_listing_entry_t **) memory_allocate(
+		                                          sizeof( directory_listing_entry_t * ) * number_of_buckets );
+
+		if( buckets == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create buckets.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_set(
+		     buckets,
+		     0,
+		     sizeof( directory_listing_entry_t * ) * number_of_buckets ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear buckets.",
+			 function );
+
+			memory_free(
+			 buckets );
+
+			return( -1 );
+		}
+		for( old_bucket_index = 0;
+		     old_bucket_index < directory_listing->number_of_buckets;
+		     old_bucket_index++ )
+		{
+			entry = directory_listing->buckets[ old_bucket_index ];
+
+			while( entry != NULL )
+			{
+				next_entry   = entry->next_bucket_entry;
+				bucket_index = entry->name_hash & ( number_of_buckets - 1 );
+
+				entry->next_bucket_entry = buckets[ bucket_index ];
+				buckets[ bucket_index ]  = entry;
+
+				entry = next_entry;
+			}
+		}
+		memory_free(
+		 directory_listing->buckets );
+
+		directory_listing->buckets           = buckets;
+		directory_listing->number_of_buckets = number_of_buckets;
+	}
+	entry = memory_allocate_structure(
+	         directory_listing_entry_t );
+
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     entry,
+	     0,
+	     sizeof( directory_listing_entry_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear entry.",
+		 function );
+
+		goto on_error;
+	}
+	entry->name_size = name_length + 1;
+
+	entry->name = system_string_allocate(
+	               entry->name_size );
+
+	if( entry->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     entry->name,
+	     name,
+	     name_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy name.",
+		 function );
+
+		goto on_error;
+	}
+	entry->name[ name_length ] = 0;
+
+	entry->name_hash = directory_listing_calculate_hash(
+	                    name,
+	                    name_length,
+	                    1 );
+
+	entry->type = type;
+
+	bucket_index = entry->name_hash & ( directory_listing->number_of_buckets - 1 );
+
+	entry->next_bucket_entry                   = directory_listing->buckets[ bucket_index ];
+	directory_listing->buckets[ bucket_index ] = entry;
+
+	directory_listing->number_of_entries += 1;
+
+	return( 1 );
+
+on_error:
+	if( entry != NULL )
+	{
+		if( entry->name != NULL )
+		{
+			memory_free(
+			 entry->name );
+		}
+		memory_free(
+		 entry );
+	}
+	return( -1 );
+}
+
+/* Reads the entries of the directory into the directory listing
+ * Returns 1 if successful or -1 on error
+ */
+int directory_listing_read(
+     directory_listing_t *directory_listing,
+     libcerror_error_t **error )
+{
+	libcdirectory_directory_t *directory             = NULL;
+	libcdirectory_directory_entry_t *directory_entry = NULL;
+	system_character_t *directory_entry_name         = NULL;
+	static char *function                            = "directory_listing_read";
+	size_t directory_entry_name_length               = 0;
+	uint8_t directory_entry_type                     = 0;
+	int result                                       = 0;
+
+	if( directory_listing == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory listing.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdirectory_directory_initialize(
+	     &directory,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create directory.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcdirectory_directory_open_wide(
+		  directory,
+		  directory_listing->path,
+		  error );
+#else
+	result = libcdirectory_directory_open(
+		  directory,
+		  directory_listing->path,
+		  error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open directory: %" PRIs_SYSTEM ".",
+		 function,
+		 directory_listing->path );
+
+		goto on_error;
+	}
+	if( libcdirectory_directory_entry_initialize(
+	     &directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create directory entry.",
+		 function );
+
+		goto on_error;
+	}
+	do
+	{
+		result = libcdirectory_directory_read_entry(
+		          directory,
+		          directory_entry,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read directory entry.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( libcdirectory_directory_entry_get_type(
+		     directory_entry,
+		     &directory_entry_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory entry type.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libcdirectory_directory_entry_get_name_wide(
+			  directory_entry,
+			  (wchar_t **) &directory_entry_name,
+			  error );
+#else
+		result = libcdirectory_directory_entry_get_name(
+			  directory_entry,
+			  (char **) &directory_entry_name,
+			  error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory entry name.",
+			 function );
+
+			goto on_error;
+		}
+		directory_entry_name_length = system_string_length(
+		                               directory_entry_name );
+
+		if( directory_listing_append_entry(
+		     directory_listing,
+		     directory_entry_name,
+		     directory_entry_name_length,
+		     directory_entry_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append directory entry: %" PRIs_SYSTEM ".",
+			 function,
+			 directory_entry_name );
+
+			goto on_error;
+		}
+	}
+	while( result != 0 );
+
+	if( libcdirectory_directory_entry_free(
+	     &directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free directory entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdirectory_directory_close(
+	     directory,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdirectory_directory_free(
+	     &directory,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free directory.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( directory_entry != NULL )
+	{
+		libcdirectory_directory_entry_free(
+		 &directory_entry,
+		 NULL );
+	}
+	if( directory != NULL )
+	{
+		libcdirectory_directory_free(
+		 &directory,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves a specific entry by name ignoring case
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int directory_listing_get_entry_by_name_no_case(
+     directory_listing_t *directory_listing,
+     const system_character_t *name,
+     size_t name_length,
+     uint8_t type,
+     directory_listing_entry_t **entry,
+     libcerror_error_t **error )
+{
+	directory_listing_entry_t *bucket_entry = NULL;
+	static char *function                   = "directory_listing_get_entry_by_name_no_case";
+	uint32_t name_hash                      = 0;
+
+	if( directory_listing == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory listing.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	*entry = NULL;
+
+	name_hash = directory_listing_calculate_hash(
+	             name,
+	             name_length,
+	             1 );
+
+	bucket_entry = directory_listing->buckets[ name_hash & ( directory_listing->number_of_buckets - 1 ) ];
+
+	while( bucket_entry != NULL )
+	{
+		if( ( bucket_entry->name_hash == name_hash )
+		 && ( bucket_entry->type == type )
+		 && ( bucket_entry->name_size == ( name_length + 1 ) ) )
+		{
+			if( system_string_compare_no_case(
+			     bucket_entry->name,
+			     name,
+			     name_length ) == 0 )
+			{
+				*entry = bucket_entry;
+
+				return( 1 );
+			}
+		}
+		bucket_entry = bucket_entry->next_bucket_entry;
+	}
+	return( 0 );
+}
+
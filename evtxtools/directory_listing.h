@@ -0,0 +1,136 @@
+/*
+ * Directory listing
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _DIRECTORY_LISTING_H )
+#define _DIRECTORY_LISTING_H
+
+#include <common.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The initial number of buckets of a directory listing
+ * This value must be a power of 2
+ */
+#define DIRECTORY_LISTING_INITIAL_NUMBER_OF_BUCKETS	64
+
+typedef struct directory_listing_entry directory_listing_entry_t;
+
+struct directory_listing_entry
+{
+	/* The name
+	 */
+	system_character_t *name;
+
+	/* The name size
+	 */
+	size_t name_size;
+
+	/* The hash of the case folded name
+	 */
+	uint32_t name_hash;
+
+	/* The entry type
+	 */
+	uint8_t type;
+
+	/* The next entry in the same bucket
+	 */
+	directory_listing_entry_t *next_bucket_entry;
+};
+
+typedef struct directory_listing directory_listing_t;
+
+struct directory_listing
+{
+	/* The path of the directory
+	 */
+	system_character_t *path;
+
+	/* The path size
+	 */
+	size_t path_size;
+
+	/* The hash of the path
+	 */
+	uint32_t path_hash;
+
+	/* The buckets
+	 */
+	directory_listing_entry_t **buckets;
+
+	/* The number of buckets
+	 */
+	uint32_t number_of_buckets;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The next directory listing, used by the path handle to chain directory listings
+	 */
+	directory_listing_t *next_directory_listing;
+};
+
+uint32_t directory_listing_calculate_hash(
+          const system_character_t *string,
+          size_t string_length,
+          uint8_t fold_case );
+
+int directory_listing_initialize(
+     directory_listing_t **directory_listing,
+     const system_character_t *path,
+     size_t path_length,
+     libcerror_error_t **error );
+
+int directory_listing_free(
+     directory_listing_t **directory_listing,
+     libcerror_error_t **error );
+
+int directory_listing_append_entry(
+     directory_listing_t *directory_listing,
+     const system_character_t *name,
+     size_t name_length,
+     uint8_t type,
+     libcerror_error_t **error );
+
+int directory_listing_read(
+     directory_listing_t *directory_listing,
+     libcerror_error_t **error );
+
+int directory_listing_get_entry_by_name_no_case(
+     directory_listing_t *directory_listing,
+     const system_character_t *name,
+     size_t name_length,
+     uint8_t type,
+     directory_listing_entry_t **entry,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _DIRECTORY_LISTING_H ) */
+
@@ -0,0 +1,440 @@
+/*
+ * Event provider
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "event_provider.h"
+#include "evtxtools_libcdata.h"
+#include "evtxtools_libcerror.h"
+
+/* Creates an event provider
+ * Make sure the value event_provider is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int event_provider_initialize(
+     event_provider_t **event_provider,
+     const system_character_t *identifier,
+     size_t identifier_length,
+     const system_character_t *event_source,
+     size_t event_source_length,
+     libcerror_error_t **error )
+{
+	static char *function = "event_provider_initialize";
+
+	if( event_provider == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid event provider.",
+		 function );
+
+		return( -1 );
+	}
+	if( *event_provider != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid event provider value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( identifier_length > (size_t) ( SSIZE_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid identifier length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( event_source_length > (size_t) ( SSIZE_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid event source length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*event_provider = memory_allocate_structure(
+	                   event_provider_t );
+
+	if( *event_provider == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create event provider.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *event_provider,
+	     0,
+	     sizeof( event_provider_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear event provider.",
+		 function );
+
+		memory_free(
+		 *event_provider );
+
+		*event_provider = NULL;
+
+		return( -1 );
+	}
+	if( identifier != NULL )
+	{
+		( *event_provider )->identifier_size = identifier_length + 1;
+
+		( *event_provider )->identifier = system_string_allocate(
+		                                   ( *event_provider )->identifier_size );
+
+		if( ( *event_provider )->identifier == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create identifier.",
+			 function );
+
+			goto on_error;
+		}
+		if( system_string_copy(
+		     ( *event_provider )->identifier,
+		     identifier,
+		     identifier_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy identifier.",
+			 function );
+
+			goto on_error;
+		}
+		( ( *event_provider )->identifier )[ identifier_length ] = 0;
+	}
+	if( event_source != NULL )
+	{
+		( *event_provider )->event_source_size = event_source_length + 1;
+
+		( *event_provider )->event_source = system_string_allocate(
+		                                     ( *event_provider )->event_source_size );
+
+		if( ( *event_provider )->event_source == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create event source.",
+			 function );
+
+			goto on_error;
+		}
+		if( system_string_copy(
+		     ( *event_provider )->event_source,
+		     event_source,
+		     event_source_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy event source.",
+			 function );
+
+			goto on_error;
+		}
+		( ( *event_provider )->event_source )[ event_source_length ] = 0;
+	}
+	return( 1 );
+
+on_error:
+	if( *event_provider != NULL )
+	{
+		event_provider_free(
+		 event_provider,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees an event provider
+ * Returns 1 if successful or -1 on error
+ */
+int event_provider_free(
+     event_provider_t **event_provider,
+     libcerror_error_t **error )
+{
+	static char *function = "event_provider_free";
+
+	if( event_provider == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid event provider.",
+		 function );
+
+		return( -1 );
+	}
+	if( *event_provider != NULL )
+	{
+		if( ( *event_provider )->resource_file_name != NULL )
+		{
+			memory_free(
+			 ( *event_provider )->resource_file_name );
+		}
+		if( ( *event_provider )->message_filename != NULL )
+		{
+			memory_free(
+			 ( *event_provider )->message_filename );
+		}
+		if( ( *event_provider )->resource_filename != NULL )
+		{
+			memory_free(
+			 ( *event_provider )->resource_filename );
+		}
+		if( ( *event_provider )->event_source != NULL )
+		{
+			memory_free(
+			 ( *event_provider )->event_source );
+		}
+		if( ( *event_provider )->identifier != NULL )
+		{
+			memory_free(
+			 ( *event_provider )->identifier );
+		}
+		memory_free(
+		 *event_provider );
+
+		*event_provider = NULL;
+	}
+	return( 1 );
+}
+
+/* Compares two event providers
+ * The event providers are ordered by provider identifier and event source,
+ * where a shorter string is considered less than a longer string
+ * Returns LIBCDATA_COMPARE_LESS, LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
+ */
+int event_provider_compare(
+     event_provider_t *first_event_provider,
+     event_provider_t *second_event_provider,
+     libcerror_error_t **error )
+{
+	static char *function = "event_provider_compare";
+	int result            = 0;
+
+	if( first_event_provider == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first event provider.",
+		 function );
+
+		return( -1 );
+	}
+	if( second_event_provider == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second event provider.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_event_provider->identifier_size < second_event_provider->identifier_size )
+	{
+		return( LIBCDATA_COMPARE_LESS );
+	}
+	else if( first_event_provider->identifier_size > second_event_provider->identifier_size )
+	{
+		return( LIBCDATA_COMPARE_GREATER );
+	}
+	if( first_event_provider->identifier_size > 1 )
+	{
+		result = system_string_compare(
+		          first_event_provider->identifier,
+		          second_event_provider->identifier,
+		          first_event_provider->identifier_size - 1 );
+
+		if( result < 0 )
+		{
+			return( LIBCDATA_COMPARE_LESS );
+		}
+		else if( result > 0 )
+		{
+			return( LIBCDATA_COMPARE_GREATER );
+		}
+	}
+	if( first_event_provider->event_source_size < second_event_provider->event_source_size )
+	{
+		return( LIBCDATA_COMPARE_LESS );
+	}
+	else if( first_event_provider->event_source_size > second_event_provider->event_source_size )
+	{
+		return( LIBCDATA_COMPARE_GREATER );
+	}
+	if( first_event_provider->event_source_size > 1 )
+	{
+		result = system_string_compare(
+		          first_event_provider->event_source,
+		          second_event_provider->event_source,
+		          first_event_provider->event_source_size - 1 );
+
+		if( result < 0 )
+		{
+			return( LIBCDATA_COMPARE_LESS );
+		}
+		else if( result > 0 )
+		{
+			return( LIBCDATA_COMPARE_GREATER );
+		}
+	}
+	return( LIBCDATA_COMPARE_EQUAL );
+}
+
+/* Sets the name of the resource file that contains the provider
+ * Returns 1 if successful or -1 on error
+ */
+int event_provider_set_resource_file_name(
+     event_provider_t *event_provider,
+     const system_character_t *name,
+     size_t name_length,
+     libcerror_error_t **error )
+{
+	static char *function = "event_provider_set_resource_file_name";
+
+	if( event_provider == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid event provider.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_length > (size_t) ( SSIZE_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid name length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( event_provider->resource_file_name != NULL )
+	{
+		memory_free(
+		 event_provider->resource_file_name );
+
+		event_provider->resource_file_name = NULL;
+	}
+	event_provider->resource_file_name_size = name_length + 1;
+
+	event_provider->resource_file_name = system_string_allocate(
+	                                      event_provider->resource_file_name_size );
+
+	if( event_provider->resource_file_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create resource file name.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     event_provider->resource_file_name,
+	     name,
+	     name_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy resource file name.",
+		 function );
+
+		goto on_error;
+	}
+	( event_provider->resource_file_name )[ name_length ] = 0;
+
+	return( 1 );
+
+on_error:
+	if( event_provider->resource_file_name != NULL )
+	{
+		memory_free(
+		 event_provider->resource_file_name );
+
+		event_provider->resource_file_name = NULL;
+	}
+	event_provider->resource_file_name_size = 0;
+
+	return( -1 );
+}
+
@@ -0,0 +1,119 @@
+/*
+ * Event provider
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _EVENT_PROVIDER_H )
+#define _EVENT_PROVIDER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct event_provider event_provider_t;
+
+struct event_provider
+{
+	/* The provider identifier string
+	 */
+	system_character_t *identifier;
+
+	/* The provider identifier string size
+	 */
+	size_t identifier_size;
+
+	/* The event source
+	 */
+	system_character_t *event_source;
+
+	/* The event source size
+	 */
+	size_t event_source_size;
+
+	/* The resource filename(s)
+	 */
+	system_character_t *resource_filename;
+
+	/* The resource filename(s) size
+	 */
+	size_t resource_filename_size;
+
+	/* The message filename(s)
+	 */
+	system_character_t *message_filename;
+
+	/* The message filename(s) size
+	 */
+	size_t message_filename_size;
+
+	/* The name of the resource file that contains the provider
+	 */
+	system_character_t *resource_file_name;
+
+	/* The name size of the resource file that contains the provider
+	 */
+	size_t resource_file_name_size;
+
+	/* Value to indicate the resource file that contains the provider was resolved
+	 */
+	uint8_t resource_file_is_resolved;
+
+	/* The number of records that referenced the provider
+	 */
+	uint64_t number_of_records;
+
+	/* The number of event messages that were resolved
+	 */
+	uint64_t number_of_resolved_messages;
+};
+
+int event_provider_initialize(
+     event_provider_t **event_provider,
+     const system_character_t *identifier,
+     size_t identifier_length,
+     const system_character_t *event_source,
+     size_t event_source_length,
+     libcerror_error_t **error );
+
+int event_provider_free(
+     event_provider_t **event_provider,
+     libcerror_error_t **error );
+
+int event_provider_compare(
+     event_provider_t *first_event_provider,
+     event_provider_t *second_event_provider,
+     libcerror_error_t **error );
+
+int event_provider_set_resource_file_name(
+     event_provider_t *event_provider,
+     const system_character_t *name,
+     size_t name_length,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _EVENT_PROVIDER_H ) */
+
@@ -0,0 +1,398 @@
+/*
+ * Measures the time spent in the phases of reading a Windows XML Event Viewer Log (EVTX) file
+ *
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "bench_handle.h"
+#include "evtxtools_getopt.h"
+#include "evtxtools_libcerror.h"
+#include "evtxtools_libclocale.h"
+#include "evtxtools_libcnotify.h"
+#include "evtxtools_libevtx.h"
+#include "evtxtools_output.h"
+#include "evtxtools_signal.h"
+#include "evtxtools_unused.h"
+
+bench_handle_t *evtxbench_bench_handle = NULL;
+int evtxbench_abort                    = 0;
+
+/* Prints the executable usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use evtxbench to measure the time spent in the phases of reading\n"
+	                 "a Windows XML Event Viewer Log (EVTX) file.\n\n" );
+
+	fprintf( stream, "Usage: evtxbench [ -c codepage ] [ -f format ] [ -hvV ] source\n\n" );
+
+	fprintf( stream, "\tsource: the source file\n\n" );
+
+	fprintf( stream, "\t-c:     codepage of ASCII strings, options: ascii, windows-874,\n"
+	                 "\t        windows-932, windows-936, windows-949, windows-950,\n"
+	                 "\t        windows-1250, windows-1251, windows-1252 (default),\n"
+	                 "\t        windows-1253, windows-1254, windows-1255, windows-1256\n"
+	                 "\t        windows-1257 or windows-1258\n" );
+	fprintf( stream, "\t-f:     output format, options: json, text (default)\n" );
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-v:     verbose output to stderr\n" );
+	fprintf( stream, "\t-V:     print version\n" );
+}
+
+/* Signal handler for evtxbench
+ */
+void evtxbench_signal_handler(
+      evtxtools_signal_t signal EVTXTOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "evtxbench_signal_handler";
+
+	EVTXTOOLS_UNREFERENCED_PARAMETER( signal )
+
+	evtxbench_abort = 1;
+
+	if( evtxbench_bench_handle != NULL )
+	{
+		if( bench_handle_signal_abort(
+		     evtxbench_bench_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal bench handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	/* Force stdin to close otherwise any function reading it will remain blocked
+	 */
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+	if( _close(
+	     0 ) != 0 )
+#else
+	if( close(
+	     0 ) != 0 )
+#endif
+	{
+		libcnotify_printf(
+		 "%s: unable to close stdin.\n",
+		 function );
+	}
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	libcerror_error_t *error                  = NULL;
+	system_character_t *option_ascii_codepage = NULL;
+	system_character_t *option_output_format  = NULL;
+	system_character_t *source                = NULL;
+	char *program                             = "evtxbench";
+	system_integer_t option                   = 0;
+	int result                                = 0;
+	int verbose                               = 0;
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+	     "evtxtools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+	if( evtxtools_output_initialize(
+	     _IONBF,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	/* The version is printed to stderr so that the results on stdout
+	 * can be processed as-is
+	 */
+	evtxoutput_version_fprint(
+	 stderr,
+	 program );
+
+	while( ( option = evtxtools_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "c:f:hvV" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'c':
+				option_ascii_codepage = optarg;
+
+				break;
+
+			case (system_integer_t) 'f':
+				option_output_format = optarg;
+
+				break;
+
+			case (system_integer_t) 'h':
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				evtxoutput_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source file.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	source = argv[ optind ];
+
+	libcnotify_verbose_set(
+	 verbose );
+	libevtx_notify_set_stream(
+	 stderr,
+	 NULL );
+	libevtx_notify_set_verbose(
+	 verbose );
+
+	if( bench_handle_initialize(
+	     &evtxbench_bench_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize bench handle.\n" );
+
+		goto on_error;
+	}
+	if( option_ascii_codepage != NULL )
+	{
+		result = bench_handle_set_ascii_codepage(
+		          evtxbench_bench_handle,
+		          option_ascii_codepage,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set ASCII codepage in bench handle.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported ASCII codepage defaulting to: windows-1252.\n" );
+		}
+	}
+	if( option_output_format != NULL )
+	{
+		result = bench_handle_set_output_format(
+		          evtxbench_bench_handle,
+		          option_output_format,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set output format in bench handle.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported output format defaulting to: text.\n" );
+		}
+	}
+	if( evtxtools_signal_attach(
+	     evtxbench_signal_handler,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( bench_handle_open_input(
+	     evtxbench_bench_handle,
+	     source,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open: %" PRIs_SYSTEM ".\n",
+		 source );
+
+		goto on_error;
+	}
+	result = bench_handle_benchmark_records(
+	          evtxbench_bench_handle,
+	          &error );
+
+	if( result == -1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to benchmark records.\n" );
+
+		goto on_error;
+	}
+	if( evtxtools_signal_detach(
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to detach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( evtxbench_abort != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Benchmark aborted.\n" );
+
+		goto on_error;
+	}
+	if( bench_handle_results_fprint(
+	     evtxbench_bench_handle,
+	     source,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to print benchmark results.\n" );
+
+		goto on_error;
+	}
+	if( bench_handle_close_input(
+	     evtxbench_bench_handle,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close bench handle.\n" );
+
+		goto on_error;
+	}
+	if( bench_handle_free(
+	     &evtxbench_bench_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free bench handle.\n" );
+
+		goto on_error;
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( evtxbench_bench_handle != NULL )
+	{
+		bench_handle_free(
+		 &evtxbench_bench_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
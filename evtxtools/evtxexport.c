@@ -58,28 +58,42 @@ void usage_fprint(
 	fprintf( stream, "Use evtxexport to export items stored in a Windows XML Event Viewer\n"
 	                 "Log (EVTX) file.\n\n" );
 
-	fprintf( stream, "Usage: evtxexport [ -c codepage ] [ -f format ] [ -l log_file ]\n"
-	                 "                  [ -m mode ] [ -p resource_files_path ]\n"
+	fprintf( stream, "Usage: evtxexport [ -B size ] [ -c codepage ] [ -C capacity ]\n"
+	                 "                  [ -f format ] [ -j threads ] [ -l log_file ]\n"
+	                 "                  [ -m mode ] [ -M message_catalog ]\n"
+	                 "                  [ -p resource_files_path ]\n"
 	                 "                  [ -r registy_files_path ] [ -s system_file ]\n"
 	                 "                  [ -S software_file ] [ -t event_log_type ]\n"
-	                 "                  [ -hTvV ] source\n\n" );
+	                 "                  [ -hPTvVx ] source\n\n" );
 
 
 	fprintf( stream, "\tsource: the source file\n\n" );
 
+	fprintf( stream, "\t-B:     the size of the output buffer, the default is 1M. A K or M\n"
+	                 "\t        suffix specifies the size in KiB or MiB. The exported records\n"
+	                 "\t        are written when the buffered output exceeds this size\n" );
 	fprintf( stream, "\t-c:     codepage of ASCII strings, options: ascii, windows-874,\n"
 	                 "\t        windows-932, windows-936, windows-949, windows-950,\n"
 	                 "\t        windows-1250, windows-1251, windows-1252 (default),\n"
 	                 "\t        windows-1253, windows-1254, windows-1255, windows-1256\n"
 	                 "\t        windows-1257 or windows-1258\n" );
-	fprintf( stream, "\t-f:     output format, options: xml, text (default)\n" );
+	fprintf( stream, "\t-C:     the maximum number of resource files kept open,\n"
+	                 "\t        the default is 64\n" );
+	fprintf( stream, "\t-f:     output format, options: json, jsonl, text (default), xml\n" );
 	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-j:     the number of threads used to export the records,\n"
+	                 "\t        the default is 1. The records are written in the same\n"
+	                 "\t        order regardless of the number of threads\n" );
 	fprintf( stream, "\t-l:     logs information about the exported items\n" );
 	fprintf( stream, "\t-m:     export mode, option: all, items (default), recovered\n"
 	                 "\t        'all' exports the (allocated) items and recovered items,\n"
 	                 "\t        'items' exports the (allocated) items and 'recovered' exports\n"
 	                 "\t        the recovered items\n" );
+	fprintf( stream, "\t-M:     use a message catalog compiled by evtxmsgdb instead of\n"
+	                 "\t        the (Windows) Registry and resource files\n" );
 	fprintf( stream, "\t-p:     search PATH for the resource files\n" );
+	fprintf( stream, "\t-P:     preload the publisher and event source keys and close\n"
+	                 "\t        the (Windows) Registry files before exporting\n" );
 	fprintf( stream, "\t-r:     name of the directory containing the SOFTWARE and SYSTEM\n"
 	                 "\t        (Windows) Registry file\n" );
 	fprintf( stream, "\t-s:     filename of the SYSTEM (Windows) Registry file.\n"
@@ -92,6 +106,9 @@ void usage_fprint(
 	fprintf( stream, "\t-T:     use event template definitions to parse the event record data\n" );
 	fprintf( stream, "\t-v:     verbose output to stderr\n" );
 	fprintf( stream, "\t-V:     print version\n" );
+	fprintf( stream, "\t-x:     profile the export, prints the time spent per phase, the\n"
+	                 "\t        event provider resolution counts and the cache hit rates\n"
+	                 "\t        to stderr\n" );
 }
 
 /* Signal handler for evtxexport
@@ -146,13 +163,18 @@ int wmain( int argc, wchar_t * const argv[] )
 int main( int argc, char * const argv[] )
 #endif
 {
+	FILE *notify_stream                                   = stdout;
 	libcerror_error_t *error                              = NULL;
 	log_handle_t *log_handle                              = NULL;
 	system_character_t *option_ascii_codepage             = NULL;
+	system_character_t *option_buffer_size                = NULL;
+	system_character_t *option_cache_capacity             = NULL;
 	system_character_t *option_event_log_type             = NULL;
 	system_character_t *option_export_format              = NULL;
 	system_character_t *option_export_mode                = NULL;
 	system_character_t *option_log_filename               = NULL;
+	system_character_t *option_message_catalog_filename   = NULL;
+	system_character_t *option_number_of_threads          = NULL;
 	system_character_t *option_resource_files_path        = NULL;
 	system_character_t *option_preferred_language         = NULL;
 	system_character_t *option_registry_directory_name    = NULL;
@@ -161,6 +183,8 @@ int main( int argc, char * const argv[] )
 	system_character_t *source                            = NULL;
 	char *program                                         = "evtxexport";
 	system_integer_t option                               = 0;
+	int preload_registry_keys                             = 0;
+	int profile                                           = 0;
 	int result                                            = 0;
 	int use_template_definition                           = 0;
 	int verbose                                           = 0;
@@ -191,19 +215,19 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	evtxoutput_version_fprint(
-	 stdout,
-	 program );
-
 	while( ( option = evtxtools_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "c:f:hl:m:p:r:s:S:t:TvV" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "B:c:C:f:hj:l:m:M:p:Pr:s:S:t:TvVx" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
 			case (system_integer_t) '?':
 			default:
+				evtxoutput_version_fprint(
+				 stdout,
+				 program );
+
 				fprintf(
 				 stderr,
 				 "Invalid argument: %" PRIs_SYSTEM "\n",
@@ -214,22 +238,41 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_FAILURE );
 
+			case (system_integer_t) 'B':
+				option_buffer_size = optarg;
+
+				break;
+
 			case (system_integer_t) 'c':
 				option_ascii_codepage = optarg;
 
 				break;
 
+			case (system_integer_t) 'C':
+				option_cache_capacity = optarg;
+
+				break;
+
 			case (system_integer_t) 'f':
 				option_export_format = optarg;
 
 				break;
 
 			case (system_integer_t) 'h':
+				evtxoutput_version_fprint(
+				 stdout,
+				 program );
+
 				usage_fprint(
 				 stdout );
 
 				return( EXIT_SUCCESS );
 
+			case (system_integer_t) 'j':
+				option_number_of_threads = optarg;
+
+				break;
+
 			case (system_integer_t) 'l':
 				option_log_filename = optarg;
 
@@ -240,11 +283,21 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (system_integer_t) 'M':
+				option_message_catalog_filename = optarg;
+
+				break;
+
 			case (system_integer_t) 'p':
 				option_resource_files_path = optarg;
 
 				break;
 
+			case (system_integer_t) 'P':
+				preload_registry_keys = 1;
+
+				break;
+
 			case (system_integer_t) 'r':
 				option_registry_directory_name = optarg;
 
@@ -276,14 +329,27 @@ int main( int argc, char * const argv[] )
 				break;
 
 			case (system_integer_t) 'V':
+				evtxoutput_version_fprint(
+				 stdout,
+				 program );
+
 				evtxoutput_copyright_fprint(
 				 stdout );
 
 				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'x':
+				profile = 1;
+
+				break;
 		}
 	}
 	if( optind == argc )
 	{
+		evtxoutput_version_fprint(
+		 stdout,
+		 program );
+
 		fprintf(
 		 stderr,
 		 "Missing source file.\n" );
@@ -383,6 +449,18 @@ int main( int argc, char * const argv[] )
 			 "Unsupported export format defaulting to: text.\n" );
 		}
 	}
+	/* The JSON output is intended to be parsed, hence messages
+	 * that are not part of it are written to stderr
+	 */
+	if( ( evtxexport_export_handle->export_format == EXPORT_FORMAT_JSON )
+	 || ( evtxexport_export_handle->export_format == EXPORT_FORMAT_JSONL ) )
+	{
+		notify_stream = stderr;
+	}
+	evtxoutput_version_fprint(
+	 notify_stream,
+	 program );
+
 	if( option_export_mode != NULL )
 	{
 		result = export_handle_set_export_mode(
@@ -422,6 +500,95 @@ int main( int argc, char * const argv[] )
 			goto on_error;
 		}
 	}
+	if( option_number_of_threads != NULL )
+	{
+		result = export_handle_set_number_of_threads(
+			  evtxexport_export_handle,
+			  option_number_of_threads,
+			  &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set number of threads.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of threads defaulting to: 1.\n" );
+		}
+#if !defined( HAVE_MULTI_THREAD_SUPPORT )
+		else if( evtxexport_export_handle->number_of_threads > 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Multi-threading not supported, exporting with a single thread.\n" );
+		}
+#endif
+	}
+	if( option_buffer_size != NULL )
+	{
+		result = export_handle_set_output_buffer_size(
+			  evtxexport_export_handle,
+			  option_buffer_size,
+			  &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set output buffer size.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported output buffer size defaulting to: 1M.\n" );
+		}
+	}
+	if( option_cache_capacity != NULL )
+	{
+		result = export_handle_set_resource_file_cache_capacity(
+			  evtxexport_export_handle,
+			  option_cache_capacity,
+			  &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set resource file cache capacity.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported resource file cache capacity defaulting to: 64.\n" );
+		}
+	}
+	if( option_message_catalog_filename != NULL )
+	{
+		if( export_handle_open_message_catalog(
+		     evtxexport_export_handle,
+		     option_message_catalog_filename,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open message catalog: %" PRIs_SYSTEM ".\n",
+			 option_message_catalog_filename );
+
+			goto on_error;
+		}
+	}
 	if( option_resource_files_path != NULL )
 	{
 		if( export_handle_set_resource_files_path(
@@ -436,6 +603,20 @@ int main( int argc, char * const argv[] )
 			goto on_error;
 		}
 	}
+	if( preload_registry_keys != 0 )
+	{
+		if( export_handle_set_preload_registry_keys(
+		     evtxexport_export_handle,
+		     (uint8_t) preload_registry_keys,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set preload registry keys in export handle.\n" );
+
+			goto on_error;
+		}
+	}
 	if( option_software_registry_filename != NULL )
 	{
 		if( export_handle_set_software_registry_filename(
@@ -493,6 +674,20 @@ int main( int argc, char * const argv[] )
 			goto on_error;
 		}
 	}
+	if( profile != 0 )
+	{
+		if( export_handle_set_profile(
+		     evtxexport_export_handle,
+		     (uint8_t) profile,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set profile in export handle.\n" );
+
+			goto on_error;
+		}
+	}
 	evtxexport_export_handle->use_template_definition = use_template_definition;
 	evtxexport_export_handle->verbose                 = verbose;
 
@@ -533,6 +728,34 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	if( verbose != 0 )
+	{
+		if( message_handle_cache_statistics_fprint(
+		     evtxexport_export_handle->message_handle,
+		     stderr,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print cache statistics.\n" );
+
+			goto on_error;
+		}
+	}
+	if( profile != 0 )
+	{
+		if( export_handle_profile_fprint(
+		     evtxexport_export_handle,
+		     stderr,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print profile.\n" );
+
+			goto on_error;
+		}
+	}
 	if( export_handle_close_input(
 	     evtxexport_export_handle,
 	     &error ) != 0 )
@@ -576,7 +799,7 @@ int main( int argc, char * const argv[] )
 	if( result == 0 )
 	{
 		fprintf(
-		 stdout,
+		 notify_stream,
 		 "No records to export.\n" );
 	}
 	return( EXIT_SUCCESS );
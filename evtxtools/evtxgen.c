@@ -0,0 +1,539 @@
+/*
+ * Generates a synthetic Windows XML Event Viewer Log (EVTX) file
+ *
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtxtools_getopt.h"
+#include "evtxtools_libcerror.h"
+#include "evtxtools_libclocale.h"
+#include "evtxtools_libcnotify.h"
+#include "evtxtools_output.h"
+#include "evtxtools_signal.h"
+#include "evtxtools_unused.h"
+#include "generate_handle.h"
+
+generate_handle_t *evtxgen_generate_handle = NULL;
+int evtxgen_abort                          = 0;
+
+/* Prints the executable usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use evtxgen to generate a synthetic Windows XML Event Viewer Log\n"
+	                 "(EVTX) file, for example to benchmark reading large files.\n\n" );
+
+	fprintf( stream, "Usage: evtxgen [ -c number_of_chunks ] [ -l maximum_string_length ]\n"
+	                 "               [ -n number_of_values ] [ -r number_of_records ]\n"
+	                 "               [ -R number_of_remnants ] [ -s seed ]\n"
+	                 "               [ -t template_reuse ] [ -dhvV ] destination\n\n" );
+
+	fprintf( stream, "\tdestination: the destination file\n\n" );
+
+	fprintf( stream, "\t-c:          number of chunks, where a chunk is 64 KiB (default is 1,\n"
+	                 "\t             maximum is 65535)\n" );
+	fprintf( stream, "\t-d:          mark the file as dirty, the file header then does not\n"
+	                 "\t             contain the last chunk\n" );
+	fprintf( stream, "\t-h:          shows this help\n" );
+	fprintf( stream, "\t-l:          maximum number of characters of the event data string\n"
+	                 "\t             values (default is 32, maximum is 4096)\n" );
+	fprintf( stream, "\t-n:          number of event data values per record (default is 4,\n"
+	                 "\t             maximum is 256)\n" );
+	fprintf( stream, "\t-r:          maximum number of records per chunk (default is 0,\n"
+	                 "\t             which represents as many as fit in the chunk)\n" );
+	fprintf( stream, "\t-R:          number of record remnants after the free space offset\n"
+	                 "\t             of every chunk (default is 0)\n" );
+	fprintf( stream, "\t-s:          seed of the pseudo random values, the same seed and\n"
+	                 "\t             options result in the same file (default is 1)\n" );
+	fprintf( stream, "\t-t:          percentage of records that reuse a template that was\n"
+	                 "\t             defined earlier in the same chunk (default is 90)\n" );
+	fprintf( stream, "\t-v:          verbose output to stderr\n" );
+	fprintf( stream, "\t-V:          print version\n" );
+}
+
+/* Signal handler for evtxgen
+ */
+void evtxgen_signal_handler(
+      evtxtools_signal_t signal EVTXTOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "evtxgen_signal_handler";
+
+	EVTXTOOLS_UNREFERENCED_PARAMETER( signal )
+
+	evtxgen_abort = 1;
+
+	if( evtxgen_generate_handle != NULL )
+	{
+		if( generate_handle_signal_abort(
+		     evtxgen_generate_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal generate handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	/* Force stdin to close otherwise any function reading it will remain blocked
+	 */
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+	if( _close(
+	     0 ) != 0 )
+#else
+	if( close(
+	     0 ) != 0 )
+#endif
+	{
+		libcnotify_printf(
+		 "%s: unable to close stdin.\n",
+		 function );
+	}
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	libcerror_error_t *error                          = NULL;
+	system_character_t *option_maximum_string_length = NULL;
+	system_character_t *option_number_of_chunks      = NULL;
+	system_character_t *option_number_of_records     = NULL;
+	system_character_t *option_number_of_remnants    = NULL;
+	system_character_t *option_number_of_values      = NULL;
+	system_character_t *option_seed                  = NULL;
+	system_character_t *option_template_reuse        = NULL;
+	system_character_t *destination                  = NULL;
+	char *program                                    = "evtxgen";
+	system_integer_t option                          = 0;
+	int is_dirty                                     = 0;
+	int result                                       = 0;
+	int verbose                                      = 0;
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+	     "evtxtools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+	if( evtxtools_output_initialize(
+	     _IONBF,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	evtxoutput_version_fprint(
+	 stdout,
+	 program );
+
+	while( ( option = evtxtools_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "c:dhl:n:r:R:s:t:vV" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'c':
+				option_number_of_chunks = optarg;
+
+				break;
+
+			case (system_integer_t) 'd':
+				is_dirty = 1;
+
+				break;
+
+			case (system_integer_t) 'h':
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'l':
+				option_maximum_string_length = optarg;
+
+				break;
+
+			case (system_integer_t) 'n':
+				option_number_of_values = optarg;
+
+				break;
+
+			case (system_integer_t) 'r':
+				option_number_of_records = optarg;
+
+				break;
+
+			case (system_integer_t) 'R':
+				option_number_of_remnants = optarg;
+
+				break;
+
+			case (system_integer_t) 's':
+				option_seed = optarg;
+
+				break;
+
+			case (system_integer_t) 't':
+				option_template_reuse = optarg;
+
+				break;
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				evtxoutput_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing destination file.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	destination = argv[ optind ];
+
+	libcnotify_verbose_set(
+	 verbose );
+
+	if( generate_handle_initialize(
+	     &evtxgen_generate_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize generate handle.\n" );
+
+		goto on_error;
+	}
+	evtxgen_generate_handle->is_dirty = is_dirty;
+
+	if( option_number_of_chunks != NULL )
+	{
+		result = generate_handle_set_number_of_chunks(
+		          evtxgen_generate_handle,
+		          option_number_of_chunks,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set number of chunks in generate handle.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of chunks defaulting to: %d.\n",
+			 evtxgen_generate_handle->number_of_chunks );
+		}
+	}
+	if( option_number_of_records != NULL )
+	{
+		result = generate_handle_set_maximum_number_of_records_per_chunk(
+		          evtxgen_generate_handle,
+		          option_number_of_records,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set number of records in generate handle.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of records defaulting to: %d.\n",
+			 evtxgen_generate_handle->maximum_number_of_records_per_chunk );
+		}
+	}
+	if( option_template_reuse != NULL )
+	{
+		result = generate_handle_set_template_reuse_percentage(
+		          evtxgen_generate_handle,
+		          option_template_reuse,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set template reuse in generate handle.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported template reuse defaulting to: %d.\n",
+			 evtxgen_generate_handle->template_reuse_percentage );
+		}
+	}
+	if( option_number_of_values != NULL )
+	{
+		result = generate_handle_set_number_of_values(
+		          evtxgen_generate_handle,
+		          option_number_of_values,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set number of values in generate handle.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of values defaulting to: %d.\n",
+			 evtxgen_generate_handle->number_of_values );
+		}
+	}
+	if( option_maximum_string_length != NULL )
+	{
+		result = generate_handle_set_maximum_string_length(
+		          evtxgen_generate_handle,
+		          option_maximum_string_length,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set maximum string length in generate handle.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported maximum string length defaulting to: %d.\n",
+			 evtxgen_generate_handle->maximum_string_length );
+		}
+	}
+	if( option_number_of_remnants != NULL )
+	{
+		result = generate_handle_set_number_of_remnants(
+		          evtxgen_generate_handle,
+		          option_number_of_remnants,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set number of remnants in generate handle.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of remnants defaulting to: %d.\n",
+			 evtxgen_generate_handle->number_of_remnants );
+		}
+	}
+	if( option_seed != NULL )
+	{
+		result = generate_handle_set_seed(
+		          evtxgen_generate_handle,
+		          option_seed,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set seed in generate handle.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported seed defaulting to: %" PRIu64 ".\n",
+			 evtxgen_generate_handle->seed );
+		}
+	}
+	if( evtxtools_signal_attach(
+	     evtxgen_signal_handler,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	fprintf(
+	 stdout,
+	 "Generating: %" PRIs_SYSTEM "\n",
+	 destination );
+
+	if( generate_handle_generate_file(
+	     evtxgen_generate_handle,
+	     destination,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to generate: %" PRIs_SYSTEM ".\n",
+		 destination );
+
+		goto on_error;
+	}
+	if( evtxtools_signal_detach(
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to detach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( evtxgen_abort != 0 )
+	{
+		fprintf(
+		 stdout,
+		 "Generate aborted.\n" );
+
+		goto on_error;
+	}
+	if( generate_handle_statistics_fprint(
+	     evtxgen_generate_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to print statistics.\n" );
+
+		goto on_error;
+	}
+	if( generate_handle_free(
+	     &evtxgen_generate_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free generate handle.\n" );
+
+		goto on_error;
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( evtxgen_generate_handle != NULL )
+	{
+		generate_handle_free(
+		 &evtxgen_generate_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
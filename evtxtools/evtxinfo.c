@@ -58,7 +58,7 @@ void usage_fprint(
 	fprintf( stream, "Use evtxinfo to determine information about a Windows XML Event Viewer\n"
 	                 "Log (EVTX) file\n\n" );
 
-	fprintf( stream, "Usage: evtxinfo [ -c codepage ] [ -hvV ] source\n\n" );
+	fprintf( stream, "Usage: evtxinfo [ -c codepage ] [ -hsvV ] source\n\n" );
 
 	fprintf( stream, "\tsource: the source file\n\n" );
 
@@ -68,6 +68,7 @@ void usage_fprint(
 	                 "\t        windows-1253, windows-1254, windows-1255, windows-1256\n"
 	                 "\t        windows-1257 or windows-1258\n" );
 	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-s:     read all records and print the library statistics\n" );
 	fprintf( stream, "\t-v:     verbose output to stderr\n" );
 	fprintf( stream, "\t-V:     print version\n" );
 }
@@ -129,6 +130,7 @@ int main( int argc, char * const argv[] )
 	system_character_t *source                = NULL;
 	char *program                             = "evtxinfo";
 	system_integer_t option                   = 0;
+	int option_print_statistics               = 0;
 	int result                                = 0;
 	int verbose                               = 0;
 
@@ -165,7 +167,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = evtxtools_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "c:hvV" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "c:hsvV" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -192,6 +194,11 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_SUCCESS );
 
+			case (system_integer_t) 's':
+				option_print_statistics = 1;
+
+				break;
+
 			case (system_integer_t) 'v':
 				verbose = 1;
 
@@ -292,6 +299,19 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	if( option_print_statistics != 0 )
+	{
+		if( info_handle_statistics_fprint(
+		     evtxinfo_info_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print statistics.\n" );
+
+			goto on_error;
+		}
+	}
 	if( info_handle_close(
 	     evtxinfo_info_handle,
 	     &error ) != 0 )
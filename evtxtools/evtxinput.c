@@ -31,6 +31,43 @@
 #include "evtxtools_libevtx.h"
 #include "evtxtools_wide_string.h"
 
+/* Retrieves the name of the event log (Windows Registry) key of a specific event log type
+ */
+const char *evtxinput_get_event_log_key_name(
+             int event_log_type )
+{
+	switch( event_log_type )
+	{
+		case EVTXTOOLS_EVENT_LOG_TYPE_APPLICATION:
+			return( "Application" );
+
+		case EVTXTOOLS_EVENT_LOG_TYPE_DFS_REPLICATION:
+			return( "DFS Replication" );
+
+		case EVTXTOOLS_EVENT_LOG_TYPE_HARDWARE_EVENTS:
+			return( "Hardware Events" );
+
+		case EVTXTOOLS_EVENT_LOG_TYPE_INTERNET_EXPLORER:
+			return( "Internet Explorer" );
+
+		case EVTXTOOLS_EVENT_LOG_TYPE_KEY_MANAGEMENT_SERVICE:
+			return( "Key Management Service" );
+
+		case EVTXTOOLS_EVENT_LOG_TYPE_MEDIA_CENTER:
+			return( "Media Center" );
+
+		case EVTXTOOLS_EVENT_LOG_TYPE_SECURITY:
+			return( "Security" );
+
+		case EVTXTOOLS_EVENT_LOG_TYPE_SYSTEM:
+			return( "System" );
+
+		default:
+			break;
+	}
+	return( "(Unknown)" );
+}
+
 /* Determines the event log type from a string
  * Returns 1 if successful, 0 if unsupported value or -1 on error
  */
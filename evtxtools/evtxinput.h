@@ -44,6 +44,9 @@ enum EVTXTOOLS_EVENT_LOG_TYPES
 	EVTXTOOLS_EVENT_LOG_TYPE_SYSTEM
 };
 
+const char *evtxinput_get_event_log_key_name(
+             int event_log_type );
+
 int evtxinput_determine_event_log_type(
      const system_character_t *string,
      int *event_log_type,
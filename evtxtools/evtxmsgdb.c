@@ -0,0 +1,462 @@
+/*
+ * Compiles the event messages of a Windows system into a message catalog
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "compile_handle.h"
+#include "evtxtools_getopt.h"
+#include "evtxtools_libcerror.h"
+#include "evtxtools_libclocale.h"
+#include "evtxtools_libcnotify.h"
+#include "evtxtools_libevtx.h"
+#include "evtxtools_output.h"
+#include "evtxtools_signal.h"
+#include "evtxtools_unused.h"
+
+compile_handle_t *evtxmsgdb_compile_handle = NULL;
+int evtxmsgdb_abort                        = 0;
+
+/* Prints the executable usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use evtxmsgdb to compile the event messages of a Windows system into\n"
+	                 "a message catalog that can be used by evtxexport -M.\n\n" );
+
+	fprintf( stream, "Usage: evtxmsgdb [ -p resource_files_path ] [ -r registy_files_path ]\n"
+	                 "                 [ -s system_file ] [ -S software_file ]\n"
+	                 "                 [ -t event_log_type ] [ -hvV ] destination\n\n" );
+
+	fprintf( stream, "\tdestination: the message catalog file\n\n" );
+
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-p:     search PATH for the resource files\n" );
+	fprintf( stream, "\t-r:     name of the directory containing the SOFTWARE and SYSTEM\n"
+	                 "\t        (Windows) Registry file\n" );
+	fprintf( stream, "\t-s:     filename of the SYSTEM (Windows) Registry file.\n"
+	                 "\t        This option overrides the path provided by -r\n" );
+	fprintf( stream, "\t-S:     filename of the SOFTWARE (Windows) Registry file.\n"
+	                 "\t        This option overrides the path provided by -r\n" );
+	fprintf( stream, "\t-t:     event log type, options: application (default), security,\n"
+	                 "\t        system. A message catalog is specific to one event log type\n" );
+	fprintf( stream, "\t-v:     verbose output to stderr\n" );
+	fprintf( stream, "\t-V:     print version\n" );
+}
+
+/* Signal handler for evtxmsgdb
+ */
+void evtxmsgdb_signal_handler(
+      evtxtools_signal_t signal EVTXTOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "evtxmsgdb_signal_handler";
+
+	EVTXTOOLS_UNREFERENCED_PARAMETER( signal )
+
+	evtxmsgdb_abort = 1;
+
+	if( evtxmsgdb_compile_handle != NULL )
+	{
+		if( compile_handle_signal_abort(
+		     evtxmsgdb_compile_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal compile handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	/* Force stdin to close otherwise any function reading it will remain blocked
+	 */
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+	if( _close(
+	     0 ) != 0 )
+#else
+	if( close(
+	     0 ) != 0 )
+#endif
+	{
+		libcnotify_printf(
+		 "%s: unable to close stdin.\n",
+		 function );
+	}
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	libcerror_error_t *error                              = NULL;
+	system_character_t *option_event_log_type             = NULL;
+	system_character_t *option_registry_directory_name    = NULL;
+	system_character_t *option_resource_files_path        = NULL;
+	system_character_t *option_software_registry_filename = NULL;
+	system_character_t *option_system_registry_filename   = NULL;
+	system_character_t *destination                       = NULL;
+	char *program                                         = "evtxmsgdb";
+	system_integer_t option                               = 0;
+	int result                                            = 0;
+	int verbose                                           = 0;
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+	     "evtxtools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+	if( evtxtools_output_initialize(
+	     _IONBF,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	evtxoutput_version_fprint(
+	 stdout,
+	 program );
+
+	while( ( option = evtxtools_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "hp:r:s:S:t:vV" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'h':
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'p':
+				option_resource_files_path = optarg;
+
+				break;
+
+			case (system_integer_t) 'r':
+				option_registry_directory_name = optarg;
+
+				break;
+
+			case (system_integer_t) 's':
+				option_system_registry_filename = optarg;
+
+				break;
+
+			case (system_integer_t) 'S':
+				option_software_registry_filename = optarg;
+
+				break;
+
+			case (system_integer_t) 't':
+				option_event_log_type = optarg;
+
+				break;
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				evtxoutput_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing destination file.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	destination = argv[ optind ];
+
+	libcnotify_verbose_set(
+	 verbose );
+	libevtx_notify_set_stream(
+	 stderr,
+	 NULL );
+	libevtx_notify_set_verbose(
+	 verbose );
+
+	if( compile_handle_initialize(
+	     &evtxmsgdb_compile_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize compile handle.\n" );
+
+		goto on_error;
+	}
+	if( option_event_log_type != NULL )
+	{
+		result = compile_handle_set_event_log_type(
+		          evtxmsgdb_compile_handle,
+		          option_event_log_type,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set event log type in compile handle.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported event log type defaulting to: application.\n" );
+		}
+	}
+	if( option_resource_files_path != NULL )
+	{
+		if( compile_handle_set_resource_files_path(
+		     evtxmsgdb_compile_handle,
+		     option_resource_files_path,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set resource files path in compile handle.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_software_registry_filename != NULL )
+	{
+		if( compile_handle_set_software_registry_filename(
+		     evtxmsgdb_compile_handle,
+		     option_software_registry_filename,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set software registry filename in compile handle.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_system_registry_filename != NULL )
+	{
+		if( compile_handle_set_system_registry_filename(
+		     evtxmsgdb_compile_handle,
+		     option_system_registry_filename,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set system registry filename in compile handle.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_registry_directory_name != NULL )
+	{
+		if( compile_handle_set_registry_directory_name(
+		     evtxmsgdb_compile_handle,
+		     option_registry_directory_name,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set registry directory name in compile handle.\n" );
+
+			goto on_error;
+		}
+	}
+	evtxmsgdb_compile_handle->verbose = verbose;
+
+	if( compile_handle_open_input(
+	     evtxmsgdb_compile_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open the (Windows) Registry files.\n" );
+
+		goto on_error;
+	}
+	if( evtxtools_signal_attach(
+	     evtxmsgdb_signal_handler,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	result = compile_handle_compile(
+	          evtxmsgdb_compile_handle,
+	          &error );
+
+	if( result != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to compile message catalog.\n" );
+
+		goto on_error;
+	}
+	if( evtxtools_signal_detach(
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to detach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( evtxmsgdb_abort != 0 )
+	{
+		fprintf(
+		 stdout,
+		 "Compile aborted.\n" );
+
+		goto on_error;
+	}
+	if( compile_handle_write_message_catalog(
+	     evtxmsgdb_compile_handle,
+	     destination,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to write message catalog: %" PRIs_SYSTEM ".\n",
+		 destination );
+
+		goto on_error;
+	}
+	if( compile_handle_compile_statistics_fprint(
+	     evtxmsgdb_compile_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to print compile statistics.\n" );
+
+		goto on_error;
+	}
+	if( compile_handle_close_input(
+	     evtxmsgdb_compile_handle,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close compile handle.\n" );
+
+		goto on_error;
+	}
+	if( compile_handle_free(
+	     &evtxmsgdb_compile_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free compile handle.\n" );
+
+		goto on_error;
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( evtxmsgdb_compile_handle != NULL )
+	{
+		compile_handle_free(
+		 &evtxmsgdb_compile_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
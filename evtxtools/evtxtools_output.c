@@ -22,8 +22,18 @@
 #include <common.h>
 #include <file_stream.h>
 #include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
 #include <types.h>
 
+#if defined( HAVE_STDARG_H ) || defined( WINAPI )
+#include <stdarg.h>
+#elif defined( HAVE_VARARGS_H )
+#include <varargs.h>
+#else
+#error Missing headers stdarg.h and varargs.h
+#endif
+
 #include "evtxtools_i18n.h"
 #include "evtxtools_libbfio.h"
 #include "evtxtools_libcerror.h"
@@ -205,3 +215,495 @@ void evtxoutput_version_detailed_fprint(
 	 ")\n\n" );
 }
 
+/* Creates an output buffer
+ * Make sure the value output_buffer is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int evtxtools_output_buffer_initialize(
+     evtxtools_output_buffer_t **output_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "evtxtools_output_buffer_initialize";
+
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *output_buffer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid output buffer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*output_buffer = memory_allocate_structure(
+	                  evtxtools_output_buffer_t );
+
+	if( *output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create output buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *output_buffer,
+	     0,
+	     sizeof( evtxtools_output_buffer_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear output buffer.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *output_buffer != NULL )
+	{
+		memory_free(
+		 *output_buffer );
+
+		*output_buffer = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an output buffer
+ * Returns 1 if successful or -1 on error
+ */
+int evtxtools_output_buffer_free(
+     evtxtools_output_buffer_t **output_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "evtxtools_output_buffer_free";
+
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *output_buffer != NULL )
+	{
+		if( ( *output_buffer )->data != NULL )
+		{
+			memory_free(
+			 ( *output_buffer )->data );
+		}
+		memory_free(
+		 *output_buffer );
+
+		*output_buffer = NULL;
+	}
+	return( 1 );
+}
+
+/* Resizes an output buffer
+ * The buffer is only enlarged, the data in the buffer is preserved
+ * Returns 1 if successful or -1 on error
+ */
+int evtxtools_output_buffer_resize(
+     evtxtools_output_buffer_t *output_buffer,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *data         = NULL;
+	static char *function = "evtxtools_output_buffer_resize";
+
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size <= output_buffer->data_size )
+	{
+		return( 1 );
+	}
+	/* Grow the buffer at least by a factor 2 to limit the number of reallocations
+	 */
+	if( data_size < ( 2 * output_buffer->data_size ) )
+	{
+		data_size = 2 * output_buffer->data_size;
+	}
+	if( data_size < EVTXTOOLS_OUTPUT_BUFFER_MINIMUM_SIZE )
+	{
+		data_size = EVTXTOOLS_OUTPUT_BUFFER_MINIMUM_SIZE;
+	}
+	data = (uint8_t *) memory_reallocate(
+	                    output_buffer->data,
+	                    sizeof( uint8_t ) * data_size );
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize data.",
+		 function );
+
+		return( -1 );
+	}
+	output_buffer->data      = data;
+	output_buffer->data_size = data_size;
+
+	return( 1 );
+}
+
+/* Appends data to an output buffer
+ * Returns 1 if successful or -1 on error
+ */
+int evtxtools_output_buffer_append(
+     evtxtools_output_buffer_t *output_buffer,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "evtxtools_output_buffer_append";
+
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > ( (size_t) SSIZE_MAX - output_buffer->data_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( evtxtools_output_buffer_resize(
+	     output_buffer,
+	     output_buffer->data_offset + data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     &( output_buffer->data[ output_buffer->data_offset ] ),
+	     data,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy data.",
+		 function );
+
+		return( -1 );
+	}
+	output_buffer->data_offset += data_size;
+
+	return( 1 );
+}
+
+#if defined( HAVE_STDARG_H ) || defined( WINAPI )
+#define VARARGS( function, type, argument ) \
+	function( evtxtools_output_buffer_t *output_buffer, type argument, ... )
+#define VASTART( argument_list, type, name ) \
+	va_start( argument_list, name )
+#define VAEND( argument_list ) \
+	va_end( argument_list )
+
+#elif defined( HAVE_VARARGS_H )
+#define VARARGS( function, type, argument ) \
+	function( evtxtools_output_buffer_t *output_buffer, va_alist ) va_dcl
+#define VASTART( argument_list, type, name ) \
+	{ type name; va_start( argument_list ); name = va_arg( argument_list, type )
+#define VAEND( argument_list ) \
+	va_end( argument_list ); }
+
+#endif
+
+/* Print a formatted string to an output buffer
+ * The formatted string is appended to the data in the buffer, the end-of-string
+ * character is not considered part of the data
+ * Returns the number of printed characters or -1 on error
+ */
+int VARARGS(
+     evtxtools_output_buffer_printf,
+     const char *,
+     format )
+{
+	va_list argument_list;
+
+	char *string          = NULL;
+	size_t remaining_size = 0;
+	size_t required_size  = 0;
+	int print_count       = -1;
+
+	if( output_buffer == NULL )
+	{
+		return( -1 );
+	}
+	do
+	{
+		remaining_size = output_buffer->data_size - output_buffer->data_offset;
+
+		if( output_buffer->data != NULL )
+		{
+			string = (char *) &( output_buffer->data[ output_buffer->data_offset ] );
+		}
+		VASTART(
+		 argument_list,
+		 const char *,
+		 format );
+
+		print_count = narrow_string_vsnprintf(
+		               string,
+		               remaining_size,
+		               format,
+		               argument_list );
+
+		VAEND(
+		 argument_list );
+
+		if( ( print_count >= 0 )
+		 && ( (size_t) print_count < remaining_size ) )
+		{
+			break;
+		}
+		/* Some implementations of vsnprintf return -1 if the string
+		 * does not fit instead of the required string size
+		 */
+		if( print_count < 0 )
+		{
+			if( remaining_size >= EVTXTOOLS_OUTPUT_BUFFER_MAXIMUM_PRINT_SIZE )
+			{
+				return( -1 );
+			}
+			required_size = output_buffer->data_size + 1;
+		}
+		else
+		{
+			required_size = output_buffer->data_offset + (size_t) print_count + 1;
+		}
+		if( evtxtools_output_buffer_resize(
+		     output_buffer,
+		     required_size,
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+	while( 1 );
+
+	output_buffer->data_offset += (size_t) print_count;
+
+	return( print_count );
+}
+
+#undef VARARGS
+#undef VASTART
+#undef VAEND
+
+/* Writes the data in an output buffer to a stream
+ * The output buffer is emptied afterwards
+ * Returns 1 if successful or -1 on error
+ */
+int evtxtools_output_buffer_write_to_stream(
+     evtxtools_output_buffer_t *output_buffer,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	static char *function = "evtxtools_output_buffer_write_to_stream";
+
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_buffer->data_offset > 0 )
+	{
+		if( fwrite(
+		     output_buffer->data,
+		     sizeof( uint8_t ),
+		     output_buffer->data_offset,
+		     stream ) != output_buffer->data_offset )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write data to stream.",
+			 function );
+
+			return( -1 );
+		}
+		output_buffer->data_offset = 0;
+	}
+	return( 1 );
+}
+
+/* Determines the output buffer size from a string
+ * The size is a decimal value in bytes, optionally followed by a K or M
+ * suffix for KiB or MiB
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int evtxtools_output_buffer_size_copy_from_string(
+     const system_character_t *string,
+     size_t *buffer_size,
+     libcerror_error_t **error )
+{
+	static char *function   = "evtxtools_output_buffer_size_copy_from_string";
+	size_t multiplier       = 1;
+	size_t string_index     = 0;
+	size_t string_length    = 0;
+	size_t safe_buffer_size = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer size.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( string_length == 0 )
+	{
+		return( 0 );
+	}
+	if( ( string[ string_length - 1 ] == (system_character_t) 'k' )
+	 || ( string[ string_length - 1 ] == (system_character_t) 'K' ) )
+	{
+		multiplier     = 1024;
+		string_length -= 1;
+	}
+	else if( ( string[ string_length - 1 ] == (system_character_t) 'm' )
+	      || ( string[ string_length - 1 ] == (system_character_t) 'M' ) )
+	{
+		multiplier     = 1024 * 1024;
+		string_length -= 1;
+	}
+	if( string_length == 0 )
+	{
+		return( 0 );
+	}
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] < (system_character_t) '0' )
+		 || ( string[ string_index ] > (system_character_t) '9' ) )
+		{
+			return( 0 );
+		}
+		safe_buffer_size *= 10;
+		safe_buffer_size += (size_t) ( string[ string_index ] - (system_character_t) '0' );
+
+		if( safe_buffer_size > ( EVTXTOOLS_OUTPUT_BUFFER_MAXIMUM_SIZE / multiplier ) )
+		{
+			return( 0 );
+		}
+	}
+	*buffer_size = safe_buffer_size * multiplier;
+
+	return( 1 );
+}
+
@@ -24,6 +24,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <system_string.h>
 #include <types.h>
 
 #include "evtxtools_libcerror.h"
@@ -32,6 +33,39 @@
 extern "C" {
 #endif
 
+/* The minimum size of an output buffer
+ */
+#define EVTXTOOLS_OUTPUT_BUFFER_MINIMUM_SIZE		4096
+
+/* The default size of the buffered output, when exceeded the output is written
+ */
+#define EVTXTOOLS_OUTPUT_BUFFER_DEFAULT_SIZE		( 1024 * 1024 )
+
+/* The maximum size of the buffered output
+ */
+#define EVTXTOOLS_OUTPUT_BUFFER_MAXIMUM_SIZE		( 256 * 1024 * 1024 )
+
+/* The maximum size of a single formatted print to an output buffer
+ */
+#define EVTXTOOLS_OUTPUT_BUFFER_MAXIMUM_PRINT_SIZE	( 16 * 1024 * 1024 )
+
+typedef struct evtxtools_output_buffer evtxtools_output_buffer_t;
+
+struct evtxtools_output_buffer
+{
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The data offset
+	 */
+	size_t data_offset;
+};
+
 int evtxtools_output_initialize(
      int stdio_mode,
      libcerror_error_t **error );
@@ -47,6 +81,40 @@ void evtxoutput_version_detailed_fprint(
       FILE *stream,
       const char *program );
 
+int evtxtools_output_buffer_initialize(
+     evtxtools_output_buffer_t **output_buffer,
+     libcerror_error_t **error );
+
+int evtxtools_output_buffer_free(
+     evtxtools_output_buffer_t **output_buffer,
+     libcerror_error_t **error );
+
+int evtxtools_output_buffer_resize(
+     evtxtools_output_buffer_t *output_buffer,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int evtxtools_output_buffer_append(
+     evtxtools_output_buffer_t *output_buffer,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int evtxtools_output_buffer_printf(
+     evtxtools_output_buffer_t *output_buffer,
+     const char *format,
+     ... );
+
+int evtxtools_output_buffer_write_to_stream(
+     evtxtools_output_buffer_t *output_buffer,
+     FILE *stream,
+     libcerror_error_t **error );
+
+int evtxtools_output_buffer_size_copy_from_string(
+     const system_character_t *string,
+     size_t *buffer_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,149 @@
+/*
+ * Profiling functions
+ *
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#if defined( HAVE_SYS_TIME_H )
+#include <sys/time.h>
+#endif
+
+#if defined( HAVE_TIME_H )
+#include <time.h>
+#endif
+
+#if defined( HAVE_SYS_RESOURCE_H )
+#include <sys/resource.h>
+#endif
+
+#include "evtxtools_libcerror.h"
+#include "evtxtools_profile.h"
+
+/* Retrieves the current time of a monotonic clock
+ * The time is in nanoseconds and is only meaningful relative to another time
+ * retrieved by this function
+ * Returns the current time or 0 if not available
+ */
+uint64_t evtxtools_profile_get_time(
+          void )
+{
+#if defined( WINAPI )
+	static LARGE_INTEGER performance_frequency = { 0 };
+	LARGE_INTEGER performance_count;
+
+	if( performance_frequency.QuadPart == 0 )
+	{
+		if( QueryPerformanceFrequency(
+		     &performance_frequency ) == 0 )
+		{
+			return( 0 );
+		}
+	}
+	if( QueryPerformanceCounter(
+	     &performance_count ) == 0 )
+	{
+		return( 0 );
+	}
+	return( (uint64_t) ( ( (double) performance_count.QuadPart * 1000000000.0 ) / (double) performance_frequency.QuadPart ) );
+
+#elif defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+	struct timespec time_specification;
+
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_specification ) != 0 )
+	{
+		return( 0 );
+	}
+	return( ( (uint64_t) time_specification.tv_sec * 1000000000 ) + (uint64_t) time_specification.tv_nsec );
+
+#elif defined( HAVE_GETTIMEOFDAY )
+	struct timeval time_value;
+
+	if( gettimeofday(
+	     &time_value,
+	     NULL ) != 0 )
+	{
+		return( 0 );
+	}
+	return( ( (uint64_t) time_value.tv_sec * 1000000000 ) + ( (uint64_t) time_value.tv_usec * 1000 ) );
+
+#else
+	return( 0 );
+
+#endif
+}
+
+/* Retrieves the peak memory usage of the process
+ * The peak memory usage is the maximum resident set size in bytes
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int evtxtools_profile_get_peak_memory_usage(
+     uint64_t *peak_memory_usage,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_GETRUSAGE ) && !defined( WINAPI )
+	struct rusage resource_usage;
+#endif
+
+	static char *function = "evtxtools_profile_get_peak_memory_usage";
+
+	if( peak_memory_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid peak memory usage.",
+		 function );
+
+		return( -1 );
+	}
+	*peak_memory_usage = 0;
+
+#if defined( HAVE_GETRUSAGE ) && !defined( WINAPI )
+	if( getrusage(
+	     RUSAGE_SELF,
+	     &resource_usage ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve resource usage.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( __APPLE__ )
+	/* On Mac OS X the maximum resident set size is in bytes
+	 */
+	*peak_memory_usage = (uint64_t) resource_usage.ru_maxrss;
+#else
+	*peak_memory_usage = (uint64_t) resource_usage.ru_maxrss * 1024;
+#endif
+	return( 1 );
+#else
+	return( 0 );
+#endif
+}
+
@@ -0,0 +1,73 @@
+/*
+ * Profiling functions
+ *
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _EVTXTOOLS_PROFILE_H )
+#define _EVTXTOOLS_PROFILE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The profile counters are updated by multiple threads
+ * hence relaxed atomic operations are used where available
+ */
+#if defined( __GNUC__ ) && defined( __ATOMIC_RELAXED )
+#define evtxtools_profile_counter_add( counter, value ) \
+	__atomic_fetch_add( &( counter ), (uint64_t) ( value ), __ATOMIC_RELAXED )
+
+#define evtxtools_profile_counter_get( counter ) \
+	__atomic_load_n( &( counter ), __ATOMIC_RELAXED )
+
+#elif defined( WINAPI ) && ( WINVER >= 0x0600 )
+#define evtxtools_profile_counter_add( counter, value ) \
+	InterlockedExchangeAdd64( (LONGLONG volatile *) &( counter ), (LONGLONG) ( value ) )
+
+#define evtxtools_profile_counter_get( counter ) \
+	(uint64_t) InterlockedCompareExchange64( (LONGLONG volatile *) &( counter ), 0, 0 )
+
+#else
+#define evtxtools_profile_counter_add( counter, value ) \
+	( counter ) += (uint64_t) ( value )
+
+#define evtxtools_profile_counter_get( counter ) \
+	( counter )
+
+#endif
+
+uint64_t evtxtools_profile_get_time(
+          void );
+
+int evtxtools_profile_get_peak_memory_usage(
+     uint64_t *peak_memory_usage,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _EVTXTOOLS_PROFILE_H ) */
+
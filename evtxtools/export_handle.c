@@ -30,50 +30,29 @@
 #include "evtxtools_libcerror.h"
 #include "evtxtools_libcnotify.h"
 #include "evtxtools_libclocale.h"
+#include "evtxtools_libcthreads.h"
 #include "evtxtools_libevtx.h"
 #include "evtxtools_libfdatetime.h"
 #include "evtxtools_libfguid.h"
+#include "evtxtools_output.h"
 #include "export_handle.h"
+#include "export_job.h"
 #include "log_handle.h"
+#include "message_catalog.h"
 #include "message_handle.h"
 #include "message_string.h"
+#include "profile_handle.h"
 #include "resource_file.h"
+#include "resource_file_cache.h"
+#include "template_definition_cache.h"
 
 #define EXPORT_HANDLE_NOTIFY_STREAM		stdout
 
 const char *export_handle_get_event_log_key_name(
              int event_log_type )
 {
-	switch( event_log_type )
-	{
-		case EVTXTOOLS_EVENT_LOG_TYPE_APPLICATION:
-			return( "Application" );
-
-		case EVTXTOOLS_EVENT_LOG_TYPE_DFS_REPLICATION:
-			return( "DFS Replication" );
-
-		case EVTXTOOLS_EVENT_LOG_TYPE_HARDWARE_EVENTS:
-			return( "Hardware Events" );
-
-		case EVTXTOOLS_EVENT_LOG_TYPE_INTERNET_EXPLORER:
-			return( "Internet Explorer" );
-
-		case EVTXTOOLS_EVENT_LOG_TYPE_KEY_MANAGEMENT_SERVICE:
-			return( "Key Management Service" );
-
-		case EVTXTOOLS_EVENT_LOG_TYPE_MEDIA_CENTER:
-			return( "Media Center" );
-
-		case EVTXTOOLS_EVENT_LOG_TYPE_SECURITY:
-			return( "Security" );
-
-		case EVTXTOOLS_EVENT_LOG_TYPE_SYSTEM:
-			return( "System" );
-
-		default:
-			break;
-	}
-	return( "(Unknown)" );
+	return( evtxinput_get_event_log_key_name(
+	         event_log_type ) );
 }
 
 const char *export_handle_get_event_level(
@@ -176,6 +155,19 @@ int export_handle_initialize(
 
 		goto on_error;
 	}
+	if( template_definition_cache_initialize(
+	     &( ( *export_handle )->template_definition_cache ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create template definition cache.",
+		 function );
+
+		goto on_error;
+	}
 	if( libevtx_file_initialize(
 	     &( ( *export_handle )->input_file ),
 	     error ) != 1 )
@@ -189,17 +181,45 @@ int export_handle_initialize(
 
 		goto on_error;
 	}
+	if( evtxtools_output_buffer_initialize(
+	     &( ( *export_handle )->output_buffer ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create output buffer.",
+		 function );
+
+		goto on_error;
+	}
 	( *export_handle )->export_mode    = EXPORT_MODE_ITEMS;
 	( *export_handle )->export_format  = EXPORT_FORMAT_TEXT;
 	( *export_handle )->event_log_type = EVTXTOOLS_EVENT_LOG_TYPE_UNKNOWN;
 	( *export_handle )->ascii_codepage = LIBEVTX_CODEPAGE_WINDOWS_1252;
 	( *export_handle )->notify_stream  = EXPORT_HANDLE_NOTIFY_STREAM;
 
+	( *export_handle )->number_of_threads  = 1;
+	( *export_handle )->output_buffer_size = EVTXTOOLS_OUTPUT_BUFFER_DEFAULT_SIZE;
+
 	return( 1 );
 
 on_error:
 	if( *export_handle != NULL )
 	{
+		if( ( *export_handle )->input_file != NULL )
+		{
+			libevtx_file_free(
+			 &( ( *export_handle )->input_file ),
+			 NULL );
+		}
+		if( ( *export_handle )->template_definition_cache != NULL )
+		{
+			template_definition_cache_free(
+			 &( ( *export_handle )->template_definition_cache ),
+			 NULL );
+		}
 		if( ( *export_handle )->message_handle != NULL )
 		{
 			message_handle_free(
@@ -266,6 +286,35 @@ int export_handle_free(
 
 			result = -1;
 		}
+		if( template_definition_cache_free(
+		     &( ( *export_handle )->template_definition_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free template definition cache.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *export_handle )->profile_handle != NULL )
+		{
+			if( profile_handle_free(
+			     &( ( *export_handle )->profile_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free profile handle.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( libevtx_file_free(
 		     &( ( *export_handle )->input_file ),
 		     error ) != 1 )
@@ -279,6 +328,35 @@ int export_handle_free(
 
 			result = -1;
 		}
+		if( ( *export_handle )->export_jobs != NULL )
+		{
+			if( export_handle_stop_export_jobs(
+			     *export_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to stop export jobs.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( evtxtools_output_buffer_free(
+		     &( ( *export_handle )->output_buffer ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free output buffer.",
+			 function );
+
+			result = -1;
+		}
 		memory_free(
 		 *export_handle );
 
@@ -459,14 +537,35 @@ int export_handle_set_export_format(
 	{
 		if( system_string_compare(
 		     string,
-		     _SYSTEM_STRING( "text" ),
+		     _SYSTEM_STRING( "json" ),
 		     4 ) == 0 )
+		{
+			export_handle->export_format = EXPORT_FORMAT_JSON;
+
+			result = 1;
+		}
+		else if( system_string_compare(
+		          string,
+		          _SYSTEM_STRING( "text" ),
+		          4 ) == 0 )
 		{
 			export_handle->export_format = EXPORT_FORMAT_TEXT;
 
 			result = 1;
 		}
 	}
+	else if( string_length == 5 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "jsonl" ),
+		     5 ) == 0 )
+		{
+			export_handle->export_format = EXPORT_FORMAT_JSONL;
+
+			result = 1;
+		}
+	}
 	return( result );
 }
 
@@ -546,6 +645,200 @@ int export_handle_set_ascii_codepage(
 	return( result );
 }
 
+/* Sets the number of threads
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int export_handle_set_number_of_threads(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_number_of_threads";
+	size_t string_index   = 0;
+	size_t string_length  = 0;
+	int number_of_threads = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( string_length == 0 )
+	{
+		return( 0 );
+	}
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] < (system_character_t) '0' )
+		 || ( string[ string_index ] > (system_character_t) '9' ) )
+		{
+			return( 0 );
+		}
+		number_of_threads *= 10;
+		number_of_threads += (int) ( string[ string_index ] - (system_character_t) '0' );
+
+		if( number_of_threads > EXPORT_HANDLE_MAXIMUM_NUMBER_OF_THREADS )
+		{
+			return( 0 );
+		}
+	}
+	if( number_of_threads == 0 )
+	{
+		return( 0 );
+	}
+	export_handle->number_of_threads = number_of_threads;
+
+	return( 1 );
+}
+
+/* Sets the output buffer size
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int export_handle_set_output_buffer_size(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function     = "export_handle_set_output_buffer_size";
+	size_t output_buffer_size = 0;
+	int result                = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = evtxtools_output_buffer_size_copy_from_string(
+	          string,
+	          &output_buffer_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine output buffer size.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		export_handle->output_buffer_size = output_buffer_size;
+	}
+	return( result );
+}
+
+/* Sets the resource file cache capacity
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int export_handle_set_resource_file_cache_capacity(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_resource_file_cache_capacity";
+	size_t string_index   = 0;
+	size_t string_length  = 0;
+	int capacity          = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( string_length == 0 )
+	{
+		return( 0 );
+	}
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] < (system_character_t) '0' )
+		 || ( string[ string_index ] > (system_character_t) '9' ) )
+		{
+			return( 0 );
+		}
+		capacity *= 10;
+		capacity += (int) ( string[ string_index ] - (system_character_t) '0' );
+
+		if( capacity > RESOURCE_FILE_CACHE_MAXIMUM_CAPACITY )
+		{
+			return( 0 );
+		}
+	}
+	if( capacity < RESOURCE_FILE_CACHE_MINIMUM_CAPACITY )
+	{
+		return( 0 );
+	}
+	if( message_handle_set_resource_file_cache_capacity(
+	     export_handle->message_handle,
+	     capacity,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set resource file cache capacity in message handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Sets the preferred language identifier
  * Returns 1 if successful or -1 on error
  */
@@ -818,15 +1111,15 @@ int export_handle_set_resource_files_path(
 	return( 1 );
 }
 
-/* Opens the input
+/* Sets if the publisher and event source registry keys should be preloaded
  * Returns 1 if successful or -1 on error
  */
-int export_handle_open_input(
+int export_handle_set_preload_registry_keys(
      export_handle_t *export_handle,
-     const system_character_t *filename,
+     uint8_t preload_registry_keys,
      libcerror_error_t **error )
 {
-	static char *function = "export_handle_open_input";
+	static char *function = "export_handle_set_preload_registry_keys";
 
 	if( export_handle == NULL )
 	{
@@ -839,22 +1132,297 @@ int export_handle_open_input(
 
 		return( -1 );
 	}
-	if( export_handle->input_is_open != 0 )
+	if( message_handle_set_preload_registry_keys(
+	     export_handle->message_handle,
+	     preload_registry_keys,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid export handle input is already open.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set preload registry keys in message handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( message_handle_open_input(
-	     export_handle->message_handle,
-	     export_handle_get_event_log_key_name(
-	      export_handle->event_log_type ),
-	     error ) != 1 )
+	return( 1 );
+}
+
+/* Sets if the time spent in the phases of the export should be profiled
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_set_profile(
+     export_handle_t *export_handle,
+     uint8_t profile,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_profile";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( profile != 0 )
+	 && ( export_handle->profile_handle == NULL ) )
+	{
+		if( profile_handle_initialize(
+		     &( export_handle->profile_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create profile handle.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else if( ( profile == 0 )
+	      && ( export_handle->profile_handle != NULL ) )
+	{
+		if( profile_handle_free(
+		     &( export_handle->profile_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free profile handle.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	export_handle->message_handle->profile_handle = export_handle->profile_handle;
+
+	return( 1 );
+}
+
+/* Prints the time spent in the phases of the export, the event provider resolution counts
+ * and the cache statistics
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_profile_fprint(
+     export_handle_t *export_handle,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	libevtx_statistics_t statistics;
+
+	static char *function         = "export_handle_profile_fprint";
+	uint64_t number_of_retrievals = 0;
+	uint64_t hit_rate             = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->profile_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle - missing profile handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( profile_handle_fprint(
+	     export_handle->profile_handle,
+	     export_handle->number_of_threads,
+	     stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print profile.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 stream,
+	 "\n" );
+
+	if( export_handle->input_file != NULL )
+	{
+		statistics.size = sizeof( libevtx_statistics_t );
+
+		if( libevtx_file_get_statistics(
+		     export_handle->input_file,
+		     &statistics,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve statistics of input file.",
+			 function );
+
+			return( -1 );
+		}
+		number_of_retrievals = statistics.number_of_chunk_cache_hits
+		                     + statistics.number_of_chunk_cache_misses;
+
+		if( number_of_retrievals > 0 )
+		{
+			hit_rate = ( statistics.number_of_chunk_cache_hits * 100 ) / number_of_retrievals;
+		}
+		fprintf(
+		 stream,
+		 "libevtx chunk cache: %" PRIu64 " hits, %" PRIu64 " misses (hit rate: %" PRIu64 "%%)\n",
+		 statistics.number_of_chunk_cache_hits,
+		 statistics.number_of_chunk_cache_misses,
+		 hit_rate );
+
+		number_of_retrievals = statistics.number_of_record_cache_hits
+		                     + statistics.number_of_record_cache_misses;
+
+		hit_rate = 0;
+
+		if( number_of_retrievals > 0 )
+		{
+			hit_rate = ( statistics.number_of_record_cache_hits * 100 ) / number_of_retrievals;
+		}
+		fprintf(
+		 stream,
+		 "libevtx record cache: %" PRIu64 " hits, %" PRIu64 " misses (hit rate: %" PRIu64 "%%)\n",
+		 statistics.number_of_record_cache_hits,
+		 statistics.number_of_record_cache_misses,
+		 hit_rate );
+	}
+	if( message_handle_cache_statistics_fprint(
+	     export_handle->message_handle,
+	     stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print cache statistics.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 stream,
+	 "\n" );
+
+	if( message_handle_event_providers_fprint(
+	     export_handle->message_handle,
+	     stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print event providers.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Opens a message catalog that is used instead of the registry and resource files
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_open_message_catalog(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_open_message_catalog";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_handle_open_message_catalog(
+	     export_handle->message_handle,
+	     filename,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open message catalog.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Opens the input
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_open_input(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_open_input";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->input_is_open != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle input is already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_handle_open_input(
+	     export_handle->message_handle,
+	     export_handle_get_event_log_key_name(
+	      export_handle->event_log_type ),
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -1068,6 +1636,8 @@ on_error:
 }
 
 /* Retrieves the template definition from the resource file
+ * The template definitions are cached so that their data is copied and their XML document
+ * is read once per run, the template definition is managed by the template definition cache
  * Returns 1 if successful, 0 if not available or -1 on error
  */
 int export_handle_resource_file_get_template_definition(
@@ -1099,6 +1669,28 @@ int export_handle_resource_file_get_template_definition(
 
 		return( -1 );
 	}
+	if( resource_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_file->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid resource file - missing name.",
+		 function );
+
+		return( -1 );
+	}
 	if( template_definition == NULL )
 	{
 		libcerror_error_set(
@@ -1110,6 +1702,35 @@ int export_handle_resource_file_get_template_definition(
 
 		return( -1 );
 	}
+	result = template_definition_cache_get_template_definition(
+		  export_handle->template_definition_cache,
+		  resource_file->name,
+		  resource_file->name_size - 1,
+		  provider_identifier,
+		  provider_identifier_size,
+		  event_identifier,
+		  template_definition,
+		  error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve template definition from cache.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( *template_definition == NULL )
+		{
+			return( 0 );
+		}
+		return( 1 );
+	}
 	result = resource_file_get_template_definition(
 		  resource_file,
 		  provider_identifier,
@@ -1192,7 +1813,6 @@ int export_handle_resource_file_get_template_definition(
 
 				goto on_error;
 			}
-/* TODO cache the EVTX template definitions ? */
 			if( libevtx_template_definition_initialize(
 			     template_definition,
 			     error ) != 1 )
@@ -1267,15 +1887,40 @@ int export_handle_resource_file_get_template_definition(
 			goto on_error;
 		}
 	}
-	return( result );
-
-on_error:
-	if( template_data != NULL )
-	{
-		memory_free(
-		 template_data );
-	}
-	if( wevt_template_definition != NULL )
+	/* Events without a template definition are cached as well
+	 */
+	if( template_definition_cache_insert_template_definition(
+	     export_handle->template_definition_cache,
+	     resource_file->name,
+	     resource_file->name_size - 1,
+	     provider_identifier,
+	     provider_identifier_size,
+	     event_identifier,
+	     *template_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert template definition into cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( *template_definition == NULL )
+	{
+		return( 0 );
+	}
+	return( 1 );
+
+on_error:
+	if( template_data != NULL )
+	{
+		memory_free(
+		 template_data );
+	}
+	if( wevt_template_definition != NULL )
 	{
 		libwrc_wevt_template_definition_free(
 		 &wevt_template_definition,
@@ -1302,37 +1947,34 @@ on_error:
 	return( -1 );
 }
 
-/* Exports the record event message
+/* Resolves the message string and template definition of the record event message
+ * The message string is a copy owned by the caller, the template definition
+ * is managed by the template definition cache or the message catalog
  * Returns 1 if successful or -1 on error
  */
-int export_handle_export_record_event_message(
+int export_handle_resolve_record_event_message(
      export_handle_t *export_handle,
      libevtx_record_t *record,
+     evtxtools_output_buffer_t *output_buffer,
      const system_character_t *event_provider_identifier,
      size_t event_provider_identifier_length,
      const system_character_t *event_source,
      size_t event_source_length,
      uint32_t event_identifier,
-     log_handle_t *log_handle,
+     message_string_t **message_string,
+     libevtx_template_definition_t **template_definition,
      libcerror_error_t **error )
 {
 	uint8_t provider_identifier[ 16 ];
 
-	libevtx_template_definition_t *template_definition = NULL;
-	message_string_t *message_string                   = NULL;
-	resource_file_t *resource_file                     = NULL;
-	system_character_t *message_filename               = NULL;
-	system_character_t *resource_filename              = NULL;
-	system_character_t *value_string                   = NULL;
-	static char *function                              = "export_handle_export_record_event_message";
-	size_t message_filename_size                       = 0;
-	size_t resource_filename_size                      = 0;
-	size_t value_string_size                           = 0;
-	uint32_t event_identifier_qualifiers               = 0;
-	uint32_t message_identifier                        = 0;
-	int number_of_strings                              = 0;
-	int result                                         = 0;
-	int value_string_index                             = 0;
+	event_provider_t *event_provider        = NULL;
+	message_string_t *cached_message_string = NULL;
+	resource_file_t *resource_file          = NULL;
+	static char *function                   = "export_handle_resolve_record_event_message";
+	uint64_t start_time                     = 0;
+	uint32_t event_identifier_qualifiers    = 0;
+	uint32_t message_identifier             = 0;
+	int result                              = 0;
 
 	if( export_handle == NULL )
 	{
@@ -1345,63 +1987,104 @@ int export_handle_export_record_event_message(
 
 		return( -1 );
 	}
-	if( event_provider_identifier != NULL )
+	if( output_buffer == NULL )
 	{
-		result = message_handle_get_value_by_provider_identifier(
-		          export_handle->message_handle,
-		          event_provider_identifier,
-		          event_provider_identifier_length,
-		          _SYSTEM_STRING( "ResourceFileName" ),
-		          16,
-		          &resource_filename,
-		          &resource_filename_size,
-		          error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
 
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve resource filename by provider identifier.",
-			 function );
+		return( -1 );
+	}
+	if( message_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message string.",
+		 function );
 
-			goto on_error;
-		}
-		result = message_handle_get_value_by_provider_identifier(
-		          export_handle->message_handle,
-		          event_provider_identifier,
-		          event_provider_identifier_length,
-		          _SYSTEM_STRING( "MessageFileName" ),
-		          15,
-		          &message_filename,
-		          &message_filename_size,
-		          error );
+		return( -1 );
+	}
+	if( *message_string != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid message string value already set.",
+		 function );
 
-		if( result == -1 )
+		return( -1 );
+	}
+	if( template_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( event_provider_identifier != NULL )
+	 || ( event_source != NULL ) )
+	{
+		if( message_handle_get_event_provider(
+		     export_handle->message_handle,
+		     event_provider_identifier,
+		     event_provider_identifier_length,
+		     event_source,
+		     event_source_length,
+		     &event_provider,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve message filename by provider identifier.",
+			 "%s: unable to retrieve event provider.",
 			 function );
 
 			goto on_error;
 		}
+		if( event_provider != NULL )
+		{
+			event_provider->number_of_records += 1;
+		}
 	}
-	if( ( message_filename == NULL )
-	 && ( event_source != NULL ) )
+	if( ( event_provider != NULL )
+	 && ( event_provider->resource_filename != NULL )
+	 && ( export_handle->message_handle->message_catalog != NULL ) )
 	{
-		result = message_handle_get_value_by_event_source(
-		          export_handle->message_handle,
-		          event_source,
-		          event_source_length,
-		          _SYSTEM_STRING( "EventMessageFile" ),
-		          16,
-		          &message_filename,
-		          &message_filename_size,
-		          error );
+		evtxtools_output_buffer_printf(
+		 output_buffer,
+		 "Resource filename\t\t: %" PRIs_SYSTEM "\n",
+		 event_provider->resource_filename );
+
+		/* The message catalog contains the message identifier and template definition
+		 * of the event hence the resource file is not needed
+		 */
+		start_time = profile_handle_start_phase(
+		              export_handle->profile_handle );
+
+		result = message_catalog_get_event(
+			  export_handle->message_handle->message_catalog,
+			  event_provider_identifier,
+			  event_provider_identifier_length,
+			  event_identifier,
+			  &message_identifier,
+			  ( export_handle->use_template_definition != 0 ) ? template_definition : NULL,
+			  error );
+
+		profile_handle_end_phase(
+		 export_handle->profile_handle,
+		 PROFILE_HANDLE_PHASE_MESSAGE_LOOKUP,
+		 start_time );
 
 		if( result == -1 )
 		{
@@ -1409,21 +2092,24 @@ int export_handle_export_record_event_message(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve message filename by event source.",
+			 "%s: unable to retrieve event from message catalog.",
 			 function );
 
 			goto on_error;
 		}
+		else if( result == 0 )
+		{
+			message_identifier = 0;
+		}
 	}
-	if( resource_filename != NULL )
+	else if( ( event_provider != NULL )
+	      && ( event_provider->resource_filename != NULL ) )
 	{
-		fprintf(
-		 export_handle->notify_stream,
+		evtxtools_output_buffer_printf(
+		 output_buffer,
 		 "Resource filename\t\t: %" PRIs_SYSTEM "\n",
-		 resource_filename );
-	}
-	if( resource_filename != NULL )
-	{
+		 event_provider->resource_filename );
+
 		if( export_handle_guid_string_copy_to_byte_stream(
 		     export_handle,
 		     event_provider_identifier,
@@ -1441,10 +2127,9 @@ int export_handle_export_record_event_message(
 
 			goto on_error;
 		}
-		result = message_handle_get_resource_file_by_provider_identifier(
+		result = message_handle_get_resource_file_by_event_provider(
 			  export_handle->message_handle,
-			  resource_filename,
-			  resource_filename_size - 1,
+			  event_provider,
 			  provider_identifier,
 			  16,
 			  &resource_file,
@@ -1488,15 +2173,23 @@ int export_handle_export_record_event_message(
 			}
 			if( export_handle->use_template_definition != 0 )
 			{
+				start_time = profile_handle_start_phase(
+				              export_handle->profile_handle );
+
 				result = export_handle_resource_file_get_template_definition(
 					  export_handle,
 					  resource_file,
 					  provider_identifier,
 					  16,
 					  event_identifier,
-					  &template_definition,
+					  template_definition,
 					  error );
 
+				profile_handle_end_phase(
+				 export_handle->profile_handle,
+				 PROFILE_HANDLE_PHASE_TEMPLATE_DEFINITION,
+				 start_time );
+
 				if( result == -1 )
 				{
 					libcerror_error_set(
@@ -1510,17 +2203,14 @@ int export_handle_export_record_event_message(
 				}
 			}
 		}
-		memory_free(
-		 resource_filename );
-
-		resource_filename = NULL;
 	}
-	if( message_filename != NULL )
+	if( ( event_provider != NULL )
+	 && ( event_provider->message_filename != NULL ) )
 	{
-		fprintf(
-		 export_handle->notify_stream,
+		evtxtools_output_buffer_printf(
+		 output_buffer,
 		 "Message filename\t\t: %" PRIs_SYSTEM "\n",
-		 message_filename );
+		 event_provider->message_filename );
 
 		if( message_identifier == 0 )
 		{
@@ -1544,8 +2234,8 @@ int export_handle_export_record_event_message(
 			{
 				if( export_handle->verbose != 0 )
 				{
-					fprintf(
-					 export_handle->notify_stream,
+					evtxtools_output_buffer_printf(
+					 output_buffer,
 					 "Event identifier qualifiers\t: 0x%08" PRIx32 "\n",
 					 event_identifier_qualifiers );
 				}
@@ -1555,17 +2245,17 @@ int export_handle_export_record_event_message(
 		}
 		if( export_handle->verbose != 0 )
 		{
-			fprintf(
-			 export_handle->notify_stream,
+			evtxtools_output_buffer_printf(
+			 output_buffer,
 			 "Message identifier\t\t: 0x%08" PRIx32 "\n",
 			 message_identifier );
 		}
 		result = message_handle_get_message_string(
 			  export_handle->message_handle,
-			  message_filename,
-			  message_filename_size - 1,
+			  event_provider->message_filename,
+			  event_provider->message_filename_size - 1,
 			  message_identifier,
-			  &message_string,
+			  &cached_message_string,
 			  error );
 
 		if( result == -1 )
@@ -1579,18 +2269,174 @@ int export_handle_export_record_event_message(
 
 			goto on_error;
 		}
-		memory_free(
-		 message_filename );
+		if( cached_message_string != NULL )
+		{
+			event_provider->number_of_resolved_messages += 1;
+
+			/* The cached message string is compiled before it is cloned
+			 * so that it is compiled only once
+			 */
+			if( message_string_compile(
+			     cached_message_string,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to compile message string.",
+				 function );
+
+				goto on_error;
+			}
+			/* The cached message string can be freed by another export job
+			 * once the message mutex is released
+			 */
+			if( message_string_clone(
+			     message_string,
+			     cached_message_string,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to clone message string.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( *message_string != NULL )
+	{
+		message_string_free(
+		 message_string,
+		 NULL );
+	}
+	*template_definition = NULL;
+
+	return( -1 );
+}
+
+/* Exports the record event message
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_record_event_message(
+     export_handle_t *export_handle,
+     libevtx_record_t *record,
+     evtxtools_output_buffer_t *output_buffer,
+     const system_character_t *event_provider_identifier,
+     size_t event_provider_identifier_length,
+     const system_character_t *event_source,
+     size_t event_source_length,
+     uint32_t event_identifier,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	libevtx_template_definition_t *template_definition = NULL;
+	message_string_t *message_string                   = NULL;
+	system_character_t *value_strings                  = NULL;
+	static char *function                              = "export_handle_export_record_event_message";
+	size_t *value_string_offsets                       = NULL;
+	size_t value_strings_size                          = 0;
+	uint64_t start_time                                = 0;
+	int number_of_strings                              = 0;
+	int result                                         = 0;
+	int value_string_index                             = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The message handle and the resource files it caches are not thread-safe
+	 * hence the event messages are resolved by one export job at a time
+	 */
+	if( export_handle->message_mutex != NULL )
+	{
+		if( libcthreads_mutex_grab(
+		     export_handle->message_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab message mutex.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	result = export_handle_resolve_record_event_message(
+	          export_handle,
+	          record,
+	          output_buffer,
+	          event_provider_identifier,
+	          event_provider_identifier_length,
+	          event_source,
+	          event_source_length,
+	          event_identifier,
+	          &message_string,
+	          &template_definition,
+	          error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( export_handle->message_mutex != NULL )
+	{
+		if( libcthreads_mutex_release(
+		     export_handle->message_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release message mutex.",
+			 function );
 
-		message_filename = NULL;
+			goto on_error;
+		}
+	}
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to resolve event message.",
+		 function );
+
+		goto on_error;
 	}
-	if( export_handle->use_template_definition != 0 )
+	if( template_definition != NULL )
 	{
+		start_time = profile_handle_start_phase(
+		              export_handle->profile_handle );
+
 		result = libevtx_record_parse_data_with_template_definition(
 			  record,
 			  template_definition,
 			  error );
 
+		profile_handle_end_phase(
+		 export_handle->profile_handle,
+		 PROFILE_HANDLE_PHASE_TEMPLATE_DEFINITION,
+		 start_time );
+
 		if( result == -1 )
 		{
 			libcerror_error_set(
@@ -1611,19 +2457,10 @@ int export_handle_export_record_event_message(
 			libcerror_error_free(
 			 error );
 		}
-		if( libevtx_template_definition_free(
-		     &template_definition,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free template definition.",
-			 function );
-
-			goto on_error;
-		}
+		/* The template definition is managed by the template definition cache
+		 * or the message catalog
+		 */
+		template_definition = NULL;
 	}
 	if( libevtx_record_get_number_of_strings(
 	     record,
@@ -1639,31 +2476,20 @@ int export_handle_export_record_event_message(
 
 		goto on_error;
 	}
-	fprintf(
-	 export_handle->notify_stream,
-	 "Number of strings\t\t: %d\n",
-	 number_of_strings );
-
-	for( value_string_index = 0;
-	     value_string_index < number_of_strings;
-	     value_string_index++ )
+	if( number_of_strings > 0 )
 	{
-		fprintf(
-		 export_handle->notify_stream,
-		 "String: %d\t\t\t: ",
-		 value_string_index + 1 );
-
+		/* Retrieve all strings at once, they are used both to print the strings
+		 * and to format the message string
+		 */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libevtx_record_get_utf16_string_size(
+		result = libevtx_record_get_utf16_strings_size(
 			  record,
-			  value_string_index,
-			  &value_string_size,
+			  &value_strings_size,
 			  error );
 #else
-		result = libevtx_record_get_utf8_string_size(
+		result = libevtx_record_get_utf8_strings_size(
 			  record,
-			  value_string_index,
-			  &value_string_size,
+			  &value_strings_size,
 			  error );
 #endif
 		if( result != 1 )
@@ -1672,75 +2498,91 @@ int export_handle_export_record_event_message(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve string: %d size.",
-			 function,
-			 value_string_index );
+			 "%s: unable to retrieve strings size.",
+			 function );
 
 			goto on_error;
 		}
-		if( value_string_size > 0 )
+		value_strings = system_string_allocate(
+		                 value_strings_size );
+
+		if( value_strings == NULL )
 		{
-			value_string = system_string_allocate(
-					value_string_size );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create value strings.",
+			 function );
 
-			if( value_string == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-				 "%s: unable to create value string.",
-				 function );
+			goto on_error;
+		}
+		value_string_offsets = (size_t *) memory_allocate(
+		                                   sizeof( size_t ) * number_of_strings );
 
-				goto on_error;
-			}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-			result = libevtx_record_get_utf16_string(
-				  record,
-				  value_string_index,
-				  (uint16_t *) value_string,
-				  value_string_size,
-				  error );
-#else
-			result = libevtx_record_get_utf8_string(
-				  record,
-				  value_string_index,
-				  (uint8_t *) value_string,
-				  value_string_size,
-				  error );
-#endif
-			if( result != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve string: %d.",
-				 function,
-				 value_string_index );
-
-				goto on_error;
-			}
-			fprintf(
-			 export_handle->notify_stream,
-			 "%" PRIs_SYSTEM "",
-			 value_string );
+		if( value_string_offsets == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create value string offsets.",
+			 function );
 
-			memory_free(
-			 value_string );
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libevtx_record_get_utf16_strings(
+			  record,
+			  (uint16_t *) value_strings,
+			  value_strings_size,
+			  value_string_offsets,
+			  number_of_strings,
+			  error );
+#else
+		result = libevtx_record_get_utf8_strings(
+			  record,
+			  (uint8_t *) value_strings,
+			  value_strings_size,
+			  value_string_offsets,
+			  number_of_strings,
+			  error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve strings.",
+			 function );
 
-			value_string = NULL;
+			goto on_error;
 		}
-		fprintf(
-		 export_handle->notify_stream,
-		 "\n" );
+	}
+	evtxtools_output_buffer_printf(
+	 output_buffer,
+	 "Number of strings\t\t: %d\n",
+	 number_of_strings );
+
+	for( value_string_index = 0;
+	     value_string_index < number_of_strings;
+	     value_string_index++ )
+	{
+		evtxtools_output_buffer_printf(
+		 output_buffer,
+		 "String: %d\t\t\t: %" PRIs_SYSTEM "\n",
+		 value_string_index + 1,
+		 &( value_strings[ value_string_offsets[ value_string_index ] ] ) );
 	}
 	if( message_string != NULL )
 	{
-		if( message_string_fprint(
+		if( message_string_print(
 		     message_string,
-		     record,
-		     export_handle->notify_stream,
+		     value_strings,
+		     value_string_offsets,
+		     number_of_strings,
+		     output_buffer,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -1752,31 +2594,48 @@ int export_handle_export_record_event_message(
 
 			goto on_error;
 		}
-		message_string = NULL;
-	}
-	return( 1 );
+		if( message_string_free(
+		     &message_string,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free message string.",
+			 function );
 
-on_error:
-	if( value_string != NULL )
+			goto on_error;
+		}
+	}
+	if( value_string_offsets != NULL )
 	{
 		memory_free(
-		 value_string );
+		 value_string_offsets );
 	}
-	if( template_definition != NULL )
+	if( value_strings != NULL )
 	{
-		libevtx_template_definition_free(
-		 &template_definition,
+		memory_free(
+		 value_strings );
+	}
+	return( 1 );
+
+on_error:
+	if( message_string != NULL )
+	{
+		message_string_free(
+		 &message_string,
 		 NULL );
 	}
-	if( message_filename != NULL )
+	if( value_string_offsets != NULL )
 	{
 		memory_free(
-		 message_filename );
+		 value_string_offsets );
 	}
-	if( resource_filename != NULL )
+	if( value_strings != NULL )
 	{
 		memory_free(
-		 resource_filename );
+		 value_strings );
 	}
 	return( -1 );
 }
@@ -1786,7 +2645,7 @@ on_error:
  */
 int export_handle_export_record(
      export_handle_t *export_handle,
-     libevtx_record_t *record,
+     export_job_t *export_job,
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
@@ -1807,7 +2666,7 @@ int export_handle_export_record(
 	{
 		if( export_handle_export_record_text(
 		     export_handle,
-		     record,
+		     export_job,
 		     log_handle,
 		     error ) != 1 )
 		{
@@ -1825,7 +2684,7 @@ int export_handle_export_record(
 	{
 		if( export_handle_export_record_xml(
 		     export_handle,
-		     record,
+		     export_job,
 		     log_handle,
 		     error ) != 1 )
 		{
@@ -1839,6 +2698,25 @@ int export_handle_export_record(
 			return( -1 );
 		}
 	}
+	else if( ( export_handle->export_format == EXPORT_FORMAT_JSON )
+	      || ( export_handle->export_format == EXPORT_FORMAT_JSONL ) )
+	{
+		if( export_handle_export_record_json(
+		     export_handle,
+		     export_job,
+		     log_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export record in JSON.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	return( 1 );
 }
 
@@ -1847,12 +2725,13 @@ int export_handle_export_record(
  */
 int export_handle_export_record_text(
      export_handle_t *export_handle,
-     libevtx_record_t *record,
+     export_job_t *export_job,
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
 	system_character_t filetime_string[ 48 ];
 
+	libevtx_record_t *record                = NULL;
 	libfdatetime_filetime_t *filetime       = NULL;
 	system_character_t *source_name         = NULL;
 	system_character_t *provider_identifier = NULL;
@@ -1861,6 +2740,7 @@ int export_handle_export_record_text(
 	size_t source_name_size                 = 0;
 	size_t provider_identifier_size         = 0;
 	size_t value_string_size                = 0;
+	uint64_t start_time                     = 0;
 	uint64_t value_64bit                    = 0;
 	uint32_t event_identifier               = 0;
 	uint8_t event_level                     = 0;
@@ -1877,13 +2757,26 @@ int export_handle_export_record_text(
 
 		return( -1 );
 	}
-	if( record == NULL )
+	if( export_job == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record.",
+		 "%s: invalid export job.",
+		 function );
+
+		return( -1 );
+	}
+	record = export_job->record;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export job - missing record.",
 		 function );
 
 		return( -1 );
@@ -1915,8 +2808,8 @@ int export_handle_export_record_text(
 
 		goto on_error;
 	}
-	fprintf(
-	 export_handle->notify_stream,
+	evtxtools_output_buffer_printf(
+	 export_job->output_buffer,
 	 "Event number\t\t\t: %" PRIu64 "\n",
 	 value_64bit );
 
@@ -1974,8 +2867,8 @@ int export_handle_export_record_text(
 
 		goto on_error;
 	}
-	fprintf(
-	 export_handle->notify_stream,
+	evtxtools_output_buffer_printf(
+	 export_job->output_buffer,
 	 "Written time\t\t\t: %" PRIs_SYSTEM " UTC\n",
 	 filetime_string );
 
@@ -2006,8 +2899,8 @@ int export_handle_export_record_text(
 
 		goto on_error;
 	}
-	fprintf(
-	 export_handle->notify_stream,
+	evtxtools_output_buffer_printf(
+	 export_job->output_buffer,
 	 "Event level\t\t\t: %s (%d)\n",
 	 export_handle_get_event_level(
 	  event_level ),
@@ -2076,8 +2969,8 @@ int export_handle_export_record_text(
 
 			goto on_error;
 		}
-		fprintf(
-		 export_handle->notify_stream,
+		evtxtools_output_buffer_printf(
+		 export_job->output_buffer,
 		 "User security identifier\t: %" PRIs_SYSTEM "\n",
 		 value_string );
 
@@ -2149,8 +3042,8 @@ int export_handle_export_record_text(
 
 			goto on_error;
 		}
-		fprintf(
-		 export_handle->notify_stream,
+		evtxtools_output_buffer_printf(
+		 export_job->output_buffer,
 		 "Computer name\t\t\t: %" PRIs_SYSTEM "\n",
 		 value_string );
 
@@ -2224,8 +3117,8 @@ int export_handle_export_record_text(
 		}
 		if( export_handle->verbose != 0 )
 		{
-			fprintf(
-			 export_handle->notify_stream,
+			evtxtools_output_buffer_printf(
+			 export_job->output_buffer,
 			 "Provider identifier\t\t: %" PRIs_SYSTEM "\n",
 			 provider_identifier );
 		}
@@ -2293,8 +3186,8 @@ int export_handle_export_record_text(
 
 			goto on_error;
 		}
-		fprintf(
-		 export_handle->notify_stream,
+		evtxtools_output_buffer_printf(
+		 export_job->output_buffer,
 		 "Source name\t\t\t: %" PRIs_SYSTEM "\n",
 		 source_name );
 	}
@@ -2314,22 +3207,33 @@ int export_handle_export_record_text(
 
 		goto on_error;
 	}
-	fprintf(
-	 export_handle->notify_stream,
+	evtxtools_output_buffer_printf(
+	 export_job->output_buffer,
 	 "Event identifier\t\t: 0x%08" PRIx32 " (%" PRIu32 ")\n",
 	 event_identifier,
 	 event_identifier );
 
-	if( export_handle_export_record_event_message(
-	     export_handle,
-	     record,
-	     provider_identifier,
-	     provider_identifier_size - 1,
-	     source_name,
-	     source_name_size - 1,
-	     event_identifier,
-	     log_handle,
-	     error ) != 1 )
+	start_time = profile_handle_start_phase(
+	              export_handle->profile_handle );
+
+	result = export_handle_export_record_event_message(
+	          export_handle,
+	          record,
+	          export_job->output_buffer,
+	          provider_identifier,
+	          provider_identifier_size - 1,
+	          source_name,
+	          source_name_size - 1,
+	          event_identifier,
+	          log_handle,
+	          error );
+
+	profile_handle_end_phase(
+	 export_handle->profile_handle,
+	 PROFILE_HANDLE_PHASE_EVENT_MESSAGE,
+	 start_time );
+
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -2340,8 +3244,8 @@ int export_handle_export_record_text(
 
 		goto on_error;
 	}
-	fprintf(
-	 export_handle->notify_stream,
+	evtxtools_output_buffer_printf(
+	 export_job->output_buffer,
 	 "\n" );
 
 	if( provider_identifier != NULL )
@@ -2385,126 +3289,1164 @@ on_error:
 	return( -1 );
 }
 
-/* Exports the record in the XML format
- * Returns 1 if successful or -1 on error
- */
-int export_handle_export_record_xml(
-     export_handle_t *export_handle,
-     libevtx_record_t *record,
-     log_handle_t *log_handle,
-     libcerror_error_t **error )
-{
-	system_character_t *event_xml = NULL;
-	static char *function         = "export_handle_export_record_xml";
-	size_t event_xml_size         = 0;
+/* Exports the record in the XML format
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_record_xml(
+     export_handle_t *export_handle,
+     export_job_t *export_job,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	libevtx_record_t *record = NULL;
+	static char *function    = "export_handle_export_record_xml";
+	size_t event_xml_length  = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export job.",
+		 function );
+
+		return( -1 );
+	}
+	record = export_job->record;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export job - missing record.",
+		 function );
+
+		return( -1 );
+	}
+	/* The event XML buffer of the export job is reused for all records
+	 * so that the XML is rendered only once per record
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libevtx_record_get_utf16_xml_string_buffer(
+	     record,
+	     (uint16_t **) &( export_job->event_xml ),
+	     &( export_job->event_xml_size ),
+	     &event_xml_length,
+	     error ) != 1 )
+#else
+	if( libevtx_record_get_utf8_xml_string_buffer(
+	     record,
+	     (uint8_t **) &( export_job->event_xml ),
+	     &( export_job->event_xml_size ),
+	     &event_xml_length,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event XML.",
+		 function );
+
+		return( -1 );
+	}
+	if( event_xml_length > 0 )
+	{
+		/* Note that the event XML ends with a new line
+		 */
+		evtxtools_output_buffer_printf(
+		 export_job->output_buffer,
+		 "%" PRIs_SYSTEM "",
+		 export_job->event_xml );
+	}
+	evtxtools_output_buffer_printf(
+	 export_job->output_buffer,
+	 "\n" );
+
+	return( 1 );
+}
+
+/* Exports the record in the JSON format
+ * In the JSON format the records are elements of a single array,
+ * in the JSON lines format every record is written on a separate line
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_record_json(
+     export_handle_t *export_handle,
+     export_job_t *export_job,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	libevtx_record_t *record = NULL;
+	uint8_t *event_json      = NULL;
+	static char *function    = "export_handle_export_record_json";
+	size_t event_json_size   = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export job.",
+		 function );
+
+		return( -1 );
+	}
+	record = export_job->record;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export job - missing record.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_record_get_utf8_json_string_size(
+	     record,
+	     &event_json_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event JSON size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( event_json_size == 0 )
+	 || ( event_json_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid event JSON size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The event JSON buffer of the export job is reused for all records
+	 */
+	if( event_json_size > export_job->event_json_size )
+	{
+		event_json = (uint8_t *) memory_reallocate(
+		                          export_job->event_json,
+		                          sizeof( uint8_t ) * event_json_size );
+
+		if( event_json == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize event JSON.",
+			 function );
+
+			return( -1 );
+		}
+		export_job->event_json      = event_json;
+		export_job->event_json_size = event_json_size;
+	}
+	if( libevtx_record_get_utf8_json_string(
+	     record,
+	     export_job->event_json,
+	     event_json_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event JSON.",
+		 function );
+
+		return( -1 );
+	}
+	/* The JSON string is UTF-8 encoded and written as-is, the separator
+	 * between the elements of the JSON array is written with the record
+	 * by export_handle_write_export_job
+	 */
+	if( evtxtools_output_buffer_append(
+	     export_job->output_buffer,
+	     export_job->event_json,
+	     event_json_size - 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append event JSON to output buffer.",
+		 function );
+
+		return( -1 );
+	}
+
+	if( export_handle->export_format == EXPORT_FORMAT_JSONL )
+	{
+		evtxtools_output_buffer_printf(
+		 export_job->output_buffer,
+		 "\n" );
+	}
+	return( 1 );
+}
+
+/* Starts the export jobs
+ * When multiple threads are used the records are exported by a thread pool,
+ * otherwise by the calling thread
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_start_export_jobs(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function     = "export_handle_start_export_jobs";
+	size_t export_jobs_size   = 0;
+	int export_job_index      = 0;
+	int number_of_export_jobs = 1;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->export_jobs != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle - export jobs value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( export_handle->number_of_threads > 1 )
+	{
+		/* Queue twice the number of threads so that the workers
+		 * do not have to wait for the records to be written
+		 */
+		number_of_export_jobs = 2 * export_handle->number_of_threads;
+
+		if( number_of_export_jobs > EXPORT_HANDLE_MAXIMUM_NUMBER_OF_EXPORT_JOBS )
+		{
+			number_of_export_jobs = EXPORT_HANDLE_MAXIMUM_NUMBER_OF_EXPORT_JOBS;
+		}
+	}
+#endif
+	export_jobs_size = sizeof( export_job_t * ) * number_of_export_jobs;
+
+	export_handle->export_jobs = (export_job_t **) memory_allocate(
+	                                                export_jobs_size );
+
+	if( export_handle->export_jobs == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create export jobs.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     export_handle->export_jobs,
+	     0,
+	     export_jobs_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear export jobs.",
+		 function );
+
+		memory_free(
+		 export_handle->export_jobs );
+
+		export_handle->export_jobs = NULL;
+
+		return( -1 );
+	}
+	export_handle->number_of_export_jobs        = number_of_export_jobs;
+	export_handle->first_export_job_index       = 0;
+	export_handle->number_of_queued_export_jobs = 0;
+
+	for( export_job_index = 0;
+	     export_job_index < number_of_export_jobs;
+	     export_job_index++ )
+	{
+		if( export_job_initialize(
+		     &( export_handle->export_jobs[ export_job_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create export job: %d.",
+			 function,
+			 export_job_index );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( export_handle->number_of_threads > 1 )
+	{
+		if( libcthreads_mutex_initialize(
+		     &( export_handle->export_jobs_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create export jobs mutex.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcthreads_condition_initialize(
+		     &( export_handle->export_jobs_condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create export jobs condition.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcthreads_mutex_initialize(
+		     &( export_handle->message_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create message mutex.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcthreads_thread_pool_create(
+		     &( export_handle->export_jobs_thread_pool ),
+		     NULL,
+		     export_handle->number_of_threads,
+		     number_of_export_jobs,
+		     (int (*)(intptr_t *, void *)) &export_handle_process_export_job_callback,
+		     (void *) export_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create export jobs thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	return( 1 );
+
+on_error:
+	export_handle_stop_export_jobs(
+	 export_handle,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Stops the export jobs
+ * Records of export jobs that were not written are discarded
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_stop_export_jobs(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_stop_export_jobs";
+	int export_job_index  = 0;
+	int result            = 1;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( export_handle->export_jobs_thread_pool != NULL )
+	{
+		if( libcthreads_thread_pool_join(
+		     &( export_handle->export_jobs_thread_pool ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join export jobs thread pool.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( export_handle->message_mutex != NULL )
+	{
+		if( libcthreads_mutex_free(
+		     &( export_handle->message_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free message mutex.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( export_handle->export_jobs_condition != NULL )
+	{
+		if( libcthreads_condition_free(
+		     &( export_handle->export_jobs_condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free export jobs condition.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( export_handle->export_jobs_mutex != NULL )
+	{
+		if( libcthreads_mutex_free(
+		     &( export_handle->export_jobs_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free export jobs mutex.",
+			 function );
+
+			result = -1;
+		}
+	}
+#endif
+	if( export_handle->export_jobs != NULL )
+	{
+		for( export_job_index = 0;
+		     export_job_index < export_handle->number_of_export_jobs;
+		     export_job_index++ )
+		{
+			if( export_handle->export_jobs[ export_job_index ] == NULL )
+			{
+				continue;
+			}
+			if( export_job_free(
+			     &( export_handle->export_jobs[ export_job_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free export job: %d.",
+				 function,
+				 export_job_index );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 export_handle->export_jobs );
+
+		export_handle->export_jobs = NULL;
+	}
+	export_handle->number_of_export_jobs        = 0;
+	export_handle->first_export_job_index       = 0;
+	export_handle->number_of_queued_export_jobs = 0;
+
+	return( result );
+}
+
+/* Processes an export job
+ * Errors exporting the record are stored in the result of the export job
+ * and are reported when the export job is written
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_process_export_job(
+     export_handle_t *export_handle,
+     export_job_t *export_job,
+     libcerror_error_t **error )
+{
+	libcerror_error_t *export_error = NULL;
+	static char *function           = "export_handle_process_export_job";
+	uint64_t start_time             = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export job.",
+		 function );
+
+		return( -1 );
+	}
+	start_time = profile_handle_start_phase(
+	              export_handle->profile_handle );
+
+	export_job->result = export_handle_export_record(
+	                      export_handle,
+	                      export_job,
+	                      export_job->log_handle,
+	                      &export_error );
+
+	profile_handle_end_phase(
+	 export_handle->profile_handle,
+	 PROFILE_HANDLE_PHASE_RECORD_EXPORT,
+	 start_time );
+
+	if( export_job->result != 1 )
+	{
+		if( export_job->is_recovered != 0 )
+		{
+			libcerror_error_set(
+			 &export_error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export recovered record: %d.",
+			 function,
+			 export_job->record_index );
+		}
+		else
+		{
+			libcerror_error_set(
+			 &export_error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export record: %d.",
+			 function,
+			 export_job->record_index );
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		libcnotify_print_error_backtrace(
+		 export_error );
+#endif
+		libcerror_error_free(
+		 &export_error );
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Callback function to process an export job in the thread pool
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_process_export_job_callback(
+     export_job_t *export_job,
+     export_handle_t *export_handle )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "export_handle_process_export_job_callback";
+	int result               = 1;
+
+	if( export_handle == NULL )
+	{
+		return( -1 );
+	}
+	if( export_job == NULL )
+	{
+		return( -1 );
+	}
+	if( export_handle_process_export_job(
+	     export_handle,
+	     export_job,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to process export job.",
+		 function );
+
+		export_job->result = -1;
+
+		result = -1;
+	}
+	/* The export job is always marked as processed otherwise the writer
+	 * would wait for it indefinitely
+	 */
+	if( libcthreads_mutex_grab(
+	     export_handle->export_jobs_mutex,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab export jobs mutex.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		export_job->is_processed = 1;
+
+		if( libcthreads_condition_broadcast(
+		     export_handle->export_jobs_condition,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to broadcast export jobs condition.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_release(
+		     export_handle->export_jobs_mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release export jobs mutex.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( error != NULL )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		libcnotify_print_error_backtrace(
+		 error );
+#endif
+		libcerror_error_free(
+		 &error );
+	}
+	return( result );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Writes the buffered output to the notification output stream
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_flush_output_buffer(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_flush_output_buffer";
+	uint64_t start_time   = 0;
+	int result            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	start_time = profile_handle_start_phase(
+	              export_handle->profile_handle );
+
+	result = evtxtools_output_buffer_write_to_stream(
+	          export_handle->output_buffer,
+	          export_handle->notify_stream,
+	          error );
+
+	profile_handle_end_phase(
+	 export_handle->profile_handle,
+	 PROFILE_HANDLE_PHASE_OUTPUT,
+	 start_time );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes the first queued export job
+ * Waits for the export job to be processed, so that the records are written
+ * in the order they were queued
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_write_next_export_job(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	export_job_t *export_job = NULL;
+	static char *function    = "export_handle_write_next_export_job";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->export_jobs == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle - missing export jobs.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->number_of_queued_export_jobs <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid export handle - no queued export jobs.",
+		 function );
+
+		return( -1 );
+	}
+	export_job = export_handle->export_jobs[ export_handle->first_export_job_index ];
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( export_handle->export_jobs_thread_pool != NULL )
+	{
+		if( libcthreads_mutex_grab(
+		     export_handle->export_jobs_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab export jobs mutex.",
+			 function );
+
+			return( -1 );
+		}
+		while( export_job->is_processed == 0 )
+		{
+			if( libcthreads_condition_wait(
+			     export_handle->export_jobs_condition,
+			     export_handle->export_jobs_mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to wait for export jobs condition.",
+				 function );
+
+				libcthreads_mutex_release(
+				 export_handle->export_jobs_mutex,
+				 NULL );
+
+				return( -1 );
+			}
+		}
+		if( libcthreads_mutex_release(
+		     export_handle->export_jobs_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release export jobs mutex.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	/* The separator between the elements of the JSON array depends on
+	 * the preceding records and is therefore written here
+	 */
+	if( ( export_job->result == 1 )
+	 && ( export_handle->export_format == EXPORT_FORMAT_JSON ) )
+	{
+		if( export_handle->number_of_json_records > 0 )
+		{
+			evtxtools_output_buffer_printf(
+			 export_handle->output_buffer,
+			 ",\n" );
+		}
+		export_handle->number_of_json_records += 1;
+	}
+	/* Discard the partial JSON output of a record that could not be exported
+	 */
+	if( ( export_job->result != 1 )
+	 && ( ( export_handle->export_format == EXPORT_FORMAT_JSON )
+	  || ( export_handle->export_format == EXPORT_FORMAT_JSONL ) ) )
+	{
+		export_job->output_buffer->data_offset = 0;
+	}
+	if( export_job->output_buffer->data_offset > 0 )
+	{
+		if( evtxtools_output_buffer_append(
+		     export_handle->output_buffer,
+		     export_job->output_buffer->data,
+		     export_job->output_buffer->data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append export job output to output buffer.",
+			 function );
+
+			return( -1 );
+		}
+		export_job->output_buffer->data_offset = 0;
+	}
+	if( export_job->result != 1 )
+	{
+		/* The JSON output is intended to be parsed, hence the message
+		 * is written to stderr instead of the output buffer
+		 */
+		if( ( export_handle->export_format == EXPORT_FORMAT_JSON )
+		 || ( export_handle->export_format == EXPORT_FORMAT_JSONL ) )
+		{
+			if( export_job->is_recovered != 0 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to export recovered record: %d.\n",
+				 export_job->record_index );
+			}
+			else
+			{
+				fprintf(
+				 stderr,
+				 "Unable to export record: %d.\n",
+				 export_job->record_index );
+			}
+		}
+		else if( export_job->is_recovered != 0 )
+		{
+			evtxtools_output_buffer_printf(
+			 export_handle->output_buffer,
+			 "Unable to export recovered record: %d.\n\n",
+			 export_job->record_index );
+		}
+		else
+		{
+			evtxtools_output_buffer_printf(
+			 export_handle->output_buffer,
+			 "Unable to export record: %d.\n\n",
+			 export_job->record_index );
+		}
+	}
+	if( export_handle->output_buffer->data_offset >= export_handle->output_buffer_size )
+	{
+		if( export_handle_flush_output_buffer(
+		     export_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush output buffer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( export_job_free_record(
+	     export_job,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free record of export job.",
+		 function );
+
+		return( -1 );
+	}
+	export_handle->first_export_job_index += 1;
+
+	if( export_handle->first_export_job_index >= export_handle->number_of_export_jobs )
+	{
+		export_handle->first_export_job_index = 0;
+	}
+	export_handle->number_of_queued_export_jobs -= 1;
+
+	return( 1 );
+}
+
+/* Queues a record to be exported
+ * The export handle takes over management of the record
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_queue_record(
+     export_handle_t *export_handle,
+     libevtx_record_t **record,
+     int record_index,
+     uint8_t is_recovered,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	export_job_t *export_job = NULL;
+	static char *function    = "export_handle_queue_record";
+	int export_job_index     = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->export_jobs == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle - missing export jobs.",
+		 function );
+
+		return( -1 );
+	}
+	/* If all export jobs are in use wait for the first one to be written
+	 */
+	if( export_handle->number_of_queued_export_jobs >= export_handle->number_of_export_jobs )
+	{
+		if( export_handle_write_next_export_job(
+		     export_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to write export job.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	export_job_index = ( export_handle->first_export_job_index + export_handle->number_of_queued_export_jobs )
+	                 % export_handle->number_of_export_jobs;
+
+	export_job = export_handle->export_jobs[ export_job_index ];
 
-	if( export_handle == NULL )
+	if( export_job_set_record(
+	     export_job,
+	     record,
+	     record_index,
+	     is_recovered,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid export handle.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set record in export job.",
 		 function );
 
 		return( -1 );
 	}
-	if( record == NULL )
+	export_job->log_handle = log_handle;
+
+	export_handle->number_of_queued_export_jobs += 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( export_handle->export_jobs_thread_pool != NULL )
+	{
+		if( libcthreads_thread_pool_push(
+		     export_handle->export_jobs_thread_pool,
+		     (intptr_t *) export_job,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to push export job onto thread pool.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+#endif
+	if( export_handle_process_export_job(
+	     export_handle,
+	     export_job,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to process export job.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	if( libevtx_record_get_utf16_xml_string_size(
-	     record,
-	     &event_xml_size,
-	     error ) != 1 )
-#else
-	if( libevtx_record_get_utf8_xml_string_size(
-	     record,
-	     &event_xml_size,
+	export_job->is_processed = 1;
+
+	if( export_handle_write_next_export_job(
+	     export_handle,
 	     error ) != 1 )
-#endif
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve event XML size.",
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to write export job.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( event_xml_size > 0 )
-	{
-		event_xml = system_string_allocate(
-		             event_xml_size );
+	return( 1 );
+}
 
-		if( event_xml == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create event XML.",
-			 function );
+/* Writes all queued export jobs
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_flush_export_jobs(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_flush_export_jobs";
 
-			goto on_error;
-		}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		if( libevtx_record_get_utf16_xml_string(
-		     record,
-		     (uint16_t *) event_xml,
-		     event_xml_size,
-		     error ) != 1 )
-#else
-		if( libevtx_record_get_utf8_xml_string(
-		     record,
-		     (uint8_t *) event_xml,
-		     event_xml_size,
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	while( export_handle->number_of_queued_export_jobs > 0 )
+	{
+		if( export_handle_write_next_export_job(
+		     export_handle,
 		     error ) != 1 )
-#endif
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve event XML.",
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to write export job.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		/* Note that the event XML ends with a new line
-		 */
-		fprintf(
-		 export_handle->notify_stream,
-		 "%" PRIs_SYSTEM "",
-		 event_xml );
-
-		memory_free(
-		 event_xml );
-
-		event_xml = NULL;
 	}
-	fprintf(
-	 export_handle->notify_stream,
-	 "\n" );
-
 	return( 1 );
-
-on_error:
-	if( event_xml != NULL )
-	{
-		memory_free(
-		 event_xml );
-	}
-	return( -1 );
 }
 
 /* Exports the records
@@ -2518,8 +4460,10 @@ int export_handle_export_records(
 {
 	libevtx_record_t *record = NULL;
 	static char *function   = "export_handle_export_records";
+	uint64_t start_time     = 0;
 	int number_of_records   = 0;
 	int record_index        = 0;
+	int result              = 0;
 
 	if( export_handle == NULL )
 	{
@@ -2569,11 +4513,21 @@ int export_handle_export_records(
 		{
 			return( -1 );
 		}
-		if( libevtx_file_get_record_by_index(
-		     file,
-		     record_index,
-		     &record,
-		     error ) != 1 )
+		start_time = profile_handle_start_phase(
+		              export_handle->profile_handle );
+
+		result = libevtx_file_get_record_by_index(
+		          file,
+		          record_index,
+		          &record,
+		          error );
+
+		profile_handle_end_phase(
+		 export_handle->profile_handle,
+		 PROFILE_HANDLE_PHASE_RECORD_RETRIEVAL,
+		 start_time );
+
+		if( result != 1 )
 		{
 			libcerror_error_set(
 			 error,
@@ -2585,52 +4539,51 @@ int export_handle_export_records(
 
 			return( -1 );
 		}
-		if( export_handle_export_record(
+		if( export_handle_queue_record(
 		     export_handle,
-		     record,
+		     &record,
+		     record_index,
+		     0,
 		     log_handle,
 		     error ) != 1 )
 		{
-			fprintf(
-			 export_handle->notify_stream,
-			 "Unable to export record: %d.\n\n",
-			 record_index );
-
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to export record: %d.",
+			 "%s: unable to queue record: %d.",
 			 function,
 			 record_index );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( ( error != NULL )
-			 && ( *error != NULL ) )
-			{
-				libcnotify_print_error_backtrace(
-				 *error );
-			}
-#endif
-			libcerror_error_free(
-			 error );
+			goto on_error;
 		}
-		if( libevtx_record_free(
-		     &record,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free record: %d.",
-			 function,
-			 record_index );
+	}
+	/* Write all queued records before the recovered records are retrieved
+	 * since these can reuse the cached record values
+	 */
+	if( export_handle_flush_export_jobs(
+	     export_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to write queued records.",
+		 function );
 
-			return( -1 );
-		}
+		return( -1 );
 	}
 	return( 1 );
+
+on_error:
+	if( record != NULL )
+	{
+		libevtx_record_free(
+		 &record,
+		 NULL );
+	}
+	return( -1 );
 }
 
 /* Exports the recovered records
@@ -2644,8 +4597,10 @@ int export_handle_export_recovered_records(
 {
 	libevtx_record_t *record = NULL;
 	static char *function   = "export_handle_export_recovered_records";
+	uint64_t start_time     = 0;
 	int number_of_records   = 0;
 	int record_index        = 0;
+	int result              = 0;
 
 	if( export_handle == NULL )
 	{
@@ -2695,11 +4650,21 @@ int export_handle_export_recovered_records(
 		{
 			return( -1 );
 		}
-		if( libevtx_file_get_recovered_record_by_index(
-		     file,
-		     record_index,
-		     &record,
-		     error ) != 1 )
+		start_time = profile_handle_start_phase(
+		              export_handle->profile_handle );
+
+		result = libevtx_file_get_recovered_record_by_index(
+		          file,
+		          record_index,
+		          &record,
+		          error );
+
+		profile_handle_end_phase(
+		 export_handle->profile_handle,
+		 PROFILE_HANDLE_PHASE_RECORD_RETRIEVAL,
+		 start_time );
+
+		if( result != 1 )
 		{
 			libcerror_error_set(
 			 error,
@@ -2720,52 +4685,48 @@ int export_handle_export_recovered_records(
 			libcerror_error_free(
 			 error );
 		}
-		else if( export_handle_export_record(
+		else if( export_handle_queue_record(
 		          export_handle,
-		          record,
+		          &record,
+		          record_index,
+		          1,
 		          log_handle,
 		          error ) != 1 )
 		{
-			fprintf(
-			 export_handle->notify_stream,
-			 "Unable to export recovered record: %d.\n\n",
-			 record_index );
-
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to export recovered record: %d.",
+			 "%s: unable to queue recovered record: %d.",
 			 function,
 			 record_index );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( ( error != NULL )
-			 && ( *error != NULL ) )
-			{
-				libcnotify_print_error_backtrace(
-				 *error );
-			}
-#endif
-			libcerror_error_free(
-			 error );
+			goto on_error;
 		}
-		if( libevtx_record_free(
-		     &record,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free record: %d.",
-			 function,
-			 record_index );
+	}
+	if( export_handle_flush_export_jobs(
+	     export_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to write queued recovered records.",
+		 function );
 
-			return( -1 );
-		}
+		return( -1 );
 	}
 	return( 1 );
+
+on_error:
+	if( record != NULL )
+	{
+		libevtx_record_free(
+		 &record,
+		 NULL );
+	}
+	return( -1 );
 }
 
 /* Exports the records from the file
@@ -2791,6 +4752,27 @@ int export_handle_export_file(
 
 		return( -1 );
 	}
+	if( export_handle_start_export_jobs(
+	     export_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to start export jobs.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->export_format == EXPORT_FORMAT_JSON )
+	{
+		export_handle->number_of_json_records = 0;
+
+		evtxtools_output_buffer_printf(
+		 export_handle->output_buffer,
+		 "[\n" );
+	}
 	if( export_handle->export_mode != EXPORT_MODE_RECOVERED )
 	{
 		result_records = export_handle_export_records(
@@ -2808,7 +4790,7 @@ int export_handle_export_file(
 			 "%s: unable to export records.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 	}
 	if( export_handle->export_mode != EXPORT_MODE_ITEMS )
@@ -2828,8 +4810,46 @@ int export_handle_export_file(
 			 "%s: unable to export recovered records.",
 			 function );
 
-			return( -1 );
+			goto on_error;
+		}
+	}
+	if( export_handle_stop_export_jobs(
+	     export_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to stop export jobs.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->export_format == EXPORT_FORMAT_JSON )
+	{
+		if( export_handle->number_of_json_records > 0 )
+		{
+			evtxtools_output_buffer_printf(
+			 export_handle->output_buffer,
+			 "\n" );
 		}
+		evtxtools_output_buffer_printf(
+		 export_handle->output_buffer,
+		 "]\n" );
+	}
+	if( export_handle_flush_output_buffer(
+	     export_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush output buffer.",
+		 function );
+
+		return( -1 );
 	}
 	if( ( result_records != 0 )
 	 || ( result_recovered_records != 0 ) )
@@ -2837,5 +4857,18 @@ int export_handle_export_file(
 		return( 1 );
 	}
 	return( 0 );
+
+on_error:
+	export_handle_stop_export_jobs(
+	 export_handle,
+	 NULL );
+
+	/* Write the records that were exported before the error or abort
+	 */
+	export_handle_flush_output_buffer(
+	 export_handle,
+	 NULL );
+
+	return( -1 );
 }
 
@@ -27,16 +27,31 @@
 #include <types.h>
 
 #include "evtxtools_libcerror.h"
+#include "evtxtools_libcthreads.h"
 #include "evtxtools_libevtx.h"
+#include "evtxtools_output.h"
+#include "export_job.h"
 #include "log_handle.h"
 #include "message_handle.h"
 #include "message_string.h"
+#include "profile_handle.h"
 #include "resource_file.h"
+#include "template_definition_cache.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+/* The maximum number of threads used to export records
+ */
+#define EXPORT_HANDLE_MAXIMUM_NUMBER_OF_THREADS		16
+
+/* The maximum number of export jobs that can be in progress
+ * This must be smaller than the number of records libevtx caches
+ * since the queued records reference the cached record values
+ */
+#define EXPORT_HANDLE_MAXIMUM_NUMBER_OF_EXPORT_JOBS	32
+
 enum EXPORT_MODES
 {
 	EXPORT_MODE_ALL				= (int) 'a',
@@ -46,6 +61,8 @@ enum EXPORT_MODES
 
 enum EXPORT_FORMATS
 {
+	EXPORT_FORMAT_JSON			= (int) 'j',
+	EXPORT_FORMAT_JSONL			= (int) 'l',
 	EXPORT_FORMAT_TEXT			= (int) 't',
 	EXPORT_FORMAT_XML			= (int) 'x'
 };
@@ -70,6 +87,10 @@ struct export_handle
 	 */
 	message_handle_t *message_handle;
 
+	/* The template definition cache
+	 */
+	template_definition_cache_t *template_definition_cache;
+
 	/* The event log type
 	 */
 	int event_log_type;
@@ -86,10 +107,62 @@ struct export_handle
 	 */
 	int ascii_codepage;
 
+	/* The number of records exported in the JSON format
+	 */
+	int number_of_json_records;
+
+	/* The number of threads used to export records
+	 */
+	int number_of_threads;
+
+	/* The export jobs, which are used as a ring buffer
+	 * so that the records are written in order
+	 */
+	export_job_t **export_jobs;
+
+	/* The number of export jobs
+	 */
+	int number_of_export_jobs;
+
+	/* The index of the first queued export job
+	 */
+	int first_export_job_index;
+
+	/* The number of queued export jobs
+	 */
+	int number_of_queued_export_jobs;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The thread pool that processes the export jobs
+	 */
+	libcthreads_thread_pool_t *export_jobs_thread_pool;
+
+	/* The mutex that protects the processed state of the export jobs
+	 */
+	libcthreads_mutex_t *export_jobs_mutex;
+
+	/* The condition that is signalled when an export job was processed
+	 */
+	libcthreads_condition_t *export_jobs_condition;
+
+	/* The mutex that serializes the event message resolution
+	 */
+	libcthreads_mutex_t *message_mutex;
+#endif
+
 	/* The notification output stream
 	 */
 	FILE *notify_stream;
 
+	/* The output buffer, which buffers the exported records
+	 * before they are written to the notification output stream
+	 */
+	evtxtools_output_buffer_t *output_buffer;
+
+	/* The output buffer size, when exceeded the output buffer is written
+	 */
+	size_t output_buffer_size;
+
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
@@ -97,6 +170,10 @@ struct export_handle
 	/* Value to indicate if the output should be verbose
 	 */
 	int verbose;
+
+	/* The profile handle, which is set when the export is profiled
+	 */
+	profile_handle_t *profile_handle;
 };
 
 const char *export_handle_get_event_log_key_name(
@@ -132,6 +209,21 @@ int export_handle_set_ascii_codepage(
      const system_character_t *string,
      libcerror_error_t **error );
 
+int export_handle_set_number_of_threads(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_set_output_buffer_size(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_set_resource_file_cache_capacity(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
 int export_handle_set_preferred_language_identifier(
      export_handle_t *export_handle,
      uint32_t preferred_language_identifier,
@@ -167,6 +259,26 @@ int export_handle_set_resource_files_path(
      const system_character_t *path,
      libcerror_error_t **error );
 
+int export_handle_set_preload_registry_keys(
+     export_handle_t *export_handle,
+     uint8_t preload_registry_keys,
+     libcerror_error_t **error );
+
+int export_handle_set_profile(
+     export_handle_t *export_handle,
+     uint8_t profile,
+     libcerror_error_t **error );
+
+int export_handle_profile_fprint(
+     export_handle_t *export_handle,
+     FILE *stream,
+     libcerror_error_t **error );
+
+int export_handle_open_message_catalog(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
 int export_handle_open_input(
      export_handle_t *export_handle,
      const system_character_t *filename,
@@ -201,9 +313,23 @@ int export_handle_message_string_fprint(
      libevtx_record_t *record,
      libcerror_error_t **error );
 
+int export_handle_resolve_record_event_message(
+     export_handle_t *export_handle,
+     libevtx_record_t *record,
+     evtxtools_output_buffer_t *output_buffer,
+     const system_character_t *event_provider_identifier,
+     size_t event_provider_identifier_length,
+     const system_character_t *event_source,
+     size_t event_source_length,
+     uint32_t event_identifier,
+     message_string_t **message_string,
+     libevtx_template_definition_t **template_definition,
+     libcerror_error_t **error );
+
 int export_handle_export_record_event_message(
      export_handle_t *export_handle,
      libevtx_record_t *record,
+     evtxtools_output_buffer_t *output_buffer,
      const system_character_t *event_provider_identifier,
      size_t event_provider_identifier_length,
      const system_character_t *event_source,
@@ -214,22 +340,69 @@ int export_handle_export_record_event_message(
 
 int export_handle_export_record(
      export_handle_t *export_handle,
-     libevtx_record_t *record,
+     export_job_t *export_job,
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
 int export_handle_export_record_text(
      export_handle_t *export_handle,
-     libevtx_record_t *record,
+     export_job_t *export_job,
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
 int export_handle_export_record_xml(
      export_handle_t *export_handle,
-     libevtx_record_t *record,
+     export_job_t *export_job,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+int export_handle_export_record_json(
+     export_handle_t *export_handle,
+     export_job_t *export_job,
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
+/* Export job functions
+ */
+int export_handle_start_export_jobs(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_stop_export_jobs(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_process_export_job(
+     export_handle_t *export_handle,
+     export_job_t *export_job,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+int export_handle_process_export_job_callback(
+     export_job_t *export_job,
+     export_handle_t *export_handle );
+#endif
+
+int export_handle_flush_output_buffer(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_write_next_export_job(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_queue_record(
+     export_handle_t *export_handle,
+     libevtx_record_t **record,
+     int record_index,
+     uint8_t is_recovered,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+int export_handle_flush_export_jobs(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
 /* File export functions
  */
 int export_handle_export_records(
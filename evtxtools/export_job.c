@@ -0,0 +1,290 @@
+/*
+ * Export job
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+#include "evtxtools_libevtx.h"
+#include "evtxtools_output.h"
+#include "export_job.h"
+
+/* Creates an export job
+ * Make sure the value export_job is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int export_job_initialize(
+     export_job_t **export_job,
+     libcerror_error_t **error )
+{
+	static char *function = "export_job_initialize";
+
+	if( export_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export job.",
+		 function );
+
+		return( -1 );
+	}
+	if( *export_job != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export job value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*export_job = memory_allocate_structure(
+	               export_job_t );
+
+	if( *export_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create export job.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *export_job,
+	     0,
+	     sizeof( export_job_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear export job.",
+		 function );
+
+		memory_free(
+		 *export_job );
+
+		*export_job = NULL;
+
+		return( -1 );
+	}
+	if( evtxtools_output_buffer_initialize(
+	     &( ( *export_job )->output_buffer ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create output buffer.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *export_job != NULL )
+	{
+		memory_free(
+		 *export_job );
+
+		*export_job = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an export job
+ * Returns 1 if successful or -1 on error
+ */
+int export_job_free(
+     export_job_t **export_job,
+     libcerror_error_t **error )
+{
+	static char *function = "export_job_free";
+	int result            = 1;
+
+	if( export_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export job.",
+		 function );
+
+		return( -1 );
+	}
+	if( *export_job != NULL )
+	{
+		if( ( *export_job )->record != NULL )
+		{
+			if( libevtx_record_free(
+			     &( ( *export_job )->record ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free record.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( evtxtools_output_buffer_free(
+		     &( ( *export_job )->output_buffer ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free output buffer.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *export_job )->event_xml != NULL )
+		{
+			memory_free(
+			 ( *export_job )->event_xml );
+		}
+		if( ( *export_job )->event_json != NULL )
+		{
+			memory_free(
+			 ( *export_job )->event_json );
+		}
+		memory_free(
+		 *export_job );
+
+		*export_job = NULL;
+	}
+	return( result );
+}
+
+/* Sets the record of an export job
+ * The export job takes over management of the record
+ * Returns 1 if successful or -1 on error
+ */
+int export_job_set_record(
+     export_job_t *export_job,
+     libevtx_record_t **record,
+     int record_index,
+     uint8_t is_recovered,
+     libcerror_error_t **error )
+{
+	static char *function = "export_job_set_record";
+
+	if( export_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export job.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_job->record != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export job - record value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	export_job->record       = *record;
+	export_job->record_index = record_index;
+	export_job->is_recovered = is_recovered;
+	export_job->result       = 0;
+	export_job->is_processed = 0;
+
+	export_job->output_buffer->data_offset = 0;
+
+	*record = NULL;
+
+	return( 1 );
+}
+
+/* Frees the record of an export job
+ * Returns 1 if successful or -1 on error
+ */
+int export_job_free_record(
+     export_job_t *export_job,
+     libcerror_error_t **error )
+{
+	static char *function = "export_job_free_record";
+
+	if( export_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export job.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_job->record != NULL )
+	{
+		if( libevtx_record_free(
+		     &( export_job->record ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record: %d.",
+			 function,
+			 export_job->record_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,110 @@
+/*
+ * Export job
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _EXPORT_JOB_H )
+#define _EXPORT_JOB_H
+
+#include <common.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+#include "evtxtools_libevtx.h"
+#include "evtxtools_output.h"
+#include "log_handle.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct export_job export_job_t;
+
+struct export_job
+{
+	/* The record index
+	 */
+	int record_index;
+
+	/* Value to indicate the record is a recovered record
+	 */
+	uint8_t is_recovered;
+
+	/* The record
+	 */
+	libevtx_record_t *record;
+
+	/* The log handle
+	 */
+	log_handle_t *log_handle;
+
+	/* The output buffer, which contains the formatted record
+	 */
+	evtxtools_output_buffer_t *output_buffer;
+
+	/* The event XML buffer, which is reused for every record
+	 */
+	system_character_t *event_xml;
+
+	/* The event XML buffer size
+	 */
+	size_t event_xml_size;
+
+	/* The event JSON buffer, which is reused for every record
+	 */
+	uint8_t *event_json;
+
+	/* The event JSON buffer size
+	 */
+	size_t event_json_size;
+
+	/* The result of exporting the record
+	 */
+	int result;
+
+	/* Value to indicate the job has been processed
+	 */
+	int is_processed;
+};
+
+int export_job_initialize(
+     export_job_t **export_job,
+     libcerror_error_t **error );
+
+int export_job_free(
+     export_job_t **export_job,
+     libcerror_error_t **error );
+
+int export_job_set_record(
+     export_job_t *export_job,
+     libevtx_record_t **record,
+     int record_index,
+     uint8_t is_recovered,
+     libcerror_error_t **error );
+
+int export_job_free_record(
+     export_job_t *export_job,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _EXPORT_JOB_H ) */
+
@@ -0,0 +1,1213 @@
+/*
+ * Generate chunk
+ *
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <byte_stream.h>
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+#include "generate_chunk.h"
+
+/* The maximum number of event records in a chunk, an event record is at least 32 bytes
+ */
+#define GENERATE_CHUNK_MAXIMUM_NUMBER_OF_RECORDS	( ( GENERATE_CHUNK_SIZE - GENERATE_CHUNK_HEADER_SIZE ) / 32 )
+
+const char *generate_chunk_names[ GENERATE_CHUNK_NUMBER_OF_NAMES ] = {
+	"Channel",
+	"Computer",
+	"Data",
+	"Event",
+	"EventData",
+	"EventID",
+	"EventRecordID",
+	"Execution",
+	"Keywords",
+	"Level",
+	"Name",
+	"Opcode",
+	"ProcessID",
+	"Provider",
+	"Qualifiers",
+	"Security",
+	"System",
+	"SystemTime",
+	"Task",
+	"ThreadID",
+	"TimeCreated",
+	"UserID",
+	"xmlns" };
+
+uint8_t generate_chunk_signature[ 8 ] = { 'E', 'l', 'f', 'C', 'h', 'n', 'k', 0 };
+
+uint8_t generate_chunk_record_signature[ 4 ] = { 0x2a, 0x2a, 0x00, 0x00 };
+
+/* Table of CRC-32 values of 8-bit values
+ */
+uint32_t generate_chunk_crc32_table[ 256 ];
+
+/* Value to indicate the CRC-32 table been computed
+ */
+int generate_chunk_crc32_table_computed = 0;
+
+/* Creates a chunk
+ * Make sure the value chunk is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int generate_chunk_initialize(
+     generate_chunk_t **chunk,
+     int number_of_templates,
+     libcerror_error_t **error )
+{
+	static char *function = "generate_chunk_initialize";
+
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunk != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid chunk value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_templates <= 0 )
+	 || ( (size_t) number_of_templates > (size_t) ( SSIZE_MAX / sizeof( uint32_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of templates value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*chunk = memory_allocate_structure(
+	          generate_chunk_t );
+
+	if( *chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create chunk.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *chunk,
+	     0,
+	     sizeof( generate_chunk_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear chunk.",
+		 function );
+
+		memory_free(
+		 *chunk );
+
+		*chunk = NULL;
+
+		return( -1 );
+	}
+	( *chunk )->data = (uint8_t *) memory_allocate(
+	                                sizeof( uint8_t ) * GENERATE_CHUNK_SIZE );
+
+	if( ( *chunk )->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	( *chunk )->template_offsets = (uint32_t *) memory_allocate(
+	                                             sizeof( uint32_t ) * number_of_templates );
+
+	if( ( *chunk )->template_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create template offsets.",
+		 function );
+
+		goto on_error;
+	}
+	( *chunk )->defined_templates = (int *) memory_allocate(
+	                                         sizeof( int ) * number_of_templates );
+
+	if( ( *chunk )->defined_templates == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create defined templates.",
+		 function );
+
+		goto on_error;
+	}
+	( *chunk )->record_offsets = (uint32_t *) memory_allocate(
+	                                           sizeof( uint32_t ) * GENERATE_CHUNK_MAXIMUM_NUMBER_OF_RECORDS );
+
+	if( ( *chunk )->record_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record offsets.",
+		 function );
+
+		goto on_error;
+	}
+	( *chunk )->record_sizes = (uint32_t *) memory_allocate(
+	                                         sizeof( uint32_t ) * GENERATE_CHUNK_MAXIMUM_NUMBER_OF_RECORDS );
+
+	if( ( *chunk )->record_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record sizes.",
+		 function );
+
+		goto on_error;
+	}
+	( *chunk )->record_has_definitions = (uint8_t *) memory_allocate(
+	                                                   sizeof( uint8_t ) * GENERATE_CHUNK_MAXIMUM_NUMBER_OF_RECORDS );
+
+	if( ( *chunk )->record_has_definitions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record has definitions.",
+		 function );
+
+		goto on_error;
+	}
+	( *chunk )->number_of_templates = number_of_templates;
+
+	return( 1 );
+
+on_error:
+	if( *chunk != NULL )
+	{
+		generate_chunk_free(
+		 chunk,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a chunk
+ * Returns 1 if successful or -1 on error
+ */
+int generate_chunk_free(
+     generate_chunk_t **chunk,
+     libcerror_error_t **error )
+{
+	static char *function = "generate_chunk_free";
+
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunk != NULL )
+	{
+		if( ( *chunk )->record_has_definitions != NULL )
+		{
+			memory_free(
+			 ( *chunk )->record_has_definitions );
+		}
+		if( ( *chunk )->record_sizes != NULL )
+		{
+			memory_free(
+			 ( *chunk )->record_sizes );
+		}
+		if( ( *chunk )->record_offsets != NULL )
+		{
+			memory_free(
+			 ( *chunk )->record_offsets );
+		}
+		if( ( *chunk )->defined_templates != NULL )
+		{
+			memory_free(
+			 ( *chunk )->defined_templates );
+		}
+		if( ( *chunk )->template_offsets != NULL )
+		{
+			memory_free(
+			 ( *chunk )->template_offsets );
+		}
+		if( ( *chunk )->data != NULL )
+		{
+			memory_free(
+			 ( *chunk )->data );
+		}
+		memory_free(
+		 *chunk );
+
+		*chunk = NULL;
+	}
+	return( 1 );
+}
+
+/* Clears a chunk for reuse
+ * Returns 1 if successful or -1 on error
+ */
+int generate_chunk_clear(
+     generate_chunk_t *chunk,
+     uint64_t chunk_number,
+     libcerror_error_t **error )
+{
+	static char *function = "generate_chunk_clear";
+
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     chunk->data,
+	     0,
+	     sizeof( uint8_t ) * GENERATE_CHUNK_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear data.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     chunk->template_offsets,
+	     0,
+	     sizeof( uint32_t ) * chunk->number_of_templates ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear template offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     chunk->name_offsets,
+	     0,
+	     sizeof( uint32_t ) * GENERATE_CHUNK_NUMBER_OF_NAMES ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear name offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     chunk->string_offsets,
+	     0,
+	     sizeof( uint32_t ) * 64 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear string offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     chunk->template_pointers,
+	     0,
+	     sizeof( uint32_t ) * 32 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear template pointers.",
+		 function );
+
+		return( -1 );
+	}
+	chunk->data_offset                 = GENERATE_CHUNK_HEADER_SIZE;
+	chunk->is_full                     = 0;
+	chunk->chunk_number                = chunk_number;
+	chunk->number_of_defined_templates = 0;
+	chunk->number_of_records           = 0;
+	chunk->first_record_identifier     = 0;
+	chunk->last_record_identifier      = 0;
+	chunk->free_space_offset           = GENERATE_CHUNK_HEADER_SIZE;
+
+	return( 1 );
+}
+
+/* Appends data to the chunk
+ * Data that does not fit in the chunk is not stored and marks the chunk as full
+ */
+void generate_chunk_append_data(
+      generate_chunk_t *chunk,
+      const uint8_t *data,
+      size_t data_size )
+{
+	if( ( chunk->is_full != 0 )
+	 || ( data_size > ( GENERATE_CHUNK_SIZE - chunk->data_offset ) ) )
+	{
+		chunk->is_full = 1;
+
+		return;
+	}
+	if( data_size > 0 )
+	{
+		memory_copy(
+		 &( chunk->data[ chunk->data_offset ] ),
+		 data,
+		 data_size );
+
+		chunk->data_offset += data_size;
+	}
+}
+
+/* Appends an 8-bit value to the chunk
+ */
+void generate_chunk_append_uint8(
+      generate_chunk_t *chunk,
+      uint8_t value )
+{
+	generate_chunk_append_data(
+	 chunk,
+	 &value,
+	 1 );
+}
+
+/* Appends a 16-bit little-endian value to the chunk
+ */
+void generate_chunk_append_uint16(
+      generate_chunk_t *chunk,
+      uint16_t value )
+{
+	uint8_t value_data[ 2 ];
+
+	byte_stream_copy_from_uint16_little_endian(
+	 value_data,
+	 value );
+
+	generate_chunk_append_data(
+	 chunk,
+	 value_data,
+	 2 );
+}
+
+/* Appends a 32-bit little-endian value to the chunk
+ */
+void generate_chunk_append_uint32(
+      generate_chunk_t *chunk,
+      uint32_t value )
+{
+	uint8_t value_data[ 4 ];
+
+	byte_stream_copy_from_uint32_little_endian(
+	 value_data,
+	 value );
+
+	generate_chunk_append_data(
+	 chunk,
+	 value_data,
+	 4 );
+}
+
+/* Appends a 64-bit little-endian value to the chunk
+ */
+void generate_chunk_append_uint64(
+      generate_chunk_t *chunk,
+      uint64_t value )
+{
+	uint8_t value_data[ 8 ];
+
+	byte_stream_copy_from_uint64_little_endian(
+	 value_data,
+	 value );
+
+	generate_chunk_append_data(
+	 chunk,
+	 value_data,
+	 8 );
+}
+
+/* Appends an ASCII string as an UTF-16 little-endian string without end-of-string character
+ */
+void generate_chunk_append_utf16_string(
+      generate_chunk_t *chunk,
+      const char *string,
+      size_t string_length )
+{
+	size_t string_index = 0;
+
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		generate_chunk_append_uint16(
+		 chunk,
+		 (uint16_t) (uint8_t) string[ string_index ] );
+	}
+}
+
+/* Sets a 32-bit little-endian value at a specific offset in the chunk
+ * The value is not set if the chunk is full
+ */
+void generate_chunk_set_uint32(
+      generate_chunk_t *chunk,
+      size_t data_offset,
+      uint32_t value )
+{
+	if( ( chunk->is_full != 0 )
+	 || ( ( data_offset + 4 ) > chunk->data_offset ) )
+	{
+		return;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( chunk->data[ data_offset ] ),
+	 value );
+}
+
+/* Appends a name offset and, the first time the name is used in the chunk, the name
+ * The name is linked into the common string offsets of the chunk header
+ */
+void generate_chunk_append_name(
+      generate_chunk_t *chunk,
+      int name_index )
+{
+	const char *name     = NULL;
+	size_t name_length   = 0;
+	size_t string_index  = 0;
+	uint32_t name_hash   = 0;
+	uint32_t name_offset = 0;
+	uint8_t bucket_index = 0;
+
+	name_offset = chunk->name_offsets[ name_index ];
+
+	if( name_offset != 0 )
+	{
+		generate_chunk_append_uint32(
+		 chunk,
+		 name_offset );
+
+		return;
+	}
+	name        = generate_chunk_names[ name_index ];
+	name_length = narrow_string_length(
+	               name );
+
+	for( string_index = 0;
+	     string_index < name_length;
+	     string_index++ )
+	{
+		name_hash = ( name_hash * 65599 ) + (uint8_t) name[ string_index ];
+	}
+	bucket_index = (uint8_t) ( name_hash % 64 );
+	name_offset  = (uint32_t) ( chunk->data_offset + 4 );
+
+	generate_chunk_append_uint32(
+	 chunk,
+	 name_offset );
+
+	/* The name starts with the offset of the next name in the same bucket
+	 */
+	generate_chunk_append_uint32(
+	 chunk,
+	 chunk->string_offsets[ bucket_index ] );
+
+	generate_chunk_append_uint16(
+	 chunk,
+	 (uint16_t) name_hash );
+
+	generate_chunk_append_uint16(
+	 chunk,
+	 (uint16_t) name_length );
+
+	generate_chunk_append_utf16_string(
+	 chunk,
+	 name,
+	 name_length );
+
+	generate_chunk_append_uint16(
+	 chunk,
+	 0 );
+
+	if( chunk->is_full == 0 )
+	{
+		chunk->name_offsets[ name_index ]    = name_offset;
+		chunk->string_offsets[ bucket_index ] = name_offset;
+	}
+}
+
+/* Appends an element start
+ * The element size must be set with generate_chunk_set_element_size after the end
+ * of the element and if the element has attributes the attribute list size must be
+ * set with generate_chunk_set_attribute_list_size after the last attribute
+ */
+void generate_chunk_append_element_start(
+      generate_chunk_t *chunk,
+      int name_index,
+      uint8_t has_attributes,
+      size_t *element_offset,
+      size_t *attribute_list_offset )
+{
+	*element_offset = chunk->data_offset;
+
+	if( has_attributes != 0 )
+	{
+		generate_chunk_append_uint8(
+		 chunk,
+		 0x41 );
+	}
+	else
+	{
+		generate_chunk_append_uint8(
+		 chunk,
+		 0x01 );
+	}
+	/* Dependency identifier, which is not set
+	 */
+	generate_chunk_append_uint16(
+	 chunk,
+	 0xffff );
+
+	generate_chunk_append_uint32(
+	 chunk,
+	 0 );
+
+	generate_chunk_append_name(
+	 chunk,
+	 name_index );
+
+	if( has_attributes != 0 )
+	{
+		*attribute_list_offset = chunk->data_offset;
+
+		generate_chunk_append_uint32(
+		 chunk,
+		 0 );
+	}
+}
+
+/* Sets the size of an element that ends at the current offset
+ * The size excludes the token, dependency identifier and size of the element start
+ */
+void generate_chunk_set_element_size(
+      generate_chunk_t *chunk,
+      size_t element_offset )
+{
+	generate_chunk_set_uint32(
+	 chunk,
+	 element_offset + 3,
+	 (uint32_t) ( chunk->data_offset - ( element_offset + 7 ) ) );
+}
+
+/* Sets the size of an attribute list that ends at the current offset
+ */
+void generate_chunk_set_attribute_list_size(
+      generate_chunk_t *chunk,
+      size_t attribute_list_offset )
+{
+	generate_chunk_set_uint32(
+	 chunk,
+	 attribute_list_offset,
+	 (uint32_t) ( chunk->data_offset - ( attribute_list_offset + 4 ) ) );
+}
+
+/* Appends an attribute, which must be followed by the attribute value
+ */
+void generate_chunk_append_attribute(
+      generate_chunk_t *chunk,
+      int name_index,
+      uint8_t is_last )
+{
+	if( is_last != 0 )
+	{
+		generate_chunk_append_uint8(
+		 chunk,
+		 0x06 );
+	}
+	else
+	{
+		generate_chunk_append_uint8(
+		 chunk,
+		 0x46 );
+	}
+	generate_chunk_append_name(
+	 chunk,
+	 name_index );
+}
+
+/* Appends a value text containing an ASCII string
+ */
+void generate_chunk_append_value_text(
+      generate_chunk_t *chunk,
+      const char *string )
+{
+	size_t string_length = 0;
+
+	string_length = narrow_string_length(
+	                 string );
+
+	generate_chunk_append_uint8(
+	 chunk,
+	 0x05 );
+
+	/* String value type
+	 */
+	generate_chunk_append_uint8(
+	 chunk,
+	 0x01 );
+
+	generate_chunk_append_uint16(
+	 chunk,
+	 (uint16_t) string_length );
+
+	generate_chunk_append_utf16_string(
+	 chunk,
+	 string,
+	 string_length );
+}
+
+/* Appends a normal (0x0d) or optional (0x0e) substitution
+ */
+void generate_chunk_append_substitution(
+      generate_chunk_t *chunk,
+      uint8_t token_type,
+      uint16_t substitution_identifier,
+      uint8_t value_type )
+{
+	generate_chunk_append_uint8(
+	 chunk,
+	 token_type );
+
+	generate_chunk_append_uint16(
+	 chunk,
+	 substitution_identifier );
+
+	generate_chunk_append_uint8(
+	 chunk,
+	 value_type );
+}
+
+/* Retrieves the offset of a template definition stored in the chunk
+ * Returns 1 if successful or 0 if the template is not stored in the chunk
+ */
+int generate_chunk_get_template_definition_offset(
+     generate_chunk_t *chunk,
+     int template_index,
+     uint32_t *template_definition_offset )
+{
+	if( ( template_index < 0 )
+	 || ( template_index >= chunk->number_of_templates ) )
+	{
+		return( 0 );
+	}
+	*template_definition_offset = chunk->template_offsets[ template_index ];
+
+	if( *template_definition_offset == 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Appends the header of a template definition, which must be followed by the template
+ * fragment and the size of the template definition must be set at data size offset
+ * The template definition is linked into the template pointers of the chunk header
+ */
+void generate_chunk_append_template_definition_header(
+      generate_chunk_t *chunk,
+      int template_index,
+      const uint8_t *template_identifier,
+      size_t *data_size_offset )
+{
+	uint32_t template_definition_offset = 0;
+	uint8_t bucket_index                = 0;
+
+	bucket_index               = template_identifier[ 0 ] % 32;
+	template_definition_offset = (uint32_t) chunk->data_offset;
+
+	/* The template definition starts with the offset of the next template definition
+	 * in the same bucket
+	 */
+	generate_chunk_append_uint32(
+	 chunk,
+	 chunk->template_pointers[ bucket_index ] );
+
+	generate_chunk_append_data(
+	 chunk,
+	 template_identifier,
+	 16 );
+
+	*data_size_offset = chunk->data_offset;
+
+	generate_chunk_append_uint32(
+	 chunk,
+	 0 );
+
+	if( chunk->is_full == 0 )
+	{
+		chunk->template_offsets[ template_index ]                          = template_definition_offset;
+		chunk->template_pointers[ bucket_index ]                           = template_definition_offset;
+		chunk->defined_templates[ chunk->number_of_defined_templates++ ] = template_index;
+	}
+}
+
+/* Starts an event record
+ */
+void generate_chunk_start_record(
+      generate_chunk_t *chunk,
+      uint64_t record_identifier,
+      uint64_t written_time,
+      size_t *record_offset )
+{
+	memory_copy(
+	 chunk->saved_string_offsets,
+	 chunk->string_offsets,
+	 sizeof( uint32_t ) * 64 );
+
+	memory_copy(
+	 chunk->saved_template_pointers,
+	 chunk->template_pointers,
+	 sizeof( uint32_t ) * 32 );
+
+	*record_offset = chunk->data_offset;
+
+	generate_chunk_append_data(
+	 chunk,
+	 generate_chunk_record_signature,
+	 4 );
+
+	/* The size is set when the event record is finished
+	 */
+	generate_chunk_append_uint32(
+	 chunk,
+	 0 );
+
+	generate_chunk_append_uint64(
+	 chunk,
+	 record_identifier );
+
+	generate_chunk_append_uint64(
+	 chunk,
+	 written_time );
+}
+
+/* Finishes an event record
+ * The event record is padded to a multiple of 8 bytes and ends with a copy of its size
+ * Returns 1 if successful or 0 if the event record does not fit in the chunk
+ */
+int generate_chunk_finish_record(
+     generate_chunk_t *chunk,
+     size_t record_offset,
+     uint64_t record_identifier )
+{
+	uint32_t record_size = 0;
+
+	while( ( chunk->is_full == 0 )
+	    && ( ( ( chunk->data_offset + 4 ) % 8 ) != 0 ) )
+	{
+		generate_chunk_append_uint8(
+		 chunk,
+		 0 );
+	}
+	record_size = (uint32_t) ( chunk->data_offset + 4 - record_offset );
+
+	generate_chunk_append_uint32(
+	 chunk,
+	 record_size );
+
+	if( ( chunk->is_full != 0 )
+	 || ( chunk->number_of_records >= GENERATE_CHUNK_MAXIMUM_NUMBER_OF_RECORDS ) )
+	{
+		generate_chunk_rollback(
+		 chunk,
+		 record_offset );
+
+		return( 0 );
+	}
+	generate_chunk_set_uint32(
+	 chunk,
+	 record_offset + 4,
+	 record_size );
+
+	if( chunk->number_of_records == 0 )
+	{
+		chunk->first_record_identifier = record_identifier;
+	}
+	chunk->last_record_identifier = record_identifier;
+
+	chunk->record_offsets[ chunk->number_of_records ] = (uint32_t) record_offset;
+	chunk->record_sizes[ chunk->number_of_records ]   = record_size;
+
+	/* A name or template definition changes the common string offsets or template pointers
+	 */
+	if( ( memory_compare(
+	       chunk->string_offsets,
+	       chunk->saved_string_offsets,
+	       sizeof( uint32_t ) * 64 ) != 0 )
+	 || ( memory_compare(
+	       chunk->template_pointers,
+	       chunk->saved_template_pointers,
+	       sizeof( uint32_t ) * 32 ) != 0 ) )
+	{
+		chunk->record_has_definitions[ chunk->number_of_records ] = 1;
+	}
+	else
+	{
+		chunk->record_has_definitions[ chunk->number_of_records ] = 0;
+	}
+
+	chunk->number_of_records += 1;
+	chunk->free_space_offset  = (uint32_t) chunk->data_offset;
+
+	return( 1 );
+}
+
+/* Removes the event record that starts at record offset and everything it stored in the chunk
+ */
+void generate_chunk_rollback(
+      generate_chunk_t *chunk,
+      size_t record_offset )
+{
+	int name_index     = 0;
+	int template_index = 0;
+
+	for( name_index = 0;
+	     name_index < GENERATE_CHUNK_NUMBER_OF_NAMES;
+	     name_index++ )
+	{
+		if( chunk->name_offsets[ name_index ] >= record_offset )
+		{
+			chunk->name_offsets[ name_index ] = 0;
+		}
+	}
+	while( chunk->number_of_defined_templates > 0 )
+	{
+		template_index = chunk->defined_templates[ chunk->number_of_defined_templates - 1 ];
+
+		if( chunk->template_offsets[ template_index ] < record_offset )
+		{
+			break;
+		}
+		chunk->template_offsets[ template_index ] = 0;
+
+		chunk->number_of_defined_templates -= 1;
+	}
+	memory_copy(
+	 chunk->string_offsets,
+	 chunk->saved_string_offsets,
+	 sizeof( uint32_t ) * 64 );
+
+	memory_copy(
+	 chunk->template_pointers,
+	 chunk->saved_template_pointers,
+	 sizeof( uint32_t ) * 32 );
+
+	memory_set(
+	 &( chunk->data[ record_offset ] ),
+	 0,
+	 chunk->data_offset - record_offset );
+
+	chunk->data_offset = record_offset;
+	chunk->is_full     = 0;
+}
+
+/* Appends a copy of an event record of the chunk after the free space offset
+ * Only event records that do not store name or template definitions can be copied,
+ * since the definitions are referenced by offset, the first event record from record
+ * index onwards that can be copied is used
+ * The copy is preceded by alignment padding size bytes of 0-byte values
+ * Returns 1 if successful or 0 if no copy fits in the chunk
+ */
+int generate_chunk_append_remnant(
+     generate_chunk_t *chunk,
+     int record_index,
+     size_t alignment_padding_size )
+{
+	size_t record_offset     = 0;
+	size_t record_size       = 0;
+	int number_of_iterations = 0;
+
+	if( ( record_index < 0 )
+	 || ( record_index >= chunk->number_of_records ) )
+	{
+		return( 0 );
+	}
+	while( chunk->record_has_definitions[ record_index ] != 0 )
+	{
+		number_of_iterations++;
+
+		if( number_of_iterations >= chunk->number_of_records )
+		{
+			return( 0 );
+		}
+		record_index++;
+
+		if( record_index >= chunk->number_of_records )
+		{
+			record_index = 0;
+		}
+	}
+	record_offset = (size_t) chunk->record_offsets[ record_index ];
+	record_size   = (size_t) chunk->record_sizes[ record_index ];
+
+	if( ( alignment_padding_size + record_size ) > ( GENERATE_CHUNK_SIZE - chunk->data_offset ) )
+	{
+		return( 0 );
+	}
+	chunk->data_offset += alignment_padding_size;
+
+	generate_chunk_append_data(
+	 chunk,
+	 &( chunk->data[ record_offset ] ),
+	 record_size );
+
+	return( 1 );
+}
+
+/* Calculates the CRC-32 of data
+ * Based on RFC 1952, the same as the CRC-32 used by libevtx
+ * Returns the CRC-32
+ */
+uint32_t generate_chunk_calculate_crc32(
+          const uint8_t *data,
+          size_t data_size,
+          uint32_t initial_value )
+{
+	size_t data_offset          = 0;
+	uint32_t crc32              = 0;
+	uint32_t crc32_table_index  = 0;
+	uint8_t bit_iterator        = 0;
+
+	if( generate_chunk_crc32_table_computed == 0 )
+	{
+		for( crc32_table_index = 0;
+		     crc32_table_index < 256;
+		     crc32_table_index++ )
+		{
+			crc32 = crc32_table_index;
+
+			for( bit_iterator = 0;
+			     bit_iterator < 8;
+			     bit_iterator++ )
+			{
+				if( ( crc32 & 1 ) != 0 )
+				{
+					crc32 = (uint32_t) 0xedb88320UL ^ ( crc32 >> 1 );
+				}
+				else
+				{
+					crc32 = crc32 >> 1;
+				}
+			}
+			generate_chunk_crc32_table[ crc32_table_index ] = crc32;
+		}
+		generate_chunk_crc32_table_computed = 1;
+	}
+	crc32 = initial_value ^ (uint32_t) 0xffffffffUL;
+
+	for( data_offset = 0;
+	     data_offset < data_size;
+	     data_offset++ )
+	{
+		crc32_table_index = ( crc32 ^ data[ data_offset ] ) & 0x000000ffUL;
+
+		crc32 = generate_chunk_crc32_table[ crc32_table_index ] ^ ( crc32 >> 8 );
+	}
+	return( crc32 ^ (uint32_t) 0xffffffffUL );
+}
+
+/* Finalizes the chunk by writing the chunk header
+ * Returns 1 if successful or -1 on error
+ */
+int generate_chunk_finalize(
+     generate_chunk_t *chunk,
+     libcerror_error_t **error )
+{
+	static char *function        = "generate_chunk_finalize";
+	uint32_t checksum            = 0;
+	uint32_t last_record_offset  = 0;
+	int table_index              = 0;
+
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk->number_of_records == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid chunk - missing event records.",
+		 function );
+
+		return( -1 );
+	}
+	last_record_offset = chunk->record_offsets[ chunk->number_of_records - 1 ];
+
+	if( memory_copy(
+	     chunk->data,
+	     generate_chunk_signature,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		return( -1 );
+	}
+	/* The event record numbers are the same as the event record identifiers
+	 */
+	byte_stream_copy_from_uint64_little_endian(
+	 &( chunk->data[ 8 ] ),
+	 chunk->first_record_identifier );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( chunk->data[ 16 ] ),
+	 chunk->last_record_identifier );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( chunk->data[ 24 ] ),
+	 chunk->first_record_identifier );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( chunk->data[ 32 ] ),
+	 chunk->last_record_identifier );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( chunk->data[ 40 ] ),
+	 128 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( chunk->data[ 44 ] ),
+	 last_record_offset );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( chunk->data[ 48 ] ),
+	 chunk->free_space_offset );
+
+	checksum = generate_chunk_calculate_crc32(
+	            &( chunk->data[ GENERATE_CHUNK_HEADER_SIZE ] ),
+	            chunk->free_space_offset - GENERATE_CHUNK_HEADER_SIZE,
+	            0 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( chunk->data[ 52 ] ),
+	 checksum );
+
+	for( table_index = 0;
+	     table_index < 64;
+	     table_index++ )
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 &( chunk->data[ 128 + ( table_index * 4 ) ] ),
+		 chunk->string_offsets[ table_index ] );
+	}
+	for( table_index = 0;
+	     table_index < 32;
+	     table_index++ )
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 &( chunk->data[ 384 + ( table_index * 4 ) ] ),
+		 chunk->template_pointers[ table_index ] );
+	}
+	checksum = generate_chunk_calculate_crc32(
+	            chunk->data,
+	            120,
+	            0 );
+
+	checksum = generate_chunk_calculate_crc32(
+	            &( chunk->data[ 128 ] ),
+	            384,
+	            checksum );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( chunk->data[ 124 ] ),
+	 checksum );
+
+	return( 1 );
+}
+
@@ -0,0 +1,280 @@
+/*
+ * Generate chunk
+ *
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _GENERATE_CHUNK_H )
+#define _GENERATE_CHUNK_H
+
+#include <common.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#define GENERATE_CHUNK_SIZE			65536
+#define GENERATE_CHUNK_HEADER_SIZE		512
+
+/* The names of the elements and attributes of the generated events
+ */
+enum GENERATE_CHUNK_NAMES
+{
+	GENERATE_CHUNK_NAME_CHANNEL,
+	GENERATE_CHUNK_NAME_COMPUTER,
+	GENERATE_CHUNK_NAME_DATA,
+	GENERATE_CHUNK_NAME_EVENT,
+	GENERATE_CHUNK_NAME_EVENT_DATA,
+	GENERATE_CHUNK_NAME_EVENT_IDENTIFIER,
+	GENERATE_CHUNK_NAME_EVENT_RECORD_IDENTIFIER,
+	GENERATE_CHUNK_NAME_EXECUTION,
+	GENERATE_CHUNK_NAME_KEYWORDS,
+	GENERATE_CHUNK_NAME_LEVEL,
+	GENERATE_CHUNK_NAME_NAME,
+	GENERATE_CHUNK_NAME_OPCODE,
+	GENERATE_CHUNK_NAME_PROCESS_IDENTIFIER,
+	GENERATE_CHUNK_NAME_PROVIDER,
+	GENERATE_CHUNK_NAME_QUALIFIERS,
+	GENERATE_CHUNK_NAME_SECURITY,
+	GENERATE_CHUNK_NAME_SYSTEM,
+	GENERATE_CHUNK_NAME_SYSTEM_TIME,
+	GENERATE_CHUNK_NAME_TASK,
+	GENERATE_CHUNK_NAME_THREAD_IDENTIFIER,
+	GENERATE_CHUNK_NAME_TIME_CREATED,
+	GENERATE_CHUNK_NAME_USER_IDENTIFIER,
+	GENERATE_CHUNK_NAME_XMLNS,
+
+	/* The number of names
+	 */
+	GENERATE_CHUNK_NUMBER_OF_NAMES
+};
+
+typedef struct generate_chunk generate_chunk_t;
+
+struct generate_chunk
+{
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The current data offset
+	 */
+	size_t data_offset;
+
+	/* Value to indicate data did not fit in the chunk
+	 */
+	int is_full;
+
+	/* The chunk number
+	 */
+	uint64_t chunk_number;
+
+	/* The offsets of the names, 0 if the name is not stored in the chunk
+	 */
+	uint32_t name_offsets[ GENERATE_CHUNK_NUMBER_OF_NAMES ];
+
+	/* The common string offsets (string table) of the chunk header
+	 */
+	uint32_t string_offsets[ 64 ];
+
+	/* The template definition offsets (template pointers) of the chunk header
+	 */
+	uint32_t template_pointers[ 32 ];
+
+	/* The common string offsets at the start of the current event record
+	 */
+	uint32_t saved_string_offsets[ 64 ];
+
+	/* The template definition offsets at the start of the current event record
+	 */
+	uint32_t saved_template_pointers[ 32 ];
+
+	/* The offsets of the template definitions, 0 if the template is not stored in the chunk
+	 */
+	uint32_t *template_offsets;
+
+	/* The number of templates
+	 */
+	int number_of_templates;
+
+	/* The templates stored in the chunk
+	 */
+	int *defined_templates;
+
+	/* The number of templates stored in the chunk
+	 */
+	int number_of_defined_templates;
+
+	/* The offsets of the event records
+	 */
+	uint32_t *record_offsets;
+
+	/* The sizes of the event records
+	 */
+	uint32_t *record_sizes;
+
+	/* Values to indicate the event records store a name or template definition
+	 */
+	uint8_t *record_has_definitions;
+
+	/* The number of event records
+	 */
+	int number_of_records;
+
+	/* The first event record identifier
+	 */
+	uint64_t first_record_identifier;
+
+	/* The last event record identifier
+	 */
+	uint64_t last_record_identifier;
+
+	/* The free space offset, which is the end of the last event record
+	 */
+	uint32_t free_space_offset;
+};
+
+int generate_chunk_initialize(
+     generate_chunk_t **chunk,
+     int number_of_templates,
+     libcerror_error_t **error );
+
+int generate_chunk_free(
+     generate_chunk_t **chunk,
+     libcerror_error_t **error );
+
+int generate_chunk_clear(
+     generate_chunk_t *chunk,
+     uint64_t chunk_number,
+     libcerror_error_t **error );
+
+void generate_chunk_append_data(
+      generate_chunk_t *chunk,
+      const uint8_t *data,
+      size_t data_size );
+
+void generate_chunk_append_uint8(
+      generate_chunk_t *chunk,
+      uint8_t value );
+
+void generate_chunk_append_uint16(
+      generate_chunk_t *chunk,
+      uint16_t value );
+
+void generate_chunk_append_uint32(
+      generate_chunk_t *chunk,
+      uint32_t value );
+
+void generate_chunk_append_uint64(
+      generate_chunk_t *chunk,
+      uint64_t value );
+
+void generate_chunk_append_utf16_string(
+      generate_chunk_t *chunk,
+      const char *string,
+      size_t string_length );
+
+void generate_chunk_set_uint32(
+      generate_chunk_t *chunk,
+      size_t data_offset,
+      uint32_t value );
+
+void generate_chunk_append_name(
+      generate_chunk_t *chunk,
+      int name_index );
+
+void generate_chunk_append_element_start(
+      generate_chunk_t *chunk,
+      int name_index,
+      uint8_t has_attributes,
+      size_t *element_offset,
+      size_t *attribute_list_offset );
+
+void generate_chunk_set_element_size(
+      generate_chunk_t *chunk,
+      size_t element_offset );
+
+void generate_chunk_set_attribute_list_size(
+      generate_chunk_t *chunk,
+      size_t attribute_list_offset );
+
+void generate_chunk_append_attribute(
+      generate_chunk_t *chunk,
+      int name_index,
+      uint8_t is_last );
+
+void generate_chunk_append_value_text(
+      generate_chunk_t *chunk,
+      const char *string );
+
+void generate_chunk_append_substitution(
+      generate_chunk_t *chunk,
+      uint8_t token_type,
+      uint16_t substitution_identifier,
+      uint8_t value_type );
+
+int generate_chunk_get_template_definition_offset(
+     generate_chunk_t *chunk,
+     int template_index,
+     uint32_t *template_definition_offset );
+
+void generate_chunk_append_template_definition_header(
+      generate_chunk_t *chunk,
+      int template_index,
+      const uint8_t *template_identifier,
+      size_t *data_size_offset );
+
+void generate_chunk_start_record(
+      generate_chunk_t *chunk,
+      uint64_t record_identifier,
+      uint64_t written_time,
+      size_t *record_offset );
+
+int generate_chunk_finish_record(
+     generate_chunk_t *chunk,
+     size_t record_offset,
+     uint64_t record_identifier );
+
+void generate_chunk_rollback(
+      generate_chunk_t *chunk,
+      size_t record_offset );
+
+int generate_chunk_append_remnant(
+     generate_chunk_t *chunk,
+     int record_index,
+     size_t alignment_padding_size );
+
+uint32_t generate_chunk_calculate_crc32(
+          const uint8_t *data,
+          size_t data_size,
+          uint32_t initial_value );
+
+int generate_chunk_finalize(
+     generate_chunk_t *chunk,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _GENERATE_CHUNK_H ) */
+
@@ -0,0 +1,2071 @@
+/*
+ * Generate handle
+ *
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <byte_stream.h>
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+#include "generate_chunk.h"
+#include "generate_handle.h"
+
+#define GENERATE_HANDLE_NOTIFY_STREAM		stdout
+
+#define GENERATE_HANDLE_FILE_HEADER_SIZE	4096
+
+/* The written time of the first record: 2019-03-20 10:40:00 as a FILETIME
+ */
+#define GENERATE_HANDLE_FIRST_WRITTEN_TIME	(uint64_t) 131976000000000000ULL
+
+uint8_t generate_handle_file_signature[ 8 ] = { 'E', 'l', 'f', 'F', 'i', 'l', 'e', 0 };
+
+/* The local system SID: S-1-5-18
+ */
+uint8_t generate_handle_local_system_sid[ 12 ] = {
+	0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x12, 0x00, 0x00, 0x00 };
+
+/* Creates a generate handle
+ * Make sure the value generate_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int generate_handle_initialize(
+     generate_handle_t **generate_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "generate_handle_initialize";
+
+	if( generate_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generate handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *generate_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid generate handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*generate_handle = memory_allocate_structure(
+	                    generate_handle_t );
+
+	if( *generate_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create generate handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *generate_handle,
+	     0,
+	     sizeof( generate_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear generate handle.",
+		 function );
+
+		memory_free(
+		 *generate_handle );
+
+		*generate_handle = NULL;
+
+		return( -1 );
+	}
+	if( generate_chunk_initialize(
+	     &( ( *generate_handle )->chunk ),
+	     GENERATE_HANDLE_NUMBER_OF_TEMPLATES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create chunk.",
+		 function );
+
+		goto on_error;
+	}
+	( *generate_handle )->number_of_chunks          = 1;
+	( *generate_handle )->template_reuse_percentage = 90;
+	( *generate_handle )->number_of_values          = 4;
+	( *generate_handle )->maximum_string_length     = 32;
+	( *generate_handle )->seed                      = 1;
+	( *generate_handle )->notify_stream             = GENERATE_HANDLE_NOTIFY_STREAM;
+
+	return( 1 );
+
+on_error:
+	if( *generate_handle != NULL )
+	{
+		memory_free(
+		 *generate_handle );
+
+		*generate_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a generate handle
+ * Returns 1 if successful or -1 on error
+ */
+int generate_handle_free(
+     generate_handle_t **generate_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "generate_handle_free";
+	int result            = 1;
+
+	if( generate_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generate handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *generate_handle != NULL )
+	{
+		if( ( *generate_handle )->output_stream != NULL )
+		{
+			if( file_stream_close(
+			     ( *generate_handle )->output_stream ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close output stream.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( generate_chunk_free(
+		     &( ( *generate_handle )->chunk ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free chunk.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *generate_handle );
+
+		*generate_handle = NULL;
+	}
+	return( result );
+}
+
+/* Signals the generate handle to abort
+ * Returns 1 if successful or -1 on error
+ */
+int generate_handle_signal_abort(
+     generate_handle_t *generate_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "generate_handle_signal_abort";
+
+	if( generate_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generate handle.",
+		 function );
+
+		return( -1 );
+	}
+	generate_handle->abort = 1;
+
+	return( 1 );
+}
+
+/* Copies a decimal value from a string
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int generate_handle_copy_decimal_from_string(
+     const system_character_t *string,
+     uint64_t maximum_value,
+     uint64_t *value,
+     libcerror_error_t **error )
+{
+	static char *function   = "generate_handle_copy_decimal_from_string";
+	size_t string_index     = 0;
+	size_t string_length    = 0;
+	uint64_t decimal_value  = 0;
+	uint8_t character_value = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( ( string_length == 0 )
+	 || ( string_length > 20 ) )
+	{
+		return( 0 );
+	}
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] < (system_character_t) '0' )
+		 || ( string[ string_index ] > (system_character_t) '9' ) )
+		{
+			return( 0 );
+		}
+		character_value = (uint8_t) ( string[ string_index ] - (system_character_t) '0' );
+
+		if( decimal_value > ( ( maximum_value - character_value ) / 10 ) )
+		{
+			return( 0 );
+		}
+		decimal_value *= 10;
+		decimal_value += character_value;
+	}
+	*value = decimal_value;
+
+	return( 1 );
+}
+
+/* Sets the number of chunks
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int generate_handle_set_number_of_chunks(
+     generate_handle_t *generate_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "generate_handle_set_number_of_chunks";
+	uint64_t value_64bit  = 0;
+	int result            = 0;
+
+	if( generate_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generate handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = generate_handle_copy_decimal_from_string(
+	          string,
+	          GENERATE_HANDLE_MAXIMUM_NUMBER_OF_CHUNKS,
+	          &value_64bit,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy decimal value from string.",
+		 function );
+
+		return( -1 );
+	}
+	else if( ( result != 0 )
+	      && ( value_64bit > 0 ) )
+	{
+		generate_handle->number_of_chunks = (int) value_64bit;
+
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Sets the maximum number of records per chunk
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int generate_handle_set_maximum_number_of_records_per_chunk(
+     generate_handle_t *generate_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "generate_handle_set_maximum_number_of_records_per_chunk";
+	uint64_t value_64bit  = 0;
+	int result            = 0;
+
+	if( generate_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generate handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = generate_handle_copy_decimal_from_string(
+	          string,
+	          ( GENERATE_CHUNK_SIZE - GENERATE_CHUNK_HEADER_SIZE ) / 32,
+	          &value_64bit,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy decimal value from string.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		generate_handle->maximum_number_of_records_per_chunk = (int) value_64bit;
+	}
+	return( result );
+}
+
+/* Sets the template reuse percentage
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int generate_handle_set_template_reuse_percentage(
+     generate_handle_t *generate_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "generate_handle_set_template_reuse_percentage";
+	uint64_t value_64bit  = 0;
+	int result            = 0;
+
+	if( generate_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generate handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = generate_handle_copy_decimal_from_string(
+	          string,
+	          100,
+	          &value_64bit,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy decimal value from string.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		generate_handle->template_reuse_percentage = (int) value_64bit;
+	}
+	return( result );
+}
+
+/* Sets the number of event data values per record
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int generate_handle_set_number_of_values(
+     generate_handle_t *generate_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "generate_handle_set_number_of_values";
+	uint64_t value_64bit  = 0;
+	int result            = 0;
+
+	if( generate_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generate handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = generate_handle_copy_decimal_from_string(
+	          string,
+	          GENERATE_HANDLE_MAXIMUM_NUMBER_OF_VALUES,
+	          &value_64bit,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy decimal value from string.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		generate_handle->number_of_values = (int) value_64bit;
+	}
+	return( result );
+}
+
+/* Sets the maximum number of characters of string values
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int generate_handle_set_maximum_string_length(
+     generate_handle_t *generate_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "generate_handle_set_maximum_string_length";
+	uint64_t value_64bit  = 0;
+	int result            = 0;
+
+	if( generate_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generate handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = generate_handle_copy_decimal_from_string(
+	          string,
+	          GENERATE_HANDLE_MAXIMUM_STRING_LENGTH,
+	          &value_64bit,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy decimal value from string.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		generate_handle->maximum_string_length = (int) value_64bit;
+	}
+	return( result );
+}
+
+/* Sets the number of record remnants per chunk
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int generate_handle_set_number_of_remnants(
+     generate_handle_t *generate_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "generate_handle_set_number_of_remnants";
+	uint64_t value_64bit  = 0;
+	int result            = 0;
+
+	if( generate_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generate handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = generate_handle_copy_decimal_from_string(
+	          string,
+	          ( GENERATE_CHUNK_SIZE - GENERATE_CHUNK_HEADER_SIZE ) / 32,
+	          &value_64bit,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy decimal value from string.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		generate_handle->number_of_remnants = (int) value_64bit;
+	}
+	return( result );
+}
+
+/* Sets the seed
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int generate_handle_set_seed(
+     generate_handle_t *generate_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "generate_handle_set_seed";
+	uint64_t value_64bit  = 0;
+	int result            = 0;
+
+	if( generate_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generate handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = generate_handle_copy_decimal_from_string(
+	          string,
+	          UINT64_MAX,
+	          &value_64bit,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy decimal value from string.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		generate_handle->seed = value_64bit;
+	}
+	return( result );
+}
+
+/* Retrieves the next pseudo random value
+ * This uses SplitMix64 so that the same seed results in the same file on every platform
+ * Returns the pseudo random value
+ */
+uint64_t generate_handle_get_random_value(
+          generate_handle_t *generate_handle )
+{
+	uint64_t value = 0;
+
+	generate_handle->random_state += (uint64_t) 0x9e3779b97f4a7c15ULL;
+
+	value = generate_handle->random_state;
+	value = ( value ^ ( value >> 30 ) ) * (uint64_t) 0xbf58476d1ce4e5b9ULL;
+	value = ( value ^ ( value >> 27 ) ) * (uint64_t) 0x94d049bb133111ebULL;
+
+	return( value ^ ( value >> 31 ) );
+}
+
+/* Retrieves the 16-byte identifier of a template
+ * The identifier only depends on the seed and template index and not on the order
+ * in which the templates are used
+ */
+void generate_handle_get_template_identifier(
+      generate_handle_t *generate_handle,
+      int template_index,
+      uint8_t *template_identifier )
+{
+	uint64_t random_state = 0;
+
+	random_state = generate_handle->random_state;
+
+	generate_handle->random_state = generate_handle->seed ^ ( (uint64_t) template_index << 32 );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 template_identifier,
+	 generate_handle_get_random_value(
+	  generate_handle ) );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( template_identifier[ 8 ] ),
+	 generate_handle_get_random_value(
+	  generate_handle ) );
+
+	generate_handle->random_state = random_state;
+}
+
+/* Appends a pseudo random UTF-16 little-endian string without end-of-string character
+ */
+void generate_handle_append_random_utf16_string(
+      generate_handle_t *generate_handle,
+      size_t string_length )
+{
+	size_t string_index = 0;
+	uint16_t character  = 0;
+
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		character = (uint16_t) 'a' + (uint16_t) ( generate_handle_get_random_value( generate_handle ) % 26 );
+
+		generate_chunk_append_uint16(
+		 generate_handle->chunk,
+		 character );
+	}
+}
+
+/* Appends an element without attributes that contains a single substitution
+ */
+void generate_handle_append_value_element(
+      generate_handle_t *generate_handle,
+      int name_index,
+      uint16_t substitution_identifier,
+      uint8_t value_type )
+{
+	size_t attribute_list_offset = 0;
+	size_t element_offset        = 0;
+
+	generate_chunk_append_element_start(
+	 generate_handle->chunk,
+	 name_index,
+	 0,
+	 &element_offset,
+	 &attribute_list_offset );
+
+	/* Close start element tag
+	 */
+	generate_chunk_append_uint8(
+	 generate_handle->chunk,
+	 0x02 );
+
+	generate_chunk_append_substitution(
+	 generate_handle->chunk,
+	 0x0d,
+	 substitution_identifier,
+	 value_type );
+
+	/* End element tag
+	 */
+	generate_chunk_append_uint8(
+	 generate_handle->chunk,
+	 0x04 );
+
+	generate_chunk_set_element_size(
+	 generate_handle->chunk,
+	 element_offset );
+}
+
+/* Appends the binary XML fragment of a template
+ * The templates all share the System element of an event but differ in the types
+ * and names of their event data values
+ */
+void generate_handle_append_template_fragment(
+      generate_handle_t *generate_handle,
+      int template_index )
+{
+	char data_name[ 32 ];
+
+	generate_chunk_t *chunk             = NULL;
+	size_t attribute_list_offset        = 0;
+	size_t element_offset               = 0;
+	size_t event_attribute_list_offset  = 0;
+	size_t event_data_element_offset    = 0;
+	size_t event_element_offset         = 0;
+	size_t system_attribute_list_offset = 0;
+	size_t system_element_offset        = 0;
+	int value_index                     = 0;
+	uint8_t value_type                  = 0;
+
+	chunk = generate_handle->chunk;
+
+	/* Fragment header
+	 */
+	generate_chunk_append_uint32(
+	 chunk,
+	 0x0001010fUL );
+
+	generate_chunk_append_element_start(
+	 chunk,
+	 GENERATE_CHUNK_NAME_EVENT,
+	 1,
+	 &event_element_offset,
+	 &event_attribute_list_offset );
+
+	generate_chunk_append_attribute(
+	 chunk,
+	 GENERATE_CHUNK_NAME_XMLNS,
+	 1 );
+
+	generate_chunk_append_value_text(
+	 chunk,
+	 "http://schemas.microsoft.com/win/2004/08/events/event" );
+
+	generate_chunk_set_attribute_list_size(
+	 chunk,
+	 event_attribute_list_offset );
+
+	generate_chunk_append_uint8(
+	 chunk,
+	 0x02 );
+
+	generate_chunk_append_element_start(
+	 chunk,
+	 GENERATE_CHUNK_NAME_SYSTEM,
+	 0,
+	 &system_element_offset,
+	 &system_attribute_list_offset );
+
+	generate_chunk_append_uint8(
+	 chunk,
+	 0x02 );
+
+	/* <Provider Name="%10"/>
+	 */
+	generate_chunk_append_element_start(
+	 chunk,
+	 GENERATE_CHUNK_NAME_PROVIDER,
+	 1,
+	 &element_offset,
+	 &attribute_list_offset );
+
+	generate_chunk_append_attribute(
+	 chunk,
+	 GENERATE_CHUNK_NAME_NAME,
+	 1 );
+
+	generate_chunk_append_substitution(
+	 chunk,
+	 0x0d,
+	 10,
+	 0x01 );
+
+	generate_chunk_set_attribute_list_size(
+	 chunk,
+	 attribute_list_offset );
+
+	generate_chunk_append_uint8(
+	 chunk,
+	 0x03 );
+
+	generate_chunk_set_element_size(
+	 chunk,
+	 element_offset );
+
+	/* <EventID Qualifiers="%9">%8</EventID>
+	 */
+	generate_chunk_append_element_start(
+	 chunk,
+	 GENERATE_CHUNK_NAME_EVENT_IDENTIFIER,
+	 1,
+	 &element_offset,
+	 &attribute_list_offset );
+
+	generate_chunk_append_attribute(
+	 chunk,
+	 GENERATE_CHUNK_NAME_QUALIFIERS,
+	 1 );
+
+	generate_chunk_append_substitution(
+	 chunk,
+	 0x0e,
+	 9,
+	 0x06 );
+
+	generate_chunk_set_attribute_list_size(
+	 chunk,
+	 attribute_list_offset );
+
+	generate_chunk_append_uint8(
+	 chunk,
+	 0x02 );
+
+	generate_chunk_append_substitution(
+	 chunk,
+	 0x0d,
+	 8,
+	 0x06 );
+
+	generate_chunk_append_uint8(
+	 chunk,
+	 0x04 );
+
+	generate_chunk_set_element_size(
+	 chunk,
+	 element_offset );
+
+	generate_handle_append_value_element(
+	 generate_handle,
+	 GENERATE_CHUNK_NAME_LEVEL,
+	 0,
+	 0x04 );
+
+	generate_handle_append_value_element(
+	 generate_handle,
+	 GENERATE_CHUNK_NAME_TASK,
+	 1,
+	 0x06 );
+
+	generate_handle_append_value_element(
+	 generate_handle,
+	 GENERATE_CHUNK_NAME_OPCODE,
+	 2,
+	 0x04 );
+
+	generate_handle_append_value_element(
+	 generate_handle,
+	 GENERATE_CHUNK_NAME_KEYWORDS,
+	 3,
+	 0x15 );
+
+	/* <TimeCreated SystemTime="%4"/>
+	 */
+	generate_chunk_append_element_start(
+	 chunk,
+	 GENERATE_CHUNK_NAME_TIME_CREATED,
+	 1,
+	 &element_offset,
+	 &attribute_list_offset );
+
+	generate_chunk_append_attribute(
+	 chunk,
+	 GENERATE_CHUNK_NAME_SYSTEM_TIME,
+	 1 );
+
+	generate_chunk_append_substitution(
+	 chunk,
+	 0x0d,
+	 4,
+	 0x11 );
+
+	generate_chunk_set_attribute_list_size(
+	 chunk,
+	 attribute_list_offset );
+
+	generate_chunk_append_uint8(
+	 chunk,
+	 0x03 );
+
+	generate_chunk_set_element_size(
+	 chunk,
+	 element_offset );
+
+	generate_handle_append_value_element(
+	 generate_handle,
+	 GENERATE_CHUNK_NAME_EVENT_RECORD_IDENTIFIER,
+	 5,
+	 0x0a );
+
+	/* <Execution ProcessID="%6" ThreadID="%7"/>
+	 */
+	generate_chunk_append_element_start(
+	 chunk,
+	 GENERATE_CHUNK_NAME_EXECUTION,
+	 1,
+	 &element_offset,
+	 &attribute_list_offset );
+
+	generate_chunk_append_attribute(
+	 chunk,
+	 GENERATE_CHUNK_NAME_PROCESS_IDENTIFIER,
+	 0 );
+
+	generate_chunk_append_substitution(
+	 chunk,
+	 0x0d,
+	 6,
+	 0x08 );
+
+	generate_chunk_append_attribute(
+	 chunk,
+	 GENERATE_CHUNK_NAME_THREAD_IDENTIFIER,
+	 1 );
+
+	generate_chunk_append_substitution(
+	 chunk,
+	 0x0d,
+	 7,
+	 0x08 );
+
+	generate_chunk_set_attribute_list_size(
+	 chunk,
+	 attribute_list_offset );
+
+	generate_chunk_append_uint8(
+	 chunk,
+	 0x03 );
+
+	generate_chunk_set_element_size(
+	 chunk,
+	 element_offset );
+
+	generate_handle_append_value_element(
+	 generate_handle,
+	 GENERATE_CHUNK_NAME_CHANNEL,
+	 11,
+	 0x01 );
+
+	generate_handle_append_value_element(
+	 generate_handle,
+	 GENERATE_CHUNK_NAME_COMPUTER,
+	 12,
+	 0x01 );
+
+	/* <Security UserID="%13"/>
+	 */
+	generate_chunk_append_element_start(
+	 chunk,
+	 GENERATE_CHUNK_NAME_SECURITY,
+	 1,
+	 &element_offset,
+	 &attribute_list_offset );
+
+	generate_chunk_append_attribute(
+	 chunk,
+	 GENERATE_CHUNK_NAME_USER_IDENTIFIER,
+	 1 );
+
+	generate_chunk_append_substitution(
+	 chunk,
+	 0x0e,
+	 13,
+	 0x13 );
+
+	generate_chunk_set_attribute_list_size(
+	 chunk,
+	 attribute_list_offset );
+
+	generate_chunk_append_uint8(
+	 chunk,
+	 0x03 );
+
+	generate_chunk_set_element_size(
+	 chunk,
+	 element_offset );
+
+	/* </System>
+	 */
+	generate_chunk_append_uint8(
+	 chunk,
+	 0x04 );
+
+	generate_chunk_set_element_size(
+	 chunk,
+	 system_element_offset );
+
+	/* <EventData><Data Name="...">%14</Data>...</EventData>
+	 */
+	generate_chunk_append_element_start(
+	 chunk,
+	 GENERATE_CHUNK_NAME_EVENT_DATA,
+	 0,
+	 &event_data_element_offset,
+	 &attribute_list_offset );
+
+	generate_chunk_append_uint8(
+	 chunk,
+	 0x02 );
+
+	for( value_index = 0;
+	     value_index < generate_handle->number_of_values;
+	     value_index++ )
+	{
+		switch( ( template_index + value_index ) % 3 )
+		{
+			case 0:
+				value_type = 0x01;
+				break;
+
+			case 1:
+				value_type = 0x08;
+				break;
+
+			default:
+				value_type = 0x15;
+				break;
+		}
+		narrow_string_snprintf(
+		 data_name,
+		 32,
+		 "Field%d_%d",
+		 template_index,
+		 value_index );
+
+		generate_chunk_append_element_start(
+		 chunk,
+		 GENERATE_CHUNK_NAME_DATA,
+		 1,
+		 &element_offset,
+		 &attribute_list_offset );
+
+		generate_chunk_append_attribute(
+		 chunk,
+		 GENERATE_CHUNK_NAME_NAME,
+		 1 );
+
+		generate_chunk_append_value_text(
+		 chunk,
+		 data_name );
+
+		generate_chunk_set_attribute_list_size(
+		 chunk,
+		 attribute_list_offset );
+
+		generate_chunk_append_uint8(
+		 chunk,
+		 0x02 );
+
+		generate_chunk_append_substitution(
+		 chunk,
+		 0x0e,
+		 (uint16_t) ( GENERATE_HANDLE_NUMBER_OF_SYSTEM_VALUES + value_index ),
+		 value_type );
+
+		generate_chunk_append_uint8(
+		 chunk,
+		 0x04 );
+
+		generate_chunk_set_element_size(
+		 chunk,
+		 element_offset );
+	}
+	/* </EventData>
+	 */
+	generate_chunk_append_uint8(
+	 chunk,
+	 0x04 );
+
+	generate_chunk_set_element_size(
+	 chunk,
+	 event_data_element_offset );
+
+	/* </Event>
+	 */
+	generate_chunk_append_uint8(
+	 chunk,
+	 0x04 );
+
+	generate_chunk_set_element_size(
+	 chunk,
+	 event_element_offset );
+
+	/* End of fragment
+	 */
+	generate_chunk_append_uint8(
+	 chunk,
+	 0x00 );
+}
+
+/* Appends an event record that uses a specific template
+ * The template definition is stored in the record if the chunk does not contain it yet
+ * Returns 1 if successful or 0 if the record does not fit in the chunk
+ */
+int generate_handle_append_record(
+     generate_handle_t *generate_handle,
+     int template_index,
+     uint64_t record_identifier,
+     uint64_t written_time )
+{
+	uint8_t template_identifier[ 16 ];
+	size_t string_lengths[ GENERATE_HANDLE_MAXIMUM_NUMBER_OF_VALUES ];
+	char provider_name[ 32 ];
+
+	generate_chunk_t *chunk             = NULL;
+	const char *channel_name            = "Application";
+	const char *computer_name           = "evtxgen.example.com";
+	size_t data_size_offset             = 0;
+	size_t provider_name_length         = 0;
+	size_t record_offset                = 0;
+	size_t template_instance_offset     = 0;
+	uint32_t template_definition_offset = 0;
+	uint16_t value_size                 = 0;
+	int has_qualifiers                  = 0;
+	int has_user_identifier             = 0;
+	int number_of_values                = 0;
+	int value_index                     = 0;
+	int result                          = 0;
+
+	chunk = generate_handle->chunk;
+
+	generate_handle_get_template_identifier(
+	 generate_handle,
+	 template_index,
+	 template_identifier );
+
+	provider_name_length = (size_t) narrow_string_snprintf(
+	                                 provider_name,
+	                                 32,
+	                                 "Generated-Provider-%d",
+	                                 template_index % 64 );
+
+	has_qualifiers      = (int) ( ( template_index % 4 ) == 0 );
+	has_user_identifier = (int) ( ( template_index % 3 ) == 0 );
+	number_of_values    = GENERATE_HANDLE_NUMBER_OF_SYSTEM_VALUES + generate_handle->number_of_values;
+
+	for( value_index = 0;
+	     value_index < generate_handle->number_of_values;
+	     value_index++ )
+	{
+		string_lengths[ value_index ] = (size_t) ( generate_handle_get_random_value( generate_handle )
+		                              % ( generate_handle->maximum_string_length + 1 ) );
+	}
+	generate_chunk_start_record(
+	 chunk,
+	 record_identifier,
+	 written_time,
+	 &record_offset );
+
+	/* Fragment header
+	 */
+	generate_chunk_append_uint32(
+	 chunk,
+	 0x0001010fUL );
+
+	/* Template instance
+	 */
+	template_instance_offset = chunk->data_offset;
+
+	generate_chunk_append_uint8(
+	 chunk,
+	 0x0c );
+
+	generate_chunk_append_uint8(
+	 chunk,
+	 0x01 );
+
+	generate_chunk_append_data(
+	 chunk,
+	 template_identifier,
+	 4 );
+
+	result = generate_chunk_get_template_definition_offset(
+	          chunk,
+	          template_index,
+	          &template_definition_offset );
+
+	if( result != 0 )
+	{
+		generate_chunk_append_uint32(
+		 chunk,
+		 template_definition_offset );
+	}
+	else
+	{
+		/* The template definition directly follows the template instance
+		 */
+		generate_chunk_append_uint32(
+		 chunk,
+		 (uint32_t) ( template_instance_offset + 10 ) );
+
+		generate_chunk_append_template_definition_header(
+		 chunk,
+		 template_index,
+		 template_identifier,
+		 &data_size_offset );
+
+		generate_handle_append_template_fragment(
+		 generate_handle,
+		 template_index );
+
+		generate_chunk_set_uint32(
+		 chunk,
+		 data_size_offset,
+		 (uint32_t) ( chunk->data_offset - ( data_size_offset + 4 ) ) );
+	}
+	/* Template instance values
+	 */
+	generate_chunk_append_uint32(
+	 chunk,
+	 (uint32_t) number_of_values );
+
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		switch( value_index )
+		{
+			case 0:
+			case 2:
+				value_size = 1;
+				break;
+
+			case 1:
+			case 8:
+				value_size = 2;
+				break;
+
+			case 3:
+			case 4:
+			case 5:
+				value_size = 8;
+				break;
+
+			case 6:
+			case 7:
+				value_size = 4;
+				break;
+
+			case 9:
+				value_size = ( has_qualifiers != 0 ) ? 2 : 0;
+				break;
+
+			case 10:
+				value_size = (uint16_t) ( provider_name_length * 2 );
+				break;
+
+			case 11:
+				value_size = (uint16_t) ( narrow_string_length( channel_name ) * 2 );
+				break;
+
+			case 12:
+				value_size = (uint16_t) ( narrow_string_length( computer_name ) * 2 );
+				break;
+
+			case 13:
+				value_size = ( has_user_identifier != 0 ) ? 12 : 0;
+				break;
+
+			default:
+				switch( ( template_index + value_index - GENERATE_HANDLE_NUMBER_OF_SYSTEM_VALUES ) % 3 )
+				{
+					case 0:
+						value_size = (uint16_t) ( string_lengths[ value_index - GENERATE_HANDLE_NUMBER_OF_SYSTEM_VALUES ] * 2 );
+						break;
+
+					case 1:
+						value_size = 4;
+						break;
+
+					default:
+						value_size = 8;
+						break;
+				}
+				break;
+		}
+		generate_chunk_append_uint16(
+		 chunk,
+		 value_size );
+
+		/* The value types are the same as in the template definition
+		 * except for optional values that are not set
+		 */
+		switch( value_index )
+		{
+			case 0:
+			case 2:
+				generate_chunk_append_uint8(
+				 chunk,
+				 0x04 );
+				break;
+
+			case 1:
+			case 8:
+				generate_chunk_append_uint8(
+				 chunk,
+				 0x06 );
+				break;
+
+			case 3:
+				generate_chunk_append_uint8(
+				 chunk,
+				 0x15 );
+				break;
+
+			case 4:
+				generate_chunk_append_uint8(
+				 chunk,
+				 0x11 );
+				break;
+
+			case 5:
+				generate_chunk_append_uint8(
+				 chunk,
+				 0x0a );
+				break;
+
+			case 6:
+			case 7:
+				generate_chunk_append_uint8(
+				 chunk,
+				 0x08 );
+				break;
+
+			case 9:
+				generate_chunk_append_uint8(
+				 chunk,
+				 ( has_qualifiers != 0 ) ? 0x06 : 0x00 );
+				break;
+
+			case 10:
+			case 11:
+			case 12:
+				generate_chunk_append_uint8(
+				 chunk,
+				 0x01 );
+				break;
+
+			case 13:
+				generate_chunk_append_uint8(
+				 chunk,
+				 ( has_user_identifier != 0 ) ? 0x13 : 0x00 );
+				break;
+
+			default:
+				switch( ( template_index + value_index - GENERATE_HANDLE_NUMBER_OF_SYSTEM_VALUES ) % 3 )
+				{
+					case 0:
+						generate_chunk_append_uint8(
+						 chunk,
+						 0x01 );
+						break;
+
+					case 1:
+						generate_chunk_append_uint8(
+						 chunk,
+						 0x08 );
+						break;
+
+					default:
+						generate_chunk_append_uint8(
+						 chunk,
+						 0x15 );
+						break;
+				}
+				break;
+		}
+		generate_chunk_append_uint8(
+		 chunk,
+		 0x00 );
+	}
+	/* Level, task, opcode and keywords
+	 */
+	generate_chunk_append_uint8(
+	 chunk,
+	 (uint8_t) ( generate_handle_get_random_value( generate_handle ) % 5 ) );
+
+	generate_chunk_append_uint16(
+	 chunk,
+	 (uint16_t) ( template_index % 16 ) );
+
+	generate_chunk_append_uint8(
+	 chunk,
+	 0 );
+
+	generate_chunk_append_uint64(
+	 chunk,
+	 (uint64_t) 0x8080000000000000ULL );
+
+	/* Time created and event record identifier
+	 */
+	generate_chunk_append_uint64(
+	 chunk,
+	 written_time );
+
+	generate_chunk_append_uint64(
+	 chunk,
+	 record_identifier );
+
+	/* Process and thread identifier
+	 */
+	generate_chunk_append_uint32(
+	 chunk,
+	 (uint32_t) ( generate_handle_get_random_value( generate_handle ) % 65536 ) & ~( 3UL ) );
+
+	generate_chunk_append_uint32(
+	 chunk,
+	 (uint32_t) ( generate_handle_get_random_value( generate_handle ) % 65536 ) & ~( 3UL ) );
+
+	/* Event identifier and qualifiers
+	 */
+	generate_chunk_append_uint16(
+	 chunk,
+	 (uint16_t) ( 1000 + template_index ) );
+
+	if( has_qualifiers != 0 )
+	{
+		generate_chunk_append_uint16(
+		 chunk,
+		 0x4000 );
+	}
+	/* Provider, channel and computer name
+	 */
+	generate_chunk_append_utf16_string(
+	 chunk,
+	 provider_name,
+	 provider_name_length );
+
+	generate_chunk_append_utf16_string(
+	 chunk,
+	 channel_name,
+	 narrow_string_length(
+	  channel_name ) );
+
+	generate_chunk_append_utf16_string(
+	 chunk,
+	 computer_name,
+	 narrow_string_length(
+	  computer_name ) );
+
+	/* User identifier
+	 */
+	if( has_user_identifier != 0 )
+	{
+		generate_chunk_append_data(
+		 chunk,
+		 generate_handle_local_system_sid,
+		 12 );
+	}
+	/* Event data values
+	 */
+	for( value_index = 0;
+	     value_index < generate_handle->number_of_values;
+	     value_index++ )
+	{
+		switch( ( template_index + value_index ) % 3 )
+		{
+			case 0:
+				generate_handle_append_random_utf16_string(
+				 generate_handle,
+				 string_lengths[ value_index ] );
+				break;
+
+			case 1:
+				generate_chunk_append_uint32(
+				 chunk,
+				 (uint32_t) generate_handle_get_random_value( generate_handle ) );
+				break;
+
+			default:
+				generate_chunk_append_uint64(
+				 chunk,
+				 generate_handle_get_random_value( generate_handle ) );
+				break;
+		}
+	}
+	/* End of fragment
+	 */
+	generate_chunk_append_uint8(
+	 chunk,
+	 0x00 );
+
+	return( generate_chunk_finish_record(
+	         chunk,
+	         record_offset,
+	         record_identifier ) );
+}
+
+/* Generates a chunk and writes it to the output stream
+ * Returns 1 if successful or -1 on error
+ */
+int generate_handle_write_chunk(
+     generate_handle_t *generate_handle,
+     int chunk_index,
+     libcerror_error_t **error )
+{
+	static char *function      = "generate_handle_write_chunk";
+	size_t alignment_padding   = 0;
+	size_t maximum_record_size = 0;
+	ssize_t write_count        = 0;
+	uint64_t random_value      = 0;
+	int number_of_definitions  = 0;
+	int number_of_records      = 0;
+	int remnant_index          = 0;
+	int result                 = 0;
+	int template_index         = 0;
+
+	if( generate_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generate handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( generate_chunk_clear(
+	     generate_handle->chunk,
+	     (uint64_t) chunk_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to clear chunk: %d.",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	while( ( generate_handle->maximum_number_of_records_per_chunk == 0 )
+	    || ( number_of_records < generate_handle->maximum_number_of_records_per_chunk ) )
+	{
+		/* Keep space free for the remnants
+		 */
+		if( ( generate_handle->number_of_remnants > 0 )
+		 && ( ( generate_handle->chunk->data_offset + ( generate_handle->number_of_remnants * ( maximum_record_size + 24 ) ) ) > GENERATE_CHUNK_SIZE ) )
+		{
+			break;
+		}
+		number_of_definitions = generate_handle->chunk->number_of_defined_templates;
+
+		random_value = generate_handle_get_random_value(
+		                generate_handle );
+
+		if( ( number_of_definitions > 0 )
+		 && ( (int) ( random_value % 100 ) < generate_handle->template_reuse_percentage ) )
+		{
+			random_value = generate_handle_get_random_value(
+			                generate_handle );
+
+			template_index = generate_handle->chunk->defined_templates[ random_value % number_of_definitions ];
+		}
+		else
+		{
+			template_index = generate_handle->next_template_index;
+
+			generate_handle->next_template_index += 1;
+
+			if( generate_handle->next_template_index >= GENERATE_HANDLE_NUMBER_OF_TEMPLATES )
+			{
+				generate_handle->next_template_index = 0;
+			}
+		}
+		random_value = generate_handle_get_random_value(
+		                generate_handle );
+
+		result = generate_handle_append_record(
+		          generate_handle,
+		          template_index,
+		          generate_handle->next_record_identifier,
+		          generate_handle->written_time + ( ( random_value % 60 ) * 10000000 ) );
+
+		if( result == 0 )
+		{
+			break;
+		}
+		if( generate_handle->chunk->number_of_defined_templates > number_of_definitions )
+		{
+			generate_handle->number_of_template_definitions_written += 1;
+		}
+		if( generate_handle->chunk->record_sizes[ number_of_records ] > maximum_record_size )
+		{
+			maximum_record_size = generate_handle->chunk->record_sizes[ number_of_records ];
+		}
+		generate_handle->written_time           += ( random_value % 60 ) * 10000000;
+		generate_handle->next_record_identifier += 1;
+
+		number_of_records++;
+	}
+	if( number_of_records == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: unable to fit record in empty chunk: %d - reduce the number of values or maximum string length.",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	generate_handle->number_of_records_written += number_of_records;
+
+	for( remnant_index = 0;
+	     remnant_index < generate_handle->number_of_remnants;
+	     remnant_index++ )
+	{
+		random_value = generate_handle_get_random_value(
+		                generate_handle );
+
+		alignment_padding = (size_t) ( ( random_value >> 32 ) % 4 ) * 8;
+
+		if( generate_chunk_append_remnant(
+		     generate_handle->chunk,
+		     (int) ( random_value % number_of_records ),
+		     alignment_padding ) == 0 )
+		{
+			break;
+		}
+		generate_handle->number_of_remnants_written += 1;
+	}
+	if( generate_chunk_finalize(
+	     generate_handle->chunk,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to finalize chunk: %d.",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	write_count = file_stream_write(
+	               generate_handle->output_stream,
+	               generate_handle->chunk->data,
+	               GENERATE_CHUNK_SIZE );
+
+	if( write_count != (ssize_t) GENERATE_CHUNK_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write chunk: %d.",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	generate_handle->number_of_chunks_written += 1;
+
+	return( 1 );
+}
+
+/* Writes the file header to the start of the output stream
+ * Returns 1 if successful or -1 on error
+ */
+int generate_handle_write_file_header(
+     generate_handle_t *generate_handle,
+     uint64_t number_of_chunks,
+     uint64_t next_record_identifier,
+     libcerror_error_t **error )
+{
+	uint8_t file_header_data[ GENERATE_HANDLE_FILE_HEADER_SIZE ];
+
+	static char *function = "generate_handle_write_file_header";
+	ssize_t write_count   = 0;
+	uint32_t checksum     = 0;
+	uint32_t file_flags   = 0;
+
+	if( generate_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generate handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     file_header_data,
+	     0,
+	     GENERATE_HANDLE_FILE_HEADER_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file header data.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     file_header_data,
+	     generate_handle_file_signature,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( generate_handle->is_dirty != 0 )
+	{
+		file_flags = 0x00000001UL;
+	}
+	/* The first chunk number is 0
+	 */
+	if( number_of_chunks > 0 )
+	{
+		byte_stream_copy_from_uint64_little_endian(
+		 &( file_header_data[ 16 ] ),
+		 number_of_chunks - 1 );
+	}
+	byte_stream_copy_from_uint64_little_endian(
+	 &( file_header_data[ 24 ] ),
+	 next_record_identifier );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( file_header_data[ 32 ] ),
+	 128 );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( file_header_data[ 36 ] ),
+	 1 );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( file_header_data[ 38 ] ),
+	 3 );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( file_header_data[ 40 ] ),
+	 GENERATE_HANDLE_FILE_HEADER_SIZE );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( file_header_data[ 42 ] ),
+	 (uint16_t) number_of_chunks );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( file_header_data[ 120 ] ),
+	 file_flags );
+
+	checksum = generate_chunk_calculate_crc32(
+	            file_header_data,
+	            120,
+	            0 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( file_header_data[ 124 ] ),
+	 checksum );
+
+	if( file_stream_seek_offset(
+	     generate_handle->output_stream,
+	     0,
+	     SEEK_SET ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek file header offset.",
+		 function );
+
+		return( -1 );
+	}
+	write_count = file_stream_write(
+	               generate_handle->output_stream,
+	               file_header_data,
+	               GENERATE_HANDLE_FILE_HEADER_SIZE );
+
+	if( write_count != (ssize_t) GENERATE_HANDLE_FILE_HEADER_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write file header.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Generates a file
+ * A dirty file is written as if the file header was not updated after the last chunk
+ * Returns 1 if successful or -1 on error
+ */
+int generate_handle_generate_file(
+     generate_handle_t *generate_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function                   = "generate_handle_generate_file";
+	uint64_t header_next_record_identifier  = 0;
+	uint64_t header_number_of_chunks        = 0;
+	int chunk_index                         = 0;
+
+	if( generate_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generate handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( generate_handle->output_stream != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid generate handle - output stream value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	generate_handle->random_state           = generate_handle->seed;
+	generate_handle->next_template_index    = 0;
+	generate_handle->next_record_identifier = 1;
+	generate_handle->written_time           = GENERATE_HANDLE_FIRST_WRITTEN_TIME;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	generate_handle->output_stream = file_stream_open_wide(
+	                                  filename,
+	                                  _SYSTEM_STRING( FILE_STREAM_BINARY_OPEN_WRITE ) );
+#else
+	generate_handle->output_stream = file_stream_open(
+	                                  filename,
+	                                  FILE_STREAM_BINARY_OPEN_WRITE );
+#endif
+	if( generate_handle->output_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open output file.",
+		 function );
+
+		goto on_error;
+	}
+	/* Reserve the file header, it is written after the last chunk
+	 */
+	if( generate_handle_write_file_header(
+	     generate_handle,
+	     0,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to reserve file header.",
+		 function );
+
+		goto on_error;
+	}
+	for( chunk_index = 0;
+	     chunk_index < generate_handle->number_of_chunks;
+	     chunk_index++ )
+	{
+		if( generate_handle->abort != 0 )
+		{
+			break;
+		}
+		if( generate_handle_write_chunk(
+		     generate_handle,
+		     chunk_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write chunk: %d.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		/* The file header of a dirty file does not contain the last chunk
+		 */
+		if( ( generate_handle->is_dirty == 0 )
+		 || ( chunk_index == 0 )
+		 || ( chunk_index < ( generate_handle->number_of_chunks - 1 ) ) )
+		{
+			header_number_of_chunks       = (uint64_t) chunk_index + 1;
+			header_next_record_identifier = generate_handle->next_record_identifier;
+		}
+	}
+	if( generate_handle_write_file_header(
+	     generate_handle,
+	     header_number_of_chunks,
+	     header_next_record_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write file header.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_stream_close(
+	     generate_handle->output_stream ) != 0 )
+	{
+		generate_handle->output_stream = NULL;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close output file.",
+		 function );
+
+		goto on_error;
+	}
+	generate_handle->output_stream = NULL;
+
+	return( 1 );
+
+on_error:
+	if( generate_handle->output_stream != NULL )
+	{
+		file_stream_close(
+		 generate_handle->output_stream );
+
+		generate_handle->output_stream = NULL;
+	}
+	return( -1 );
+}
+
+/* Prints the statistics of the generated file
+ * Returns 1 if successful or -1 on error
+ */
+int generate_handle_statistics_fprint(
+     generate_handle_t *generate_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "generate_handle_statistics_fprint";
+
+	if( generate_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generate handle.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 generate_handle->notify_stream,
+	 "Generated:\n" );
+
+	fprintf(
+	 generate_handle->notify_stream,
+	 "\tnumber of chunks\t\t: %d\n",
+	 generate_handle->number_of_chunks_written );
+
+	fprintf(
+	 generate_handle->notify_stream,
+	 "\tnumber of records\t\t: %" PRIu64 "\n",
+	 generate_handle->number_of_records_written );
+
+	fprintf(
+	 generate_handle->notify_stream,
+	 "\tnumber of template definitions\t: %" PRIu64 "\n",
+	 generate_handle->number_of_template_definitions_written );
+
+	fprintf(
+	 generate_handle->notify_stream,
+	 "\tnumber of remnants\t\t: %" PRIu64 "\n",
+	 generate_handle->number_of_remnants_written );
+
+	fprintf(
+	 generate_handle->notify_stream,
+	 "\tfile size\t\t\t: %" PRIu64 " bytes\n",
+	 (uint64_t) GENERATE_HANDLE_FILE_HEADER_SIZE
+	 + ( (uint64_t) generate_handle->number_of_chunks_written * GENERATE_CHUNK_SIZE ) );
+
+	fprintf(
+	 generate_handle->notify_stream,
+	 "\n" );
+
+	return( 1 );
+}
+
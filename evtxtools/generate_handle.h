@@ -0,0 +1,243 @@
+/*
+ * Generate handle
+ *
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _GENERATE_HANDLE_H )
+#define _GENERATE_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+#include "generate_chunk.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The file header and chunk header only support 16-bit chunk numbers
+ */
+#define GENERATE_HANDLE_MAXIMUM_NUMBER_OF_CHUNKS		65535
+
+#define GENERATE_HANDLE_MAXIMUM_NUMBER_OF_VALUES		256
+#define GENERATE_HANDLE_MAXIMUM_STRING_LENGTH			4096
+
+/* The number of distinct templates (event shapes) that are generated
+ */
+#define GENERATE_HANDLE_NUMBER_OF_TEMPLATES			1024
+
+/* The number of fixed substitution values of the generated events
+ */
+#define GENERATE_HANDLE_NUMBER_OF_SYSTEM_VALUES			14
+
+typedef struct generate_handle generate_handle_t;
+
+struct generate_handle
+{
+	/* The chunk
+	 */
+	generate_chunk_t *chunk;
+
+	/* The output stream
+	 */
+	FILE *output_stream;
+
+	/* The number of chunks
+	 */
+	int number_of_chunks;
+
+	/* The maximum number of records per chunk, where 0 represents as many as fit
+	 */
+	int maximum_number_of_records_per_chunk;
+
+	/* The percentage of records that reuse a template defined earlier in the chunk
+	 */
+	int template_reuse_percentage;
+
+	/* The number of event data values per record
+	 */
+	int number_of_values;
+
+	/* The maximum number of characters of string values
+	 */
+	int maximum_string_length;
+
+	/* The number of record remnants per chunk
+	 */
+	int number_of_remnants;
+
+	/* Value to indicate the file should be marked as dirty
+	 */
+	int is_dirty;
+
+	/* The seed
+	 */
+	uint64_t seed;
+
+	/* The state of the pseudo random number generator
+	 */
+	uint64_t random_state;
+
+	/* The index of the next template that is not yet used
+	 */
+	int next_template_index;
+
+	/* The next record identifier
+	 */
+	uint64_t next_record_identifier;
+
+	/* The written time of the last record, as a FILETIME
+	 */
+	uint64_t written_time;
+
+	/* The number of records written
+	 */
+	uint64_t number_of_records_written;
+
+	/* The number of template definitions written
+	 */
+	uint64_t number_of_template_definitions_written;
+
+	/* The number of remnants written
+	 */
+	uint64_t number_of_remnants_written;
+
+	/* The number of chunks written
+	 */
+	int number_of_chunks_written;
+
+	/* The notification output stream
+	 */
+	FILE *notify_stream;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+int generate_handle_initialize(
+     generate_handle_t **generate_handle,
+     libcerror_error_t **error );
+
+int generate_handle_free(
+     generate_handle_t **generate_handle,
+     libcerror_error_t **error );
+
+int generate_handle_signal_abort(
+     generate_handle_t *generate_handle,
+     libcerror_error_t **error );
+
+int generate_handle_copy_decimal_from_string(
+     const system_character_t *string,
+     uint64_t maximum_value,
+     uint64_t *value,
+     libcerror_error_t **error );
+
+int generate_handle_set_number_of_chunks(
+     generate_handle_t *generate_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int generate_handle_set_maximum_number_of_records_per_chunk(
+     generate_handle_t *generate_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int generate_handle_set_template_reuse_percentage(
+     generate_handle_t *generate_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int generate_handle_set_number_of_values(
+     generate_handle_t *generate_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int generate_handle_set_maximum_string_length(
+     generate_handle_t *generate_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int generate_handle_set_number_of_remnants(
+     generate_handle_t *generate_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int generate_handle_set_seed(
+     generate_handle_t *generate_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+uint64_t generate_handle_get_random_value(
+          generate_handle_t *generate_handle );
+
+void generate_handle_get_template_identifier(
+      generate_handle_t *generate_handle,
+      int template_index,
+      uint8_t *template_identifier );
+
+void generate_handle_append_random_utf16_string(
+      generate_handle_t *generate_handle,
+      size_t string_length );
+
+void generate_handle_append_value_element(
+      generate_handle_t *generate_handle,
+      int name_index,
+      uint16_t substitution_identifier,
+      uint8_t value_type );
+
+void generate_handle_append_template_fragment(
+      generate_handle_t *generate_handle,
+      int template_index );
+
+int generate_handle_append_record(
+     generate_handle_t *generate_handle,
+     int template_index,
+     uint64_t record_identifier,
+     uint64_t written_time );
+
+int generate_handle_write_chunk(
+     generate_handle_t *generate_handle,
+     int chunk_index,
+     libcerror_error_t **error );
+
+int generate_handle_write_file_header(
+     generate_handle_t *generate_handle,
+     uint64_t number_of_chunks,
+     uint64_t next_record_identifier,
+     libcerror_error_t **error );
+
+int generate_handle_generate_file(
+     generate_handle_t *generate_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int generate_handle_statistics_fprint(
+     generate_handle_t *generate_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _GENERATE_HANDLE_H ) */
+
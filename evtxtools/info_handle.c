@@ -32,6 +32,7 @@
 #include "evtxtools_libclocale.h"
 #include "evtxtools_libfdatetime.h"
 #include "evtxtools_libevtx.h"
+#include "evtxtools_output.h"
 #include "info_handle.h"
 
 #define INFO_HANDLE_NOTIFY_STREAM	stdout
@@ -418,6 +419,7 @@ int info_handle_file_fprint(
      libcerror_error_t **error )
 {
 	const system_character_t *event_log_type = NULL;
+	evtxtools_output_buffer_t *output_buffer = NULL;
 	static char *function                    = "evtxinfo_file_info_fprint";
 	uint32_t flags                           = 0;
 	uint16_t major_version                   = 0;
@@ -509,23 +511,39 @@ int info_handle_file_fprint(
 
 		return( -1 );
 	}
-	fprintf(
-	 info_handle->notify_stream,
+	/* The information is formatted in an output buffer so that it is written
+	 * to the notification stream at once
+	 */
+	if( evtxtools_output_buffer_initialize(
+	     &output_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create output buffer.",
+		 function );
+
+		goto on_error;
+	}
+	evtxtools_output_buffer_printf(
+	 output_buffer,
 	 "Windows Event Viewer Log (EVTX) information:\n" );
 
-	fprintf(
-	 info_handle->notify_stream,
+	evtxtools_output_buffer_printf(
+	 output_buffer,
 	 "\tVersion\t\t\t\t: %" PRIu32 ".%" PRIu32 "\n",
 	 major_version,
 	 minor_version );
 
-	fprintf(
-	 info_handle->notify_stream,
+	evtxtools_output_buffer_printf(
+	 output_buffer,
 	 "\tNumber of records\t\t: %d\n",
 	 number_of_records );
 
-	fprintf(
-	 info_handle->notify_stream,
+	evtxtools_output_buffer_printf(
+	 output_buffer,
 	 "\tNumber of recovered records\t: %d\n",
 	 number_of_recovered_records );
 
@@ -565,40 +583,332 @@ int info_handle_file_fprint(
 	}
 	if( event_log_type != NULL )
 	{
-		fprintf(
-		 info_handle->notify_stream,
+		evtxtools_output_buffer_printf(
+		 output_buffer,
 		 "\tLog type\t\t\t: %" PRIs_SYSTEM "\n",
 		 event_log_type );
 	}
 	if( is_corrupted != 0 )
 	{
-		fprintf(
-		 info_handle->notify_stream,
+		evtxtools_output_buffer_printf(
+		 output_buffer,
 		 "\tIs corrupted\n" );
 	}
 	if( flags != 0 )
 	{
-		fprintf(
-		 info_handle->notify_stream,
+		evtxtools_output_buffer_printf(
+		 output_buffer,
 		 "\tFlags:\n" );
 
 		if( ( flags & LIBEVTX_FILE_FLAG_IS_DIRTY ) != 0 )
 		{
-			fprintf(
-			 info_handle->notify_stream,
+			evtxtools_output_buffer_printf(
+			 output_buffer,
 			 "\t\tIs dirty\n" );
 		}
 		if( ( flags & LIBEVTX_FILE_FLAG_IS_FULL ) != 0 )
 		{
-			fprintf(
-			 info_handle->notify_stream,
+			evtxtools_output_buffer_printf(
+			 output_buffer,
 			 "\t\tIs full\n" );
 		}
 	}
-	fprintf(
-	 info_handle->notify_stream,
+	evtxtools_output_buffer_printf(
+	 output_buffer,
+	 "\n" );
+
+	if( evtxtools_output_buffer_write_to_stream(
+	     output_buffer,
+	     info_handle->notify_stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write output buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( evtxtools_output_buffer_free(
+	     &output_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free output buffer.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( output_buffer != NULL )
+	{
+		evtxtools_output_buffer_free(
+		 &output_buffer,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Prints the statistics of reading all the records to a stream
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_statistics_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	libevtx_statistics_t statistics;
+
+	evtxtools_output_buffer_t *output_buffer = NULL;
+	libevtx_record_t *record                 = NULL;
+	static char *function                    = "info_handle_statistics_fprint";
+	int number_of_recovered_records          = 0;
+	int number_of_records                    = 0;
+	int record_index                         = 0;
+	int result                               = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_file_get_number_of_records(
+	     info_handle->input_file,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_file_get_number_of_recovered_records(
+	     info_handle->input_file,
+	     &number_of_recovered_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of recovered records.",
+		 function );
+
+		goto on_error;
+	}
+	/* The records are read so that the statistics cover the chunks, the caches
+	 * and the XML documents, records that cannot be read are skipped since
+	 * they are accounted for in the statistics
+	 */
+	for( record_index = 0;
+	     record_index < ( number_of_records + number_of_recovered_records );
+	     record_index++ )
+	{
+		if( info_handle->abort != 0 )
+		{
+			break;
+		}
+		if( record_index < number_of_records )
+		{
+			result = libevtx_file_get_record_by_index(
+			          info_handle->input_file,
+			          record_index,
+			          &record,
+			          error );
+		}
+		else
+		{
+			result = libevtx_file_get_recovered_record_by_index(
+			          info_handle->input_file,
+			          record_index - number_of_records,
+			          &record,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_free(
+			 error );
+
+			continue;
+		}
+		if( libevtx_record_free(
+		     &record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record: %d.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+	}
+	statistics.size = sizeof( libevtx_statistics_t );
+
+	if( libevtx_file_get_statistics(
+	     info_handle->input_file,
+	     &statistics,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve statistics.",
+		 function );
+
+		goto on_error;
+	}
+	if( evtxtools_output_buffer_initialize(
+	     &output_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create output buffer.",
+		 function );
+
+		goto on_error;
+	}
+	evtxtools_output_buffer_printf(
+	 output_buffer,
+	 "Statistics:\n" );
+
+	evtxtools_output_buffer_printf(
+	 output_buffer,
+	 "\tNumber of chunks read\t\t: %" PRIu64 "\n",
+	 statistics.number_of_chunks_read );
+
+	evtxtools_output_buffer_printf(
+	 output_buffer,
+	 "\tNumber of bytes read\t\t: %" PRIu64 "\n",
+	 statistics.number_of_bytes_read );
+
+	evtxtools_output_buffer_printf(
+	 output_buffer,
+	 "\tChunk cache hits\t\t: %" PRIu64 "\n",
+	 statistics.number_of_chunk_cache_hits );
+
+	evtxtools_output_buffer_printf(
+	 output_buffer,
+	 "\tChunk cache misses\t\t: %" PRIu64 "\n",
+	 statistics.number_of_chunk_cache_misses );
+
+	evtxtools_output_buffer_printf(
+	 output_buffer,
+	 "\tRecord cache hits\t\t: %" PRIu64 "\n",
+	 statistics.number_of_record_cache_hits );
+
+	evtxtools_output_buffer_printf(
+	 output_buffer,
+	 "\tRecord cache misses\t\t: %" PRIu64 "\n",
+	 statistics.number_of_record_cache_misses );
+
+	evtxtools_output_buffer_printf(
+	 output_buffer,
+	 "\tChecksum mismatches\t\t: %" PRIu64 "\n",
+	 statistics.number_of_checksum_mismatches );
+
+	evtxtools_output_buffer_printf(
+	 output_buffer,
+	 "\tRecords parsed\t\t\t: %" PRIu64 "\n",
+	 statistics.number_of_records_parsed );
+
+	evtxtools_output_buffer_printf(
+	 output_buffer,
+	 "\tRecovered records parsed\t: %" PRIu64 "\n",
+	 statistics.number_of_recovered_records_parsed );
+
+	evtxtools_output_buffer_printf(
+	 output_buffer,
+	 "\tXML documents read\t\t: %" PRIu64 "\n",
+	 statistics.number_of_xml_documents_read );
+
+	evtxtools_output_buffer_printf(
+	 output_buffer,
+	 "\tOpen time\t\t\t: %" PRIu64 ".%03" PRIu64 " ms\n",
+	 statistics.open_time / 1000000,
+	 ( statistics.open_time / 1000 ) % 1000 );
+
+	evtxtools_output_buffer_printf(
+	 output_buffer,
+	 "\tChunk read time\t\t\t: %" PRIu64 ".%03" PRIu64 " ms\n",
+	 statistics.chunk_read_time / 1000000,
+	 ( statistics.chunk_read_time / 1000 ) % 1000 );
+
+	evtxtools_output_buffer_printf(
+	 output_buffer,
+	 "\tXML parse time\t\t\t: %" PRIu64 ".%03" PRIu64 " ms\n",
+	 statistics.xml_parse_time / 1000000,
+	 ( statistics.xml_parse_time / 1000 ) % 1000 );
+
+	evtxtools_output_buffer_printf(
+	 output_buffer,
 	 "\n" );
 
+	if( evtxtools_output_buffer_write_to_stream(
+	     output_buffer,
+	     info_handle->notify_stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write output buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( evtxtools_output_buffer_free(
+	     &output_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free output buffer.",
+		 function );
+
+		goto on_error;
+	}
 	return( 1 );
+
+on_error:
+	if( output_buffer != NULL )
+	{
+		evtxtools_output_buffer_free(
+		 &output_buffer,
+		 NULL );
+	}
+	if( record != NULL )
+	{
+		libevtx_record_free(
+		 &record,
+		 NULL );
+	}
+	return( -1 );
 }
 
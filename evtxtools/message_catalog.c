@@ -0,0 +1,2187 @@
+/*
+ * Message catalog
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#include "evtxtools_libcerror.h"
+#include "evtxtools_libevtx.h"
+#include "message_catalog.h"
+#include "message_catalog_format.h"
+#include "message_string.h"
+
+uint8_t message_catalog_file_signature[ 8 ] = { 'E', 'V', 'T', 'X', 'M', 'S', 'G', 'C' };
+
+/* Calculates the hash of an entry key
+ * Keys are case insensitive hence ASCII upper case characters are hashed as their lower case equivalent
+ * Returns the FNV-1a hash of the entry type, key and identifier
+ */
+uint32_t message_catalog_calculate_hash(
+          uint32_t entry_type,
+          const system_character_t *key,
+          size_t key_length,
+          uint32_t identifier )
+{
+	size_t key_index             = 0;
+	uint32_t hash                = 0x811c9dc5UL;
+	system_character_t character = 0;
+	uint8_t byte_index           = 0;
+
+	hash ^= entry_type & 0xff;
+	hash *= 0x01000193UL;
+
+	if( key != NULL )
+	{
+		for( key_index = 0;
+		     key_index < key_length;
+		     key_index++ )
+		{
+			character = key[ key_index ];
+
+			if( ( character >= (system_character_t) 'A' )
+			 && ( character <= (system_character_t) 'Z' ) )
+			{
+				character = character - (system_character_t) 'A' + (system_character_t) 'a';
+			}
+			hash ^= (uint32_t) character;
+			hash *= 0x01000193UL;
+		}
+	}
+	for( byte_index = 0;
+	     byte_index < 4;
+	     byte_index++ )
+	{
+		hash ^= identifier & 0xff;
+		hash *= 0x01000193UL;
+
+		identifier >>= 8;
+	}
+	return( hash );
+}
+
+/* Creates a message catalog
+ * Make sure the value message_catalog is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int message_catalog_initialize(
+     message_catalog_t **message_catalog,
+     libcerror_error_t **error )
+{
+	static char *function = "message_catalog_initialize";
+
+	if( message_catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( *message_catalog != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid message catalog value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*message_catalog = memory_allocate_structure(
+	                    message_catalog_t );
+
+	if( *message_catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create message catalog.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *message_catalog,
+	     0,
+	     sizeof( message_catalog_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear message catalog.",
+		 function );
+
+		memory_free(
+		 *message_catalog );
+
+		*message_catalog = NULL;
+
+		return( -1 );
+	}
+	( *message_catalog )->buckets_data = (uint8_t *) memory_allocate(
+	                                                  sizeof( uint32_t ) * MESSAGE_CATALOG_NUMBER_OF_BUCKETS );
+
+	if( ( *message_catalog )->buckets_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buckets data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *message_catalog )->buckets_data,
+	     0,
+	     sizeof( uint32_t ) * MESSAGE_CATALOG_NUMBER_OF_BUCKETS ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buckets data.",
+		 function );
+
+		goto on_error;
+	}
+	( *message_catalog )->number_of_buckets = MESSAGE_CATALOG_NUMBER_OF_BUCKETS;
+
+	return( 1 );
+
+on_error:
+	if( *message_catalog != NULL )
+	{
+		if( ( *message_catalog )->buckets_data != NULL )
+		{
+			memory_free(
+			 ( *message_catalog )->buckets_data );
+		}
+		memory_free(
+		 *message_catalog );
+
+		*message_catalog = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a message catalog
+ * Returns 1 if successful or -1 on error
+ */
+int message_catalog_free(
+     message_catalog_t **message_catalog,
+     libcerror_error_t **error )
+{
+	static char *function = "message_catalog_free";
+	uint32_t entry_index  = 0;
+	int result            = 1;
+
+	if( message_catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( *message_catalog != NULL )
+	{
+		if( ( *message_catalog )->message_strings != NULL )
+		{
+			for( entry_index = 0;
+			     entry_index < ( *message_catalog )->number_of_entries;
+			     entry_index++ )
+			{
+				if( ( *message_catalog )->message_strings[ entry_index ] == NULL )
+				{
+					continue;
+				}
+				if( message_string_free(
+				     &( ( *message_catalog )->message_strings[ entry_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free message string: %" PRIu32 ".",
+					 function,
+					 entry_index );
+
+					result = -1;
+				}
+			}
+			memory_free(
+			 ( *message_catalog )->message_strings );
+		}
+		if( ( *message_catalog )->template_definitions != NULL )
+		{
+			for( entry_index = 0;
+			     entry_index < ( *message_catalog )->number_of_entries;
+			     entry_index++ )
+			{
+				if( ( *message_catalog )->template_definitions[ entry_index ] == NULL )
+				{
+					continue;
+				}
+				if( libevtx_template_definition_free(
+				     &( ( *message_catalog )->template_definitions[ entry_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free template definition: %" PRIu32 ".",
+					 function,
+					 entry_index );
+
+					result = -1;
+				}
+			}
+			memory_free(
+			 ( *message_catalog )->template_definitions );
+		}
+		/* The buckets, entries and values data of a catalog that was read
+		 * are part of the file data
+		 */
+		if( ( *message_catalog )->file_data != NULL )
+		{
+			memory_free(
+			 ( *message_catalog )->file_data );
+		}
+		else
+		{
+			if( ( *message_catalog )->values_data != NULL )
+			{
+				memory_free(
+				 ( *message_catalog )->values_data );
+			}
+			if( ( *message_catalog )->entries_data != NULL )
+			{
+				memory_free(
+				 ( *message_catalog )->entries_data );
+			}
+			if( ( *message_catalog )->buckets_data != NULL )
+			{
+				memory_free(
+				 ( *message_catalog )->buckets_data );
+			}
+		}
+		memory_free(
+		 *message_catalog );
+
+		*message_catalog = NULL;
+	}
+	return( result );
+}
+
+/* Sets the name of the event log (Windows Registry) key the catalog is compiled for
+ * Returns 1 if successful or -1 on error
+ */
+int message_catalog_set_eventlog_key_name(
+     message_catalog_t *message_catalog,
+     const char *eventlog_key_name,
+     libcerror_error_t **error )
+{
+	static char *function           = "message_catalog_set_eventlog_key_name";
+	size_t eventlog_key_name_length = 0;
+
+	if( message_catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( eventlog_key_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid eventlog key name.",
+		 function );
+
+		return( -1 );
+	}
+	eventlog_key_name_length = narrow_string_length(
+	                            eventlog_key_name );
+
+	if( eventlog_key_name_length >= 32 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid eventlog key name length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     message_catalog->eventlog_key_name,
+	     0,
+	     32 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear eventlog key name.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     message_catalog->eventlog_key_name,
+	     eventlog_key_name,
+	     eventlog_key_name_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy eventlog key name.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the index of the entry of a specific type, key and identifier
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int message_catalog_get_entry_by_key(
+     message_catalog_t *message_catalog,
+     uint32_t entry_type,
+     const system_character_t *key,
+     size_t key_length,
+     uint32_t identifier,
+     uint32_t *entry_index,
+     libcerror_error_t **error )
+{
+	message_catalog_entry_t *entry = NULL;
+	static char *function          = "message_catalog_get_entry_by_key";
+	uint32_t bucket_index          = 0;
+	uint32_t entry_hash            = 0;
+	uint32_t entry_identifier      = 0;
+	uint32_t entry_key_offset      = 0;
+	uint32_t entry_key_size        = 0;
+	uint32_t entry_number          = 0;
+	uint32_t hash                  = 0;
+	uint32_t number_of_iterations  = 0;
+	uint32_t stored_entry_type     = 0;
+
+	if( message_catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_length > (size_t) ( ( UINT32_MAX / sizeof( system_character_t ) ) - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid key length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry index.",
+		 function );
+
+		return( -1 );
+	}
+	hash = message_catalog_calculate_hash(
+	        entry_type,
+	        key,
+	        key_length,
+	        identifier );
+
+	bucket_index = hash & ( message_catalog->number_of_buckets - 1 );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( message_catalog->buckets_data[ bucket_index * sizeof( uint32_t ) ] ),
+	 entry_number );
+
+	while( entry_number != 0 )
+	{
+		/* Prevent a corrupted catalog from causing an endless loop
+		 */
+		if( ( entry_number > message_catalog->number_of_entries )
+		 || ( number_of_iterations >= message_catalog->number_of_entries ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid entry number: %" PRIu32 " value out of bounds.",
+			 function,
+			 entry_number );
+
+			return( -1 );
+		}
+		number_of_iterations++;
+
+		entry = (message_catalog_entry_t *) &( message_catalog->entries_data[ ( entry_number - 1 ) * sizeof( message_catalog_entry_t ) ] );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 entry->hash,
+		 entry_hash );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 entry->type,
+		 stored_entry_type );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 entry->identifier,
+		 entry_identifier );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 entry->key_offset,
+		 entry_key_offset );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 entry->key_size,
+		 entry_key_size );
+
+		if( ( entry_hash == hash )
+		 && ( stored_entry_type == entry_type )
+		 && ( entry_identifier == identifier )
+		 && ( entry_key_size == (uint32_t) ( ( key_length + 1 ) * sizeof( system_character_t ) ) ) )
+		{
+			if( ( (size_t) entry_key_offset > message_catalog->values_data_size )
+			 || ( (size_t) entry_key_size > ( message_catalog->values_data_size - entry_key_offset ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid entry: %" PRIu32 " key value out of bounds.",
+				 function,
+				 entry_number - 1 );
+
+				return( -1 );
+			}
+			if( system_string_compare_no_case(
+			     (system_character_t *) &( message_catalog->values_data[ entry_key_offset ] ),
+			     key,
+			     key_length ) == 0 )
+			{
+				*entry_index = entry_number - 1;
+
+				return( 1 );
+			}
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 entry->next_entry_number,
+		 entry_number );
+	}
+	return( 0 );
+}
+
+/* Appends data to the values data
+ * The data is padded with 0-byte values to value data size, which is aligned to 4 bytes
+ * Returns 1 if successful or -1 on error
+ */
+int message_catalog_append_value_data(
+     message_catalog_t *message_catalog,
+     const uint8_t *data,
+     size_t data_size,
+     size_t value_data_size,
+     uint32_t *value_data_offset,
+     libcerror_error_t **error )
+{
+	uint8_t *reallocation           = NULL;
+	static char *function           = "message_catalog_append_value_data";
+	size_t aligned_value_data_size  = 0;
+	size_t maximum_values_data_size = 0;
+
+	if( message_catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data == NULL )
+	 && ( data_size != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_data_size < data_size )
+	 || ( value_data_size > (size_t) ( UINT32_MAX - 3 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data offset.",
+		 function );
+
+		return( -1 );
+	}
+	aligned_value_data_size = ( value_data_size + 3 ) & ~( (size_t) 3 );
+
+	if( aligned_value_data_size > (size_t) ( UINT32_MAX - message_catalog->values_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid values data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( message_catalog->values_data_size + aligned_value_data_size ) > message_catalog->maximum_values_data_size )
+	{
+		maximum_values_data_size = message_catalog->maximum_values_data_size * 2;
+
+		if( maximum_values_data_size < 65536 )
+		{
+			maximum_values_data_size = 65536;
+		}
+		if( maximum_values_data_size < ( message_catalog->values_data_size + aligned_value_data_size ) )
+		{
+			maximum_values_data_size = message_catalog->values_data_size + aligned_value_data_size;
+		}
+		reallocation = (uint8_t *) memory_reallocate(
+		                            message_catalog->values_data,
+		                            sizeof( uint8_t ) * maximum_values_data_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize values data.",
+			 function );
+
+			return( -1 );
+		}
+		message_catalog->values_data              = reallocation;
+		message_catalog->maximum_values_data_size = maximum_values_data_size;
+	}
+	if( data_size > 0 )
+	{
+		if( memory_copy(
+		     &( message_catalog->values_data[ message_catalog->values_data_size ] ),
+		     data,
+		     data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy value data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( aligned_value_data_size > data_size )
+	{
+		if( memory_set(
+		     &( message_catalog->values_data[ message_catalog->values_data_size + data_size ] ),
+		     0,
+		     aligned_value_data_size - data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear value data padding.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*value_data_offset = (uint32_t) message_catalog->values_data_size;
+
+	message_catalog->values_data_size += aligned_value_data_size;
+
+	return( 1 );
+}
+
+/* Appends an entry
+ * String values are expected to include the end-of-string character
+ * Returns 1 if successful, 0 if an entry with the same type, key and identifier already exists or -1 on error
+ */
+int message_catalog_append_entry(
+     message_catalog_t *message_catalog,
+     uint32_t entry_type,
+     const system_character_t *key,
+     size_t key_length,
+     uint32_t identifier,
+     uint32_t value_number,
+     const uint8_t *value1_data,
+     size_t value1_data_size,
+     const uint8_t *value2_data,
+     size_t value2_data_size,
+     libcerror_error_t **error )
+{
+	message_catalog_entry_t *entry     = NULL;
+	uint8_t *reallocation              = NULL;
+	static char *function              = "message_catalog_append_entry";
+	uint32_t bucket_index              = 0;
+	uint32_t entry_index               = 0;
+	uint32_t hash                      = 0;
+	uint32_t key_offset                = 0;
+	uint32_t maximum_number_of_entries = 0;
+	uint32_t next_entry_number         = 0;
+	uint32_t value1_offset             = 0;
+	uint32_t value2_offset             = 0;
+	int result                         = 0;
+
+	if( message_catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_catalog->file_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported message catalog - catalog that was read cannot be modified.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value1_data_size > (size_t) UINT32_MAX )
+	 || ( value2_data_size > (size_t) UINT32_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	result = message_catalog_get_entry_by_key(
+	          message_catalog,
+	          entry_type,
+	          key,
+	          key_length,
+	          identifier,
+	          &entry_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		return( 0 );
+	}
+	if( message_catalog->number_of_entries >= message_catalog->maximum_number_of_entries )
+	{
+		if( message_catalog->maximum_number_of_entries >= (uint32_t) ( UINT32_MAX / ( 2 * sizeof( message_catalog_entry_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of entries value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		maximum_number_of_entries = message_catalog->maximum_number_of_entries * 2;
+
+		if( maximum_number_of_entries < 1024 )
+		{
+			maximum_number_of_entries = 1024;
+		}
+		reallocation = (uint8_t *) memory_reallocate(
+		                            message_catalog->entries_data,
+		                            sizeof( message_catalog_entry_t ) * maximum_number_of_entries );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entries data.",
+			 function );
+
+			return( -1 );
+		}
+		message_catalog->entries_data              = reallocation;
+		message_catalog->maximum_number_of_entries = maximum_number_of_entries;
+	}
+	/* The key is stored with an end-of-string character
+	 */
+	if( message_catalog_append_value_data(
+	     message_catalog,
+	     (uint8_t *) key,
+	     key_length * sizeof( system_character_t ),
+	     ( key_length + 1 ) * sizeof( system_character_t ),
+	     &key_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append key.",
+		 function );
+
+		return( -1 );
+	}
+	if( value1_data_size > 0 )
+	{
+		if( message_catalog_append_value_data(
+		     message_catalog,
+		     value1_data,
+		     value1_data_size,
+		     value1_data_size,
+		     &value1_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append value 1.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( value2_data_size > 0 )
+	{
+		if( message_catalog_append_value_data(
+		     message_catalog,
+		     value2_data,
+		     value2_data_size,
+		     value2_data_size,
+		     &value2_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append value 2.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	hash = message_catalog_calculate_hash(
+	        entry_type,
+	        key,
+	        key_length,
+	        identifier );
+
+	bucket_index = hash & ( message_catalog->number_of_buckets - 1 );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( message_catalog->buckets_data[ bucket_index * sizeof( uint32_t ) ] ),
+	 next_entry_number );
+
+	entry = (message_catalog_entry_t *) &( message_catalog->entries_data[ message_catalog->number_of_entries * sizeof( message_catalog_entry_t ) ] );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 entry->type,
+	 entry_type );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 entry->hash,
+	 hash );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 entry->next_entry_number,
+	 next_entry_number );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 entry->identifier,
+	 identifier );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 entry->key_offset,
+	 key_offset );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 entry->key_size,
+	 (uint32_t) ( ( key_length + 1 ) * sizeof( system_character_t ) ) );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 entry->value_number,
+	 value_number );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 entry->value1_offset,
+	 value1_offset );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 entry->value1_size,
+	 (uint32_t) value1_data_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 entry->value2_offset,
+	 value2_offset );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 entry->value2_size,
+	 (uint32_t) value2_data_size );
+
+	message_catalog->number_of_entries += 1;
+
+	/* The new entry becomes the first entry of the bucket
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 &( message_catalog->buckets_data[ bucket_index * sizeof( uint32_t ) ] ),
+	 message_catalog->number_of_entries );
+
+	return( 1 );
+}
+
+/* Writes the message catalog to a file
+ * Returns 1 if successful or -1 on error
+ */
+int message_catalog_write(
+     message_catalog_t *message_catalog,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	message_catalog_file_header_t file_header;
+
+	FILE *file_stream     = NULL;
+	static char *function = "message_catalog_write";
+	size_t write_size     = 0;
+
+	if( message_catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &file_header,
+	     0,
+	     sizeof( message_catalog_file_header_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     file_header.signature,
+	     message_catalog_file_signature,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header.format_version,
+	 MESSAGE_CATALOG_FORMAT_VERSION );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header.character_size,
+	 (uint32_t) sizeof( system_character_t ) );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header.number_of_buckets,
+	 message_catalog->number_of_buckets );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header.number_of_entries,
+	 message_catalog->number_of_entries );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header.values_data_size,
+	 (uint32_t) message_catalog->values_data_size );
+
+	if( memory_copy(
+	     file_header.eventlog_key_name,
+	     message_catalog->eventlog_key_name,
+	     32 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy eventlog key name.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	file_stream = file_stream_open_wide(
+	               filename,
+	               _SYSTEM_STRING( FILE_STREAM_BINARY_OPEN_WRITE ) );
+#else
+	file_stream = file_stream_open(
+	               filename,
+	               FILE_STREAM_BINARY_OPEN_WRITE );
+#endif
+	if( file_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		goto on_error;
+	}
+	write_size = file_stream_write(
+	              file_stream,
+	              &file_header,
+	              sizeof( message_catalog_file_header_t ) );
+
+	if( write_size != sizeof( message_catalog_file_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write file header.",
+		 function );
+
+		goto on_error;
+	}
+	write_size = sizeof( uint32_t ) * message_catalog->number_of_buckets;
+
+	if( file_stream_write(
+	     file_stream,
+	     message_catalog->buckets_data,
+	     write_size ) != write_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write buckets data.",
+		 function );
+
+		goto on_error;
+	}
+	if( message_catalog->number_of_entries > 0 )
+	{
+		write_size = sizeof( message_catalog_entry_t ) * message_catalog->number_of_entries;
+
+		if( file_stream_write(
+		     file_stream,
+		     message_catalog->entries_data,
+		     write_size ) != write_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write entries data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( message_catalog->values_data_size > 0 )
+	{
+		write_size = message_catalog->values_data_size;
+
+		if( file_stream_write(
+		     file_stream,
+		     message_catalog->values_data,
+		     write_size ) != write_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write values data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( file_stream_close(
+	     file_stream ) != 0 )
+	{
+		file_stream = NULL;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_stream != NULL )
+	{
+		file_stream_close(
+		 file_stream );
+	}
+	return( -1 );
+}
+
+/* Reads the message catalog from a file
+ * The file is read into a single buffer and the entries are used in-place
+ * Returns 1 if successful or -1 on error
+ */
+int message_catalog_read(
+     message_catalog_t *message_catalog,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	message_catalog_file_header_t file_header;
+
+	FILE *file_stream          = NULL;
+	uint8_t *file_data         = NULL;
+	static char *function      = "message_catalog_read";
+	size_t read_size           = 0;
+	uint64_t file_size         = 0;
+	uint32_t character_size    = 0;
+	uint32_t format_version    = 0;
+	uint32_t number_of_buckets = 0;
+	uint32_t number_of_entries = 0;
+	uint32_t values_data_size  = 0;
+
+	if( message_catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( message_catalog->file_data != NULL )
+	 || ( message_catalog->number_of_entries != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid message catalog - entries already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	file_stream = file_stream_open_wide(
+	               filename,
+	               _SYSTEM_STRING( FILE_STREAM_BINARY_OPEN_READ ) );
+#else
+	file_stream = file_stream_open(
+	               filename,
+	               FILE_STREAM_BINARY_OPEN_READ );
+#endif
+	if( file_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		goto on_error;
+	}
+	read_size = file_stream_read(
+	             file_stream,
+	             &file_header,
+	             sizeof( message_catalog_file_header_t ) );
+
+	if( read_size != sizeof( message_catalog_file_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_compare(
+	     file_header.signature,
+	     message_catalog_file_signature,
+	     8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported file signature.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header.format_version,
+	 format_version );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header.character_size,
+	 character_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header.number_of_buckets,
+	 number_of_buckets );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header.number_of_entries,
+	 number_of_entries );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header.values_data_size,
+	 values_data_size );
+
+	if( format_version != MESSAGE_CATALOG_FORMAT_VERSION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format version: %" PRIu32 ".",
+		 function,
+		 format_version );
+
+		goto on_error;
+	}
+	/* The strings are stored as system strings hence the catalog can only be
+	 * used by tools built with the same system character size
+	 */
+	if( character_size != (uint32_t) sizeof( system_character_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported character size: %" PRIu32 ".",
+		 function,
+		 character_size );
+
+		goto on_error;
+	}
+	if( ( number_of_buckets == 0 )
+	 || ( ( number_of_buckets & ( number_of_buckets - 1 ) ) != 0 )
+	 || ( number_of_buckets > ( UINT32_MAX / sizeof( uint32_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of buckets value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	file_size = sizeof( message_catalog_file_header_t )
+	          + ( (uint64_t) number_of_buckets * sizeof( uint32_t ) )
+	          + ( (uint64_t) number_of_entries * sizeof( message_catalog_entry_t ) )
+	          + values_data_size;
+
+	if( file_size > (uint64_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file size value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	file_data = (uint8_t *) memory_allocate(
+	                         sizeof( uint8_t ) * (size_t) file_size );
+
+	if( file_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create file data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     file_data,
+	     &file_header,
+	     sizeof( message_catalog_file_header_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy file header.",
+		 function );
+
+		goto on_error;
+	}
+	read_size = (size_t) file_size - sizeof( message_catalog_file_header_t );
+
+	if( file_stream_read(
+	     file_stream,
+	     &( file_data[ sizeof( message_catalog_file_header_t ) ] ),
+	     read_size ) != read_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file data.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_stream_close(
+	     file_stream ) != 0 )
+	{
+		file_stream = NULL;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file.",
+		 function );
+
+		goto on_error;
+	}
+	file_stream = NULL;
+
+	if( number_of_entries > 0 )
+	{
+		message_catalog->message_strings = (message_string_t **) memory_allocate(
+		                                                          sizeof( message_string_t * ) * number_of_entries );
+
+		if( message_catalog->message_strings == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create message strings.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     message_catalog->message_strings,
+		     0,
+		     sizeof( message_string_t * ) * number_of_entries ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear message strings.",
+			 function );
+
+			goto on_error;
+		}
+		message_catalog->template_definitions = (libevtx_template_definition_t **) memory_allocate(
+		                                                                            sizeof( libevtx_template_definition_t * ) * number_of_entries );
+
+		if( message_catalog->template_definitions == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create template definitions.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     message_catalog->template_definitions,
+		     0,
+		     sizeof( libevtx_template_definition_t * ) * number_of_entries ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear template definitions.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( memory_copy(
+	     message_catalog->eventlog_key_name,
+	     file_header.eventlog_key_name,
+	     31 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy eventlog key name.",
+		 function );
+
+		goto on_error;
+	}
+	message_catalog->eventlog_key_name[ 31 ] = 0;
+
+	/* The buckets data allocated by initialize is replaced by the buckets in the file data
+	 */
+	memory_free(
+	 message_catalog->buckets_data );
+
+	message_catalog->file_data         = file_data;
+	message_catalog->buckets_data      = &( file_data[ sizeof( message_catalog_file_header_t ) ] );
+	message_catalog->number_of_buckets = number_of_buckets;
+	message_catalog->entries_data      = &( message_catalog->buckets_data[ number_of_buckets * sizeof( uint32_t ) ] );
+	message_catalog->number_of_entries = number_of_entries;
+	message_catalog->values_data       = &( message_catalog->entries_data[ number_of_entries * sizeof( message_catalog_entry_t ) ] );
+	message_catalog->values_data_size  = (size_t) values_data_size;
+
+	return( 1 );
+
+on_error:
+	if( message_catalog->template_definitions != NULL )
+	{
+		memory_free(
+		 message_catalog->template_definitions );
+
+		message_catalog->template_definitions = NULL;
+	}
+	if( message_catalog->message_strings != NULL )
+	{
+		memory_free(
+		 message_catalog->message_strings );
+
+		message_catalog->message_strings = NULL;
+	}
+	if( file_data != NULL )
+	{
+		memory_free(
+		 file_data );
+	}
+	if( file_stream != NULL )
+	{
+		file_stream_close(
+		 file_stream );
+	}
+	return( -1 );
+}
+
+/* Retrieves the data of a specific value of a specific entry
+ * The data is owned by the catalog
+ * Returns 1 if successful, 0 if the value is not set or -1 on error
+ */
+int message_catalog_get_entry_value_data(
+     message_catalog_t *message_catalog,
+     uint32_t entry_index,
+     int value_index,
+     const uint8_t **value_data,
+     size_t *value_data_size,
+     uint32_t *value_number,
+     libcerror_error_t **error )
+{
+	message_catalog_entry_t *entry = NULL;
+	static char *function          = "message_catalog_get_entry_value_data";
+	uint32_t data_offset           = 0;
+	uint32_t data_size             = 0;
+
+	if( message_catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index >= message_catalog->number_of_entries )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_index != 1 )
+	 && ( value_index != 2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value index: %d.",
+		 function,
+		 value_index );
+
+		return( -1 );
+	}
+	if( value_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data size.",
+		 function );
+
+		return( -1 );
+	}
+	entry = (message_catalog_entry_t *) &( message_catalog->entries_data[ entry_index * sizeof( message_catalog_entry_t ) ] );
+
+	if( value_index == 1 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 entry->value1_offset,
+		 data_offset );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 entry->value1_size,
+		 data_size );
+	}
+	else
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 entry->value2_offset,
+		 data_offset );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 entry->value2_size,
+		 data_size );
+	}
+	if( value_number != NULL )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 entry->value_number,
+		 *value_number );
+	}
+	if( data_size == 0 )
+	{
+		return( 0 );
+	}
+	if( ( (size_t) data_offset > message_catalog->values_data_size )
+	 || ( (size_t) data_size > ( message_catalog->values_data_size - data_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry: %" PRIu32 " value: %d out of bounds.",
+		 function,
+		 entry_index,
+		 value_index );
+
+		return( -1 );
+	}
+	*value_data      = &( message_catalog->values_data[ data_offset ] );
+	*value_data_size = (size_t) data_size;
+
+	return( 1 );
+}
+
+/* Retrieves the string of a specific value of a specific entry
+ * The string is owned by the catalog
+ * Returns 1 if successful, 0 if the value is not set or -1 on error
+ */
+int message_catalog_get_entry_value_string(
+     message_catalog_t *message_catalog,
+     uint32_t entry_index,
+     int value_index,
+     const system_character_t **value_string,
+     size_t *value_string_size,
+     libcerror_error_t **error )
+{
+	const uint8_t *value_data = NULL;
+	static char *function     = "message_catalog_get_entry_value_string";
+	size_t value_data_size    = 0;
+	size_t string_size        = 0;
+	int result                = 0;
+
+	if( value_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value string.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value string size.",
+		 function );
+
+		return( -1 );
+	}
+	result = message_catalog_get_entry_value_data(
+	          message_catalog,
+	          entry_index,
+	          value_index,
+	          &value_data,
+	          &value_data_size,
+	          NULL,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry: %" PRIu32 " value: %d data.",
+		 function,
+		 entry_index,
+		 value_index );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	string_size = value_data_size / sizeof( system_character_t );
+
+	if( ( ( value_data_size % sizeof( system_character_t ) ) != 0 )
+	 || ( ( (system_character_t *) value_data )[ string_size - 1 ] != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported entry: %" PRIu32 " value: %d string.",
+		 function,
+		 entry_index,
+		 value_index );
+
+		return( -1 );
+	}
+	*value_string      = (system_character_t *) value_data;
+	*value_string_size = string_size;
+
+	return( 1 );
+}
+
+/* Retrieves a specific value string of a publisher or event source
+ * The value string is owned by the catalog
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int message_catalog_get_value_string(
+     message_catalog_t *message_catalog,
+     uint32_t entry_type,
+     const system_character_t *key,
+     size_t key_length,
+     const system_character_t *value_name,
+     size_t value_name_length,
+     const system_character_t **value_string,
+     size_t *value_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "message_catalog_get_value_string";
+	uint32_t entry_index  = 0;
+	int result            = 0;
+	int value_index       = 0;
+
+	if( value_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value name.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_type == MESSAGE_CATALOG_ENTRY_TYPE_PUBLISHER )
+	{
+		if( ( value_name_length == 16 )
+		 && ( system_string_compare_no_case(
+		       value_name,
+		       _SYSTEM_STRING( "ResourceFileName" ),
+		       16 ) == 0 ) )
+		{
+			value_index = 1;
+		}
+		else if( ( value_name_length == 15 )
+		      && ( system_string_compare_no_case(
+		            value_name,
+		            _SYSTEM_STRING( "MessageFileName" ),
+		            15 ) == 0 ) )
+		{
+			value_index = 2;
+		}
+	}
+	else if( entry_type == MESSAGE_CATALOG_ENTRY_TYPE_EVENT_SOURCE )
+	{
+		if( ( value_name_length == 16 )
+		 && ( system_string_compare_no_case(
+		       value_name,
+		       _SYSTEM_STRING( "EventMessageFile" ),
+		       16 ) == 0 ) )
+		{
+			value_index = 1;
+		}
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported entry type: %" PRIu32 ".",
+		 function,
+		 entry_type );
+
+		return( -1 );
+	}
+	/* Values that are not stored in the catalog are not available
+	 */
+	if( value_index == 0 )
+	{
+		return( 0 );
+	}
+	result = message_catalog_get_entry_by_key(
+	          message_catalog,
+	          entry_type,
+	          key,
+	          key_length,
+	          0,
+	          &entry_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	result = message_catalog_get_entry_value_string(
+	          message_catalog,
+	          entry_index,
+	          value_index,
+	          value_string,
+	          value_string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: %" PRIs_SYSTEM " string.",
+		 function,
+		 value_name );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the message identifier and template definition of a specific event
+ * The template definition is created on first use and owned by the catalog
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int message_catalog_get_event(
+     message_catalog_t *message_catalog,
+     const system_character_t *provider_identifier,
+     size_t provider_identifier_length,
+     uint32_t event_identifier,
+     uint32_t *message_identifier,
+     libevtx_template_definition_t **template_definition,
+     libcerror_error_t **error )
+{
+	const uint8_t *template_data  = NULL;
+	const uint8_t *value2_data    = NULL;
+	static char *function         = "message_catalog_get_event";
+	size_t template_data_size     = 0;
+	size_t value2_data_size       = 0;
+	uint32_t entry_index          = 0;
+	uint32_t template_data_offset = 0;
+	int result                    = 0;
+
+	if( message_catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message identifier.",
+		 function );
+
+		return( -1 );
+	}
+	result = message_catalog_get_entry_by_key(
+	          message_catalog,
+	          MESSAGE_CATALOG_ENTRY_TYPE_EVENT,
+	          provider_identifier,
+	          provider_identifier_length,
+	          event_identifier,
+	          &entry_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	result = message_catalog_get_entry_value_data(
+	          message_catalog,
+	          entry_index,
+	          1,
+	          &template_data,
+	          &template_data_size,
+	          message_identifier,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve template data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( template_definition == NULL )
+	 || ( result == 0 ) )
+	{
+		return( 1 );
+	}
+	if( message_catalog->template_definitions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid message catalog - missing template definitions.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_catalog->template_definitions[ entry_index ] == NULL )
+	{
+		result = message_catalog_get_entry_value_data(
+		          message_catalog,
+		          entry_index,
+		          2,
+		          &value2_data,
+		          &value2_data_size,
+		          NULL,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve template data offset.",
+			 function );
+
+			return( -1 );
+		}
+		else if( ( result != 0 )
+		      && ( value2_data_size == 4 ) )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 value2_data,
+			 template_data_offset );
+		}
+		if( libevtx_template_definition_initialize(
+		     &( message_catalog->template_definitions[ entry_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create template definition.",
+			 function );
+
+			return( -1 );
+		}
+		if( libevtx_template_definition_set_data(
+		     message_catalog->template_definitions[ entry_index ],
+		     template_data,
+		     template_data_size,
+		     template_data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set template definition data.",
+			 function );
+
+			libevtx_template_definition_free(
+			 &( message_catalog->template_definitions[ entry_index ] ),
+			 NULL );
+
+			return( -1 );
+		}
+	}
+	*template_definition = message_catalog->template_definitions[ entry_index ];
+
+	return( 1 );
+}
+
+/* Retrieves a specific message string of specific message filename(s)
+ * The message string is created on first use and owned by the catalog
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int message_catalog_get_message_string(
+     message_catalog_t *message_catalog,
+     const system_character_t *message_filename,
+     size_t message_filename_length,
+     uint32_t message_identifier,
+     message_string_t **message_string,
+     libcerror_error_t **error )
+{
+	const system_character_t *string = NULL;
+	static char *function            = "message_catalog_get_message_string";
+	size_t string_size               = 0;
+	uint32_t entry_index             = 0;
+	int result                       = 0;
+
+	if( message_catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message string.",
+		 function );
+
+		return( -1 );
+	}
+	result = message_catalog_get_entry_by_key(
+	          message_catalog,
+	          MESSAGE_CATALOG_ENTRY_TYPE_MESSAGE,
+	          message_filename,
+	          message_filename_length,
+	          message_identifier,
+	          &entry_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( message_catalog->message_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid message catalog - missing message strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_catalog->message_strings[ entry_index ] == NULL )
+	{
+		result = message_catalog_get_entry_value_string(
+		          message_catalog,
+		          entry_index,
+		          1,
+		          &string,
+		          &string_size,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve message string: 0x%08" PRIx32 ".",
+			 function,
+			 message_identifier );
+
+			goto on_error;
+		}
+		if( message_string_initialize(
+		     &( message_catalog->message_strings[ entry_index ] ),
+		     message_identifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create message string.",
+			 function );
+
+			goto on_error;
+		}
+		message_catalog->message_strings[ entry_index ]->string = system_string_allocate(
+		                                                           string_size );
+
+		if( message_catalog->message_strings[ entry_index ]->string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create message string.",
+			 function );
+
+			goto on_error;
+		}
+		if( system_string_copy(
+		     message_catalog->message_strings[ entry_index ]->string,
+		     string,
+		     string_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy message string.",
+			 function );
+
+			goto on_error;
+		}
+		message_catalog->message_strings[ entry_index ]->string_size = string_size;
+	}
+	*message_string = message_catalog->message_strings[ entry_index ];
+
+	return( 1 );
+
+on_error:
+	if( message_catalog->message_strings[ entry_index ] != NULL )
+	{
+		message_string_free(
+		 &( message_catalog->message_strings[ entry_index ] ),
+		 NULL );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,229 @@
+/*
+ * Message catalog
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _MESSAGE_CATALOG_H )
+#define _MESSAGE_CATALOG_H
+
+#include <common.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+#include "evtxtools_libevtx.h"
+#include "message_string.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#define MESSAGE_CATALOG_FORMAT_VERSION			1
+#define MESSAGE_CATALOG_NUMBER_OF_BUCKETS		65536
+
+enum MESSAGE_CATALOG_ENTRY_TYPES
+{
+	/* The entry contains the values of a publisher (provider) by identifier
+	 * value 1 contains the resource filename(s) and value 2 the message filename(s)
+	 */
+	MESSAGE_CATALOG_ENTRY_TYPE_PUBLISHER		= 1,
+
+	/* The entry contains the values of an event source by name
+	 * value 1 contains the event message filename(s)
+	 */
+	MESSAGE_CATALOG_ENTRY_TYPE_EVENT_SOURCE		= 2,
+
+	/* The entry contains an event of a provider by provider identifier and event identifier
+	 * the value number contains the message identifier, value 1 the template data
+	 * and value 2 the 32-bit little-endian offset of the template data in the resource
+	 */
+	MESSAGE_CATALOG_ENTRY_TYPE_EVENT		= 3,
+
+	/* The entry contains a message string by message filename(s) and message identifier
+	 * value 1 contains the message string
+	 */
+	MESSAGE_CATALOG_ENTRY_TYPE_MESSAGE		= 4,
+
+	/* The entry indicates the message strings of message filename(s) were compiled
+	 */
+	MESSAGE_CATALOG_ENTRY_TYPE_MESSAGE_FILE		= 5
+};
+
+typedef struct message_catalog message_catalog_t;
+
+struct message_catalog
+{
+	/* The name of the event log (Windows Registry) key the catalog was compiled for
+	 */
+	char eventlog_key_name[ 32 ];
+
+	/* The data of a catalog that was read
+	 */
+	uint8_t *file_data;
+
+	/* The hash buckets data
+	 */
+	uint8_t *buckets_data;
+
+	/* The number of hash buckets
+	 */
+	uint32_t number_of_buckets;
+
+	/* The entries data
+	 */
+	uint8_t *entries_data;
+
+	/* The number of entries
+	 */
+	uint32_t number_of_entries;
+
+	/* The number of entries the entries data was allocated for
+	 */
+	uint32_t maximum_number_of_entries;
+
+	/* The values data
+	 */
+	uint8_t *values_data;
+
+	/* The values data size
+	 */
+	size_t values_data_size;
+
+	/* The allocated values data size
+	 */
+	size_t maximum_values_data_size;
+
+	/* The message strings materialized from the entries
+	 */
+	message_string_t **message_strings;
+
+	/* The template definitions materialized from the entries
+	 */
+	libevtx_template_definition_t **template_definitions;
+};
+
+uint32_t message_catalog_calculate_hash(
+          uint32_t entry_type,
+          const system_character_t *key,
+          size_t key_length,
+          uint32_t identifier );
+
+int message_catalog_initialize(
+     message_catalog_t **message_catalog,
+     libcerror_error_t **error );
+
+int message_catalog_free(
+     message_catalog_t **message_catalog,
+     libcerror_error_t **error );
+
+int message_catalog_set_eventlog_key_name(
+     message_catalog_t *message_catalog,
+     const char *eventlog_key_name,
+     libcerror_error_t **error );
+
+int message_catalog_get_entry_by_key(
+     message_catalog_t *message_catalog,
+     uint32_t entry_type,
+     const system_character_t *key,
+     size_t key_length,
+     uint32_t identifier,
+     uint32_t *entry_index,
+     libcerror_error_t **error );
+
+int message_catalog_append_value_data(
+     message_catalog_t *message_catalog,
+     const uint8_t *data,
+     size_t data_size,
+     size_t value_data_size,
+     uint32_t *value_data_offset,
+     libcerror_error_t **error );
+
+int message_catalog_append_entry(
+     message_catalog_t *message_catalog,
+     uint32_t entry_type,
+     const system_character_t *key,
+     size_t key_length,
+     uint32_t identifier,
+     uint32_t value_number,
+     const uint8_t *value1_data,
+     size_t value1_data_size,
+     const uint8_t *value2_data,
+     size_t value2_data_size,
+     libcerror_error_t **error );
+
+int message_catalog_write(
+     message_catalog_t *message_catalog,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int message_catalog_read(
+     message_catalog_t *message_catalog,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int message_catalog_get_entry_value_data(
+     message_catalog_t *message_catalog,
+     uint32_t entry_index,
+     int value_index,
+     const uint8_t **value_data,
+     size_t *value_data_size,
+     uint32_t *value_number,
+     libcerror_error_t **error );
+
+int message_catalog_get_entry_value_string(
+     message_catalog_t *message_catalog,
+     uint32_t entry_index,
+     int value_index,
+     const system_character_t **value_string,
+     size_t *value_string_size,
+     libcerror_error_t **error );
+
+int message_catalog_get_value_string(
+     message_catalog_t *message_catalog,
+     uint32_t entry_type,
+     const system_character_t *key,
+     size_t key_length,
+     const system_character_t *value_name,
+     size_t value_name_length,
+     const system_character_t **value_string,
+     size_t *value_string_size,
+     libcerror_error_t **error );
+
+int message_catalog_get_event(
+     message_catalog_t *message_catalog,
+     const system_character_t *provider_identifier,
+     size_t provider_identifier_length,
+     uint32_t event_identifier,
+     uint32_t *message_identifier,
+     libevtx_template_definition_t **template_definition,
+     libcerror_error_t **error );
+
+int message_catalog_get_message_string(
+     message_catalog_t *message_catalog,
+     const system_character_t *message_filename,
+     size_t message_filename_length,
+     uint32_t message_identifier,
+     message_string_t **message_string,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _MESSAGE_CATALOG_H ) */
+
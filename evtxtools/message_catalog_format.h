@@ -0,0 +1,154 @@
+/*
+ * Message catalog file format definitions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _MESSAGE_CATALOG_FORMAT_H )
+#define _MESSAGE_CATALOG_FORMAT_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The message catalog file consists of:
+ * the file header
+ * the hash buckets, which contain the number of the first entry of each bucket or 0 if empty
+ * the entries
+ * the values data, which contains the keys and values the entries refer to
+ *
+ * All values are stored in little-endian and all offsets are relative to the start of the values data,
+ * hence the file can be used as-is once read into memory
+ */
+
+typedef struct message_catalog_file_header message_catalog_file_header_t;
+
+struct message_catalog_file_header
+{
+	/* The signature
+	 * Consists of 8 bytes
+	 * Contains: "EVTXMSGC"
+	 */
+	uint8_t signature[ 8 ];
+
+	/* The format version
+	 * Consists of 4 bytes
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* The size of the characters of the key and value strings
+	 * Consists of 4 bytes
+	 */
+	uint8_t character_size[ 4 ];
+
+	/* The number of hash buckets
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_buckets[ 4 ];
+
+	/* The number of entries
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_entries[ 4 ];
+
+	/* The values data size
+	 * Consists of 4 bytes
+	 */
+	uint8_t values_data_size[ 4 ];
+
+	/* Reserved
+	 * Consists of 4 bytes
+	 */
+	uint8_t reserved[ 4 ];
+
+	/* The name of the event log (Windows Registry) key the catalog was compiled for
+	 * Consists of 32 bytes
+	 * Contains an ASCII string padded with 0-byte values
+	 */
+	uint8_t eventlog_key_name[ 32 ];
+};
+
+typedef struct message_catalog_entry message_catalog_entry_t;
+
+struct message_catalog_entry
+{
+	/* The entry type
+	 * Consists of 4 bytes
+	 */
+	uint8_t type[ 4 ];
+
+	/* The hash of the key
+	 * Consists of 4 bytes
+	 */
+	uint8_t hash[ 4 ];
+
+	/* The number of the next entry in the same bucket or 0 if none
+	 * Consists of 4 bytes
+	 */
+	uint8_t next_entry_number[ 4 ];
+
+	/* The identifier, such as the event or message identifier
+	 * Consists of 4 bytes
+	 */
+	uint8_t identifier[ 4 ];
+
+	/* The key string offset
+	 * Consists of 4 bytes
+	 */
+	uint8_t key_offset[ 4 ];
+
+	/* The key string size in bytes including the end-of-string character
+	 * Consists of 4 bytes
+	 */
+	uint8_t key_size[ 4 ];
+
+	/* The value number, such as the message identifier or template offset
+	 * Consists of 4 bytes
+	 */
+	uint8_t value_number[ 4 ];
+
+	/* The first value offset
+	 * Consists of 4 bytes
+	 */
+	uint8_t value1_offset[ 4 ];
+
+	/* The first value size in bytes or 0 if not set
+	 * Consists of 4 bytes
+	 */
+	uint8_t value1_size[ 4 ];
+
+	/* The second value offset
+	 * Consists of 4 bytes
+	 */
+	uint8_t value2_offset[ 4 ];
+
+	/* The second value size in bytes or 0 if not set
+	 * Consists of 4 bytes
+	 */
+	uint8_t value2_size[ 4 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _MESSAGE_CATALOG_FORMAT_H ) */
+
@@ -26,30 +26,28 @@
 #include <types.h>
 #include <wide_string.h>
 
-#if defined( TIME_WITH_SYS_TIME )
-#include <sys/time.h>
-#include <time.h>
-#elif defined( HAVE_SYS_TIME_H )
-#include <sys/time.h>
-#else
-#include <time.h>
-#endif
-
+#include "event_provider.h"
+#include "evtxtools_libcdata.h"
 #include "evtxtools_libcdirectory.h"
 #include "evtxtools_libcerror.h"
 #include "evtxtools_libcpath.h"
 #include "evtxtools_libcsplit.h"
 #include "evtxtools_libevtx.h"
-#include "evtxtools_libfcache.h"
 #include "evtxtools_libregf.h"
 #include "evtxtools_libwrc.h"
 #include "evtxtools_system_split_string.h"
 #include "evtxtools_wide_string.h"
+#include "message_catalog.h"
 #include "message_handle.h"
 #include "message_string.h"
 #include "path_handle.h"
 #include "registry_file.h"
 #include "resource_file.h"
+#include "resource_file_cache.h"
+
+/* The maximum number of values per event providers tree node
+ */
+#define MESSAGE_HANDLE_EVENT_PROVIDERS_TREE_MAXIMUM_NUMBER_OF_VALUES	257
 
 /* Creates a message handle
  * Make sure the value message_handle is referencing, is set to NULL
@@ -129,9 +127,9 @@ int message_handle_initialize(
 
 		goto on_error;
 	}
-	if( libfcache_cache_initialize(
+	if( resource_file_cache_initialize(
 	     &( ( *message_handle )->resource_file_cache ),
-	     16,
+	     RESOURCE_FILE_CACHE_DEFAULT_CAPACITY,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -143,9 +141,9 @@ int message_handle_initialize(
 
 		goto on_error;
 	}
-	if( libfcache_cache_initialize(
+	if( resource_file_cache_initialize(
 	     &( ( *message_handle )->mui_resource_file_cache ),
-	     16,
+	     RESOURCE_FILE_CACHE_DEFAULT_CAPACITY,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -157,6 +155,20 @@ int message_handle_initialize(
 
 		goto on_error;
 	}
+	if( libcdata_btree_initialize(
+	     &( ( *message_handle )->event_providers_tree ),
+	     MESSAGE_HANDLE_EVENT_PROVIDERS_TREE_MAXIMUM_NUMBER_OF_VALUES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create event providers tree.",
+		 function );
+
+		goto on_error;
+	}
 	( *message_handle )->ascii_codepage                = LIBREGF_CODEPAGE_WINDOWS_1252;
 	( *message_handle )->preferred_language_identifier = 0x00000409UL;
 
@@ -165,9 +177,15 @@ int message_handle_initialize(
 on_error:
 	if( *message_handle != NULL )
 	{
+		if( ( *message_handle )->mui_resource_file_cache != NULL )
+		{
+			resource_file_cache_free(
+			 &( ( *message_handle )->mui_resource_file_cache ),
+			 NULL );
+		}
 		if( ( *message_handle )->resource_file_cache != NULL )
 		{
-			libfcache_cache_free(
+			resource_file_cache_free(
 			 &( ( *message_handle )->resource_file_cache ),
 			 NULL );
 		}
@@ -278,7 +296,7 @@ int message_handle_free(
 
 			result = -1;
 		}
-		if( libfcache_cache_free(
+		if( resource_file_cache_free(
 		     &( ( *message_handle )->resource_file_cache ),
 		     error ) != 1 )
 		{
@@ -291,7 +309,7 @@ int message_handle_free(
 
 			result = -1;
 		}
-		if( libfcache_cache_free(
+		if( resource_file_cache_free(
 		     &( ( *message_handle )->mui_resource_file_cache ),
 		     error ) != 1 )
 		{
@@ -304,6 +322,68 @@ int message_handle_free(
 
 			result = -1;
 		}
+		if( libcdata_btree_free(
+		     &( ( *message_handle )->event_providers_tree ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &event_provider_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free event providers tree.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *message_handle )->message_catalog != NULL )
+		{
+			if( message_catalog_free(
+			     &( ( *message_handle )->message_catalog ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free message catalog.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *message_handle )->winevt_publishers_table != NULL )
+		{
+			if( registry_key_table_free(
+			     &( ( *message_handle )->winevt_publishers_table ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free winevt publishers table.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *message_handle )->eventlog_services_table != NULL )
+		{
+			if( registry_key_table_free(
+			     &( ( *message_handle )->eventlog_services_table ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free eventlog services table.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( ( *message_handle )->winevt_publishers_key != NULL )
 		{
 			if( libregf_key_free(
@@ -807,23 +887,15 @@ int message_handle_set_resource_files_path(
 	return( 1 );
 }
 
-/* Opens the software registry file
- * Returns 1 if successful, 0 if not available or -1 on error
+/* Sets the capacity of the resource file caches
+ * Returns 1 if successful or -1 error
  */
-int message_handle_open_software_registry_file(
+int message_handle_set_resource_file_cache_capacity(
      message_handle_t *message_handle,
+     int capacity,
      libcerror_error_t **error )
 {
-	system_character_t *key_path          = NULL;
-	system_character_t *software_filename = NULL;
-	libregf_key_t *sub_key                = NULL;
-	libregf_value_t *value                = NULL;
-	const char *sub_key_path              = NULL;
-	const char *value_name                = NULL;
-	static char *function                 = "message_handle_open_software_registry_file";
-	size_t key_path_length                = 0;
-	size_t value_name_length              = 0;
-	int result                            = 0;
+	static char *function = "message_handle_set_resource_file_cache_capacity";
 
 	if( message_handle == NULL )
 	{
@@ -836,132 +908,477 @@ int message_handle_open_software_registry_file(
 
 		return( -1 );
 	}
-	if( ( message_handle->software_registry_filename == NULL )
-	 && ( message_handle->registry_directory_name != NULL ) )
+	if( resource_file_cache_set_capacity(
+	     message_handle->resource_file_cache,
+	     capacity,
+	     error ) != 1 )
 	{
-		software_filename = system_string_allocate(
-		                     9 );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set resource file cache capacity.",
+		 function );
 
-		if( software_filename == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create software filename.",
-			 function );
+		return( -1 );
+	}
+	if( resource_file_cache_set_capacity(
+	     message_handle->mui_resource_file_cache,
+	     capacity,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set MUI resource file cache capacity.",
+		 function );
 
-			goto on_error;
-		}
-		if( system_string_copy(
-		     software_filename,
-		     _SYSTEM_STRING( "SOFTWARE" ),
-		     8 ) == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-			 "%s: unable to set software filename.",
-			 function );
+		return( -1 );
+	}
+	return( 1 );
+}
 
-			goto on_error;
-		}
-		software_filename[ 8 ] = 0;
+/* Prints the event provider and resource file cache statistics
+ * Returns 1 if successful or -1 error
+ */
+int message_handle_cache_statistics_fprint(
+     message_handle_t *message_handle,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	static char *function         = "message_handle_cache_statistics_fprint";
+	uint64_t number_of_retrievals = 0;
+	uint64_t hit_rate             = 0;
 
-		result = path_handle_get_directory_entry_name_by_name_no_case(
-		          message_handle->path_handle,
-			  message_handle->registry_directory_name,
-			  message_handle->registry_directory_name_size - 1,
-			  software_filename,
-			  9,
-		          LIBCDIRECTORY_ENTRY_TYPE_FILE,
-		          error );
+	if( message_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message handle.",
+		 function );
 
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_GENERIC,
-			 "%s: unable to determine if directory has entry: %" PRIs_SYSTEM ".",
-			 function,
-			 software_filename );
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
 
-			goto on_error;
-		}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libcpath_path_join_wide(
-			  &( message_handle->software_registry_filename ),
-			  &( message_handle->software_registry_filename_size ),
-			  message_handle->registry_directory_name,
-			  message_handle->registry_directory_name_size - 1,
-			  software_filename,
-			  8,
-			  error );
-#else
-		result = libcpath_path_join(
-			  &( message_handle->software_registry_filename ),
-			  &( message_handle->software_registry_filename_size ),
-			  message_handle->registry_directory_name,
-			  message_handle->registry_directory_name_size - 1,
-			  software_filename,
-			  8,
-			  error );
-#endif
-		if( result != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable create software registry filename.",
-			 function );
+		return( -1 );
+	}
+	number_of_retrievals = message_handle->number_of_event_provider_hits
+	                     + message_handle->number_of_event_provider_misses;
 
-			return( -1 );
-		}
-		memory_free(
-		 software_filename );
+	if( number_of_retrievals > 0 )
+	{
+		hit_rate = ( message_handle->number_of_event_provider_hits * 100 ) / number_of_retrievals;
+	}
+	fprintf(
+	 stream,
+	 "Event provider cache: %" PRIu64 " hits, %" PRIu64 " misses (hit rate: %" PRIu64 "%%)\n",
+	 message_handle->number_of_event_provider_hits,
+	 message_handle->number_of_event_provider_misses,
+	 hit_rate );
 
-		software_filename = NULL;
+	if( resource_file_cache_statistics_fprint(
+	     message_handle->resource_file_cache,
+	     "Resource file",
+	     stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print resource file cache statistics.",
+		 function );
+
+		return( -1 );
 	}
-	if( message_handle->software_registry_filename != NULL )
+	if( resource_file_cache_statistics_fprint(
+	     message_handle->mui_resource_file_cache,
+	     "MUI resource file",
+	     stream,
+	     error ) != 1 )
 	{
-		if( registry_file_initialize(
-		     &( message_handle->software_registry_file ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to initialize software registry file.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print MUI resource file cache statistics.",
+		 function );
 
-			return( -1 );
-		}
-		if( registry_file_set_ascii_codepage(
-		     message_handle->software_registry_file,
-		     message_handle->ascii_codepage,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set ASCII codepage in software registry file.",
-			 function );
+		return( -1 );
+	}
+	return( 1 );
+}
 
-			return( -1 );
-		}
-		if( registry_file_open(
-		     message_handle->software_registry_file,
-		     message_handle->software_registry_filename,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
+/* Prints the resolution counts of the event providers
+ * Returns 1 if successful or -1 on error
+ */
+int message_handle_event_providers_fprint(
+     message_handle_t *message_handle,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	event_provider_t *event_provider = NULL;
+	static char *function            = "message_handle_event_providers_fprint";
+	int number_of_event_providers    = 0;
+	int value_index                  = 0;
+
+	if( message_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_btree_get_number_of_values(
+	     message_handle->event_providers_tree,
+	     &number_of_event_providers,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of event providers.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 stream,
+	 "Event providers: %d\n",
+	 number_of_event_providers );
+
+	for( value_index = 0;
+	     value_index < number_of_event_providers;
+	     value_index++ )
+	{
+		if( libcdata_btree_get_value_by_index(
+		     message_handle->event_providers_tree,
+		     value_index,
+		     (intptr_t **) &event_provider,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve event provider: %d.",
+			 function,
+			 value_index );
+
+			return( -1 );
+		}
+		if( event_provider == NULL )
+		{
+			continue;
+		}
+		if( event_provider->identifier != NULL )
+		{
+			fprintf(
+			 stream,
+			 "\t%" PRIs_SYSTEM "",
+			 event_provider->identifier );
+		}
+		else if( event_provider->event_source != NULL )
+		{
+			fprintf(
+			 stream,
+			 "\t%" PRIs_SYSTEM "",
+			 event_provider->event_source );
+		}
+		else
+		{
+			fprintf(
+			 stream,
+			 "\t(unknown)" );
+		}
+		fprintf(
+		 stream,
+		 ": %" PRIu64 " records, %" PRIu64 " messages resolved\n",
+		 event_provider->number_of_records,
+		 event_provider->number_of_resolved_messages );
+	}
+	return( 1 );
+}
+
+/* Sets if the publisher and event source registry keys should be preloaded
+ * Returns 1 if successful or -1 error
+ */
+int message_handle_set_preload_registry_keys(
+     message_handle_t *message_handle,
+     uint8_t preload_registry_keys,
+     libcerror_error_t **error )
+{
+	static char *function = "message_handle_set_preload_registry_keys";
+
+	if( message_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message handle.",
+		 function );
+
+		return( -1 );
+	}
+	message_handle->preload_registry_keys = preload_registry_keys;
+
+	return( 1 );
+}
+
+/* Opens a message catalog
+ * Returns 1 if successful or -1 error
+ */
+int message_handle_open_message_catalog(
+     message_handle_t *message_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "message_handle_open_message_catalog";
+
+	if( message_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_handle->message_catalog != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid message handle - message catalog value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_catalog_initialize(
+	     &( message_handle->message_catalog ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create message catalog.",
+		 function );
+
+		goto on_error;
+	}
+	if( message_catalog_read(
+	     message_handle->message_catalog,
+	     filename,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read message catalog.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( message_handle->message_catalog != NULL )
+	{
+		message_catalog_free(
+		 &( message_handle->message_catalog ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Opens the software registry file
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int message_handle_open_software_registry_file(
+     message_handle_t *message_handle,
+     libcerror_error_t **error )
+{
+	system_character_t *key_path          = NULL;
+	system_character_t *software_filename = NULL;
+	libregf_key_t *sub_key                = NULL;
+	libregf_value_t *value                = NULL;
+	const char *sub_key_path              = NULL;
+	const char *value_name                = NULL;
+	static char *function                 = "message_handle_open_software_registry_file";
+	size_t key_path_length                = 0;
+	size_t value_name_length              = 0;
+	int result                            = 0;
+
+	if( message_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( message_handle->software_registry_filename == NULL )
+	 && ( message_handle->registry_directory_name != NULL ) )
+	{
+		software_filename = system_string_allocate(
+		                     9 );
+
+		if( software_filename == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create software filename.",
+			 function );
+
+			goto on_error;
+		}
+		if( system_string_copy(
+		     software_filename,
+		     _SYSTEM_STRING( "SOFTWARE" ),
+		     8 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to set software filename.",
+			 function );
+
+			goto on_error;
+		}
+		software_filename[ 8 ] = 0;
+
+		result = path_handle_get_directory_entry_name_by_name_no_case(
+		          message_handle->path_handle,
+			  message_handle->registry_directory_name,
+			  message_handle->registry_directory_name_size - 1,
+			  software_filename,
+			  9,
+		          LIBCDIRECTORY_ENTRY_TYPE_FILE,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 "%s: unable to determine if directory has entry: %" PRIs_SYSTEM ".",
+			 function,
+			 software_filename );
+
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libcpath_path_join_wide(
+			  &( message_handle->software_registry_filename ),
+			  &( message_handle->software_registry_filename_size ),
+			  message_handle->registry_directory_name,
+			  message_handle->registry_directory_name_size - 1,
+			  software_filename,
+			  8,
+			  error );
+#else
+		result = libcpath_path_join(
+			  &( message_handle->software_registry_filename ),
+			  &( message_handle->software_registry_filename_size ),
+			  message_handle->registry_directory_name,
+			  message_handle->registry_directory_name_size - 1,
+			  software_filename,
+			  8,
+			  error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable create software registry filename.",
+			 function );
+
+			return( -1 );
+		}
+		memory_free(
+		 software_filename );
+
+		software_filename = NULL;
+	}
+	if( message_handle->software_registry_filename != NULL )
+	{
+		if( registry_file_initialize(
+		     &( message_handle->software_registry_file ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize software registry file.",
+			 function );
+
+			return( -1 );
+		}
+		if( registry_file_set_ascii_codepage(
+		     message_handle->software_registry_file,
+		     message_handle->ascii_codepage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set ASCII codepage in software registry file.",
+			 function );
+
+			return( -1 );
+		}
+		if( registry_file_open(
+		     message_handle->software_registry_file,
+		     message_handle->software_registry_filename,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
 			 LIBCERROR_IO_ERROR_OPEN_FAILED,
 			 "%s: unable to open software registry file.",
 			 function );
@@ -1509,94 +1926,323 @@ int message_handle_open_system_registry_file(
 			goto on_error;
 		}
 	}
-	if( libregf_key_free(
-	     &sub_key,
+	if( libregf_key_free(
+	     &sub_key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free sub key.",
+		 function );
+
+		goto on_error;
+	}
+	/* Get the control set 2 eventlog services key:
+	 * SYSTEM\ControlSet002\Services\Eventlog
+	 */
+	key_path = _SYSTEM_STRING( "ControlSet002\\Services\\Eventlog" );
+
+	key_path_length = system_string_length(
+	                   key_path );
+
+	result = registry_file_get_key_by_path(
+		  message_handle->system_registry_file,
+		  key_path,
+		  key_path_length,
+		  &sub_key,
+		  error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sub key: %" PRIs_SYSTEM ".",
+		 function,
+		 key_path );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		result = libregf_key_get_sub_key_by_utf8_name(
+			  sub_key,
+			  (uint8_t *) eventlog_key_name,
+			  eventlog_key_name_length,
+			  &( message_handle->control_set_2_eventlog_services_key ),
+			  error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub key: %s.",
+			 function,
+			 eventlog_key_name );
+
+			goto on_error;
+		}
+	}
+	if( libregf_key_free(
+	     &sub_key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free sub key.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( sub_key != NULL )
+	{
+		libregf_key_free(
+		 &sub_key,
+		 NULL );
+	}
+	if( system_filename != NULL )
+	{
+		memory_free(
+		 system_filename );
+	}
+	return( -1 );
+}
+
+/* Preloads the publisher and event source registry keys
+ * The ResourceFileName, MessageFileName and ParameterFileName values of the WinEvt publishers and
+ * the EventMessageFile, ParameterMessageFile and CategoryMessageFile values of the eventlog services
+ * are read into tables, after which the registry files are closed
+ * Returns 1 if successful or -1 on error
+ */
+int message_handle_preload_registry_keys(
+     message_handle_t *message_handle,
+     libcerror_error_t **error )
+{
+	const system_character_t *eventlog_services_value_names[ 3 ] = {
+		_SYSTEM_STRING( "EventMessageFile" ),
+		_SYSTEM_STRING( "ParameterMessageFile" ),
+		_SYSTEM_STRING( "CategoryMessageFile" ) };
+
+	const system_character_t *winevt_publishers_value_names[ 3 ] = {
+		_SYSTEM_STRING( "ResourceFileName" ),
+		_SYSTEM_STRING( "MessageFileName" ),
+		_SYSTEM_STRING( "ParameterFileName" ) };
+
+	static char *function = "message_handle_preload_registry_keys";
+
+	if( message_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_handle->winevt_publishers_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid message handle - winevt publishers table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_handle->eventlog_services_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid message handle - eventlog services table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( registry_key_table_initialize(
+	     &( message_handle->winevt_publishers_table ),
+	     winevt_publishers_value_names,
+	     3,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create winevt publishers table.",
+		 function );
+
+		goto on_error;
+	}
+	if( message_handle->winevt_publishers_key != NULL )
+	{
+		if( registry_key_table_read_key(
+		     message_handle->winevt_publishers_table,
+		     message_handle->winevt_publishers_key,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read winevt publishers key.",
+			 function );
+
+			goto on_error;
+		}
+		if( libregf_key_free(
+		     &( message_handle->winevt_publishers_key ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free winevt publishers key.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( registry_key_table_initialize(
+	     &( message_handle->eventlog_services_table ),
+	     eventlog_services_value_names,
+	     3,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free sub key.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create eventlog services table.",
 		 function );
 
 		goto on_error;
 	}
-	/* Get the control set 2 eventlog services key:
-	 * SYSTEM\ControlSet002\Services\Eventlog
+	/* The event sources of control set 1 are read first so that they take precedence
 	 */
-	key_path = _SYSTEM_STRING( "ControlSet002\\Services\\Eventlog" );
-
-	key_path_length = system_string_length(
-	                   key_path );
-
-	result = registry_file_get_key_by_path(
-		  message_handle->system_registry_file,
-		  key_path,
-		  key_path_length,
-		  &sub_key,
-		  error );
-
-	if( result == -1 )
+	if( message_handle->control_set_1_eventlog_services_key != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve sub key: %" PRIs_SYSTEM ".",
-		 function,
-		 key_path );
+		if( registry_key_table_read_key(
+		     message_handle->eventlog_services_table,
+		     message_handle->control_set_1_eventlog_services_key,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read control set 1 eventlog services key.",
+			 function );
 
-		goto on_error;
+			goto on_error;
+		}
+		if( libregf_key_free(
+		     &( message_handle->control_set_1_eventlog_services_key ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free control set 1 eventlog services key.",
+			 function );
+
+			goto on_error;
+		}
 	}
-	else if( result != 0 )
+	if( message_handle->control_set_2_eventlog_services_key != NULL )
 	{
-		result = libregf_key_get_sub_key_by_utf8_name(
-			  sub_key,
-			  (uint8_t *) eventlog_key_name,
-			  eventlog_key_name_length,
-			  &( message_handle->control_set_2_eventlog_services_key ),
-			  error );
+		if( registry_key_table_read_key(
+		     message_handle->eventlog_services_table,
+		     message_handle->control_set_2_eventlog_services_key,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read control set 2 eventlog services key.",
+			 function );
 
-		if( result == -1 )
+			goto on_error;
+		}
+		if( libregf_key_free(
+		     &( message_handle->control_set_2_eventlog_services_key ),
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve sub key: %s.",
-			 function,
-			 eventlog_key_name );
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free control set 2 eventlog services key.",
+			 function );
 
 			goto on_error;
 		}
 	}
-	if( libregf_key_free(
-	     &sub_key,
-	     error ) != 1 )
+	/* The registry files are no longer needed after the keys have been read
+	 */
+	if( message_handle->software_registry_file != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free sub key.",
-		 function );
+		if( registry_file_close(
+		     message_handle->software_registry_file,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close software registry file.",
+			 function );
 
-		goto on_error;
+			goto on_error;
+		}
+	}
+	if( message_handle->system_registry_file != NULL )
+	{
+		if( registry_file_close(
+		     message_handle->system_registry_file,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close system registry file.",
+			 function );
+
+			goto on_error;
+		}
 	}
 	return( 1 );
 
 on_error:
-	if( sub_key != NULL )
+	if( message_handle->eventlog_services_table != NULL )
 	{
-		libregf_key_free(
-		 &sub_key,
+		registry_key_table_free(
+		 &( message_handle->eventlog_services_table ),
 		 NULL );
 	}
-	if( system_filename != NULL )
+	if( message_handle->winevt_publishers_table != NULL )
 	{
-		memory_free(
-		 system_filename );
+		registry_key_table_free(
+		 &( message_handle->winevt_publishers_table ),
+		 NULL );
 	}
 	return( -1 );
 }
@@ -1623,6 +2269,29 @@ int message_handle_open_input(
 
 		return( -1 );
 	}
+	/* The message catalog is compiled for a specific event log type
+	 * and replaces the registry files
+	 */
+	if( message_handle->message_catalog != NULL )
+	{
+		if( ( eventlog_key_name == NULL )
+		 || ( narrow_string_compare_no_case(
+		       message_handle->message_catalog->eventlog_key_name,
+		       eventlog_key_name,
+		       32 ) != 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported message catalog - compiled for event log type: %s.",
+			 function,
+			 message_handle->message_catalog->eventlog_key_name );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
 	result = message_handle_open_software_registry_file(
 	          message_handle,
 	          error );
@@ -1654,6 +2323,22 @@ int message_handle_open_input(
 
 		return( -1 );
 	}
+	if( message_handle->preload_registry_keys != 0 )
+	{
+		if( message_handle_preload_registry_keys(
+		     message_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to preload registry keys.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	return( 1 );
 }
 
@@ -1710,7 +2395,39 @@ int message_handle_close_input(
 			result = -1;
 		}
 	}
-	if( libfcache_cache_empty(
+	if( message_handle->winevt_publishers_table != NULL )
+	{
+		if( registry_key_table_free(
+		     &( message_handle->winevt_publishers_table ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free winevt publishers table.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( message_handle->eventlog_services_table != NULL )
+	{
+		if( registry_key_table_free(
+		     &( message_handle->eventlog_services_table ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free eventlog services table.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( resource_file_cache_empty(
 	     message_handle->resource_file_cache,
 	     error ) != 1 )
 	{
@@ -1723,7 +2440,7 @@ int message_handle_close_input(
 
 		result = -1;
 	}
-	if( libfcache_cache_empty(
+	if( resource_file_cache_empty(
 	     message_handle->mui_resource_file_cache,
 	     error ) != 1 )
 	{
@@ -1753,10 +2470,11 @@ int message_handle_get_value_by_event_source(
      size_t *value_string_size,
      libcerror_error_t **error )
 {
-	libregf_key_t *key     = NULL;
-	libregf_value_t *value = NULL;
-	static char *function  = "message_handle_get_value_by_event_source";
-	int result             = 0;
+	const system_character_t *table_value_string = NULL;
+	libregf_key_t *key                           = NULL;
+	libregf_value_t *value                       = NULL;
+	static char *function                        = "message_handle_get_value_by_event_source";
+	int result                                   = 0;
 
 	if( message_handle == NULL )
 	{
@@ -1802,6 +2520,79 @@ int message_handle_get_value_by_event_source(
 
 		return( -1 );
 	}
+	if( ( message_handle->message_catalog != NULL )
+	 || ( message_handle->eventlog_services_table != NULL ) )
+	{
+		if( message_handle->message_catalog != NULL )
+		{
+			result = message_catalog_get_value_string(
+			          message_handle->message_catalog,
+			          MESSAGE_CATALOG_ENTRY_TYPE_EVENT_SOURCE,
+			          event_source,
+			          event_source_length,
+			          value_name,
+			          value_name_length,
+			          &table_value_string,
+			          value_string_size,
+			          error );
+		}
+		else
+		{
+			result = registry_key_table_get_value_string(
+			          message_handle->eventlog_services_table,
+			          event_source,
+			          event_source_length,
+			          value_name,
+			          value_name_length,
+			          &table_value_string,
+			          value_string_size,
+			          error );
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %" PRIs_SYSTEM " from catalog or table.",
+			 function,
+			 value_name );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			*value_string = system_string_allocate(
+			                 *value_string_size );
+
+			if( *value_string == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create value string.",
+				 function );
+
+				goto on_error;
+			}
+			if( system_string_copy(
+			     *value_string,
+			     table_value_string,
+			     *value_string_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy value string.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		return( result );
+	}
 	if( message_handle->control_set_1_eventlog_services_key != NULL )
 	{
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -2028,10 +2819,11 @@ int message_handle_get_value_by_provider_identifier(
      size_t *value_string_size,
      libcerror_error_t **error )
 {
-	libregf_key_t *key     = NULL;
-	libregf_value_t *value = NULL;
-	static char *function  = "message_handle_get_value_by_provider_identifier";
-	int result             = 0;
+	const system_character_t *table_value_string = NULL;
+	libregf_key_t *key                           = NULL;
+	libregf_value_t *value                       = NULL;
+	static char *function                        = "message_handle_get_value_by_provider_identifier";
+	int result                                   = 0;
 
 	if( message_handle == NULL )
 	{
@@ -2075,7 +2867,80 @@ int message_handle_get_value_by_provider_identifier(
 		 "%s: invalid value string size.",
 		 function );
 
-		return( -1 );
+		return( -1 );
+	}
+	if( ( message_handle->message_catalog != NULL )
+	 || ( message_handle->winevt_publishers_table != NULL ) )
+	{
+		if( message_handle->message_catalog != NULL )
+		{
+			result = message_catalog_get_value_string(
+			          message_handle->message_catalog,
+			          MESSAGE_CATALOG_ENTRY_TYPE_PUBLISHER,
+			          provider_identifier,
+			          provider_identifier_length,
+			          value_name,
+			          value_name_length,
+			          &table_value_string,
+			          value_string_size,
+			          error );
+		}
+		else
+		{
+			result = registry_key_table_get_value_string(
+			          message_handle->winevt_publishers_table,
+			          provider_identifier,
+			          provider_identifier_length,
+			          value_name,
+			          value_name_length,
+			          &table_value_string,
+			          value_string_size,
+			          error );
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %" PRIs_SYSTEM " from catalog or table.",
+			 function,
+			 value_name );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			*value_string = system_string_allocate(
+			                 *value_string_size );
+
+			if( *value_string == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create value string.",
+				 function );
+
+				goto on_error;
+			}
+			if( system_string_copy(
+			     *value_string,
+			     table_value_string,
+			     *value_string_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy value string.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		return( result );
 	}
 	if( message_handle->winevt_publishers_key != NULL )
 	{
@@ -2278,6 +3143,7 @@ int message_handle_get_resource_file_path(
 	size_t resource_filename_directory_name_index         = 0;
 	size_t resource_filename_string_segment_size          = 0;
 	size_t resource_files_path_length                     = 0;
+	uint64_t start_time                                   = 0;
 	uint8_t directory_entry_type                          = 0;
 	int resource_filename_number_of_segments              = 0;
 	int resource_filename_segment_index                   = 0;
@@ -2401,6 +3267,9 @@ int message_handle_get_resource_file_path(
 
 		return( -1 );
 	}
+	start_time = profile_handle_start_phase(
+	              message_handle->profile_handle );
+
 	if( resource_filename_length > 2 )
 	{
 		/* Check if the resource filename starts with a volume letter
@@ -2815,153 +3684,510 @@ int message_handle_get_resource_file_path(
 				mui_string = system_string_allocate(
 					      resource_filename_string_segment_size + 4 );
 
-				if( mui_string == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_MEMORY,
-					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-					 "%s: unable to create MUI resource filename string.",
-					 function );
+				if( mui_string == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to create MUI resource filename string.",
+					 function );
+
+					goto on_error;
+				}
+				resource_filename_string_segment_size--;
+
+				if( system_string_copy(
+				     mui_string,
+				     resource_filename_string_segment,
+				     resource_filename_string_segment_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+					 "%s: unable to copy MUI resource filename string.",
+					 function );
+
+					goto on_error;
+				}
+				mui_string[ resource_filename_string_segment_size++ ] = (system_character_t) '.';
+				mui_string[ resource_filename_string_segment_size++ ] = (system_character_t) 'm';
+				mui_string[ resource_filename_string_segment_size++ ] = (system_character_t) 'u';
+				mui_string[ resource_filename_string_segment_size++ ] = (system_character_t) 'i';
+				mui_string[ resource_filename_string_segment_size++ ] = 0;
+
+				resource_filename_string_segment = mui_string;
+			}
+			directory_entry_type = LIBCDIRECTORY_ENTRY_TYPE_FILE;
+		}
+		( *resource_file_path )[ resource_file_path_index ] = 0;
+
+		result = path_handle_get_directory_entry_name_by_name_no_case(
+		          message_handle->path_handle,
+		          *resource_file_path,
+		          resource_file_path_index + 1,
+			  resource_filename_string_segment,
+			  resource_filename_string_segment_size,
+		          directory_entry_type,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 "%s: unable to determine if directory has entry: %" PRIs_SYSTEM ".",
+			 function,
+			 resource_filename_string_segment );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			if( system_string_copy(
+			     &( ( *resource_file_path )[ resource_file_path_index ] ),
+			     resource_filename_string_segment,
+			     resource_filename_string_segment_size - 1 ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set resource filename string segment: %d in resource file path.",
+				 function,
+				 resource_filename_segment_index );
+
+				goto on_error;
+			}
+			resource_file_path_index += resource_filename_string_segment_size - 1;
+
+			( *resource_file_path )[ resource_file_path_index++ ] = (system_character_t) LIBCPATH_SEPARATOR;
+		}
+		if( mui_string != NULL )
+		{
+			memory_free(
+			 mui_string );
+
+			mui_string = NULL;
+		}
+		if( result == 0 )
+		{
+			break;
+		}
+	}
+	( *resource_file_path )[ resource_file_path_index - 1 ] = 0;
+
+	if( system_split_string_free(
+	     &resource_filename_split_string,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free resource filename split string.",
+		 function );
+
+		goto on_error;
+	}
+	profile_handle_end_phase(
+	 message_handle->profile_handle,
+	 PROFILE_HANDLE_PHASE_PATH_RESOLUTION,
+	 start_time );
+
+	return( result );
+
+on_error:
+	if( mui_string != NULL )
+	{
+		memory_free(
+		 mui_string );
+	}
+	if( resource_filename_split_string != NULL )
+	{
+		system_split_string_free(
+		 &resource_filename_split_string,
+		 NULL );
+	}
+	if( *resource_file_path != NULL )
+	{
+		memory_free(
+		 *resource_file_path );
+
+		*resource_file_path = NULL;
+	}
+	*resource_file_path_size = 0;
+
+	profile_handle_end_phase(
+	 message_handle->profile_handle,
+	 PROFILE_HANDLE_PHASE_PATH_RESOLUTION,
+	 start_time );
+
+	return( -1 );
+}
+
+/* Retrieves a specific resource file and adds it to the cache
+ * Returns 1 if successful, 0 if resource file was not found or -1 error
+ */
+int message_handle_get_resource_file(
+     message_handle_t *message_handle,
+     const system_character_t *resource_filename,
+     size_t resource_filename_length,
+     const system_character_t *resource_file_path,
+     resource_file_t **resource_file,
+     libcerror_error_t **error )
+{
+	static char *function = "message_handle_get_resource_file";
+	uint64_t start_time    = 0;
+
+	if( message_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_file_initialize(
+	     resource_file,
+	     message_handle->preferred_language_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create resource file.",
+		 function );
+
+		goto on_error;
+	}
+	if( resource_file_set_name(
+	     *resource_file,
+	     resource_filename,
+	     resource_filename_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set name in resource file.",
+		 function );
+
+		goto on_error;
+	}
+	start_time = profile_handle_start_phase(
+	              message_handle->profile_handle );
+
+	if( resource_file_open(
+	     *resource_file,
+	     resource_file_path,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open resource file: %" PRIs_SYSTEM ".",
+		 function,
+		 resource_file_path );
+
+		goto on_error;
+	}
+	profile_handle_end_phase(
+	 message_handle->profile_handle,
+	 PROFILE_HANDLE_PHASE_RESOURCE_FILE_OPEN,
+	 start_time );
+
+	if( resource_file_cache_insert_resource_file(
+	     message_handle->resource_file_cache,
+	     *resource_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert resource file into cache.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *resource_file != NULL )
+	{
+		resource_file_free(
+		 resource_file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves a specific resource file from the cache
+ * Returns 1 if successful, 0 if not available or -1 error
+ */
+int message_handle_get_resource_file_from_cache(
+     message_handle_t *message_handle,
+     const system_character_t *resource_filename,
+     size_t resource_filename_length,
+     resource_file_t **resource_file,
+     libcerror_error_t **error )
+{
+	static char *function = "message_handle_get_resource_file_from_cache";
+	int result            = 0;
+
+	if( message_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message handle.",
+		 function );
 
-					goto on_error;
-				}
-				resource_filename_string_segment_size--;
+		return( -1 );
+	}
+	if( resource_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file.",
+		 function );
 
-				if( system_string_copy(
-				     mui_string,
-				     resource_filename_string_segment,
-				     resource_filename_string_segment_size ) == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-					 "%s: unable to copy MUI resource filename string.",
-					 function );
+		return( -1 );
+	}
+	result = resource_file_cache_get_resource_file(
+	          message_handle->resource_file_cache,
+	          resource_filename,
+	          resource_filename_length,
+	          resource_file,
+	          error );
 
-					goto on_error;
-				}
-				mui_string[ resource_filename_string_segment_size++ ] = (system_character_t) '.';
-				mui_string[ resource_filename_string_segment_size++ ] = (system_character_t) 'm';
-				mui_string[ resource_filename_string_segment_size++ ] = (system_character_t) 'u';
-				mui_string[ resource_filename_string_segment_size++ ] = (system_character_t) 'i';
-				mui_string[ resource_filename_string_segment_size++ ] = 0;
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve resource file from cache.",
+		 function );
 
-				resource_filename_string_segment = mui_string;
-			}
-			directory_entry_type = LIBCDIRECTORY_ENTRY_TYPE_FILE;
-		}
-		( *resource_file_path )[ resource_file_path_index ] = 0;
+		return( -1 );
+	}
+	return( result );
+}
 
-		result = path_handle_get_directory_entry_name_by_name_no_case(
-		          message_handle->path_handle,
-		          *resource_file_path,
-		          resource_file_path_index + 1,
-			  resource_filename_string_segment,
-			  resource_filename_string_segment_size,
-		          directory_entry_type,
-		          error );
+/* Retrieves a specific MUI resource file and adds it to the cache
+ * Returns 1 if successful, 0 if resource file was not found or -1 error
+ */
+int message_handle_get_mui_resource_file(
+     message_handle_t *message_handle,
+     const system_character_t *resource_filename,
+     size_t resource_filename_length,
+     const system_character_t *resource_file_path,
+     resource_file_t **resource_file,
+     libcerror_error_t **error )
+{
+	static char *function = "message_handle_get_mui_resource_file";
+	uint64_t start_time    = 0;
 
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_GENERIC,
-			 "%s: unable to determine if directory has entry: %" PRIs_SYSTEM ".",
-			 function,
-			 resource_filename_string_segment );
+	if( message_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message handle.",
+		 function );
 
-			goto on_error;
-		}
-		else if( result != 0 )
-		{
-			if( system_string_copy(
-			     &( ( *resource_file_path )[ resource_file_path_index ] ),
-			     resource_filename_string_segment,
-			     resource_filename_string_segment_size - 1 ) == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set resource filename string segment: %d in resource file path.",
-				 function,
-				 resource_filename_segment_index );
+		return( -1 );
+	}
+	if( resource_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file.",
+		 function );
 
-				goto on_error;
-			}
-			resource_file_path_index += resource_filename_string_segment_size - 1;
+		return( -1 );
+	}
+	if( resource_file_initialize(
+	     resource_file,
+	     message_handle->preferred_language_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create resource file.",
+		 function );
 
-			( *resource_file_path )[ resource_file_path_index++ ] = (system_character_t) LIBCPATH_SEPARATOR;
-		}
-		if( mui_string != NULL )
-		{
-			memory_free(
-			 mui_string );
+		goto on_error;
+	}
+	if( resource_file_set_name(
+	     *resource_file,
+	     resource_filename,
+	     resource_filename_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set name in resource file.",
+		 function );
 
-			mui_string = NULL;
-		}
-		if( result == 0 )
-		{
-			break;
-		}
+		goto on_error;
 	}
-	( *resource_file_path )[ resource_file_path_index - 1 ] = 0;
+	start_time = profile_handle_start_phase(
+	              message_handle->profile_handle );
 
-	if( system_split_string_free(
-	     &resource_filename_split_string,
+	if( resource_file_open(
+	     *resource_file,
+	     resource_file_path,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open resource file: %" PRIs_SYSTEM ".",
+		 function,
+		 resource_file_path );
+
+		goto on_error;
+	}
+	profile_handle_end_phase(
+	 message_handle->profile_handle,
+	 PROFILE_HANDLE_PHASE_RESOURCE_FILE_OPEN,
+	 start_time );
+
+	if( resource_file_cache_insert_resource_file(
+	     message_handle->mui_resource_file_cache,
+	     *resource_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free resource filename split string.",
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert resource file into cache.",
 		 function );
 
 		goto on_error;
 	}
-	return( result );
+	return( 1 );
 
 on_error:
-	if( mui_string != NULL )
+	if( *resource_file != NULL )
 	{
-		memory_free(
-		 mui_string );
+		resource_file_free(
+		 resource_file,
+		 NULL );
 	}
-	if( resource_filename_split_string != NULL )
+	return( -1 );
+}
+
+/* Retrieves a specific MUI resource file from the cache
+ * Returns 1 if successful, 0 if resource file was not found or -1 error
+ */
+int message_handle_get_mui_resource_file_from_cache(
+     message_handle_t *message_handle,
+     const system_character_t *resource_filename,
+     size_t resource_filename_length,
+     resource_file_t **resource_file,
+     libcerror_error_t **error )
+{
+	static char *function = "message_handle_get_mui_resource_file_from_cache";
+	int result            = 0;
+
+	if( message_handle == NULL )
 	{
-		system_split_string_free(
-		 &resource_filename_split_string,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message handle.",
+		 function );
+
+		return( -1 );
 	}
-	if( *resource_file_path != NULL )
+	if( resource_file == NULL )
 	{
-		memory_free(
-		 *resource_file_path );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file.",
+		 function );
+
+		return( -1 );
+	}
+	result = resource_file_cache_get_resource_file(
+	          message_handle->mui_resource_file_cache,
+	          resource_filename,
+	          resource_filename_length,
+	          resource_file,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve resource file from cache.",
+		 function );
 
-		*resource_file_path = NULL;
+		return( -1 );
 	}
-	*resource_file_path_size = 0;
-
-	return( -1 );
+	return( result );
 }
 
-/* Retrieves a specific resource file and adds it to the cache
- * Returns 1 if successful, 0 if resource file was not found or -1 error
+/* Retrieves the message string from a specific resource file
+ * Returns 1 if successful, 0 if not available or -1 error
  */
-int message_handle_get_resource_file(
+int message_handle_get_message_string_from_resource_file(
      message_handle_t *message_handle,
      const system_character_t *resource_filename,
      size_t resource_filename_length,
-     const system_character_t *resource_file_path,
-     resource_file_t **resource_file,
+     uint32_t message_identifier,
+     message_string_t **message_string,
      libcerror_error_t **error )
 {
-	static char *function = "message_handle_get_resource_file";
-	time_t timestamp      = 0;
+	system_character_t *resource_file_path     = NULL;
+	system_character_t *mui_resource_file_path = NULL;
+	resource_file_t *resource_file             = NULL;
+	static char *function                      = "message_handle_get_message_string_from_resource_file";
+	size_t resource_file_path_size             = 0;
+	size_t mui_resource_file_path_size         = 0;
+	uint64_t start_time                        = 0;
+	uint32_t mui_file_type                     = 0;
+	int result                                 = 0;
 
 	if( message_handle == NULL )
 	{
@@ -2974,229 +4200,313 @@ int message_handle_get_resource_file(
 
 		return( -1 );
 	}
-	if( resource_file == NULL )
+	if( resource_filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid resource file.",
+		 "%s: invalid resource filename.",
 		 function );
 
 		return( -1 );
 	}
-	if( resource_file_initialize(
-	     resource_file,
-	     message_handle->preferred_language_identifier,
-	     error ) != 1 )
+	if( ( resource_filename_length == 0 )
+	 || ( resource_filename_length > (size_t) SSIZE_MAX ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create resource file.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid resource filename length value out of bounds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( resource_file_set_name(
-	     *resource_file,
-	     resource_filename,
-	     resource_filename_length,
-	     error ) != 1 )
+	if( message_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message string.",
+		 function );
+
+		return( -1 );
+	}
+	result = message_handle_get_resource_file_from_cache(
+		  message_handle,
+		  resource_filename,
+		  resource_filename_length,
+		  &resource_file,
+		  error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set name in resource file.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve resource file from cache.",
 		 function );
 
-		goto on_error;
+		goto on_error;
+	}
+	if( result == 0 )
+	{
+		result = message_handle_get_resource_file_path(
+		          message_handle,
+		          resource_filename,
+		          resource_filename_length,
+		          NULL,
+		          0,
+		          &resource_file_path,
+		          &resource_file_path_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve resource file path.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			if( message_handle_get_resource_file(
+			     message_handle,
+			     resource_filename,
+			     resource_filename_length,
+			     resource_file_path,
+			     &resource_file,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve resource file: %" PRIs_SYSTEM ".",
+				 function,
+				 resource_file_path );
+
+				goto on_error;
+			}
+		}
+	}
+	if( resource_file != NULL )
+	{
+		start_time = profile_handle_start_phase(
+		              message_handle->profile_handle );
+
+		result = resource_file_get_message_string(
+			  resource_file,
+			  message_identifier,
+			  message_string,
+			  error );
+
+		profile_handle_end_phase(
+		 message_handle->profile_handle,
+		 PROFILE_HANDLE_PHASE_MESSAGE_LOOKUP,
+		 start_time );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve message string: 0x%08" PRIx32 ".",
+			 function,
+			 message_identifier );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			result = resource_file_get_mui_file_type(
+				  resource_file,
+				  &mui_file_type,
+				  error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve MUI file type.",
+				 function );
+
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				if( mui_file_type != 0x00000011UL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+					 "%s: unsupported MUI file type: 0x%08" PRIx32 ".",
+					 function,
+					 mui_file_type );
+				}
+				resource_file = NULL;
+
+				result = message_handle_get_mui_resource_file_from_cache(
+					  message_handle,
+					  resource_filename,
+					  resource_filename_length,
+					  &resource_file,
+					  error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve MUI resource file from cache.",
+					 function );
+
+					goto on_error;
+				}
+				else if( result == 0 )
+				{
+/* TODO add support to determine language string */
+					/* The MUI resource file path is: %PATH%/%LANGUAGE%/%FILENAME%.mui
+					 */
+					result = message_handle_get_resource_file_path(
+						  message_handle,
+					          resource_filename,
+					          resource_filename_length,
+					          _SYSTEM_STRING( "en-US" ),
+					          5,
+						  &mui_resource_file_path,
+						  &mui_resource_file_path_size,
+						  error );
+
+					if( result == -1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+						 "%s: unable to retrieve MUI resource file path.",
+						 function );
+
+						goto on_error;
+					}
+					else if( result != 0 )
+					{
+						if( message_handle_get_mui_resource_file(
+						     message_handle,
+						     resource_filename,
+						     resource_filename_length,
+						     mui_resource_file_path,
+						     &resource_file,
+						     error ) != 1 )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+							 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+							 "%s: unable to retrieve MUI resource file: %" PRIs_SYSTEM ".",
+							 function,
+							 mui_resource_file_path );
+
+							goto on_error;
+						}
+						memory_free(
+						 mui_resource_file_path );
+
+						mui_resource_file_path = NULL;
+					}
+				}
+				if( resource_file != NULL )
+				{
+					start_time = profile_handle_start_phase(
+					              message_handle->profile_handle );
+
+					result = resource_file_get_message_string(
+						  resource_file,
+						  message_identifier,
+						  message_string,
+						  error );
+
+					profile_handle_end_phase(
+					 message_handle->profile_handle,
+					 PROFILE_HANDLE_PHASE_MESSAGE_LOOKUP,
+					 start_time );
+
+					if( result == -1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+						 "%s: unable to retrieve message string: 0x%08" PRIx32 ".",
+						 function,
+						 message_identifier );
+
+						goto on_error;
+					}
+				}
+			}
+		}
 	}
-	if( resource_file_open(
-	     *resource_file,
-	     resource_file_path,
-	     error ) != 1 )
+	if( resource_file_path != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open resource file: %" PRIs_SYSTEM ".",
-		 function,
+		memory_free(
 		 resource_file_path );
 
-		goto on_error;
+		resource_file_path = NULL;
 	}
-	if( libfcache_date_time_get_timestamp(
-	     &timestamp,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve cache timestamp.",
-		 function );
+	return( result );
 
-		return( -1 );
-	}
-	if( libfcache_cache_set_value_by_index(
-	     message_handle->resource_file_cache,
-	     message_handle->next_resource_file_cache_index,
-	     0,
-	     message_handle->next_resource_file_cache_index,
-	     timestamp,
-	     (intptr_t *) *resource_file,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &resource_file_free,
-	     LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
-	     error ) != 1 )
+on_error:
+	if( mui_resource_file_path != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set resource file in cache entry: %d.",
-		 function,
-		 message_handle->next_resource_file_cache_index );
-
-		goto on_error;
+		memory_free(
+		 mui_resource_file_path );
 	}
-	message_handle->next_resource_file_cache_index++;
-
-	if( message_handle->next_resource_file_cache_index == 16 )
+	if( resource_file_path != NULL )
 	{
-		message_handle->next_resource_file_cache_index = 0;
+		memory_free(
+		 resource_file_path );
 	}
-	return( 1 );
-
-on_error:
-	if( *resource_file != NULL )
+	if( *message_string != NULL )
 	{
-		resource_file_free(
-		 resource_file,
+		message_string_free(
+		 message_string,
 		 NULL );
 	}
 	return( -1 );
 }
 
-/* Retrieves a specific resource file from the cache
+/* Retrieves the message string from one or more specified resource files
  * Returns 1 if successful, 0 if not available or -1 error
  */
-int message_handle_get_resource_file_from_cache(
-     message_handle_t *message_handle,
-     const system_character_t *resource_filename,
-     size_t resource_filename_length,
-     resource_file_t **resource_file,
-     libcerror_error_t **error )
-{
-	libfcache_cache_value_t *cache_value = NULL;
-	static char *function                = "message_handle_get_resource_file_from_cache";
-	int cache_index                      = 0;
-	int result                           = 0;
-
-	if( message_handle == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid message handle.",
-		 function );
-
-		return( -1 );
-	}
-	if( resource_file == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid resource file.",
-		 function );
-
-		return( -1 );
-	}
-	for( cache_index = 0;
-	     cache_index < 16;
-	     cache_index++ )
-	{
-		if( libfcache_cache_get_value_by_index(
-		     message_handle->resource_file_cache,
-		     cache_index,
-		     &cache_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve cache value: %d.",
-			 function,
-			 cache_index );
-
-			return( -1 );
-		}
-		if( cache_value != NULL )
-		{
-			if( libfcache_cache_value_get_value(
-			     cache_value,
-			     (intptr_t **) resource_file,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve resource file from cache value: %d.",
-				 function,
-				 cache_index );
-
-				return( -1 );
-			}
-		}
-		if( *resource_file != NULL )
-		{
-			if( ( resource_filename_length + 1 ) != ( *resource_file )->name_size )
-			{
-				*resource_file = NULL;
-			}
-			else if( system_string_compare(
-				  resource_filename,
-				  ( *resource_file )->name,
-				  resource_filename_length ) != 0 )
-			{
-				*resource_file = NULL;
-			}
-		}
-		if( *resource_file != NULL )
-		{
-			result = 1;
-
-			break;
-		}
-	}
-	if( result == 0 )
-	{
-		*resource_file = NULL;
-	}
-	return( result );
-}
-
-/* Retrieves a specific MUI resource file and adds it to the cache
- * Returns 1 if successful, 0 if resource file was not found or -1 error
- */
-int message_handle_get_mui_resource_file(
+int message_handle_get_message_string(
      message_handle_t *message_handle,
      const system_character_t *resource_filename,
      size_t resource_filename_length,
-     const system_character_t *resource_file_path,
-     resource_file_t **resource_file,
+     uint32_t message_identifier,
+     message_string_t **message_string,
      libcerror_error_t **error )
 {
-	static char *function = "message_handle_get_mui_resource_file";
-	time_t timestamp      = 0;
+	system_character_t *resource_filename_string_segment  = NULL;
+	system_split_string_t *resource_filename_split_string = NULL;
+	static char *function                                 = "message_handle_get_message_string";
+	size_t resource_filename_string_segment_size          = 0;
+	uint64_t start_time                                   = 0;
+	int resource_filename_number_of_segments              = 0;
+	int resource_filename_segment_index                   = 0;
+	int result                                            = 0;
 
 	if( message_handle == NULL )
 	{
@@ -3209,231 +4519,193 @@ int message_handle_get_mui_resource_file(
 
 		return( -1 );
 	}
-	if( resource_file == NULL )
+	if( message_string == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid resource file.",
-		 function );
-
-		return( -1 );
-	}
-	if( resource_file_initialize(
-	     resource_file,
-	     message_handle->preferred_language_identifier,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create resource file.",
-		 function );
-
-		goto on_error;
-	}
-	if( resource_file_set_name(
-	     *resource_file,
-	     resource_filename,
-	     resource_filename_length,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set name in resource file.",
-		 function );
-
-		goto on_error;
-	}
-	if( resource_file_open(
-	     *resource_file,
-	     resource_file_path,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open resource file: %" PRIs_SYSTEM ".",
-		 function,
-		 resource_file_path );
-
-		goto on_error;
-	}
-	if( libfcache_date_time_get_timestamp(
-	     &timestamp,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve cache timestamp.",
+		 "%s: invalid message string.",
 		 function );
 
 		return( -1 );
 	}
-	if( libfcache_cache_set_value_by_index(
-	     message_handle->mui_resource_file_cache,
-	     message_handle->next_mui_resource_file_cache_index,
-	     0,
-	     message_handle->next_mui_resource_file_cache_index,
-	     timestamp,
-	     (intptr_t *) *resource_file,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &resource_file_free,
-	     LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
-	     error ) != 1 )
+	if( message_handle->message_catalog != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set resource file in cache entry: %d.",
-		 function,
-		 message_handle->next_mui_resource_file_cache_index );
-
-		goto on_error;
-	}
-	message_handle->next_mui_resource_file_cache_index++;
+		start_time = profile_handle_start_phase(
+		              message_handle->profile_handle );
 
-	if( message_handle->next_mui_resource_file_cache_index == 16 )
-	{
-		message_handle->next_mui_resource_file_cache_index = 0;
-	}
-	return( 1 );
+		result = message_catalog_get_message_string(
+		          message_handle->message_catalog,
+		          resource_filename,
+		          resource_filename_length,
+		          message_identifier,
+		          message_string,
+		          error );
 
-on_error:
-	if( resource_file != NULL )
-	{
-		resource_file_free(
-		 resource_file,
-		 NULL );
-	}
-	return( -1 );
-}
+		profile_handle_end_phase(
+		 message_handle->profile_handle,
+		 PROFILE_HANDLE_PHASE_MESSAGE_LOOKUP,
+		 start_time );
 
-/* Retrieves a specific MUI resource file from the cache
- * Returns 1 if successful, 0 if resource file was not found or -1 error
- */
-int message_handle_get_mui_resource_file_from_cache(
-     message_handle_t *message_handle,
-     const system_character_t *resource_filename,
-     size_t resource_filename_length,
-     resource_file_t **resource_file,
-     libcerror_error_t **error )
-{
-	libfcache_cache_value_t *cache_value = NULL;
-	static char *function                = "message_handle_get_mui_resource_file_from_cache";
-	int cache_index                      = 0;
-	int result                           = 0;
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve message string: 0x%08" PRIx32 " from catalog.",
+			 function,
+			 message_identifier );
 
-	if( message_handle == NULL )
+			return( -1 );
+		}
+		return( result );
+	}
+	/* The resource filename can contain multiple file names separated by ;
+	 */
+	if( system_string_split(
+	     resource_filename,
+	     resource_filename_length + 1,
+	     (system_character_t) ';',
+	     &resource_filename_split_string,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid message handle.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to split resource filename.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( resource_file == NULL )
+	if( system_split_string_get_number_of_segments(
+	     resource_filename_split_string,
+	     &resource_filename_number_of_segments,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid resource file.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of resource filename string segments.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	for( cache_index = 0;
-	     cache_index < 16;
-	     cache_index++ )
+	for( resource_filename_segment_index = 0;
+	     resource_filename_segment_index < resource_filename_number_of_segments;
+	     resource_filename_segment_index++ )
 	{
-		if( libfcache_cache_get_value_by_index(
-		     message_handle->mui_resource_file_cache,
-		     cache_index,
-		     &cache_value,
+		if( system_split_string_get_segment_by_index(
+		     resource_filename_split_string,
+		     resource_filename_segment_index,
+		     &resource_filename_string_segment,
+		     &resource_filename_string_segment_size,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve cache value: %d.",
+			 "%s: unable to retrieve resource filename string segment: %d.",
 			 function,
-			 cache_index );
+			 resource_filename_segment_index );
 
-			return( -1 );
+			goto on_error;
 		}
-		if( cache_value != NULL )
+		if( resource_filename_string_segment == NULL )
 		{
-			if( libfcache_cache_value_get_value(
-			     cache_value,
-			     (intptr_t **) resource_file,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve resource file from cache value: %d.",
-				 function,
-				 cache_index );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing resource filename string segment: %d.",
+			 function,
+			 resource_filename_segment_index );
 
-				return( -1 );
-			}
+			goto on_error;
 		}
-		if( *resource_file != NULL )
+		result = message_handle_get_message_string_from_resource_file(
+			  message_handle,
+			  resource_filename_string_segment,
+			  resource_filename_string_segment_size - 1,
+			  message_identifier,
+			  message_string,
+			  error );
+
+		if( result == -1 )
 		{
-			if( ( resource_filename_length + 1 ) != ( *resource_file )->name_size )
-			{
-				*resource_file = NULL;
-			}
-			else if( system_string_compare(
-				  resource_filename,
-				  ( *resource_file )->name,
-				  resource_filename_length ) != 0 )
-			{
-				*resource_file = NULL;
-			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve message string: 0x%08" PRIx32 " from: %" PRIs_SYSTEM ".",
+			 function,
+			 message_identifier,
+			 resource_filename_string_segment );
+
+			goto on_error;
 		}
-		if( *resource_file != NULL )
+		else if( result != 0 )
 		{
-			result = 1;
-
 			break;
 		}
 	}
+	if( system_split_string_free(
+	     &resource_filename_split_string,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free resource filename split string.",
+		 function );
+
+		goto on_error;
+	}
 	return( result );
+
+on_error:
+	if( resource_filename_split_string != NULL )
+	{
+		system_split_string_free(
+		 &resource_filename_split_string,
+		 NULL );
+	}
+	if( *message_string != NULL )
+	{
+		message_string_free(
+		 message_string,
+		 NULL );
+	}
+	return( -1 );
 }
 
-/* Retrieves the message string from a specific resource file
+/* Retrieves a specific resource file by provider identifier
  * Returns 1 if successful, 0 if not available or -1 error
  */
-int message_handle_get_message_string_from_resource_file(
+int message_handle_get_resource_file_by_provider_identifier(
      message_handle_t *message_handle,
      const system_character_t *resource_filename,
      size_t resource_filename_length,
-     uint32_t message_identifier,
-     message_string_t **message_string,
+     const uint8_t *provider_identifier,
+     size_t provider_identifier_size,
+     resource_file_t **resource_file,
      libcerror_error_t **error )
 {
-	system_character_t *resource_file_path     = NULL;
-	system_character_t *mui_resource_file_path = NULL;
-	resource_file_t *resource_file             = NULL;
-	static char *function                      = "message_handle_get_message_string_from_resource_file";
-	size_t resource_file_path_size             = 0;
-	size_t mui_resource_file_path_size         = 0;
-	uint32_t mui_file_type                     = 0;
-	int result                                 = 0;
+	libwrc_wevt_provider_t *provider                      = NULL;
+	system_character_t *resource_file_path                = NULL;
+	system_character_t *resource_filename_string_segment  = NULL;
+	system_split_string_t *resource_filename_split_string = NULL;
+	static char *function                                 = "message_handle_get_resource_file_by_provider_identifier";
+	size_t resource_file_path_size                        = 0;
+	size_t resource_filename_string_segment_size          = 0;
+	int resource_filename_number_of_segments              = 0;
+	int resource_filename_segment_index                   = 0;
+	int result                                            = 0;
 
 	if( message_handle == NULL )
 	{
@@ -3446,109 +4718,75 @@ int message_handle_get_message_string_from_resource_file(
 
 		return( -1 );
 	}
-	if( resource_filename == NULL )
+	if( resource_file == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid resource filename.",
-		 function );
-
-		return( -1 );
-	}
-	if( ( resource_filename_length == 0 )
-	 || ( resource_filename_length > (size_t) SSIZE_MAX ) )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid resource filename length value out of bounds.",
+		 "%s: invalid resource file.",
 		 function );
 
 		return( -1 );
 	}
-	if( message_string == NULL )
+	/* The resource filename can contain multiple file names separated by ;
+	 */
+	if( system_string_split(
+	     resource_filename,
+	     resource_filename_length + 1,
+	     (system_character_t) ';',
+	     &resource_filename_split_string,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid message string.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to split resource filename.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	result = message_handle_get_resource_file_from_cache(
-		  message_handle,
-		  resource_filename,
-		  resource_filename_length,
-		  &resource_file,
-		  error );
-
-	if( result == -1 )
+	if( system_split_string_get_number_of_segments(
+	     resource_filename_split_string,
+	     &resource_filename_number_of_segments,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve resource file from cache.",
+		 "%s: unable to retrieve number of resource filename string segments.",
 		 function );
 
 		goto on_error;
 	}
-	if( result == 0 )
+	for( resource_filename_segment_index = 0;
+	     resource_filename_segment_index < resource_filename_number_of_segments;
+	     resource_filename_segment_index++ )
 	{
-		result = message_handle_get_resource_file_path(
-		          message_handle,
-		          resource_filename,
-		          resource_filename_length,
-		          NULL,
-		          0,
-		          &resource_file_path,
-		          &resource_file_path_size,
-		          error );
-
-		if( result == -1 )
+		if( system_split_string_get_segment_by_index(
+		     resource_filename_split_string,
+		     resource_filename_segment_index,
+		     &resource_filename_string_segment,
+		     &resource_filename_string_segment_size,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve resource file path.",
-			 function );
+			 "%s: unable to retrieve resource filename string segment: %d.",
+			 function,
+			 resource_filename_segment_index );
 
 			goto on_error;
 		}
-		else if( result != 0 )
-		{
-			if( message_handle_get_resource_file(
-			     message_handle,
-			     resource_filename,
-			     resource_filename_length,
-			     resource_file_path,
-			     &resource_file,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve resource file: %" PRIs_SYSTEM ".",
-				 function,
-				 resource_file_path );
-
-				goto on_error;
-			}
-		}
-	}
-	if( resource_file != NULL )
-	{
-		result = resource_file_get_message_string(
+		result = message_handle_get_resource_file_from_cache(
+			  message_handle,
+			  resource_filename_string_segment,
+			  resource_filename_string_segment_size - 1,
 			  resource_file,
-			  message_identifier,
-			  message_string,
 			  error );
 
 		if( result == -1 )
@@ -3557,17 +4795,22 @@ int message_handle_get_message_string_from_resource_file(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve message string: 0x%08" PRIx32 ".",
+			 "%s: unable to retrieve resource file: %d from cache.",
 			 function,
-			 message_identifier );
+			 resource_filename_segment_index );
 
 			goto on_error;
 		}
-		else if( result == 0 )
+		if( result == 0 )
 		{
-			result = resource_file_get_mui_file_type(
-				  resource_file,
-				  &mui_file_type,
+			result = message_handle_get_resource_file_path(
+				  message_handle,
+				  resource_filename_string_segment,
+				  resource_filename_string_segment_size - 1,
+				  NULL,
+				  0,
+				  &resource_file_path,
+				  &resource_file_path_size,
 				  error );
 
 			if( result == -1 )
@@ -3576,166 +4819,130 @@ int message_handle_get_message_string_from_resource_file(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve MUI file type.",
+				 "%s: unable to retrieve resource file path.",
 				 function );
 
 				goto on_error;
 			}
 			else if( result != 0 )
 			{
-				if( mui_file_type != 0x00000011UL )
+				if( message_handle_get_resource_file(
+				     message_handle,
+				     resource_filename_string_segment,
+				     resource_filename_string_segment_size - 1,
+				     resource_file_path,
+				     resource_file,
+				     error ) != 1 )
 				{
 					libcerror_error_set(
 					 error,
 					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-					 "%s: unsupported MUI file type: 0x%08" PRIx32 ".",
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve resource file: %" PRIs_SYSTEM ".",
 					 function,
-					 mui_file_type );
+					 resource_file_path );
+
+					goto on_error;
 				}
-				resource_file = NULL;
+				memory_free(
+				 resource_file_path );
 
-				result = message_handle_get_mui_resource_file_from_cache(
-					  message_handle,
-					  resource_filename,
-					  resource_filename_length,
-					  &resource_file,
-					  error );
+				resource_file_path = NULL;
+			}
+		}
+		if( *resource_file != NULL )
+		{
+			result = resource_file_get_provider(
+			          *resource_file,
+				  provider_identifier,
+				  provider_identifier_size,
+				  &provider,
+				  error );
 
-				if( result == -1 )
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve provider.",
+				 function );
+
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				if( libwrc_wevt_provider_free(
+				     &provider,
+				     error ) != 1 )
 				{
 					libcerror_error_set(
 					 error,
 					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve MUI resource file from cache.",
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free provider.",
 					 function );
 
 					goto on_error;
 				}
-				else if( result == 0 )
-				{
-/* TODO add support to determine language string */
-					/* The MUI resource file path is: %PATH%/%LANGUAGE%/%FILENAME%.mui
-					 */
-					result = message_handle_get_resource_file_path(
-						  message_handle,
-					          resource_filename,
-					          resource_filename_length,
-					          _SYSTEM_STRING( "en-US" ),
-					          5,
-						  &mui_resource_file_path,
-						  &mui_resource_file_path_size,
-						  error );
-
-					if( result == -1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-						 "%s: unable to retrieve MUI resource file path.",
-						 function );
-
-						goto on_error;
-					}
-					else if( result != 0 )
-					{
-						if( message_handle_get_mui_resource_file(
-						     message_handle,
-						     resource_filename,
-						     resource_filename_length,
-						     mui_resource_file_path,
-						     &resource_file,
-						     error ) != 1 )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-							 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-							 "%s: unable to retrieve MUI resource file: %" PRIs_SYSTEM ".",
-							 function,
-							 mui_resource_file_path );
-
-							goto on_error;
-						}
-						memory_free(
-						 mui_resource_file_path );
-
-						mui_resource_file_path = NULL;
-					}
-				}
-				if( resource_file != NULL )
-				{
-					result = resource_file_get_message_string(
-						  resource_file,
-						  message_identifier,
-						  message_string,
-						  error );
-
-					if( result == -1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-						 "%s: unable to retrieve message string: 0x%08" PRIx32 ".",
-						 function,
-						 message_identifier );
-
-						goto on_error;
-					}
-				}
+				break;
 			}
 		}
 	}
-	if( resource_file_path != NULL )
+	if( system_split_string_free(
+	     &resource_filename_split_string,
+	     error ) != 1 )
 	{
-		memory_free(
-		 resource_file_path );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free resource filename split string.",
+		 function );
 
-		resource_file_path = NULL;
+		goto on_error;
 	}
 	return( result );
 
 on_error:
-	if( mui_resource_file_path != NULL )
-	{
-		memory_free(
-		 mui_resource_file_path );
-	}
 	if( resource_file_path != NULL )
 	{
 		memory_free(
 		 resource_file_path );
 	}
-	if( *message_string != NULL )
+	if( resource_filename_split_string != NULL )
 	{
-		message_string_free(
-		 message_string,
+		system_split_string_free(
+		 &resource_filename_split_string,
 		 NULL );
 	}
 	return( -1 );
 }
 
-/* Retrieves the message string from one or more specified resource files
- * Returns 1 if successful, 0 if not available or -1 error
+/* Retrieves the event provider for a specific provider identifier and event source
+ * The resource and message filenames of the event provider are retrieved from
+ * the Windows Registry files once and kept for subsequent retrievals, also when
+ * they are not available
+ * Returns 1 if successful or -1 on error
  */
-int message_handle_get_message_string(
+int message_handle_get_event_provider(
      message_handle_t *message_handle,
-     const system_character_t *resource_filename,
-     size_t resource_filename_length,
-     uint32_t message_identifier,
-     message_string_t **message_string,
+     const system_character_t *provider_identifier,
+     size_t provider_identifier_length,
+     const system_character_t *event_source,
+     size_t event_source_length,
+     event_provider_t **event_provider,
      libcerror_error_t **error )
 {
-	system_character_t *resource_filename_string_segment  = NULL;
-	system_split_string_t *resource_filename_split_string = NULL;
-	static char *function                                 = "message_handle_get_message_string";
-	size_t resource_filename_string_segment_size          = 0;
-	int resource_filename_number_of_segments              = 0;
-	int resource_filename_segment_index                   = 0;
-	int result                                            = 0;
+	event_provider_t lookup_event_provider;
+
+	libcdata_tree_node_t *upper_node          = NULL;
+	event_provider_t *existing_event_provider = NULL;
+	event_provider_t *new_event_provider      = NULL;
+	static char *function                     = "message_handle_get_event_provider";
+	uint64_t start_time                       = 0;
+	int result                                = 0;
+	int value_index                           = 0;
 
 	if( message_handle == NULL )
 	{
@@ -3748,89 +4955,147 @@ int message_handle_get_message_string(
 
 		return( -1 );
 	}
-	if( message_string == NULL )
+	if( event_provider == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid message string.",
+		 "%s: invalid event provider.",
 		 function );
 
 		return( -1 );
 	}
-	/* The resource filename can contain multiple file names separated by ;
-	 */
-	if( system_string_split(
-	     resource_filename,
-	     resource_filename_length + 1,
-	     (system_character_t) ';',
-	     &resource_filename_split_string,
-	     error ) != 1 )
+	if( memory_set(
+	     &lookup_event_provider,
+	     0,
+	     sizeof( event_provider_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear lookup event provider.",
+		 function );
+
+		return( -1 );
+	}
+	if( provider_identifier != NULL )
+	{
+		lookup_event_provider.identifier      = (system_character_t *) provider_identifier;
+		lookup_event_provider.identifier_size = provider_identifier_length + 1;
+	}
+	if( event_source != NULL )
+	{
+		lookup_event_provider.event_source      = (system_character_t *) event_source;
+		lookup_event_provider.event_source_size = event_source_length + 1;
+	}
+	result = libcdata_btree_get_value_by_value(
+	          message_handle->event_providers_tree,
+	          (intptr_t *) &lookup_event_provider,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &event_provider_compare,
+	          &upper_node,
+	          (intptr_t **) &existing_event_provider,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to split resource filename.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event provider from tree.",
 		 function );
 
 		goto on_error;
 	}
-	if( system_split_string_get_number_of_segments(
-	     resource_filename_split_string,
-	     &resource_filename_number_of_segments,
+	else if( result != 0 )
+	{
+		message_handle->number_of_event_provider_hits += 1;
+
+		*event_provider = existing_event_provider;
+
+		return( 1 );
+	}
+	message_handle->number_of_event_provider_misses += 1;
+
+	start_time = profile_handle_start_phase(
+	              message_handle->profile_handle );
+
+	if( event_provider_initialize(
+	     &new_event_provider,
+	     provider_identifier,
+	     provider_identifier_length,
+	     event_source,
+	     event_source_length,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of resource filename string segments.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create event provider.",
 		 function );
 
 		goto on_error;
 	}
-	for( resource_filename_segment_index = 0;
-	     resource_filename_segment_index < resource_filename_number_of_segments;
-	     resource_filename_segment_index++ )
+	if( provider_identifier != NULL )
 	{
-		if( system_split_string_get_segment_by_index(
-		     resource_filename_split_string,
-		     resource_filename_segment_index,
-		     &resource_filename_string_segment,
-		     &resource_filename_string_segment_size,
-		     error ) != 1 )
+		result = message_handle_get_value_by_provider_identifier(
+		          message_handle,
+		          provider_identifier,
+		          provider_identifier_length,
+		          _SYSTEM_STRING( "ResourceFileName" ),
+		          16,
+		          &( new_event_provider->resource_filename ),
+		          &( new_event_provider->resource_filename_size ),
+		          error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve resource filename string segment: %d.",
-			 function,
-			 resource_filename_segment_index );
+			 "%s: unable to retrieve resource filename by provider identifier.",
+			 function );
 
 			goto on_error;
 		}
-		if( resource_filename_string_segment == NULL )
+		result = message_handle_get_value_by_provider_identifier(
+		          message_handle,
+		          provider_identifier,
+		          provider_identifier_length,
+		          _SYSTEM_STRING( "MessageFileName" ),
+		          15,
+		          &( new_event_provider->message_filename ),
+		          &( new_event_provider->message_filename_size ),
+		          error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing resource filename string segment: %d.",
-			 function,
-			 resource_filename_segment_index );
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve message filename by provider identifier.",
+			 function );
 
 			goto on_error;
 		}
-		result = message_handle_get_message_string_from_resource_file(
-			  message_handle,
-			  resource_filename_string_segment,
-			  resource_filename_string_segment_size - 1,
-			  message_identifier,
-			  message_string,
-			  error );
+	}
+	if( ( new_event_provider->message_filename == NULL )
+	 && ( event_source != NULL ) )
+	{
+		result = message_handle_get_value_by_event_source(
+		          message_handle,
+		          event_source,
+		          event_source_length,
+		          _SYSTEM_STRING( "EventMessageFile" ),
+		          16,
+		          &( new_event_provider->message_filename ),
+		          &( new_event_provider->message_filename_size ),
+		          error );
 
 		if( result == -1 )
 		{
@@ -3838,71 +5103,67 @@ int message_handle_get_message_string(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve message string: 0x%08" PRIx32 " from: %" PRIs_SYSTEM ".",
-			 function,
-			 message_identifier,
-			 resource_filename_string_segment );
+			 "%s: unable to retrieve message filename by event source.",
+			 function );
 
 			goto on_error;
 		}
-		else if( result != 0 )
-		{
-			break;
-		}
 	}
-	if( system_split_string_free(
-	     &resource_filename_split_string,
-	     error ) != 1 )
+	profile_handle_end_phase(
+	 message_handle->profile_handle,
+	 PROFILE_HANDLE_PHASE_REGISTRY,
+	 start_time );
+
+	result = libcdata_btree_insert_value(
+	          message_handle->event_providers_tree,
+	          &value_index,
+	          (intptr_t *) new_event_provider,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &event_provider_compare,
+	          &upper_node,
+	          (intptr_t **) &existing_event_provider,
+	          error );
+
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free resource filename split string.",
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert event provider into tree.",
 		 function );
 
 		goto on_error;
 	}
-	return( result );
+	*event_provider = new_event_provider;
+
+	return( 1 );
 
 on_error:
-	if( resource_filename_split_string != NULL )
+	if( new_event_provider != NULL )
 	{
-		system_split_string_free(
-		 &resource_filename_split_string,
-		 NULL );
-	}
-	if( *message_string != NULL )
-	{
-		message_string_free(
-		 message_string,
+		event_provider_free(
+		 &new_event_provider,
 		 NULL );
 	}
 	return( -1 );
 }
 
-/* Retrieves a specific resource file by provider identifier
+/* Retrieves the resource file that contains a specific event provider
+ * The name of the resource file is determined once and kept in the event provider
  * Returns 1 if successful, 0 if not available or -1 error
  */
-int message_handle_get_resource_file_by_provider_identifier(
+int message_handle_get_resource_file_by_event_provider(
      message_handle_t *message_handle,
-     const system_character_t *resource_filename,
-     size_t resource_filename_length,
+     event_provider_t *event_provider,
      const uint8_t *provider_identifier,
      size_t provider_identifier_size,
      resource_file_t **resource_file,
      libcerror_error_t **error )
 {
-	libwrc_wevt_provider_t *provider                      = NULL;
-	system_character_t *resource_file_path                = NULL;
-	system_character_t *resource_filename_string_segment  = NULL;
-	system_split_string_t *resource_filename_split_string = NULL;
-	static char *function                                 = "message_handle_get_resource_file_by_provider_identifier";
-	size_t resource_file_path_size                        = 0;
-	size_t resource_filename_string_segment_size          = 0;
-	int resource_filename_number_of_segments              = 0;
-	int resource_filename_segment_index                   = 0;
-	int result                                            = 0;
+	system_character_t *resource_file_path = NULL;
+	static char *function                  = "message_handle_get_resource_file_by_event_provider";
+	size_t resource_file_path_size         = 0;
+	int result                             = 0;
 
 	if( message_handle == NULL )
 	{
@@ -3915,74 +5176,42 @@ int message_handle_get_resource_file_by_provider_identifier(
 
 		return( -1 );
 	}
-	if( resource_file == NULL )
+	if( event_provider == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid resource file.",
+		 "%s: invalid event provider.",
 		 function );
 
 		return( -1 );
 	}
-	/* The resource filename can contain multiple file names separated by ;
-	 */
-	if( system_string_split(
-	     resource_filename,
-	     resource_filename_length + 1,
-	     (system_character_t) ';',
-	     &resource_filename_split_string,
-	     error ) != 1 )
+	if( resource_file == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to split resource filename.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( system_split_string_get_number_of_segments(
-	     resource_filename_split_string,
-	     &resource_filename_number_of_segments,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of resource filename string segments.",
-		 function );
+	*resource_file = NULL;
 
-		goto on_error;
+	if( event_provider->resource_filename == NULL )
+	{
+		return( 0 );
 	}
-	for( resource_filename_segment_index = 0;
-	     resource_filename_segment_index < resource_filename_number_of_segments;
-	     resource_filename_segment_index++ )
+	if( event_provider->resource_file_is_resolved == 0 )
 	{
-		if( system_split_string_get_segment_by_index(
-		     resource_filename_split_string,
-		     resource_filename_segment_index,
-		     &resource_filename_string_segment,
-		     &resource_filename_string_segment_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve resource filename string segment: %d.",
-			 function,
-			 resource_filename_segment_index );
-
-			goto on_error;
-		}
-		result = message_handle_get_resource_file_from_cache(
+		result = message_handle_get_resource_file_by_provider_identifier(
 			  message_handle,
-			  resource_filename_string_segment,
-			  resource_filename_string_segment_size - 1,
+			  event_provider->resource_filename,
+			  event_provider->resource_filename_size - 1,
+			  provider_identifier,
+			  provider_identifier_size,
 			  resource_file,
 			  error );
 
@@ -3992,113 +5221,110 @@ int message_handle_get_resource_file_by_provider_identifier(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve resource file: %d from cache.",
-			 function,
-			 resource_filename_segment_index );
+			 "%s: unable to retrieve resource file by provider identifier.",
+			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( result == 0 )
+		else if( result != 0 )
 		{
-			result = message_handle_get_resource_file_path(
-				  message_handle,
-				  resource_filename_string_segment,
-				  resource_filename_string_segment_size - 1,
-				  NULL,
-				  0,
-				  &resource_file_path,
-				  &resource_file_path_size,
-				  error );
-
-			if( result == -1 )
+			if( event_provider_set_resource_file_name(
+			     event_provider,
+			     ( *resource_file )->name,
+			     ( *resource_file )->name_size - 1,
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve resource file path.",
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set resource file name in event provider.",
 				 function );
 
-				goto on_error;
+				return( -1 );
 			}
-			else if( result != 0 )
-			{
-				if( message_handle_get_resource_file(
-				     message_handle,
-				     resource_filename,
-				     resource_filename_length,
-				     resource_file_path,
-				     resource_file,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve resource file: %" PRIs_SYSTEM ".",
-					 function,
-					 resource_file_path );
+		}
+		else
+		{
+			*resource_file = NULL;
+		}
+		event_provider->resource_file_is_resolved = 1;
 
-					goto on_error;
-				}
-				memory_free(
-				 resource_file_path );
+		return( result );
+	}
+	if( event_provider->resource_file_name == NULL )
+	{
+		return( 0 );
+	}
+	result = message_handle_get_resource_file_from_cache(
+		  message_handle,
+		  event_provider->resource_file_name,
+		  event_provider->resource_file_name_size - 1,
+		  resource_file,
+		  error );
 
-				resource_file_path = NULL;
-			}
-		}
-		if( resource_file != NULL )
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve resource file from cache.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		/* The resource file was removed from the cache and needs to be reopened
+		 */
+		result = message_handle_get_resource_file_path(
+			  message_handle,
+			  event_provider->resource_file_name,
+			  event_provider->resource_file_name_size - 1,
+			  NULL,
+			  0,
+			  &resource_file_path,
+			  &resource_file_path_size,
+			  error );
+
+		if( result == -1 )
 		{
-			result = resource_file_get_provider(
-			          *resource_file,
-				  provider_identifier,
-				  provider_identifier_size,
-				  &provider,
-				  error );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve resource file path.",
+			 function );
 
-			if( result == -1 )
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			if( message_handle_get_resource_file(
+			     message_handle,
+			     event_provider->resource_file_name,
+			     event_provider->resource_file_name_size - 1,
+			     resource_file_path,
+			     resource_file,
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve provider.",
-				 function );
+				 "%s: unable to retrieve resource file: %" PRIs_SYSTEM ".",
+				 function,
+				 resource_file_path );
 
 				goto on_error;
 			}
-			else if( result != 0 )
-			{
-				if( libwrc_wevt_provider_free(
-				     &provider,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-					 "%s: unable to free provider.",
-					 function );
+			memory_free(
+			 resource_file_path );
 
-					goto on_error;
-				}
-				break;
-			}
+			resource_file_path = NULL;
 		}
 	}
-	if( system_split_string_free(
-	     &resource_filename_split_string,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free resource filename split string.",
-		 function );
-
-		goto on_error;
-	}
 	return( result );
 
 on_error:
@@ -4107,12 +5333,6 @@ on_error:
 		memory_free(
 		 resource_file_path );
 	}
-	if( resource_filename_split_string != NULL )
-	{
-		system_split_string_free(
-		 &resource_filename_split_string,
-		 NULL );
-	}
 	return( -1 );
 }
 
@@ -23,15 +23,21 @@
 #define _MESSAGE_HANDLE_H
 
 #include <common.h>
+#include <file_stream.h>
 #include <types.h>
 
+#include "event_provider.h"
+#include "evtxtools_libcdata.h"
 #include "evtxtools_libcerror.h"
-#include "evtxtools_libfcache.h"
 #include "evtxtools_libregf.h"
+#include "message_catalog.h"
 #include "message_string.h"
 #include "path_handle.h"
+#include "profile_handle.h"
 #include "registry_file.h"
+#include "registry_key_table.h"
 #include "resource_file.h"
+#include "resource_file_cache.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -109,25 +115,49 @@ struct message_handle
 	 */
 	libregf_key_t *control_set_2_eventlog_services_key;
 
+	/* Value to indicate the publisher and event source keys should be read once when the input is opened
+	 */
+	uint8_t preload_registry_keys;
+
+	/* The WinEvt publishers table, which contains the preloaded publisher keys
+	 */
+	registry_key_table_t *winevt_publishers_table;
+
+	/* The eventlog services table, which contains the preloaded event source keys
+	 */
+	registry_key_table_t *eventlog_services_table;
+
+	/* The message catalog, which when set is used instead of the registry and resource files
+	 */
+	message_catalog_t *message_catalog;
+
 	/* The resource files path
 	 */
 	const system_character_t *resource_files_path;
 
 	/* The resource file cache
 	 */
-	libfcache_cache_t *resource_file_cache;
+	resource_file_cache_t *resource_file_cache;
+
+	/* The MUI resource file cache
+	 */
+	resource_file_cache_t *mui_resource_file_cache;
 
-	/* The next available resource file cache index
+	/* The event providers tree, which contains the resolved event providers
 	 */
-	int next_resource_file_cache_index;
+	libcdata_btree_t *event_providers_tree;
 
-	/* The MUI resource file cache
+	/* The number of event provider retrievals that found the event provider in the tree
 	 */
-	libfcache_cache_t *mui_resource_file_cache;
+	uint64_t number_of_event_provider_hits;
 
-	/* The next available MUI resource file cache index
+	/* The number of event provider retrievals that did not find the event provider in the tree
 	 */
-	int next_mui_resource_file_cache_index;
+	uint64_t number_of_event_provider_misses;
+
+	/* The profile handle
+	 */
+	profile_handle_t *profile_handle;
 
 	/* The ascii codepage
 	 */
@@ -185,6 +215,31 @@ int message_handle_set_resource_files_path(
      const system_character_t *path,
      libcerror_error_t **error );
 
+int message_handle_set_resource_file_cache_capacity(
+     message_handle_t *message_handle,
+     int capacity,
+     libcerror_error_t **error );
+
+int message_handle_cache_statistics_fprint(
+     message_handle_t *message_handle,
+     FILE *stream,
+     libcerror_error_t **error );
+
+int message_handle_event_providers_fprint(
+     message_handle_t *message_handle,
+     FILE *stream,
+     libcerror_error_t **error );
+
+int message_handle_set_preload_registry_keys(
+     message_handle_t *message_handle,
+     uint8_t preload_registry_keys,
+     libcerror_error_t **error );
+
+int message_handle_open_message_catalog(
+     message_handle_t *message_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
 int message_handle_open_software_registry_file(
      message_handle_t *message_handle,
      libcerror_error_t **error );
@@ -194,6 +249,10 @@ int message_handle_open_system_registry_file(
      const char *eventlog_key_name,
      libcerror_error_t **error );
 
+int message_handle_preload_registry_keys(
+     message_handle_t *message_handle,
+     libcerror_error_t **error );
+
 int message_handle_open_input(
      message_handle_t *message_handle,
      const char *eventlog_key_name,
@@ -296,6 +355,23 @@ int message_handle_get_resource_file_by_provider_identifier(
      resource_file_t **resource_file,
      libcerror_error_t **error );
 
+int message_handle_get_event_provider(
+     message_handle_t *message_handle,
+     const system_character_t *provider_identifier,
+     size_t provider_identifier_length,
+     const system_character_t *event_source,
+     size_t event_source_length,
+     event_provider_t **event_provider,
+     libcerror_error_t **error );
+
+int message_handle_get_resource_file_by_event_provider(
+     message_handle_t *message_handle,
+     event_provider_t *event_provider,
+     const uint8_t *provider_identifier,
+     size_t provider_identifier_size,
+     resource_file_t **resource_file,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
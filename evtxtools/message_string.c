@@ -30,6 +30,7 @@
 #include "evtxtools_libcerror.h"
 #include "evtxtools_libevtx.h"
 #include "evtxtools_libwrc.h"
+#include "evtxtools_output.h"
 #include "message_string.h"
 
 /* Creates a message string
@@ -136,6 +137,16 @@ int message_string_free(
 	}
 	if( *message_string != NULL )
 	{
+		if( ( *message_string )->segments != NULL )
+		{
+			memory_free(
+			 ( *message_string )->segments );
+		}
+		if( ( *message_string )->compiled_characters != NULL )
+		{
+			memory_free(
+			 ( *message_string )->compiled_characters );
+		}
 		if( ( *message_string )->string != NULL )
 		{
 			memory_free(
@@ -149,6 +160,168 @@ int message_string_free(
 	return( result );
 }
 
+/* Clones a message string
+ * The compiled segments are cloned as well
+ * Returns 1 if successful or -1 on error
+ */
+int message_string_clone(
+     message_string_t **destination_message_string,
+     message_string_t *source_message_string,
+     libcerror_error_t **error )
+{
+	static char *function = "message_string_clone";
+
+	if( destination_message_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination message string.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_message_string != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination message string value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_message_string == NULL )
+	{
+		*destination_message_string = NULL;
+
+		return( 1 );
+	}
+	if( message_string_initialize(
+	     destination_message_string,
+	     source_message_string->identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination message string.",
+		 function );
+
+		goto on_error;
+	}
+	if( source_message_string->string != NULL )
+	{
+		( *destination_message_string )->string = system_string_allocate(
+		                                           source_message_string->string_size );
+
+		if( ( *destination_message_string )->string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create destination string.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     ( *destination_message_string )->string,
+		     source_message_string->string,
+		     sizeof( system_character_t ) * source_message_string->string_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy string.",
+			 function );
+
+			goto on_error;
+		}
+		( *destination_message_string )->string_size = source_message_string->string_size;
+	}
+	if( source_message_string->segments != NULL )
+	{
+		/* The compiled characters are allocated with the size of the string
+		 */
+		( *destination_message_string )->compiled_characters = system_string_allocate(
+		                                                        source_message_string->string_size );
+
+		if( ( *destination_message_string )->compiled_characters == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create destination compiled characters.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     ( *destination_message_string )->compiled_characters,
+		     source_message_string->compiled_characters,
+		     sizeof( system_character_t ) * source_message_string->string_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy compiled characters.",
+			 function );
+
+			goto on_error;
+		}
+		/* The segments are allocated even if there are none, since they mark
+		 * the message string as compiled
+		 */
+		( *destination_message_string )->segments = (message_string_segment_t *) memory_allocate(
+		                                                                          sizeof( message_string_segment_t ) * ( source_message_string->number_of_segments + 1 ) );
+
+		if( ( *destination_message_string )->segments == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create destination segments.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     ( *destination_message_string )->segments,
+		     source_message_string->segments,
+		     sizeof( message_string_segment_t ) * source_message_string->number_of_segments ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy segments.",
+			 function );
+
+			goto on_error;
+		}
+		( *destination_message_string )->number_of_segments = source_message_string->number_of_segments;
+	}
+	return( 1 );
+
+on_error:
+	if( *destination_message_string != NULL )
+	{
+		message_string_free(
+		 destination_message_string,
+		 NULL );
+	}
+	return( -1 );
+}
+
 /* Retrieve the message string from the message table resource
  * Returns 1 if successful, 0 if not available or -1 on error
  */
@@ -291,24 +464,65 @@ on_error:
 	return( -1 );
 }
 
-/* Prints the message string to a FILE stream
+/* Appends a character to the last literal segment of the compiled message string
+ * A new literal segment is created if the last segment is not a literal segment
+ */
+void message_string_compile_append_character(
+      message_string_t *message_string,
+      system_character_t character,
+      size_t *compiled_characters_offset )
+{
+	message_string_segment_t *segment = NULL;
+
+	if( message_string->number_of_segments > 0 )
+	{
+		segment = &( message_string->segments[ message_string->number_of_segments - 1 ] );
+
+		if( segment->type != MESSAGE_STRING_SEGMENT_TYPE_LITERAL )
+		{
+			segment = NULL;
+		}
+	}
+	if( segment == NULL )
+	{
+		segment = &( message_string->segments[ message_string->number_of_segments ] );
+
+		segment->type                 = MESSAGE_STRING_SEGMENT_TYPE_LITERAL;
+		segment->value_string_index   = 0;
+		segment->characters_offset    = *compiled_characters_offset;
+		segment->number_of_characters = 0;
+
+		message_string->number_of_segments += 1;
+	}
+	message_string->compiled_characters[ *compiled_characters_offset ] = character;
+
+	*compiled_characters_offset += 1;
+
+	segment->number_of_characters += 1;
+	segment->last_character        = character;
+}
+
+/* Compiles the message string into literal and insert segments
+ * The conversion specifiers are interpreted once, so that printing the message string
+ * only needs to splice the literal characters and the value strings
+ *
+ * Multiple new line characters are collapsed into one, the compiled literal characters
+ * assume the preceding segment did not end with a new line, hence a literal segment
+ * that starts with a new line character is printed without it when it did
  * Returns 1 if successful or -1 on error
  */
-int message_string_fprint(
+int message_string_compile(
      message_string_t *message_string,
-     libevtx_record_t *record,
-     FILE *stream,
      libcerror_error_t **error )
 {
-	system_character_t *value_string   = NULL;
-	static char *function              = "message_string_fprint";
+	message_string_segment_t *segment  = NULL;
+	static char *function              = "message_string_compile";
+	size_t compiled_characters_offset  = 0;
 	size_t conversion_specifier_length = 0;
-	size_t message_string_length       = 0;
 	size_t message_string_index        = 0;
-	size_t value_string_size           = 0;
+	size_t message_string_length       = 0;
 	system_character_t last_character  = 0;
-	int number_of_strings              = 0;
-	int result                         = 0;
+	int maximum_number_of_segments     = 0;
 	int value_string_index             = 0;
 
 	if( message_string == NULL )
@@ -322,32 +536,79 @@ int message_string_fprint(
 
 		return( -1 );
 	}
-	if( libevtx_record_get_number_of_strings(
-	     record,
-	     &number_of_strings,
-	     error ) != 1 )
+	if( message_string->segments != NULL )
+	{
+		return( 1 );
+	}
+	if( ( message_string->string == NULL )
+	 || ( message_string->string_size == 0 ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of strings in record.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid message string - missing string.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	fprintf(
-	 stream,
-	 "Message format string\t\t: %" PRIs_SYSTEM "\n",
-	 message_string->string );
-#endif
-	fprintf(
-	 stream,
-	 "Message string\t\t\t: " );
+	if( message_string->string_size > (size_t) ( INT_MAX / 2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid message string - string size value out of bounds.",
+		 function );
 
+		return( -1 );
+	}
 	message_string_length = message_string->string_size - 1;
-	message_string_index  = 0;
+
+	/* Every conversion specifier adds at most an insert segment and a literal segment
+	 */
+	maximum_number_of_segments = 1;
+
+	for( message_string_index = 0;
+	     message_string_index < message_string_length;
+	     message_string_index++ )
+	{
+		if( ( message_string->string )[ message_string_index ] == (system_character_t) '%' )
+		{
+			maximum_number_of_segments += 2;
+		}
+	}
+	message_string->compiled_characters = system_string_allocate(
+	                                       message_string->string_size );
+
+	if( message_string->compiled_characters == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create compiled characters.",
+		 function );
+
+		goto on_error;
+	}
+	message_string->segments = (message_string_segment_t *) memory_allocate(
+	                                                         sizeof( message_string_segment_t ) * maximum_number_of_segments );
+
+	if( message_string->segments == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create segments.",
+		 function );
+
+		goto on_error;
+	}
+	message_string->number_of_segments = 0;
+
+	message_string_index = 0;
 
 	while( message_string_index < message_string_length )
 	{
@@ -376,10 +637,10 @@ int message_string_fprint(
 			{
 				last_character = ( message_string->string )[ message_string_index + 1 ];
 
-				fprintf(
-				 stream,
-				 "%c",
-				 last_character );
+				message_string_compile_append_character(
+				 message_string,
+				 last_character,
+				 &compiled_characters_offset );
 
 				message_string_index += 2;
 
@@ -390,10 +651,10 @@ int message_string_fprint(
 			{
 				last_character = (system_character_t) ' ';
 
-				fprintf(
-				 stream,
-				 "%c",
-				 last_character );
+				message_string_compile_append_character(
+				 message_string,
+				 last_character,
+				 &compiled_characters_offset );
 
 				message_string_index += 2;
 
@@ -406,10 +667,10 @@ int message_string_fprint(
 				{
 					last_character = (system_character_t) '\n';
 
-					fprintf(
-					 stream,
-					 "%c",
-					 last_character );
+					message_string_compile_append_character(
+					 message_string,
+					 last_character,
+					 &compiled_characters_offset );
 				}
 				message_string_index += 2;
 
@@ -420,10 +681,10 @@ int message_string_fprint(
 			{
 				last_character = (system_character_t) '\t';
 
-				fprintf(
-				 stream,
-				 "%c",
-				 last_character );
+				message_string_compile_append_character(
+				 message_string,
+				 last_character,
+				 &compiled_characters_offset );
 
 				message_string_index += 2;
 
@@ -475,104 +736,41 @@ int message_string_fprint(
 				}
 				conversion_specifier_length += 3;
 			}
-/* TODO remove index check after user data support */
-			if( value_string_index < number_of_strings )
+			/* The conversion specifier is kept so that it can be printed
+			 * when the value string is not available
+			 */
+			segment = &( message_string->segments[ message_string->number_of_segments ] );
+
+			segment->type                 = MESSAGE_STRING_SEGMENT_TYPE_INSERT;
+			segment->value_string_index   = value_string_index;
+			segment->characters_offset    = compiled_characters_offset;
+			segment->number_of_characters = conversion_specifier_length;
+
+			message_string->number_of_segments += 1;
+
+			if( memory_copy(
+			     &( message_string->compiled_characters[ compiled_characters_offset ] ),
+			     &( ( message_string->string )[ message_string_index ] ),
+			     sizeof( system_character_t ) * conversion_specifier_length ) == NULL )
 			{
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-				result = libevtx_record_get_utf16_string_size(
-					  record,
-					  value_string_index,
-					  &value_string_size,
-					  error );
-#else
-				result = libevtx_record_get_utf8_string_size(
-					  record,
-					  value_string_index,
-					  &value_string_size,
-					  error );
-#endif
-				if( result != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve string: %d size.",
-					 function,
-					 value_string_index );
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy conversion specifier.",
+				 function );
 
-					goto on_error;
-				}
-				if( value_string_size > 0 )
-				{
-					value_string = system_string_allocate(
-							value_string_size );
-
-					if( value_string == NULL )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_MEMORY,
-						 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-						 "%s: unable to create value string.",
-						 function );
-
-						goto on_error;
-					}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-					result = libevtx_record_get_utf16_string(
-						  record,
-						  value_string_index,
-						  (uint16_t *) value_string,
-						  value_string_size,
-						  error );
-#else
-					result = libevtx_record_get_utf8_string(
-						  record,
-						  value_string_index,
-						  (uint8_t *) value_string,
-						  value_string_size,
-						  error );
-#endif
-					if( result != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-						 "%s: unable to retrieve string: %d.",
-						 function,
-						 value_string_index );
-
-						goto on_error;
-					}
-					fprintf(
-					 stream,
-					 "%" PRIs_SYSTEM "",
-					 value_string );
-
-					memory_free(
-					 value_string );
-
-					value_string = NULL;
-				}
-				message_string_index += conversion_specifier_length;
+				goto on_error;
 			}
-			else
-			{
-				do
-				{
-					fprintf(
-					 stream,
-					 "%" PRIc_SYSTEM "",
-					 ( message_string->string )[ message_string_index++ ] );
+			compiled_characters_offset += conversion_specifier_length;
+			message_string_index       += conversion_specifier_length;
 
-					conversion_specifier_length--;
-				}
-				while( conversion_specifier_length > 0 );
+			segment->last_character = ( message_string->string )[ message_string_index ];
 
-				last_character = ( message_string->string )[ message_string_index ];
-			}
+			/* The last character of the next literal segment does not depend on
+			 * the characters before the insert
+			 */
+			last_character = 0;
 		}
 		else
 		{
@@ -589,29 +787,234 @@ int message_string_fprint(
 				}
 				else
 				{
-					fprintf(
-					 stream,
-					 "%" PRIc_SYSTEM "",
-					 ( message_string->string )[ message_string_index ] );
-
 					last_character = ( message_string->string )[ message_string_index ];
+
+					message_string_compile_append_character(
+					 message_string,
+					 last_character,
+					 &compiled_characters_offset );
 				}
 			}
 			message_string_index += 1;
 		}
 	}
-	fprintf(
-	 stream,
-	 "\n" );
-
 	return( 1 );
 
 on_error:
-	if( value_string != NULL )
+	if( message_string->segments != NULL )
+	{
+		memory_free(
+		 message_string->segments );
+
+		message_string->segments = NULL;
+	}
+	if( message_string->compiled_characters != NULL )
 	{
 		memory_free(
-		 value_string );
+		 message_string->compiled_characters );
+
+		message_string->compiled_characters = NULL;
 	}
+	message_string->number_of_segments = 0;
+
 	return( -1 );
 }
 
+/* Appends characters to an output buffer
+ * Returns 1 if successful or -1 on error
+ */
+int message_string_append_characters(
+     evtxtools_output_buffer_t *output_buffer,
+     const system_character_t *characters,
+     size_t number_of_characters,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	size_t character_index = 0;
+#else
+	static char *function  = "message_string_append_characters";
+#endif
+
+	if( number_of_characters == 0 )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	/* The wide characters are converted by the formatted print
+	 */
+	for( character_index = 0;
+	     character_index < number_of_characters;
+	     character_index++ )
+	{
+		evtxtools_output_buffer_printf(
+		 output_buffer,
+		 "%" PRIc_SYSTEM "",
+		 characters[ character_index ] );
+	}
+#else
+	if( evtxtools_output_buffer_append(
+	     output_buffer,
+	     (uint8_t *) characters,
+	     number_of_characters,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append characters to output buffer.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Prints the message string to an output buffer
+ * The value strings are stored consecutively, the value string offsets contain
+ * the start of each value string, as returned by libevtx_record_get_utf8_strings
+ * The message string is compiled on first use
+ * Returns 1 if successful or -1 on error
+ */
+int message_string_print(
+     message_string_t *message_string,
+     const system_character_t *value_strings,
+     const size_t *value_string_offsets,
+     int number_of_value_strings,
+     evtxtools_output_buffer_t *output_buffer,
+     libcerror_error_t **error )
+{
+	const system_character_t *characters = NULL;
+	message_string_segment_t *segment    = NULL;
+	static char *function                = "message_string_print";
+	size_t number_of_characters          = 0;
+	system_character_t last_character    = 0;
+	int segment_index                    = 0;
+
+	if( message_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message string.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_value_strings < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of value strings value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_value_strings > 0 )
+	 && ( ( value_strings == NULL )
+	  ||  ( value_string_offsets == NULL ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_string_compile(
+	     message_string,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to compile message string.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	evtxtools_output_buffer_printf(
+	 output_buffer,
+	 "Message format string\t\t: %" PRIs_SYSTEM "\n",
+	 message_string->string );
+#endif
+	evtxtools_output_buffer_printf(
+	 output_buffer,
+	 "Message string\t\t\t: " );
+
+	for( segment_index = 0;
+	     segment_index < message_string->number_of_segments;
+	     segment_index++ )
+	{
+		segment = &( message_string->segments[ segment_index ] );
+
+		characters           = &( message_string->compiled_characters[ segment->characters_offset ] );
+		number_of_characters = segment->number_of_characters;
+
+		if( segment->type == MESSAGE_STRING_SEGMENT_TYPE_LITERAL )
+		{
+			/* Ignore multiple \n characters
+			 */
+			if( ( last_character == (system_character_t) '\n' )
+			 && ( characters[ 0 ] == (system_character_t) '\n' ) )
+			{
+				characters           += 1;
+				number_of_characters -= 1;
+			}
+			last_character = segment->last_character;
+		}
+/* TODO remove index check after user data support */
+		else if( segment->value_string_index < number_of_value_strings )
+		{
+			characters = &( value_strings[ value_string_offsets[ segment->value_string_index ] ] );
+
+			number_of_characters = system_string_length(
+			                        characters );
+		}
+		else
+		{
+			last_character = segment->last_character;
+		}
+		if( message_string_append_characters(
+		     output_buffer,
+		     characters,
+		     number_of_characters,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print segment: %d.",
+			 function,
+			 segment_index );
+
+			return( -1 );
+		}
+	}
+	evtxtools_output_buffer_printf(
+	 output_buffer,
+	 "\n" );
+
+	return( 1 );
+}
+
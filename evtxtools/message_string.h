@@ -29,11 +29,45 @@
 #include "evtxtools_libcerror.h"
 #include "evtxtools_libevtx.h"
 #include "evtxtools_libwrc.h"
+#include "evtxtools_output.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+enum MESSAGE_STRING_SEGMENT_TYPES
+{
+	MESSAGE_STRING_SEGMENT_TYPE_LITERAL	= 1,
+	MESSAGE_STRING_SEGMENT_TYPE_INSERT	= 2
+};
+
+typedef struct message_string_segment message_string_segment_t;
+
+struct message_string_segment
+{
+	/* The type
+	 */
+	uint8_t type;
+
+	/* The value string index of an insert segment
+	 */
+	int value_string_index;
+
+	/* The offset of the characters in the compiled characters
+	 * For an insert segment these are the characters of the conversion specifier
+	 */
+	size_t characters_offset;
+
+	/* The number of characters
+	 */
+	size_t number_of_characters;
+
+	/* The last character after the segment has been printed
+	 * For an insert segment this is only used when the value string is not available
+	 */
+	system_character_t last_character;
+};
+
 typedef struct message_string message_string_t;
 
 struct message_string
@@ -49,6 +83,18 @@ struct message_string
 	/* The string size
 	 */
 	size_t string_size;
+
+	/* The compiled characters
+	 */
+	system_character_t *compiled_characters;
+
+	/* The compiled segments
+	 */
+	message_string_segment_t *segments;
+
+	/* The number of compiled segments
+	 */
+	int number_of_segments;
 };
 
 int message_string_initialize(
@@ -60,16 +106,38 @@ int message_string_free(
      message_string_t **message_string,
      libcerror_error_t **error );
 
+int message_string_clone(
+     message_string_t **destination_message_string,
+     message_string_t *source_message_string,
+     libcerror_error_t **error );
+
 int message_string_get_from_message_table_resource(
      message_string_t *message_string,
      libwrc_resource_t *message_table_resource,
      uint32_t language_identifier,
      libcerror_error_t **error );
 
-int message_string_fprint(
+void message_string_compile_append_character(
+      message_string_t *message_string,
+      system_character_t character,
+      size_t *compiled_characters_offset );
+
+int message_string_compile(
+     message_string_t *message_string,
+     libcerror_error_t **error );
+
+int message_string_append_characters(
+     evtxtools_output_buffer_t *output_buffer,
+     const system_character_t *characters,
+     size_t number_of_characters,
+     libcerror_error_t **error );
+
+int message_string_print(
      message_string_t *message_string,
-     libevtx_record_t *record,
-     FILE *stream,
+     const system_character_t *value_strings,
+     const size_t *value_string_offsets,
+     int number_of_value_strings,
+     evtxtools_output_buffer_t *output_buffer,
      libcerror_error_t **error );
 
 #if defined( __cplusplus )
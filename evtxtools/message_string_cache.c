@@ -0,0 +1,420 @@
+/*
+ * Message string cache
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+#include "message_string.h"
+#include "message_string_cache.h"
+
+/* Determines the bucket of a message identifier and language identifier
+ */
+#define message_string_cache_get_bucket_index( identifier, language_identifier ) \
+	( ( (uint32_t) ( identifier ) ^ ( (uint32_t) ( language_identifier ) * 0x9e3779b1UL ) ) & ( MESSAGE_STRING_CACHE_NUMBER_OF_BUCKETS - 1 ) )
+
+/* Creates a message string cache
+ * Make sure the value message_string_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int message_string_cache_initialize(
+     message_string_cache_t **message_string_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "message_string_cache_initialize";
+
+	if( message_string_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message string cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *message_string_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid message string cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*message_string_cache = memory_allocate_structure(
+	                         message_string_cache_t );
+
+	if( *message_string_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create message string cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *message_string_cache,
+	     0,
+	     sizeof( message_string_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear message string cache.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *message_string_cache != NULL )
+	{
+		memory_free(
+		 *message_string_cache );
+
+		*message_string_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a message string cache
+ * The message strings in the cache are freed as well
+ * Returns 1 if successful or -1 on error
+ */
+int message_string_cache_free(
+     message_string_cache_t **message_string_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "message_string_cache_free";
+	int result            = 1;
+
+	if( message_string_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message string cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *message_string_cache != NULL )
+	{
+		if( message_string_cache_empty(
+		     *message_string_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty message string cache.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *message_string_cache );
+
+		*message_string_cache = NULL;
+	}
+	return( result );
+}
+
+/* Empties a message string cache
+ * The message strings in the cache are freed
+ * Returns 1 if successful or -1 on error
+ */
+int message_string_cache_empty(
+     message_string_cache_t *message_string_cache,
+     libcerror_error_t **error )
+{
+	message_string_cache_entry_t *cache_entry = NULL;
+	static char *function                     = "message_string_cache_empty";
+	int result                                = 1;
+
+	if( message_string_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message string cache.",
+		 function );
+
+		return( -1 );
+	}
+	while( message_string_cache->first_entry != NULL )
+	{
+		cache_entry = message_string_cache->first_entry;
+
+		message_string_cache->first_entry = cache_entry->next_entry;
+
+		if( cache_entry->message_string != NULL )
+		{
+			if( message_string_free(
+			     &( cache_entry->message_string ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free message string.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 cache_entry );
+	}
+	message_string_cache->last_entry        = NULL;
+	message_string_cache->number_of_entries = 0;
+
+	if( memory_set(
+	     message_string_cache->buckets,
+	     0,
+	     sizeof( message_string_cache_entry_t * ) * MESSAGE_STRING_CACHE_NUMBER_OF_BUCKETS ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buckets.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Retrieves a specific message string from a message string cache
+ * The message string is set to NULL if the cache records that the message is not available
+ * Returns 1 if successful, 0 if not in the cache or -1 on error
+ */
+int message_string_cache_get_message_string(
+     message_string_cache_t *message_string_cache,
+     uint32_t identifier,
+     uint32_t language_identifier,
+     message_string_t **message_string,
+     libcerror_error_t **error )
+{
+	message_string_cache_entry_t *cache_entry = NULL;
+	static char *function                     = "message_string_cache_get_message_string";
+
+	if( message_string_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message string cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message string.",
+		 function );
+
+		return( -1 );
+	}
+	*message_string = NULL;
+
+	cache_entry = message_string_cache->buckets[ message_string_cache_get_bucket_index( identifier, language_identifier ) ];
+
+	while( cache_entry != NULL )
+	{
+		if( ( cache_entry->identifier == identifier )
+		 && ( cache_entry->language_identifier == language_identifier ) )
+		{
+			*message_string = cache_entry->message_string;
+
+			message_string_cache->number_of_hits += 1;
+
+			return( 1 );
+		}
+		cache_entry = cache_entry->next_bucket_entry;
+	}
+	message_string_cache->number_of_misses += 1;
+
+	return( 0 );
+}
+
+/* Inserts a message string into a message string cache
+ * The message string cache takes over management of the message string
+ * A NULL message string records that the message is not available
+ * If the cache is full the least recently inserted message string is removed
+ * Returns 1 if successful or -1 on error
+ */
+int message_string_cache_insert_message_string(
+     message_string_cache_t *message_string_cache,
+     uint32_t identifier,
+     uint32_t language_identifier,
+     message_string_t *message_string,
+     libcerror_error_t **error )
+{
+	message_string_cache_entry_t *bucket_entry = NULL;
+	message_string_cache_entry_t *cache_entry  = NULL;
+	static char *function                      = "message_string_cache_insert_message_string";
+	uint32_t bucket_index                      = 0;
+
+	if( message_string_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message string cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_string_cache->number_of_entries >= MESSAGE_STRING_CACHE_MAXIMUM_NUMBER_OF_ENTRIES )
+	{
+		/* Reuse the least recently inserted entry
+		 */
+		cache_entry = message_string_cache->first_entry;
+
+		message_string_cache->first_entry = cache_entry->next_entry;
+
+		if( message_string_cache->first_entry == NULL )
+		{
+			message_string_cache->last_entry = NULL;
+		}
+		message_string_cache->number_of_entries -= 1;
+
+		bucket_index = message_string_cache_get_bucket_index( cache_entry->identifier, cache_entry->language_identifier );
+
+		if( message_string_cache->buckets[ bucket_index ] == cache_entry )
+		{
+			message_string_cache->buckets[ bucket_index ] = cache_entry->next_bucket_entry;
+		}
+		else
+		{
+			bucket_entry = message_string_cache->buckets[ bucket_index ];
+
+			while( bucket_entry != NULL )
+			{
+				if( bucket_entry->next_bucket_entry == cache_entry )
+				{
+					bucket_entry->next_bucket_entry = cache_entry->next_bucket_entry;
+
+					break;
+				}
+				bucket_entry = bucket_entry->next_bucket_entry;
+			}
+		}
+		if( cache_entry->message_string != NULL )
+		{
+			if( message_string_free(
+			     &( cache_entry->message_string ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free message string.",
+				 function );
+
+				memory_free(
+				 cache_entry );
+
+				return( -1 );
+			}
+		}
+	}
+	else
+	{
+		cache_entry = memory_allocate_structure(
+		               message_string_cache_entry_t );
+
+		if( cache_entry == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create cache entry.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( memory_set(
+	     cache_entry,
+	     0,
+	     sizeof( message_string_cache_entry_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear cache entry.",
+		 function );
+
+		memory_free(
+		 cache_entry );
+
+		return( -1 );
+	}
+	cache_entry->identifier          = identifier;
+	cache_entry->language_identifier = language_identifier;
+	cache_entry->message_string      = message_string;
+
+	bucket_index = message_string_cache_get_bucket_index( identifier, language_identifier );
+
+	cache_entry->next_bucket_entry                = message_string_cache->buckets[ bucket_index ];
+	message_string_cache->buckets[ bucket_index ] = cache_entry;
+
+	if( message_string_cache->last_entry != NULL )
+	{
+		message_string_cache->last_entry->next_entry = cache_entry;
+	}
+	else
+	{
+		message_string_cache->first_entry = cache_entry;
+	}
+	message_string_cache->last_entry = cache_entry;
+
+	message_string_cache->number_of_entries += 1;
+
+	return( 1 );
+}
+
@@ -0,0 +1,129 @@
+/*
+ * Message string cache
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _MESSAGE_STRING_CACHE_H )
+#define _MESSAGE_STRING_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+#include "message_string.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of buckets of a message string cache
+ * This value must be a power of 2
+ */
+#define MESSAGE_STRING_CACHE_NUMBER_OF_BUCKETS			256
+
+/* The maximum number of entries in a message string cache
+ */
+#define MESSAGE_STRING_CACHE_MAXIMUM_NUMBER_OF_ENTRIES		4096
+
+typedef struct message_string_cache_entry message_string_cache_entry_t;
+
+struct message_string_cache_entry
+{
+	/* The message identifier
+	 */
+	uint32_t identifier;
+
+	/* The language identifier
+	 */
+	uint32_t language_identifier;
+
+	/* The message string or NULL if the message table has no such message
+	 */
+	message_string_t *message_string;
+
+	/* The next entry in the same bucket
+	 */
+	message_string_cache_entry_t *next_bucket_entry;
+
+	/* The next (more recently inserted) entry
+	 */
+	message_string_cache_entry_t *next_entry;
+};
+
+typedef struct message_string_cache message_string_cache_t;
+
+struct message_string_cache
+{
+	/* The buckets
+	 */
+	message_string_cache_entry_t *buckets[ MESSAGE_STRING_CACHE_NUMBER_OF_BUCKETS ];
+
+	/* The first (least recently inserted) entry
+	 */
+	message_string_cache_entry_t *first_entry;
+
+	/* The last (most recently inserted) entry
+	 */
+	message_string_cache_entry_t *last_entry;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The number of retrievals that found the message string in the cache
+	 */
+	uint64_t number_of_hits;
+
+	/* The number of retrievals that did not find the message string in the cache
+	 */
+	uint64_t number_of_misses;
+};
+
+int message_string_cache_initialize(
+     message_string_cache_t **message_string_cache,
+     libcerror_error_t **error );
+
+int message_string_cache_free(
+     message_string_cache_t **message_string_cache,
+     libcerror_error_t **error );
+
+int message_string_cache_empty(
+     message_string_cache_t *message_string_cache,
+     libcerror_error_t **error );
+
+int message_string_cache_get_message_string(
+     message_string_cache_t *message_string_cache,
+     uint32_t identifier,
+     uint32_t language_identifier,
+     message_string_t **message_string,
+     libcerror_error_t **error );
+
+int message_string_cache_insert_message_string(
+     message_string_cache_t *message_string_cache,
+     uint32_t identifier,
+     uint32_t language_identifier,
+     message_string_t *message_string,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _MESSAGE_STRING_CACHE_H ) */
+
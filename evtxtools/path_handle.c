@@ -26,7 +26,7 @@
 #include <types.h>
 #include <wide_string.h>
 
-#include "evtxtools_libcdirectory.h"
+#include "directory_listing.h"
 #include "evtxtools_libcerror.h"
 #include "path_handle.h"
 
@@ -110,8 +110,10 @@ int path_handle_free(
      path_handle_t **path_handle,
      libcerror_error_t **error )
 {
-	static char *function = "path_handle_free";
-	int result            = 1;
+	directory_listing_t *directory_listing = NULL;
+	static char *function                  = "path_handle_free";
+	int bucket_index                       = 0;
+	int result                             = 1;
 
 	if( path_handle == NULL )
 	{
@@ -131,6 +133,31 @@ int path_handle_free(
 			memory_free(
 			 ( *path_handle )->system_root_path );
 		}
+		for( bucket_index = 0;
+		     bucket_index < PATH_HANDLE_NUMBER_OF_DIRECTORY_LISTING_BUCKETS;
+		     bucket_index++ )
+		{
+			while( ( *path_handle )->directory_listings[ bucket_index ] != NULL )
+			{
+				directory_listing = ( *path_handle )->directory_listings[ bucket_index ];
+
+				( *path_handle )->directory_listings[ bucket_index ] = directory_listing->next_directory_listing;
+
+				if( directory_listing_free(
+				     &directory_listing,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free directory listing.",
+					 function );
+
+					result = -1;
+				}
+			}
+		}
 		memory_free(
 		 *path_handle );
 
@@ -139,26 +166,21 @@ int path_handle_free(
 	return( result );
 }
 
-/* Retrieves the name of a directory entry by name ignoring case
- * If a corresponding entry is found entry name is update
- * This function is needed to find case insensitive directory entries on a case sensitive system
- * Return 1 if successful, 0 if no corresponding entry was found or -1 on error
+/* Retrieves the listing of a specific directory
+ * The directory is read when it is not yet listed and its listing is kept for the lifetime of the path handle
+ * Returns 1 if successful or -1 on error
  */
-int path_handle_get_directory_entry_name_by_name_no_case(
+int path_handle_get_directory_listing(
      path_handle_t *path_handle,
      const system_character_t *path,
      size_t path_length,
-     system_character_t *entry_name,
-     size_t entry_name_size,
-     uint8_t entry_type,
+     directory_listing_t **directory_listing,
      libcerror_error_t **error )
 {
-	libcdirectory_directory_t *directory             = NULL;
-	libcdirectory_directory_entry_t *directory_entry = NULL;
-	system_character_t *directory_entry_name         = NULL;
-	static char *function                            = "path_handle_get_directory_entry_name_by_name_no_case";
-	size_t directory_entry_name_length               = 0;
-	int result                                       = 0;
+	directory_listing_t *safe_directory_listing = NULL;
+	static char *function                       = "path_handle_get_directory_listing";
+	uint32_t bucket_index                       = 0;
+	uint32_t path_hash                          = 0;
 
 	if( path_handle == NULL )
 	{
@@ -171,158 +193,211 @@ int path_handle_get_directory_entry_name_by_name_no_case(
 
 		return( -1 );
 	}
-	if( path_length > (size_t) SSIZE_MAX )
+	if( path == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid path length value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
 		 function );
 
 		return( -1 );
 	}
-	if( entry_name == NULL )
+	if( directory_listing == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid entry name.",
+		 "%s: invalid directory listing.",
 		 function );
 
 		return( -1 );
 	}
-	if( entry_name_size > (size_t) SSIZE_MAX )
+	/* Some callers pass the path size including the end-of-string character
+	 */
+	while( ( path_length > 0 )
+	    && ( path[ path_length - 1 ] == 0 ) )
+	{
+		path_length--;
+	}
+	path_hash = directory_listing_calculate_hash(
+	             path,
+	             path_length,
+	             0 );
+
+	bucket_index = path_hash % PATH_HANDLE_NUMBER_OF_DIRECTORY_LISTING_BUCKETS;
+
+	safe_directory_listing = path_handle->directory_listings[ bucket_index ];
+
+	while( safe_directory_listing != NULL )
+	{
+		if( ( safe_directory_listing->path_hash == path_hash )
+		 && ( safe_directory_listing->path_size == ( path_length + 1 ) ) )
+		{
+			if( system_string_compare(
+			     safe_directory_listing->path,
+			     path,
+			     path_length ) == 0 )
+			{
+				*directory_listing = safe_directory_listing;
+
+				return( 1 );
+			}
+		}
+		safe_directory_listing = safe_directory_listing->next_directory_listing;
+	}
+	if( directory_listing_initialize(
+	     &safe_directory_listing,
+	     path,
+	     path_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create directory listing.",
+		 function );
+
+		goto on_error;
+	}
+	if( directory_listing_read(
+	     safe_directory_listing,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read directory listing.",
+		 function );
+
+		goto on_error;
+	}
+	safe_directory_listing->next_directory_listing = path_handle->directory_listings[ bucket_index ];
+
+	path_handle->directory_listings[ bucket_index ] = safe_directory_listing;
+
+	*directory_listing = safe_directory_listing;
+
+	return( 1 );
+
+on_error:
+	if( safe_directory_listing != NULL )
+	{
+		directory_listing_free(
+		 &safe_directory_listing,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the name of a directory entry by name ignoring case
+ * If a corresponding entry is found entry name is update
+ * This function is needed to find case insensitive directory entries on a case sensitive system
+ * The directory is looked up in a cached listing so that it is read only once
+ * Return 1 if successful, 0 if no corresponding entry was found or -1 on error
+ */
+int path_handle_get_directory_entry_name_by_name_no_case(
+     path_handle_t *path_handle,
+     const system_character_t *path,
+     size_t path_length,
+     system_character_t *entry_name,
+     size_t entry_name_size,
+     uint8_t entry_type,
+     libcerror_error_t **error )
+{
+	directory_listing_t *directory_listing             = NULL;
+	directory_listing_entry_t *directory_listing_entry = NULL;
+	static char *function                              = "path_handle_get_directory_entry_name_by_name_no_case";
+	int result                                         = 0;
+
+	if( path_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid entry name size value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( entry_name == NULL )
+	if( path_length > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid entry name.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path length value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdirectory_directory_initialize(
-	     &directory,
-	     error ) != 1 )
+	if( entry_name == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create directory.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry name.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libcdirectory_directory_open_wide(
-		  directory,
-		  path,
-		  error );
-#else
-	result = libcdirectory_directory_open(
-		  directory,
-		  path,
-		  error );
-#endif
-	if( result != 1 )
+	if( ( entry_name_size == 0 )
+	 || ( entry_name_size > (size_t) SSIZE_MAX ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open directory: %" PRIs_SYSTEM ".",
-		 function,
-		 path );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry name size value out of bounds.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libcdirectory_directory_entry_initialize(
-	     &directory_entry,
+	if( path_handle_get_directory_listing(
+	     path_handle,
+	     path,
+	     path_length,
+	     &directory_listing,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create directory entry.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory listing.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libcdirectory_directory_has_entry_wide(
-		  directory,
-		  directory_entry,
-		  entry_name,
-		  entry_name_size - 1,
-		  entry_type,
-		  LIBCDIRECTORY_COMPARE_FLAG_NO_CASE,
-		  error );
-#else
-	result = libcdirectory_directory_has_entry(
-		  directory,
-		  directory_entry,
-		  entry_name,
-		  entry_name_size - 1,
-		  entry_type,
-		  LIBCDIRECTORY_COMPARE_FLAG_NO_CASE,
-		  error );
-#endif
+	result = directory_listing_get_entry_by_name_no_case(
+	          directory_listing,
+	          entry_name,
+	          entry_name_size - 1,
+	          entry_type,
+	          &directory_listing_entry,
+	          error );
+
 	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_GENERIC,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
 		 "%s: unable to determine if directory has entry: %" PRIs_SYSTEM ".",
 		 function,
 		 entry_name );
 
-		goto on_error;
+		return( -1 );
 	}
 	else if( result != 0 )
 	{
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libcdirectory_directory_entry_get_name_wide(
-			  directory_entry,
-			  (wchar_t **) &directory_entry_name,
-			  error );
-#else
-		result = libcdirectory_directory_entry_get_name(
-			  directory_entry,
-			  (char **) &directory_entry_name,
-			  error );
-#endif
-		if( result != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve directory entry name.",
-			 function );
-
-			goto on_error;
-		}
-		directory_entry_name_length = system_string_length(
-					       directory_entry_name );
-
-		if( ( directory_entry_name_length + 1 ) != entry_name_size )
+		if( directory_listing_entry->name_size != entry_name_size )
 		{
 			libcerror_error_set(
 			 error,
@@ -331,12 +406,12 @@ int path_handle_get_directory_entry_name_by_name_no_case(
 			 "%s: entry name length value out of bounds.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 		if( system_string_copy(
 		     entry_name,
-		     directory_entry_name,
-		     directory_entry_name_length ) == NULL )
+		     directory_listing_entry->name,
+		     entry_name_size - 1 ) == NULL )
 		{
 			libcerror_error_set(
 			 error,
@@ -345,63 +420,9 @@ int path_handle_get_directory_entry_name_by_name_no_case(
 			 "%s: unable to set entry name.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 	}
-	if( libcdirectory_directory_entry_free(
-	     &directory_entry,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free directory entry.",
-		 function );
-
-		goto on_error;
-	}
-	if( libcdirectory_directory_close(
-	     directory,
-	     error ) != 0 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-		 "%s: unable to close directory.",
-		 function );
-
-		goto on_error;
-	}
-	if( libcdirectory_directory_free(
-	     &directory,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free directory.",
-		 function );
-
-		goto on_error;
-	}
 	return( result );
-
-on_error:
-	if( directory_entry != NULL )
-	{
-		libcdirectory_directory_entry_free(
-		 &directory_entry,
-		 NULL );
-	}
-	if( directory != NULL )
-	{
-		libcdirectory_directory_free(
-		 &directory,
-		 NULL );
-	}
-	return( -1 );
 }
 
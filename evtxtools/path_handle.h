@@ -25,12 +25,15 @@
 #include <common.h>
 #include <types.h>
 
+#include "directory_listing.h"
 #include "evtxtools_libcerror.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+#define PATH_HANDLE_NUMBER_OF_DIRECTORY_LISTING_BUCKETS		64
+
 typedef struct path_handle path_handle_t;
 
 struct path_handle
@@ -42,6 +45,11 @@ struct path_handle
 	/* The %SystemRoot% path size
 	 */
 	size_t system_root_path_size;
+
+	/* The directory listings hash table buckets
+	 * each bucket contains a list of directory listings chained by next directory listing
+	 */
+	directory_listing_t *directory_listings[ PATH_HANDLE_NUMBER_OF_DIRECTORY_LISTING_BUCKETS ];
 };
 
 int path_handle_initialize(
@@ -52,6 +60,13 @@ int path_handle_free(
      path_handle_t **path_handle,
      libcerror_error_t **error );
 
+int path_handle_get_directory_listing(
+     path_handle_t *path_handle,
+     const system_character_t *path,
+     size_t path_length,
+     directory_listing_t **directory_listing,
+     libcerror_error_t **error );
+
 int path_handle_get_directory_entry_name_by_name_no_case(
      path_handle_t *path_handle,
      const system_character_t *path,
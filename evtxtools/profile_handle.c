@@ -0,0 +1,343 @@
+/*
+ * Profile handle
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+#include "evtxtools_profile.h"
+#include "profile_handle.h"
+
+/* Creates a profile handle
+ * Make sure the value profile_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int profile_handle_initialize(
+     profile_handle_t **profile_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "profile_handle_initialize";
+
+	if( profile_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid profile handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *profile_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid profile handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*profile_handle = memory_allocate_structure(
+	                   profile_handle_t );
+
+	if( *profile_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create profile handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *profile_handle,
+	     0,
+	     sizeof( profile_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear profile handle.",
+		 function );
+
+		goto on_error;
+	}
+	( *profile_handle )->start_time = evtxtools_profile_get_time();
+
+	return( 1 );
+
+on_error:
+	if( *profile_handle != NULL )
+	{
+		memory_free(
+		 *profile_handle );
+
+		*profile_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a profile handle
+ * Returns 1 if successful or -1 on error
+ */
+int profile_handle_free(
+     profile_handle_t **profile_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "profile_handle_free";
+
+	if( profile_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid profile handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *profile_handle != NULL )
+	{
+		memory_free(
+		 *profile_handle );
+
+		*profile_handle = NULL;
+	}
+	return( 1 );
+}
+
+/* Starts a phase
+ * Returns the start time of the phase or 0 if the profile handle is not set
+ */
+uint64_t profile_handle_start_phase(
+          profile_handle_t *profile_handle )
+{
+	if( profile_handle == NULL )
+	{
+		return( 0 );
+	}
+	return( evtxtools_profile_get_time() );
+}
+
+/* Ends a phase
+ * The time since the start time is added to the phase
+ * Nothing is done if the profile handle is not set
+ */
+void profile_handle_end_phase(
+      profile_handle_t *profile_handle,
+      int phase,
+      uint64_t start_time )
+{
+	uint64_t end_time = 0;
+
+	if( ( profile_handle == NULL )
+	 || ( phase < 0 )
+	 || ( phase >= PROFILE_HANDLE_NUMBER_OF_PHASES ) )
+	{
+		return;
+	}
+	end_time = evtxtools_profile_get_time();
+
+	if( end_time > start_time )
+	{
+		evtxtools_profile_counter_add(
+		 profile_handle->phase_times[ phase ],
+		 end_time - start_time );
+	}
+	evtxtools_profile_counter_add(
+	 profile_handle->phase_counts[ phase ],
+	 1 );
+}
+
+/* Prints the time and count of a phase
+ */
+void profile_handle_phase_fprint(
+      const char *description,
+      uint64_t phase_time,
+      uint64_t phase_count,
+      uint64_t total_time,
+      FILE *stream )
+{
+	uint64_t percentage = 0;
+
+	if( total_time > 0 )
+	{
+		percentage = ( phase_time * 100 ) / total_time;
+	}
+	fprintf(
+	 stream,
+	 "%s: %" PRIu64 ".%03" PRIu64 " s (%" PRIu64 "%%) in %" PRIu64 " calls\n",
+	 description,
+	 phase_time / 1000000000,
+	 ( phase_time / 1000000 ) % 1000,
+	 percentage,
+	 phase_count );
+}
+
+/* Prints the phase breakdown of a profile handle
+ * Returns 1 if successful or -1 on error
+ */
+int profile_handle_fprint(
+     profile_handle_t *profile_handle,
+     int number_of_threads,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	static char *function = "profile_handle_fprint";
+	uint64_t record_time  = 0;
+	uint64_t total_time   = 0;
+
+	if( profile_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid profile handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	total_time = evtxtools_profile_get_time();
+
+	if( total_time > profile_handle->start_time )
+	{
+		total_time -= profile_handle->start_time;
+	}
+	else
+	{
+		total_time = 0;
+	}
+	/* The event message is resolved while the record is exported
+	 */
+	record_time = profile_handle->phase_times[ PROFILE_HANDLE_PHASE_RECORD_EXPORT ];
+
+	if( record_time > profile_handle->phase_times[ PROFILE_HANDLE_PHASE_EVENT_MESSAGE ] )
+	{
+		record_time -= profile_handle->phase_times[ PROFILE_HANDLE_PHASE_EVENT_MESSAGE ];
+	}
+	else
+	{
+		record_time = 0;
+	}
+	fprintf(
+	 stream,
+	 "Profile:\n" );
+
+	fprintf(
+	 stream,
+	 "\tTotal: %" PRIu64 ".%03" PRIu64 " s\n",
+	 total_time / 1000000000,
+	 ( total_time / 1000000 ) % 1000 );
+
+	profile_handle_phase_fprint(
+	 "\tRecord retrieval (libevtx)",
+	 profile_handle->phase_times[ PROFILE_HANDLE_PHASE_RECORD_RETRIEVAL ],
+	 profile_handle->phase_counts[ PROFILE_HANDLE_PHASE_RECORD_RETRIEVAL ],
+	 total_time,
+	 stream );
+
+	profile_handle_phase_fprint(
+	 "\tRecord values (libevtx getters and formatting)",
+	 record_time,
+	 profile_handle->phase_counts[ PROFILE_HANDLE_PHASE_RECORD_EXPORT ],
+	 total_time,
+	 stream );
+
+	profile_handle_phase_fprint(
+	 "\tEvent message resolution",
+	 profile_handle->phase_times[ PROFILE_HANDLE_PHASE_EVENT_MESSAGE ],
+	 profile_handle->phase_counts[ PROFILE_HANDLE_PHASE_EVENT_MESSAGE ],
+	 total_time,
+	 stream );
+
+	profile_handle_phase_fprint(
+	 "\t\tRegistry",
+	 profile_handle->phase_times[ PROFILE_HANDLE_PHASE_REGISTRY ],
+	 profile_handle->phase_counts[ PROFILE_HANDLE_PHASE_REGISTRY ],
+	 total_time,
+	 stream );
+
+	profile_handle_phase_fprint(
+	 "\t\tPath resolution",
+	 profile_handle->phase_times[ PROFILE_HANDLE_PHASE_PATH_RESOLUTION ],
+	 profile_handle->phase_counts[ PROFILE_HANDLE_PHASE_PATH_RESOLUTION ],
+	 total_time,
+	 stream );
+
+	profile_handle_phase_fprint(
+	 "\t\tResource file open",
+	 profile_handle->phase_times[ PROFILE_HANDLE_PHASE_RESOURCE_FILE_OPEN ],
+	 profile_handle->phase_counts[ PROFILE_HANDLE_PHASE_RESOURCE_FILE_OPEN ],
+	 total_time,
+	 stream );
+
+	profile_handle_phase_fprint(
+	 "\t\tMessage lookup",
+	 profile_handle->phase_times[ PROFILE_HANDLE_PHASE_MESSAGE_LOOKUP ],
+	 profile_handle->phase_counts[ PROFILE_HANDLE_PHASE_MESSAGE_LOOKUP ],
+	 total_time,
+	 stream );
+
+	profile_handle_phase_fprint(
+	 "\t\tTemplate definition",
+	 profile_handle->phase_times[ PROFILE_HANDLE_PHASE_TEMPLATE_DEFINITION ],
+	 profile_handle->phase_counts[ PROFILE_HANDLE_PHASE_TEMPLATE_DEFINITION ],
+	 total_time,
+	 stream );
+
+	profile_handle_phase_fprint(
+	 "\tOutput writing",
+	 profile_handle->phase_times[ PROFILE_HANDLE_PHASE_OUTPUT ],
+	 profile_handle->phase_counts[ PROFILE_HANDLE_PHASE_OUTPUT ],
+	 total_time,
+	 stream );
+
+	if( number_of_threads > 1 )
+	{
+		fprintf(
+		 stream,
+		 "\tThe record values and event message times are summed over %d threads.\n",
+		 number_of_threads );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,103 @@
+/*
+ * Profile handle
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _PROFILE_HANDLE_H )
+#define _PROFILE_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+enum PROFILE_HANDLE_PHASES
+{
+	PROFILE_HANDLE_PHASE_RECORD_RETRIEVAL		= 0,
+	PROFILE_HANDLE_PHASE_RECORD_EXPORT		= 1,
+	PROFILE_HANDLE_PHASE_EVENT_MESSAGE		= 2,
+	PROFILE_HANDLE_PHASE_REGISTRY			= 3,
+	PROFILE_HANDLE_PHASE_PATH_RESOLUTION		= 4,
+	PROFILE_HANDLE_PHASE_RESOURCE_FILE_OPEN		= 5,
+	PROFILE_HANDLE_PHASE_MESSAGE_LOOKUP		= 6,
+	PROFILE_HANDLE_PHASE_TEMPLATE_DEFINITION	= 7,
+	PROFILE_HANDLE_PHASE_OUTPUT			= 8
+};
+
+/* The number of phases
+ */
+#define PROFILE_HANDLE_NUMBER_OF_PHASES			9
+
+typedef struct profile_handle profile_handle_t;
+
+struct profile_handle
+{
+	/* The time the profile handle was created
+	 */
+	uint64_t start_time;
+
+	/* The time spent per phase in nanoseconds
+	 */
+	uint64_t phase_times[ PROFILE_HANDLE_NUMBER_OF_PHASES ];
+
+	/* The number of times a phase was entered
+	 */
+	uint64_t phase_counts[ PROFILE_HANDLE_NUMBER_OF_PHASES ];
+};
+
+int profile_handle_initialize(
+     profile_handle_t **profile_handle,
+     libcerror_error_t **error );
+
+int profile_handle_free(
+     profile_handle_t **profile_handle,
+     libcerror_error_t **error );
+
+uint64_t profile_handle_start_phase(
+          profile_handle_t *profile_handle );
+
+void profile_handle_end_phase(
+      profile_handle_t *profile_handle,
+      int phase,
+      uint64_t start_time );
+
+void profile_handle_phase_fprint(
+      const char *description,
+      uint64_t phase_time,
+      uint64_t phase_count,
+      uint64_t total_time,
+      FILE *stream );
+
+int profile_handle_fprint(
+     profile_handle_t *profile_handle,
+     int number_of_threads,
+     FILE *stream,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _PROFILE_HANDLE_H ) */
+
@@ -0,0 +1,1095 @@
+/*
+ * Registry key table
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#include "evtxtools_libcerror.h"
+#include "evtxtools_libregf.h"
+#include "registry_key_table.h"
+
+/* Calculates the hash of a key name
+ * Registry key names are case insensitive hence ASCII upper case characters are hashed as their lower case equivalent
+ * Returns the FNV-1a hash of the key name
+ */
+uint32_t registry_key_table_calculate_hash(
+          const system_character_t *string,
+          size_t string_length )
+{
+	size_t string_index          = 0;
+	uint32_t hash                = 0x811c9dc5UL;
+	system_character_t character = 0;
+
+	if( string == NULL )
+	{
+		return( hash );
+	}
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		character = string[ string_index ];
+
+		if( ( character >= (system_character_t) 'A' )
+		 && ( character <= (system_character_t) 'Z' ) )
+		{
+			character = character - (system_character_t) 'A' + (system_character_t) 'a';
+		}
+		hash ^= (uint32_t) character;
+		hash *= 0x01000193UL;
+	}
+	return( hash );
+}
+
+/* Frees a registry key table entry
+ * Returns 1 if successful or -1 on error
+ */
+int registry_key_table_entry_free(
+     registry_key_table_entry_t **entry,
+     libcerror_error_t **error )
+{
+	static char *function = "registry_key_table_entry_free";
+	int value_index       = 0;
+
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *entry != NULL )
+	{
+		for( value_index = 0;
+		     value_index < REGISTRY_KEY_TABLE_MAXIMUM_NUMBER_OF_VALUES;
+		     value_index++ )
+		{
+			if( ( *entry )->value_strings[ value_index ] != NULL )
+			{
+				memory_free(
+				 ( *entry )->value_strings[ value_index ] );
+			}
+		}
+		if( ( *entry )->name != NULL )
+		{
+			memory_free(
+			 ( *entry )->name );
+		}
+		memory_free(
+		 *entry );
+
+		*entry = NULL;
+	}
+	return( 1 );
+}
+
+/* Creates a registry key table
+ * The value names are not copied and must remain valid for the lifetime of the table
+ * Make sure the value registry_key_table is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int registry_key_table_initialize(
+     registry_key_table_t **registry_key_table,
+     const system_character_t **value_names,
+     int number_of_value_names,
+     libcerror_error_t **error )
+{
+	static char *function = "registry_key_table_initialize";
+	int value_index       = 0;
+
+	if( registry_key_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid registry key table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *registry_key_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid registry key table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_names == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value names.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_value_names <= 0 )
+	 || ( number_of_value_names > REGISTRY_KEY_TABLE_MAXIMUM_NUMBER_OF_VALUES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of value names value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*registry_key_table = memory_allocate_structure(
+	                       registry_key_table_t );
+
+	if( *registry_key_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create registry key table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *registry_key_table,
+	     0,
+	     sizeof( registry_key_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear registry key table.",
+		 function );
+
+		memory_free(
+		 *registry_key_table );
+
+		*registry_key_table = NULL;
+
+		return( -1 );
+	}
+	for( value_index = 0;
+	     value_index < number_of_value_names;
+	     value_index++ )
+	{
+		( *registry_key_table )->value_names[ value_index ] = value_names[ value_index ];
+	}
+	( *registry_key_table )->number_of_value_names = number_of_value_names;
+
+	( *registry_key_table )->buckets = (registry_key_table_entry_t **) memory_allocate(
+	                                    sizeof( registry_key_table_entry_t * ) * REGISTRY_KEY_TABLE_INITIAL_NUMBER_OF_BUCKETS );
+
+	if( ( *registry_key_table )->buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buckets.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *registry_key_table )->buckets,
+	     0,
+	     sizeof( registry_key_table_entry_t * ) * REGISTRY_KEY_TABLE_INITIAL_NUMBER_OF_BUCKETS ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buckets.",
+		 function );
+
+		goto on_error;
+	}
+	( *registry_key_table )->number_of_buckets = REGISTRY_KEY_TABLE_INITIAL_NUMBER_OF_BUCKETS;
+
+	return( 1 );
+
+on_error:
+	if( *registry_key_table != NULL )
+	{
+		registry_key_table_free(
+		 registry_key_table,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a registry key table
+ * Returns 1 if successful or -1 on error
+ */
+int registry_key_table_free(
+     registry_key_table_t **registry_key_table,
+     libcerror_error_t **error )
+{
+	registry_key_table_entry_t *entry = NULL;
+	static char *function             = "registry_key_table_free";
+	uint32_t bucket_index             = 0;
+	int result                        = 1;
+
+	if( registry_key_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid registry key table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *registry_key_table != NULL )
+	{
+		if( ( *registry_key_table )->buckets != NULL )
+		{
+			for( bucket_index = 0;
+			     bucket_index < ( *registry_key_table )->number_of_buckets;
+			     bucket_index++ )
+			{
+				while( ( *registry_key_table )->buckets[ bucket_index ] != NULL )
+				{
+					entry = ( *registry_key_table )->buckets[ bucket_index ];
+
+					( *registry_key_table )->buckets[ bucket_index ] = entry->next_bucket_entry;
+
+					if( registry_key_table_entry_free(
+					     &entry,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+						 "%s: unable to free entry.",
+						 function );
+
+						result = -1;
+					}
+				}
+			}
+			memory_free(
+			 ( *registry_key_table )->buckets );
+		}
+		memory_free(
+		 *registry_key_table );
+
+		*registry_key_table = NULL;
+	}
+	return( result );
+}
+
+/* Retrieves a specific entry by key name
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int registry_key_table_get_entry_by_name(
+     registry_key_table_t *registry_key_table,
+     const system_character_t *name,
+     size_t name_length,
+     registry_key_table_entry_t **entry,
+     libcerror_error_t **error )
+{
+	registry_key_table_entry_t *bucket_entry = NULL;
+	static char *function                    = "registry_key_table_get_entry_by_name";
+	uint32_t name_hash                       = 0;
+
+	if( registry_key_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid registry key table.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	*entry = NULL;
+
+	name_hash = registry_key_table_calculate_hash(
+	             name,
+	             name_length );
+
+	bucket_entry = registry_key_table->buckets[ name_hash & ( registry_key_table->number_of_buckets - 1 ) ];
+
+	while( bucket_entry != NULL )
+	{
+		if( ( bucket_entry->name_hash == name_hash )
+		 && ( bucket_entry->name_size == ( name_length + 1 ) ) )
+		{
+			if( system_string_compare_no_case(
+			     bucket_entry->name,
+			     name,
+			     name_length ) == 0 )
+			{
+				*entry = bucket_entry;
+
+				return( 1 );
+			}
+		}
+		bucket_entry = bucket_entry->next_bucket_entry;
+	}
+	return( 0 );
+}
+
+/* Inserts an entry into the registry key table
+ * The table takes over ownership of the entry
+ * Returns 1 if successful or -1 on error
+ */
+int registry_key_table_insert_entry(
+     registry_key_table_t *registry_key_table,
+     registry_key_table_entry_t *entry,
+     libcerror_error_t **error )
+{
+	registry_key_table_entry_t **buckets    = NULL;
+	registry_key_table_entry_t *next_entry  = NULL;
+	registry_key_table_entry_t *moved_entry = NULL;
+	static char *function                   = "registry_key_table_insert_entry";
+	uint32_t bucket_index                   = 0;
+	uint32_t number_of_buckets              = 0;
+	uint32_t old_bucket_index               = 0;
+
+	if( registry_key_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid registry key table.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	/* Keep the average number of entries per bucket below 2
+	 */
+	if( (uint32_t) registry_key_table->number_of_entries >= ( 2 * registry_key_table->number_of_buckets ) )
+	{
+		number_of_buckets = 2 * registry_key_table->number_of_buckets;
+
+		buckets = (registry_key_table_entry_t **) memory_allocate(
+		                                           sizeof( registry_key_table_entry_t * ) * number_of_buckets );
+
+		if( buckets == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create buckets.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_set(
+		     buckets,
+		     0,
+		     sizeof( registry_key_table_entry_t * ) * number_of_buckets ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear buckets.",
+			 function );
+
+			memory_free(
+			 buckets );
+
+			return( -1 );
+		}
+		for( old_bucket_index = 0;
+		     old_bucket_index < registry_key_table->number_of_buckets;
+		     old_bucket_index++ )
+		{
+			moved_entry = registry_key_table->buckets[ old_bucket_index ];
+
+			while( moved_entry != NULL )
+			{
+				next_entry   = moved_entry->next_bucket_entry;
+				bucket_index = moved_entry->name_hash & ( number_of_buckets - 1 );
+
+				moved_entry->next_bucket_entry = buckets[ bucket_index ];
+				buckets[ bucket_index ]        = moved_entry;
+
+				moved_entry = next_entry;
+			}
+		}
+		memory_free(
+		 registry_key_table->buckets );
+
+		registry_key_table->buckets           = buckets;
+		registry_key_table->number_of_buckets = number_of_buckets;
+	}
+	bucket_index = entry->name_hash & ( registry_key_table->number_of_buckets - 1 );
+
+	entry->next_bucket_entry                    = registry_key_table->buckets[ bucket_index ];
+	registry_key_table->buckets[ bucket_index ] = entry;
+
+	registry_key_table->number_of_entries += 1;
+
+	return( 1 );
+}
+
+/* Reads a string value of a specific key
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int registry_key_table_read_value_string(
+     libregf_key_t *key,
+     const system_character_t *value_name,
+     size_t value_name_length,
+     system_character_t **value_string,
+     size_t *value_string_size,
+     libcerror_error_t **error )
+{
+	libregf_value_t *value = NULL;
+	static char *function  = "registry_key_table_read_value_string";
+	int result             = 0;
+
+	if( value_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value string.",
+		 function );
+
+		return( -1 );
+	}
+	if( *value_string != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid value string value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value string size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libregf_key_get_value_by_utf16_name(
+		  key,
+		  (uint16_t *) value_name,
+		  value_name_length,
+		  &value,
+		  error );
+#else
+	result = libregf_key_get_value_by_utf8_name(
+		  key,
+		  (uint8_t *) value_name,
+		  value_name_length,
+		  &value,
+		  error );
+#endif
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: %" PRIs_SYSTEM ".",
+		 function,
+		 value_name );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libregf_value_get_value_utf16_string_size(
+		  value,
+		  value_string_size,
+		  error );
+#else
+	result = libregf_value_get_value_utf8_string_size(
+		  value,
+		  value_string_size,
+		  error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value string size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( *value_string_size == 0 )
+	 || ( *value_string_size > (size_t) ( SSIZE_MAX / sizeof( system_character_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value string size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	*value_string = system_string_allocate(
+	                 *value_string_size );
+
+	if( *value_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create value string.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libregf_value_get_value_utf16_string(
+		  value,
+		  (uint16_t *) *value_string,
+		  *value_string_size,
+		  error );
+#else
+	result = libregf_value_get_value_utf8_string(
+		  value,
+		  (uint8_t *) *value_string,
+		  *value_string_size,
+		  error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value string.",
+		 function );
+
+		goto on_error;
+	}
+	if( libregf_value_free(
+	     &value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free value.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( value != NULL )
+	{
+		libregf_value_free(
+		 &value,
+		 NULL );
+	}
+	if( *value_string != NULL )
+	{
+		memory_free(
+		 *value_string );
+
+		*value_string = NULL;
+	}
+	*value_string_size = 0;
+
+	return( -1 );
+}
+
+/* Reads the sub keys of a specific key into the registry key table
+ * Sub keys that are already in the table are skipped, hence the key that is read first takes precedence
+ * Returns 1 if successful or -1 on error
+ */
+int registry_key_table_read_key(
+     registry_key_table_t *registry_key_table,
+     libregf_key_t *key,
+     libcerror_error_t **error )
+{
+	libregf_key_t *sub_key                     = NULL;
+	registry_key_table_entry_t *entry          = NULL;
+	registry_key_table_entry_t *existing_entry = NULL;
+	static char *function                      = "registry_key_table_read_key";
+	size_t name_size                           = 0;
+	int number_of_sub_keys                     = 0;
+	int result                                 = 0;
+	int sub_key_index                          = 0;
+	int value_index                            = 0;
+
+	if( registry_key_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid registry key table.",
+		 function );
+
+		return( -1 );
+	}
+	if( libregf_key_get_number_of_sub_keys(
+	     key,
+	     &number_of_sub_keys,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sub keys.",
+		 function );
+
+		goto on_error;
+	}
+	for( sub_key_index = 0;
+	     sub_key_index < number_of_sub_keys;
+	     sub_key_index++ )
+	{
+		if( libregf_key_get_sub_key(
+		     key,
+		     sub_key_index,
+		     &sub_key,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub key: %d.",
+			 function,
+			 sub_key_index );
+
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libregf_key_get_utf16_name_size(
+		          sub_key,
+		          &name_size,
+		          error );
+#else
+		result = libregf_key_get_utf8_name_size(
+		          sub_key,
+		          &name_size,
+		          error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub key: %d name size.",
+			 function,
+			 sub_key_index );
+
+			goto on_error;
+		}
+		if( ( name_size == 0 )
+		 || ( name_size > (size_t) ( SSIZE_MAX / sizeof( system_character_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid sub key: %d name size value out of bounds.",
+			 function,
+			 sub_key_index );
+
+			goto on_error;
+		}
+		entry = memory_allocate_structure(
+		         registry_key_table_entry_t );
+
+		if( entry == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create entry.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     entry,
+		     0,
+		     sizeof( registry_key_table_entry_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear entry.",
+			 function );
+
+			memory_free(
+			 entry );
+
+			entry = NULL;
+
+			goto on_error;
+		}
+		entry->name = system_string_allocate(
+		               name_size );
+
+		if( entry->name == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create entry name.",
+			 function );
+
+			goto on_error;
+		}
+		entry->name_size = name_size;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libregf_key_get_utf16_name(
+		          sub_key,
+		          (uint16_t *) entry->name,
+		          entry->name_size,
+		          error );
+#else
+		result = libregf_key_get_utf8_name(
+		          sub_key,
+		          (uint8_t *) entry->name,
+		          entry->name_size,
+		          error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub key: %d name.",
+			 function,
+			 sub_key_index );
+
+			goto on_error;
+		}
+		result = registry_key_table_get_entry_by_name(
+		          registry_key_table,
+		          entry->name,
+		          entry->name_size - 1,
+		          &existing_entry,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry: %" PRIs_SYSTEM ".",
+			 function,
+			 entry->name );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			entry->name_hash = registry_key_table_calculate_hash(
+			                    entry->name,
+			                    entry->name_size - 1 );
+
+			for( value_index = 0;
+			     value_index < registry_key_table->number_of_value_names;
+			     value_index++ )
+			{
+				result = registry_key_table_read_value_string(
+				          sub_key,
+				          registry_key_table->value_names[ value_index ],
+				          system_string_length(
+				           registry_key_table->value_names[ value_index ] ),
+				          &( entry->value_strings[ value_index ] ),
+				          &( entry->value_string_sizes[ value_index ] ),
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to read value: %" PRIs_SYSTEM " of key: %" PRIs_SYSTEM ".",
+					 function,
+					 registry_key_table->value_names[ value_index ],
+					 entry->name );
+
+					goto on_error;
+				}
+			}
+			if( registry_key_table_insert_entry(
+			     registry_key_table,
+			     entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to insert entry: %" PRIs_SYSTEM ".",
+				 function,
+				 entry->name );
+
+				goto on_error;
+			}
+			entry = NULL;
+		}
+		else if( registry_key_table_entry_free(
+		          &entry,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free entry.",
+			 function );
+
+			goto on_error;
+		}
+		if( libregf_key_free(
+		     &sub_key,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sub key: %d.",
+			 function,
+			 sub_key_index );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( entry != NULL )
+	{
+		registry_key_table_entry_free(
+		 &entry,
+		 NULL );
+	}
+	if( sub_key != NULL )
+	{
+		libregf_key_free(
+		 &sub_key,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves a specific value string of a specific key
+ * The value string is owned by the table and must not be freed
+ * Returns 1 if successful, 0 if no such key or value or -1 on error
+ */
+int registry_key_table_get_value_string(
+     registry_key_table_t *registry_key_table,
+     const system_character_t *name,
+     size_t name_length,
+     const system_character_t *value_name,
+     size_t value_name_length,
+     const system_character_t **value_string,
+     size_t *value_string_size,
+     libcerror_error_t **error )
+{
+	registry_key_table_entry_t *entry = NULL;
+	static char *function             = "registry_key_table_get_value_string";
+	int result                        = 0;
+	int value_index                   = 0;
+
+	if( registry_key_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid registry key table.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value name.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value string.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value string size.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_index = 0;
+	     value_index < registry_key_table->number_of_value_names;
+	     value_index++ )
+	{
+		if( ( system_string_length(
+		       registry_key_table->value_names[ value_index ] ) == value_name_length )
+		 && ( system_string_compare_no_case(
+		       registry_key_table->value_names[ value_index ],
+		       value_name,
+		       value_name_length ) == 0 ) )
+		{
+			break;
+		}
+	}
+	if( value_index >= registry_key_table->number_of_value_names )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value name: %" PRIs_SYSTEM ".",
+		 function,
+		 value_name );
+
+		return( -1 );
+	}
+	result = registry_key_table_get_entry_by_name(
+	          registry_key_table,
+	          name,
+	          name_length,
+	          &entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( entry->value_strings[ value_index ] == NULL )
+	{
+		return( 0 );
+	}
+	*value_string      = entry->value_strings[ value_index ];
+	*value_string_size = entry->value_string_sizes[ value_index ];
+
+	return( 1 );
+}
+
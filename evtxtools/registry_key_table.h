@@ -0,0 +1,150 @@
+/*
+ * Registry key table
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _REGISTRY_KEY_TABLE_H )
+#define _REGISTRY_KEY_TABLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+#include "evtxtools_libregf.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#define REGISTRY_KEY_TABLE_MAXIMUM_NUMBER_OF_VALUES		3
+#define REGISTRY_KEY_TABLE_INITIAL_NUMBER_OF_BUCKETS		256
+
+typedef struct registry_key_table_entry registry_key_table_entry_t;
+
+struct registry_key_table_entry
+{
+	/* The key name
+	 */
+	system_character_t *name;
+
+	/* The key name size
+	 */
+	size_t name_size;
+
+	/* The (case folded) hash of the key name
+	 */
+	uint32_t name_hash;
+
+	/* The value strings, NULL if the key has no such value
+	 */
+	system_character_t *value_strings[ REGISTRY_KEY_TABLE_MAXIMUM_NUMBER_OF_VALUES ];
+
+	/* The value string sizes
+	 */
+	size_t value_string_sizes[ REGISTRY_KEY_TABLE_MAXIMUM_NUMBER_OF_VALUES ];
+
+	/* The next entry in the same bucket
+	 */
+	registry_key_table_entry_t *next_bucket_entry;
+};
+
+typedef struct registry_key_table registry_key_table_t;
+
+struct registry_key_table
+{
+	/* The names of the values that are kept per key
+	 */
+	const system_character_t *value_names[ REGISTRY_KEY_TABLE_MAXIMUM_NUMBER_OF_VALUES ];
+
+	/* The number of value names
+	 */
+	int number_of_value_names;
+
+	/* The buckets
+	 */
+	registry_key_table_entry_t **buckets;
+
+	/* The number of buckets
+	 */
+	uint32_t number_of_buckets;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+};
+
+uint32_t registry_key_table_calculate_hash(
+          const system_character_t *string,
+          size_t string_length );
+
+int registry_key_table_entry_free(
+     registry_key_table_entry_t **entry,
+     libcerror_error_t **error );
+
+int registry_key_table_initialize(
+     registry_key_table_t **registry_key_table,
+     const system_character_t **value_names,
+     int number_of_value_names,
+     libcerror_error_t **error );
+
+int registry_key_table_free(
+     registry_key_table_t **registry_key_table,
+     libcerror_error_t **error );
+
+int registry_key_table_get_entry_by_name(
+     registry_key_table_t *registry_key_table,
+     const system_character_t *name,
+     size_t name_length,
+     registry_key_table_entry_t **entry,
+     libcerror_error_t **error );
+
+int registry_key_table_insert_entry(
+     registry_key_table_t *registry_key_table,
+     registry_key_table_entry_t *entry,
+     libcerror_error_t **error );
+
+int registry_key_table_read_value_string(
+     libregf_key_t *key,
+     const system_character_t *value_name,
+     size_t value_name_length,
+     system_character_t **value_string,
+     size_t *value_string_size,
+     libcerror_error_t **error );
+
+int registry_key_table_read_key(
+     registry_key_table_t *registry_key_table,
+     libregf_key_t *key,
+     libcerror_error_t **error );
+
+int registry_key_table_get_value_string(
+     registry_key_table_t *registry_key_table,
+     const system_character_t *name,
+     size_t name_length,
+     const system_character_t *value_name,
+     size_t value_name_length,
+     const system_character_t **value_string,
+     size_t *value_string_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _REGISTRY_KEY_TABLE_H ) */
+
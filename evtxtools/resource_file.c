@@ -26,21 +26,12 @@
 #include <types.h>
 #include <wide_string.h>
 
-#if defined( TIME_WITH_SYS_TIME )
-#include <sys/time.h>
-#include <time.h>
-#elif defined( HAVE_SYS_TIME_H )
-#include <sys/time.h>
-#else
-#include <time.h>
-#endif
-
 #include "evtxtools_libbfio.h"
 #include "evtxtools_libcerror.h"
 #include "evtxtools_libexe.h"
-#include "evtxtools_libfcache.h"
 #include "evtxtools_libwrc.h"
 #include "message_string.h"
+#include "message_string_cache.h"
 #include "resource_file.h"
 
 /* Creates a resource file
@@ -135,9 +126,8 @@ int resource_file_initialize(
 
 		goto on_error;
 	}
-	if( libfcache_cache_initialize(
+	if( message_string_cache_initialize(
 	     &( ( *resource_file )->message_string_cache ),
-	     16,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -215,7 +205,7 @@ int resource_file_free(
 				result = -1;
 			}
 		}
-		if( libfcache_cache_free(
+		if( message_string_cache_free(
 		     &( ( *resource_file )->message_string_cache ),
 		     error ) != 1 )
 		{
@@ -443,7 +433,7 @@ int resource_file_close(
 	}
 	if( resource_file->is_open != 0 )
 	{
-		if( libfcache_cache_empty(
+		if( message_string_cache_empty(
 		     resource_file->message_string_cache,
 		     error ) != 1 )
 		{
@@ -773,19 +763,15 @@ on_error:
 	return( -1 );
 }
 
-/* Retrieves a message string from the cache
+/* Reads the message table resource if not already read
  * Returns 1 if successful, 0 if not available or -1 error
  */
-int resource_file_get_message_string_from_cache(
+int resource_file_read_message_table_resource(
      resource_file_t *resource_file,
-     uint32_t message_string_identifier,
-     message_string_t **message_string,
      libcerror_error_t **error )
 {
-	libfcache_cache_value_t *cache_value = NULL;
-	static char *function                = "resource_file_get_message_string_from_cache";
-	int cache_index                      = 0;
-	int result                           = 0;
+	static char *function = "resource_file_read_message_table_resource";
+	int result            = 0;
 
 	if( resource_file == NULL )
 	{
@@ -798,71 +784,55 @@ int resource_file_get_message_string_from_cache(
 
 		return( -1 );
 	}
-	if( message_string == NULL )
+	if( resource_file->message_table_resource == NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid message string.",
-		 function );
+		result = libwrc_stream_get_resource_by_type(
+		          resource_file->resource_stream,
+		          LIBWRC_RESOURCE_TYPE_MESSAGE_TABLE,
+		          &( resource_file->message_table_resource ),
+		          error );
 
-		return( -1 );
-	}
-	for( cache_index = 0;
-	     cache_index < 16;
-	     cache_index++ )
-	{
-		if( libfcache_cache_get_value_by_index(
-		     resource_file->message_string_cache,
-		     cache_index,
-		     &cache_value,
-		     error ) != 1 )
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve cache value: %d.",
-			 function,
-			 cache_index );
+			 "%s: unable to retrieve message table resource.",
+			 function );
 
 			return( -1 );
 		}
-		if( cache_value != NULL )
+		else if( result == 0 )
 		{
-			if( libfcache_cache_value_get_value(
-			     cache_value,
-			     (intptr_t **) message_string,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve message string from cache value: %d.",
-				 function,
-				 cache_index );
-
-				return( -1 );
-			}
+			return( 0 );
 		}
-		if( ( *message_string != NULL )
-		 && ( message_string_identifier == ( *message_string )->identifier ) )
+		if( resource_file_get_resource_available_languague_identifier(
+		     resource_file,
+		     resource_file->message_table_resource,
+		     &( resource_file->message_table_language_identifier ),
+		     error ) != 1 )
 		{
-			result = 1;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve an available language identifier.",
+			 function );
 
-			break;
+			libwrc_resource_free(
+			 &( resource_file->message_table_resource ),
+			 NULL );
+
+			return( -1 );
 		}
 	}
-	if( result == 0 )
-	{
-		*message_string = NULL;
-	}
-	return( result );
+	return( 1 );
 }
 
 /* Retrieves a specific message string
+ * The message string is cached per message and language identifier, including
+ * messages that are not available, so that the message table is read once per message
  * Returns 1 if successful, 0 if no such message string or -1 error
  */
 int resource_file_get_message_string(
@@ -871,10 +841,8 @@ int resource_file_get_message_string(
      message_string_t **message_string,
      libcerror_error_t **error )
 {
-	static char *function        = "resource_file_get_message_string";
-	uint32_t language_identifier = 0;
-	time_t timestamp             = 0;
-	int result                   = 0;
+	static char *function = "resource_file_get_message_string";
+	int result            = 0;
 
 	if( resource_file == NULL )
 	{
@@ -898,33 +866,29 @@ int resource_file_get_message_string(
 
 		return( -1 );
 	}
-	if( resource_file->message_table_resource == NULL )
-	{
-		result = libwrc_stream_get_resource_by_type(
-		          resource_file->resource_stream,
-		          LIBWRC_RESOURCE_TYPE_MESSAGE_TABLE,
-		          &( resource_file->message_table_resource ),
-		          error );
+	result = resource_file_read_message_table_resource(
+	          resource_file,
+	          error );
 
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve message table resource.",
-			 function );
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read message table resource.",
+		 function );
 
-			return( -1 );
-		}
-		else if( result == 0 )
-		{
-			return( 0 );
-		}
+		return( -1 );
 	}
-	result = resource_file_get_message_string_from_cache(
-	          resource_file,
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	result = message_string_cache_get_message_string(
+	          resource_file->message_string_cache,
 	          message_string_identifier,
+	          resource_file->message_table_language_identifier,
 	          message_string,
 	          error );
 
@@ -939,131 +903,213 @@ int resource_file_get_message_string(
 
 		return( -1 );
 	}
-	else if( result == 0 )
+	else if( result != 0 )
 	{
-		if( resource_file_get_resource_available_languague_identifier(
-		     resource_file,
-		     resource_file->message_table_resource,
-		     &language_identifier,
-		     error ) != 1 )
+		if( *message_string == NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve an available language identifier.",
-			 function );
-
-			return( -1 );
+			return( 0 );
 		}
-		*message_string = NULL;
+		return( 1 );
+	}
+	if( message_string_initialize(
+	     message_string,
+	     message_string_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create message string.",
+		 function );
 
-		if( message_string_initialize(
+		return( -1 );
+	}
+	result = message_string_get_from_message_table_resource(
+	          *message_string,
+	          resource_file->message_table_resource,
+	          resource_file->message_table_language_identifier,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve message string: 0x%08" PRIx32 ".",
+		 function,
+		 message_string_identifier );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		if( message_string_free(
 		     message_string,
-		     message_string_identifier,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create message string.",
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free message string.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
-		result = message_string_get_from_message_table_resource(
-		          *message_string,
-		          resource_file->message_table_resource,
-		          language_identifier,
-		          error );
+	}
+	/* The message string is cached when not available as well
+	 * to prevent the message table from being read again
+	 */
+	if( message_string_cache_insert_message_string(
+	     resource_file->message_string_cache,
+	     message_string_identifier,
+	     resource_file->message_table_language_identifier,
+	     *message_string,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert message string: 0x%08" PRIx32 " into cache.",
+		 function,
+		 message_string_identifier );
 
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve message string: 0x%08" PRIx32 ".",
-			 function,
-			 message_string_identifier );
+		goto on_error;
+	}
+	return( result );
 
-			message_string_free(
-			 message_string,
-			 NULL );
+on_error:
+	if( *message_string != NULL )
+	{
+		message_string_free(
+		 message_string,
+		 NULL );
+	}
+	return( -1 );
+}
 
-			return( -1 );
-		}
-		else if( result != 0 )
-		{
-			if( libfcache_date_time_get_timestamp(
-			     &timestamp,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve cache timestamp.",
-				 function );
+/* Retrieves the number of message strings in the message table resource
+ * Returns 1 if successful, 0 if not available or -1 error
+ */
+int resource_file_get_number_of_message_strings(
+     resource_file_t *resource_file,
+     int *number_of_message_strings,
+     libcerror_error_t **error )
+{
+	static char *function = "resource_file_get_number_of_message_strings";
+	int result            = 0;
 
-				message_string_free(
-				 message_string,
-				 NULL );
+	if( number_of_message_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of message strings.",
+		 function );
 
-				return( -1 );
-			}
-			if( libfcache_cache_set_value_by_index(
-			     resource_file->message_string_cache,
-			     resource_file->next_message_string_cache_index,
-			     0,
-			     resource_file->next_message_string_cache_index,
-			     timestamp,
-			     (intptr_t *) *message_string,
-			     (int (*)(intptr_t **, libcerror_error_t **)) &message_string_free,
-			     LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set message string in cache entry: %d.",
-				 function,
-				 resource_file->next_message_string_cache_index );
+		return( -1 );
+	}
+	result = resource_file_read_message_table_resource(
+	          resource_file,
+	          error );
 
-				message_string_free(
-				 message_string,
-				 NULL );
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read message table resource.",
+		 function );
 
-				return( -1 );
-			}
-			resource_file->next_message_string_cache_index++;
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libwrc_message_table_get_number_of_messages(
+	     resource_file->message_table_resource,
+	     resource_file->message_table_language_identifier,
+	     number_of_message_strings,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of messages.",
+		 function );
 
-			if( resource_file->next_message_string_cache_index == 16 )
-			{
-				resource_file->next_message_string_cache_index = 0;
-			}
-			message_string = NULL;
-		}
-		if( message_string != NULL )
-		{
-			if( message_string_free(
-			     message_string,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free message string.",
-				 function );
+		return( -1 );
+	}
+	return( 1 );
+}
 
-				return( -1 );
-			}
-		}
+/* Retrieves the identifier of a specific message string in the message table resource
+ * Returns 1 if successful, 0 if not available or -1 error
+ */
+int resource_file_get_message_string_identifier(
+     resource_file_t *resource_file,
+     int message_string_index,
+     uint32_t *message_string_identifier,
+     libcerror_error_t **error )
+{
+	static char *function = "resource_file_get_message_string_identifier";
+	int result            = 0;
+
+	if( message_string_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message string identifier.",
+		 function );
+
+		return( -1 );
 	}
-	return( result );
+	result = resource_file_read_message_table_resource(
+	          resource_file,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read message table resource.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libwrc_message_table_get_identifier(
+	     resource_file->message_table_resource,
+	     resource_file->message_table_language_identifier,
+	     message_string_index,
+	     message_string_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve message: %d identifier.",
+		 function,
+		 message_string_index );
+
+		return( -1 );
+	}
+	return( 1 );
 }
 
 /* Retrieves the MUI file type
@@ -28,9 +28,9 @@
 #include "evtxtools_libbfio.h"
 #include "evtxtools_libcerror.h"
 #include "evtxtools_libexe.h"
-#include "evtxtools_libfcache.h"
 #include "evtxtools_libwrc.h"
 #include "message_string.h"
+#include "message_string_cache.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -80,13 +80,13 @@ struct resource_file
 	 */
 	libwrc_resource_t *wevt_template_resource;
 
-	/* The message string cache
+	/* The language identifier of the message table resource
 	 */
-	libfcache_cache_t *message_string_cache;
+	uint32_t message_table_language_identifier;
 
-	/* The next available message string cache index
+	/* The message string cache
 	 */
-	int next_message_string_cache_index;
+	message_string_cache_t *message_string_cache;
 
 	/* Value to indicate if the message file is open
 	 */
@@ -123,10 +123,8 @@ int resource_file_set_name(
      size_t name_length,
      libcerror_error_t **error );
 
-int resource_file_get_message_string_from_cache(
+int resource_file_read_message_table_resource(
      resource_file_t *resource_file,
-     uint32_t message_string_identifier,
-     message_string_t **message_string,
      libcerror_error_t **error );
 
 int resource_file_get_message_string(
@@ -135,6 +133,17 @@ int resource_file_get_message_string(
      message_string_t **message_string,
      libcerror_error_t **error );
 
+int resource_file_get_number_of_message_strings(
+     resource_file_t *resource_file,
+     int *number_of_message_strings,
+     libcerror_error_t **error );
+
+int resource_file_get_message_string_identifier(
+     resource_file_t *resource_file,
+     int message_string_index,
+     uint32_t *message_string_identifier,
+     libcerror_error_t **error );
+
 int resource_file_get_mui_file_type(
      resource_file_t *resource_file,
      uint32_t *file_type,
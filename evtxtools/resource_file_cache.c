@@ -0,0 +1,917 @@
+/*
+ * Resource file cache
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+#include "resource_file.h"
+#include "resource_file_cache.h"
+
+/* Normalizes a resource file name character
+ * Resource file names are compared case insensitive and both / and \ are
+ * considered path segment separators
+ */
+#define resource_file_cache_normalize_character( character ) \
+	( ( ( character >= (system_character_t) 'A' ) && ( character <= (system_character_t) 'Z' ) ) ? \
+	  ( character - (system_character_t) 'A' + (system_character_t) 'a' ) : \
+	  ( ( character == (system_character_t) '/' ) ? (system_character_t) '\\' : character ) )
+
+/* Calculates the hash of a normalized resource file name
+ * Returns the FNV-1a hash of the normalized name
+ */
+uint32_t resource_file_cache_calculate_hash(
+          const system_character_t *name,
+          size_t name_length )
+{
+	size_t name_index = 0;
+	uint32_t hash     = 0x811c9dc5UL;
+
+	if( name == NULL )
+	{
+		return( hash );
+	}
+	for( name_index = 0;
+	     name_index < name_length;
+	     name_index++ )
+	{
+		hash ^= (uint32_t) resource_file_cache_normalize_character( name[ name_index ] );
+		hash *= 0x01000193UL;
+	}
+	return( hash );
+}
+
+/* Compares a name with the normalized name of a resource file
+ * Returns 1 if the names match or 0 if not
+ */
+int resource_file_cache_compare_name(
+     const system_character_t *name,
+     size_t name_length,
+     resource_file_t *resource_file )
+{
+	size_t name_index = 0;
+
+	if( ( name == NULL )
+	 || ( resource_file == NULL )
+	 || ( resource_file->name == NULL ) )
+	{
+		return( 0 );
+	}
+	if( ( name_length + 1 ) != resource_file->name_size )
+	{
+		return( 0 );
+	}
+	for( name_index = 0;
+	     name_index < name_length;
+	     name_index++ )
+	{
+		if( resource_file_cache_normalize_character( name[ name_index ] )
+		 != resource_file_cache_normalize_character( resource_file->name[ name_index ] ) )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
+/* Creates a resource file cache
+ * Make sure the value resource_file_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int resource_file_cache_initialize(
+     resource_file_cache_t **resource_file_cache,
+     int capacity,
+     libcerror_error_t **error )
+{
+	static char *function = "resource_file_cache_initialize";
+
+	if( resource_file_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *resource_file_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid resource file cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*resource_file_cache = memory_allocate_structure(
+	                        resource_file_cache_t );
+
+	if( *resource_file_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create resource file cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *resource_file_cache,
+	     0,
+	     sizeof( resource_file_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear resource file cache.",
+		 function );
+
+		memory_free(
+		 *resource_file_cache );
+
+		*resource_file_cache = NULL;
+
+		return( -1 );
+	}
+	if( resource_file_cache_set_capacity(
+	     *resource_file_cache,
+	     capacity,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set capacity.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *resource_file_cache != NULL )
+	{
+		memory_free(
+		 *resource_file_cache );
+
+		*resource_file_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a resource file cache
+ * The resource files in the cache are freed as well
+ * Returns 1 if successful or -1 on error
+ */
+int resource_file_cache_free(
+     resource_file_cache_t **resource_file_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "resource_file_cache_free";
+	int result            = 1;
+
+	if( resource_file_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *resource_file_cache != NULL )
+	{
+		if( resource_file_cache_empty(
+		     *resource_file_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty resource file cache.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *resource_file_cache )->buckets != NULL )
+		{
+			memory_free(
+			 ( *resource_file_cache )->buckets );
+		}
+		memory_free(
+		 *resource_file_cache );
+
+		*resource_file_cache = NULL;
+	}
+	return( result );
+}
+
+/* Empties a resource file cache
+ * The resource files in the cache are freed
+ * Returns 1 if successful or -1 on error
+ */
+int resource_file_cache_empty(
+     resource_file_cache_t *resource_file_cache,
+     libcerror_error_t **error )
+{
+	resource_file_cache_entry_t *cache_entry = NULL;
+	static char *function                    = "resource_file_cache_empty";
+	int result                               = 1;
+
+	if( resource_file_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file cache.",
+		 function );
+
+		return( -1 );
+	}
+	while( resource_file_cache->most_recently_used_entry != NULL )
+	{
+		cache_entry = resource_file_cache->most_recently_used_entry;
+
+		resource_file_cache->most_recently_used_entry = cache_entry->less_recently_used_entry;
+
+		if( cache_entry->resource_file->message_string_cache != NULL )
+		{
+			resource_file_cache->number_of_message_string_hits   += cache_entry->resource_file->message_string_cache->number_of_hits;
+			resource_file_cache->number_of_message_string_misses += cache_entry->resource_file->message_string_cache->number_of_misses;
+		}
+		if( resource_file_free(
+		     &( cache_entry->resource_file ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free resource file.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 cache_entry );
+	}
+	resource_file_cache->least_recently_used_entry = NULL;
+	resource_file_cache->number_of_entries         = 0;
+
+	if( resource_file_cache->buckets != NULL )
+	{
+		if( memory_set(
+		     resource_file_cache->buckets,
+		     0,
+		     sizeof( resource_file_cache_entry_t * ) * resource_file_cache->number_of_buckets ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear buckets.",
+			 function );
+
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Removes the least recently used entry from a resource file cache
+ * The resource file of the entry is freed
+ * Returns 1 if successful or -1 on error
+ */
+int resource_file_cache_remove_least_recently_used(
+     resource_file_cache_t *resource_file_cache,
+     libcerror_error_t **error )
+{
+	resource_file_cache_entry_t *bucket_entry = NULL;
+	resource_file_cache_entry_t *cache_entry  = NULL;
+	static char *function                     = "resource_file_cache_remove_least_recently_used";
+	uint32_t bucket_index                     = 0;
+
+	if( resource_file_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file cache.",
+		 function );
+
+		return( -1 );
+	}
+	cache_entry = resource_file_cache->least_recently_used_entry;
+
+	if( cache_entry == NULL )
+	{
+		return( 1 );
+	}
+	bucket_index = cache_entry->hash & ( resource_file_cache->number_of_buckets - 1 );
+
+	if( resource_file_cache->buckets[ bucket_index ] == cache_entry )
+	{
+		resource_file_cache->buckets[ bucket_index ] = cache_entry->next_bucket_entry;
+	}
+	else
+	{
+		bucket_entry = resource_file_cache->buckets[ bucket_index ];
+
+		while( bucket_entry != NULL )
+		{
+			if( bucket_entry->next_bucket_entry == cache_entry )
+			{
+				bucket_entry->next_bucket_entry = cache_entry->next_bucket_entry;
+
+				break;
+			}
+			bucket_entry = bucket_entry->next_bucket_entry;
+		}
+	}
+	resource_file_cache->least_recently_used_entry = cache_entry->more_recently_used_entry;
+
+	if( resource_file_cache->least_recently_used_entry != NULL )
+	{
+		resource_file_cache->least_recently_used_entry->less_recently_used_entry = NULL;
+	}
+	else
+	{
+		resource_file_cache->most_recently_used_entry = NULL;
+	}
+	resource_file_cache->number_of_entries -= 1;
+
+	if( cache_entry->resource_file->message_string_cache != NULL )
+	{
+		resource_file_cache->number_of_message_string_hits   += cache_entry->resource_file->message_string_cache->number_of_hits;
+		resource_file_cache->number_of_message_string_misses += cache_entry->resource_file->message_string_cache->number_of_misses;
+	}
+	if( resource_file_free(
+	     &( cache_entry->resource_file ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free resource file.",
+		 function );
+
+		memory_free(
+		 cache_entry );
+
+		return( -1 );
+	}
+	memory_free(
+	 cache_entry );
+
+	return( 1 );
+}
+
+/* Sets the capacity of a resource file cache
+ * If the cache contains more resource files than the capacity
+ * the least recently used resource files are removed
+ * Returns 1 if successful or -1 on error
+ */
+int resource_file_cache_set_capacity(
+     resource_file_cache_t *resource_file_cache,
+     int capacity,
+     libcerror_error_t **error )
+{
+	resource_file_cache_entry_t **buckets    = NULL;
+	resource_file_cache_entry_t *cache_entry = NULL;
+	static char *function                    = "resource_file_cache_set_capacity";
+	uint32_t bucket_index                    = 0;
+	uint32_t number_of_buckets               = 0;
+
+	if( resource_file_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( capacity < RESOURCE_FILE_CACHE_MINIMUM_CAPACITY )
+	 || ( capacity > RESOURCE_FILE_CACHE_MAXIMUM_CAPACITY ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid capacity value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	while( resource_file_cache->number_of_entries > capacity )
+	{
+		if( resource_file_cache_remove_least_recently_used(
+		     resource_file_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove least recently used resource file.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* Use a power of 2 number of buckets of at least twice the capacity
+	 */
+	number_of_buckets = 16;
+
+	while( number_of_buckets < (uint32_t) ( 2 * capacity ) )
+	{
+		number_of_buckets *= 2;
+	}
+	if( number_of_buckets != resource_file_cache->number_of_buckets )
+	{
+		buckets = (resource_file_cache_entry_t **) memory_allocate(
+		                                            sizeof( resource_file_cache_entry_t * ) * number_of_buckets );
+
+		if( buckets == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create buckets.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_set(
+		     buckets,
+		     0,
+		     sizeof( resource_file_cache_entry_t * ) * number_of_buckets ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear buckets.",
+			 function );
+
+			memory_free(
+			 buckets );
+
+			return( -1 );
+		}
+		for( cache_entry = resource_file_cache->most_recently_used_entry;
+		     cache_entry != NULL;
+		     cache_entry = cache_entry->less_recently_used_entry )
+		{
+			bucket_index = cache_entry->hash & ( number_of_buckets - 1 );
+
+			cache_entry->next_bucket_entry = buckets[ bucket_index ];
+			buckets[ bucket_index ]        = cache_entry;
+		}
+		if( resource_file_cache->buckets != NULL )
+		{
+			memory_free(
+			 resource_file_cache->buckets );
+		}
+		resource_file_cache->buckets           = buckets;
+		resource_file_cache->number_of_buckets = number_of_buckets;
+	}
+	resource_file_cache->capacity = capacity;
+
+	return( 1 );
+}
+
+/* Retrieves a specific resource file from a resource file cache
+ * The resource file becomes the most recently used resource file
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int resource_file_cache_get_resource_file(
+     resource_file_cache_t *resource_file_cache,
+     const system_character_t *name,
+     size_t name_length,
+     resource_file_t **resource_file,
+     libcerror_error_t **error )
+{
+	resource_file_cache_entry_t *cache_entry = NULL;
+	static char *function                    = "resource_file_cache_get_resource_file";
+	uint32_t hash                            = 0;
+
+	if( resource_file_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file.",
+		 function );
+
+		return( -1 );
+	}
+	*resource_file = NULL;
+
+	hash = resource_file_cache_calculate_hash(
+	        name,
+	        name_length );
+
+	cache_entry = resource_file_cache->buckets[ hash & ( resource_file_cache->number_of_buckets - 1 ) ];
+
+	while( cache_entry != NULL )
+	{
+		if( cache_entry->hash == hash )
+		{
+			if( resource_file_cache_compare_name(
+			     name,
+			     name_length,
+			     cache_entry->resource_file ) != 0 )
+			{
+				break;
+			}
+		}
+		cache_entry = cache_entry->next_bucket_entry;
+	}
+	if( cache_entry == NULL )
+	{
+		resource_file_cache->number_of_misses += 1;
+
+		return( 0 );
+	}
+	resource_file_cache->number_of_hits += 1;
+
+	if( cache_entry != resource_file_cache->most_recently_used_entry )
+	{
+		/* Unlink the entry from the recently used list
+		 */
+		cache_entry->more_recently_used_entry->less_recently_used_entry = cache_entry->less_recently_used_entry;
+
+		if( cache_entry->less_recently_used_entry != NULL )
+		{
+			cache_entry->less_recently_used_entry->more_recently_used_entry = cache_entry->more_recently_used_entry;
+		}
+		else
+		{
+			resource_file_cache->least_recently_used_entry = cache_entry->more_recently_used_entry;
+		}
+		/* Link the entry as the most recently used
+		 */
+		cache_entry->more_recently_used_entry = NULL;
+		cache_entry->less_recently_used_entry = resource_file_cache->most_recently_used_entry;
+
+		resource_file_cache->most_recently_used_entry->more_recently_used_entry = cache_entry;
+		resource_file_cache->most_recently_used_entry                           = cache_entry;
+	}
+	*resource_file = cache_entry->resource_file;
+
+	return( 1 );
+}
+
+/* Inserts a resource file into a resource file cache
+ * The resource file cache takes over management of the resource file
+ * and the resource file becomes the most recently used resource file
+ * If the cache is full the least recently used resource file is removed
+ * Returns 1 if successful or -1 on error
+ */
+int resource_file_cache_insert_resource_file(
+     resource_file_cache_t *resource_file_cache,
+     resource_file_t *resource_file,
+     libcerror_error_t **error )
+{
+	resource_file_cache_entry_t *cache_entry = NULL;
+	static char *function                    = "resource_file_cache_insert_resource_file";
+	uint32_t bucket_index                    = 0;
+
+	if( resource_file_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_file->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid resource file - missing name.",
+		 function );
+
+		return( -1 );
+	}
+	cache_entry = memory_allocate_structure(
+	               resource_file_cache_entry_t );
+
+	if( cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create cache entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     cache_entry,
+	     0,
+	     sizeof( resource_file_cache_entry_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear cache entry.",
+		 function );
+
+		memory_free(
+		 cache_entry );
+
+		return( -1 );
+	}
+	while( resource_file_cache->number_of_entries >= resource_file_cache->capacity )
+	{
+		if( resource_file_cache_remove_least_recently_used(
+		     resource_file_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove least recently used resource file.",
+			 function );
+
+			memory_free(
+			 cache_entry );
+
+			return( -1 );
+		}
+		resource_file_cache->number_of_evictions += 1;
+	}
+	cache_entry->hash = resource_file_cache_calculate_hash(
+	                     resource_file->name,
+	                     resource_file->name_size - 1 );
+
+	cache_entry->resource_file = resource_file;
+
+	bucket_index = cache_entry->hash & ( resource_file_cache->number_of_buckets - 1 );
+
+	cache_entry->next_bucket_entry               = resource_file_cache->buckets[ bucket_index ];
+	resource_file_cache->buckets[ bucket_index ] = cache_entry;
+
+	cache_entry->less_recently_used_entry = resource_file_cache->most_recently_used_entry;
+
+	if( resource_file_cache->most_recently_used_entry != NULL )
+	{
+		resource_file_cache->most_recently_used_entry->more_recently_used_entry = cache_entry;
+	}
+	else
+	{
+		resource_file_cache->least_recently_used_entry = cache_entry;
+	}
+	resource_file_cache->most_recently_used_entry = cache_entry;
+
+	resource_file_cache->number_of_entries += 1;
+
+	return( 1 );
+}
+
+/* Retrieves the message string cache statistics of the resource files
+ * This includes the resource files that were removed from the resource file cache
+ * Returns 1 if successful or -1 on error
+ */
+int resource_file_cache_get_message_string_statistics(
+     resource_file_cache_t *resource_file_cache,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     libcerror_error_t **error )
+{
+	resource_file_cache_entry_t *cache_entry = NULL;
+	static char *function                    = "resource_file_cache_get_message_string_statistics";
+
+	if( resource_file_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_hits == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of hits.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_misses == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of misses.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_hits   = resource_file_cache->number_of_message_string_hits;
+	*number_of_misses = resource_file_cache->number_of_message_string_misses;
+
+	cache_entry = resource_file_cache->most_recently_used_entry;
+
+	while( cache_entry != NULL )
+	{
+		if( ( cache_entry->resource_file != NULL )
+		 && ( cache_entry->resource_file->message_string_cache != NULL ) )
+		{
+			*number_of_hits   += cache_entry->resource_file->message_string_cache->number_of_hits;
+			*number_of_misses += cache_entry->resource_file->message_string_cache->number_of_misses;
+		}
+		cache_entry = cache_entry->less_recently_used_entry;
+	}
+	return( 1 );
+}
+
+/* Prints the statistics of a resource file cache
+ * Returns 1 if successful or -1 on error
+ */
+int resource_file_cache_statistics_fprint(
+     resource_file_cache_t *resource_file_cache,
+     const char *description,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	static char *function                    = "resource_file_cache_statistics_fprint";
+	uint64_t number_of_message_string_hits   = 0;
+	uint64_t number_of_message_string_misses = 0;
+	uint64_t number_of_retrievals            = 0;
+	uint64_t hit_rate                        = 0;
+
+	if( resource_file_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( description == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid description.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_retrievals = resource_file_cache->number_of_hits
+	                     + resource_file_cache->number_of_misses;
+
+	if( number_of_retrievals > 0 )
+	{
+		hit_rate = ( resource_file_cache->number_of_hits * 100 ) / number_of_retrievals;
+	}
+	fprintf(
+	 stream,
+	 "%s cache: %" PRIu64 " hits, %" PRIu64 " misses (hit rate: %" PRIu64 "%%), %" PRIu64 " evictions, capacity: %d\n",
+	 description,
+	 resource_file_cache->number_of_hits,
+	 resource_file_cache->number_of_misses,
+	 hit_rate,
+	 resource_file_cache->number_of_evictions,
+	 resource_file_cache->capacity );
+
+	if( resource_file_cache_get_message_string_statistics(
+	     resource_file_cache,
+	     &number_of_message_string_hits,
+	     &number_of_message_string_misses,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve message string cache statistics.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_retrievals = number_of_message_string_hits
+	                     + number_of_message_string_misses;
+
+	hit_rate = 0;
+
+	if( number_of_retrievals > 0 )
+	{
+		hit_rate = ( number_of_message_string_hits * 100 ) / number_of_retrievals;
+	}
+	fprintf(
+	 stream,
+	 "%s message string cache: %" PRIu64 " hits, %" PRIu64 " misses (hit rate: %" PRIu64 "%%)\n",
+	 description,
+	 number_of_message_string_hits,
+	 number_of_message_string_misses,
+	 hit_rate );
+
+	return( 1 );
+}
+
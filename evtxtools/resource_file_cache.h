@@ -0,0 +1,184 @@
+/*
+ * Resource file cache
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _RESOURCE_FILE_CACHE_H )
+#define _RESOURCE_FILE_CACHE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+#include "resource_file.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The default number of resource files kept open in a resource file cache
+ */
+#define RESOURCE_FILE_CACHE_DEFAULT_CAPACITY	64
+
+/* The minimum number of resource files kept open in a resource file cache
+ * A resource file retrieved from the cache remains valid until at least one
+ * other resource file has been added
+ */
+#define RESOURCE_FILE_CACHE_MINIMUM_CAPACITY	2
+
+/* The maximum number of resource files kept open in a resource file cache
+ */
+#define RESOURCE_FILE_CACHE_MAXIMUM_CAPACITY	1024
+
+typedef struct resource_file_cache_entry resource_file_cache_entry_t;
+
+struct resource_file_cache_entry
+{
+	/* The hash of the normalized resource file name
+	 */
+	uint32_t hash;
+
+	/* The resource file
+	 */
+	resource_file_t *resource_file;
+
+	/* The next entry in the same hash bucket
+	 */
+	resource_file_cache_entry_t *next_bucket_entry;
+
+	/* The more recently used entry
+	 */
+	resource_file_cache_entry_t *more_recently_used_entry;
+
+	/* The less recently used entry
+	 */
+	resource_file_cache_entry_t *less_recently_used_entry;
+};
+
+typedef struct resource_file_cache resource_file_cache_t;
+
+struct resource_file_cache
+{
+	/* The hash buckets
+	 */
+	resource_file_cache_entry_t **buckets;
+
+	/* The number of hash buckets
+	 */
+	uint32_t number_of_buckets;
+
+	/* The most recently used entry
+	 */
+	resource_file_cache_entry_t *most_recently_used_entry;
+
+	/* The least recently used entry
+	 */
+	resource_file_cache_entry_t *least_recently_used_entry;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The maximum number of entries
+	 */
+	int capacity;
+
+	/* The number of retrievals that found the resource file in the cache
+	 */
+	uint64_t number_of_hits;
+
+	/* The number of retrievals that did not find the resource file in the cache
+	 */
+	uint64_t number_of_misses;
+
+	/* The number of resource files that were removed to make room for another
+	 */
+	uint64_t number_of_evictions;
+
+	/* The number of message string cache hits of the resource files that were removed
+	 */
+	uint64_t number_of_message_string_hits;
+
+	/* The number of message string cache misses of the resource files that were removed
+	 */
+	uint64_t number_of_message_string_misses;
+};
+
+uint32_t resource_file_cache_calculate_hash(
+          const system_character_t *name,
+          size_t name_length );
+
+int resource_file_cache_compare_name(
+     const system_character_t *name,
+     size_t name_length,
+     resource_file_t *resource_file );
+
+int resource_file_cache_initialize(
+     resource_file_cache_t **resource_file_cache,
+     int capacity,
+     libcerror_error_t **error );
+
+int resource_file_cache_free(
+     resource_file_cache_t **resource_file_cache,
+     libcerror_error_t **error );
+
+int resource_file_cache_empty(
+     resource_file_cache_t *resource_file_cache,
+     libcerror_error_t **error );
+
+int resource_file_cache_remove_least_recently_used(
+     resource_file_cache_t *resource_file_cache,
+     libcerror_error_t **error );
+
+int resource_file_cache_set_capacity(
+     resource_file_cache_t *resource_file_cache,
+     int capacity,
+     libcerror_error_t **error );
+
+int resource_file_cache_get_resource_file(
+     resource_file_cache_t *resource_file_cache,
+     const system_character_t *name,
+     size_t name_length,
+     resource_file_t **resource_file,
+     libcerror_error_t **error );
+
+int resource_file_cache_insert_resource_file(
+     resource_file_cache_t *resource_file_cache,
+     resource_file_t *resource_file,
+     libcerror_error_t **error );
+
+int resource_file_cache_get_message_string_statistics(
+     resource_file_cache_t *resource_file_cache,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     libcerror_error_t **error );
+
+int resource_file_cache_statistics_fprint(
+     resource_file_cache_t *resource_file_cache,
+     const char *description,
+     FILE *stream,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _RESOURCE_FILE_CACHE_H ) */
+
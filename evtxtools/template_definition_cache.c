@@ -0,0 +1,714 @@
+/*
+ * Template definition cache
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "evtxtools_libcdata.h"
+#include "evtxtools_libcerror.h"
+#include "evtxtools_libevtx.h"
+#include "template_definition_cache.h"
+
+/* The maximum number of values per template definition cache tree node
+ */
+#define TEMPLATE_DEFINITION_CACHE_TREE_MAXIMUM_NUMBER_OF_VALUES	257
+
+/* Creates a template definition cache entry
+ * Make sure the value cache_entry is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int template_definition_cache_entry_initialize(
+     template_definition_cache_entry_t **cache_entry,
+     const system_character_t *resource_file_name,
+     size_t resource_file_name_length,
+     const uint8_t *provider_identifier,
+     size_t provider_identifier_size,
+     uint32_t event_identifier,
+     libcerror_error_t **error )
+{
+	static char *function = "template_definition_cache_entry_initialize";
+
+	if( cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cache_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid cache entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_file_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file name.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_file_name_length > (size_t) ( SSIZE_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid resource file name length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( provider_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid provider identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( provider_identifier_size != 16 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid provider identifier size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*cache_entry = memory_allocate_structure(
+	                template_definition_cache_entry_t );
+
+	if( *cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create cache entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *cache_entry,
+	     0,
+	     sizeof( template_definition_cache_entry_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear cache entry.",
+		 function );
+
+		memory_free(
+		 *cache_entry );
+
+		*cache_entry = NULL;
+
+		return( -1 );
+	}
+	( *cache_entry )->resource_file_name_size = resource_file_name_length + 1;
+
+	( *cache_entry )->resource_file_name = system_string_allocate(
+	                                        ( *cache_entry )->resource_file_name_size );
+
+	if( ( *cache_entry )->resource_file_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create resource file name.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     ( *cache_entry )->resource_file_name,
+	     resource_file_name,
+	     resource_file_name_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy resource file name.",
+		 function );
+
+		goto on_error;
+	}
+	( ( *cache_entry )->resource_file_name )[ resource_file_name_length ] = 0;
+
+	if( memory_copy(
+	     ( *cache_entry )->provider_identifier,
+	     provider_identifier,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy provider identifier.",
+		 function );
+
+		goto on_error;
+	}
+	( *cache_entry )->event_identifier = event_identifier;
+
+	return( 1 );
+
+on_error:
+	if( *cache_entry != NULL )
+	{
+		template_definition_cache_entry_free(
+		 cache_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a template definition cache entry
+ * Returns 1 if successful or -1 on error
+ */
+int template_definition_cache_entry_free(
+     template_definition_cache_entry_t **cache_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "template_definition_cache_entry_free";
+	int result            = 1;
+
+	if( cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cache_entry != NULL )
+	{
+		if( ( *cache_entry )->template_definition != NULL )
+		{
+			if( libevtx_template_definition_free(
+			     &( ( *cache_entry )->template_definition ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free template definition.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *cache_entry )->resource_file_name != NULL )
+		{
+			memory_free(
+			 ( *cache_entry )->resource_file_name );
+		}
+		memory_free(
+		 *cache_entry );
+
+		*cache_entry = NULL;
+	}
+	return( result );
+}
+
+/* Compares two template definition cache entries
+ * Returns LIBCDATA_COMPARE_LESS, LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
+ */
+int template_definition_cache_entry_compare(
+     template_definition_cache_entry_t *first_cache_entry,
+     template_definition_cache_entry_t *second_cache_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "template_definition_cache_entry_compare";
+	int result            = 0;
+
+	if( first_cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first cache entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( second_cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second cache entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_cache_entry->event_identifier < second_cache_entry->event_identifier )
+	{
+		return( LIBCDATA_COMPARE_LESS );
+	}
+	else if( first_cache_entry->event_identifier > second_cache_entry->event_identifier )
+	{
+		return( LIBCDATA_COMPARE_GREATER );
+	}
+	result = memory_compare(
+	          first_cache_entry->provider_identifier,
+	          second_cache_entry->provider_identifier,
+	          16 );
+
+	if( result < 0 )
+	{
+		return( LIBCDATA_COMPARE_LESS );
+	}
+	else if( result > 0 )
+	{
+		return( LIBCDATA_COMPARE_GREATER );
+	}
+	if( first_cache_entry->resource_file_name_size < second_cache_entry->resource_file_name_size )
+	{
+		return( LIBCDATA_COMPARE_LESS );
+	}
+	else if( first_cache_entry->resource_file_name_size > second_cache_entry->resource_file_name_size )
+	{
+		return( LIBCDATA_COMPARE_GREATER );
+	}
+	if( first_cache_entry->resource_file_name_size > 1 )
+	{
+		result = system_string_compare(
+		          first_cache_entry->resource_file_name,
+		          second_cache_entry->resource_file_name,
+		          first_cache_entry->resource_file_name_size - 1 );
+
+		if( result < 0 )
+		{
+			return( LIBCDATA_COMPARE_LESS );
+		}
+		else if( result > 0 )
+		{
+			return( LIBCDATA_COMPARE_GREATER );
+		}
+	}
+	return( LIBCDATA_COMPARE_EQUAL );
+}
+
+/* Creates a template definition cache
+ * Make sure the value template_definition_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int template_definition_cache_initialize(
+     template_definition_cache_t **template_definition_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "template_definition_cache_initialize";
+
+	if( template_definition_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template definition cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *template_definition_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid template definition cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*template_definition_cache = memory_allocate_structure(
+	                              template_definition_cache_t );
+
+	if( *template_definition_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create template definition cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *template_definition_cache,
+	     0,
+	     sizeof( template_definition_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear template definition cache.",
+		 function );
+
+		memory_free(
+		 *template_definition_cache );
+
+		*template_definition_cache = NULL;
+
+		return( -1 );
+	}
+	if( libcdata_btree_initialize(
+	     &( ( *template_definition_cache )->entries_tree ),
+	     TEMPLATE_DEFINITION_CACHE_TREE_MAXIMUM_NUMBER_OF_VALUES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create entries tree.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *template_definition_cache != NULL )
+	{
+		memory_free(
+		 *template_definition_cache );
+
+		*template_definition_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a template definition cache
+ * The template definitions in the cache are freed as well
+ * Returns 1 if successful or -1 on error
+ */
+int template_definition_cache_free(
+     template_definition_cache_t **template_definition_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "template_definition_cache_free";
+	int result            = 1;
+
+	if( template_definition_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template definition cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *template_definition_cache != NULL )
+	{
+		if( libcdata_btree_free(
+		     &( ( *template_definition_cache )->entries_tree ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &template_definition_cache_entry_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free entries tree.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *template_definition_cache );
+
+		*template_definition_cache = NULL;
+	}
+	return( result );
+}
+
+/* Retrieves a specific template definition from a template definition cache
+ * The template definition is set to NULL if the cache records that the event has no template definition
+ * The template definition is managed by the cache and should not be freed
+ * Returns 1 if successful, 0 if not in the cache or -1 on error
+ */
+int template_definition_cache_get_template_definition(
+     template_definition_cache_t *template_definition_cache,
+     const system_character_t *resource_file_name,
+     size_t resource_file_name_length,
+     const uint8_t *provider_identifier,
+     size_t provider_identifier_size,
+     uint32_t event_identifier,
+     libevtx_template_definition_t **template_definition,
+     libcerror_error_t **error )
+{
+	template_definition_cache_entry_t lookup_cache_entry;
+	template_definition_cache_entry_t *existing_cache_entry = NULL;
+	libcdata_tree_node_t *upper_node                        = NULL;
+	static char *function                                   = "template_definition_cache_get_template_definition";
+	int result                                              = 0;
+
+	if( template_definition_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template definition cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_file_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file name.",
+		 function );
+
+		return( -1 );
+	}
+	if( provider_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid provider identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( provider_identifier_size != 16 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid provider identifier size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( template_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &lookup_cache_entry,
+	     0,
+	     sizeof( template_definition_cache_entry_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear lookup cache entry.",
+		 function );
+
+		return( -1 );
+	}
+	lookup_cache_entry.resource_file_name      = (system_character_t *) resource_file_name;
+	lookup_cache_entry.resource_file_name_size = resource_file_name_length + 1;
+	lookup_cache_entry.event_identifier        = event_identifier;
+
+	if( memory_copy(
+	     lookup_cache_entry.provider_identifier,
+	     provider_identifier,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy provider identifier.",
+		 function );
+
+		return( -1 );
+	}
+	*template_definition = NULL;
+
+	result = libcdata_btree_get_value_by_value(
+	          template_definition_cache->entries_tree,
+	          (intptr_t *) &lookup_cache_entry,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &template_definition_cache_entry_compare,
+	          &upper_node,
+	          (intptr_t **) &existing_cache_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cache entry from tree.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		*template_definition = existing_cache_entry->template_definition;
+	}
+	return( result );
+}
+
+/* Inserts a template definition into a template definition cache
+ * The template definition cache takes over management of the template definition
+ * A NULL template definition records that the event has no template definition
+ * Returns 1 if successful or -1 on error
+ */
+int template_definition_cache_insert_template_definition(
+     template_definition_cache_t *template_definition_cache,
+     const system_character_t *resource_file_name,
+     size_t resource_file_name_length,
+     const uint8_t *provider_identifier,
+     size_t provider_identifier_size,
+     uint32_t event_identifier,
+     libevtx_template_definition_t *template_definition,
+     libcerror_error_t **error )
+{
+	template_definition_cache_entry_t *cache_entry          = NULL;
+	template_definition_cache_entry_t *existing_cache_entry = NULL;
+	libcdata_tree_node_t *upper_node                        = NULL;
+	static char *function                                   = "template_definition_cache_insert_template_definition";
+	int result                                              = 0;
+	int value_index                                         = 0;
+
+	if( template_definition_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template definition cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( template_definition_cache_entry_initialize(
+	     &cache_entry,
+	     resource_file_name,
+	     resource_file_name_length,
+	     provider_identifier,
+	     provider_identifier_size,
+	     event_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create cache entry.",
+		 function );
+
+		goto on_error;
+	}
+	result = libcdata_btree_insert_value(
+	          template_definition_cache->entries_tree,
+	          &value_index,
+	          (intptr_t *) cache_entry,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &template_definition_cache_entry_compare,
+	          &upper_node,
+	          (intptr_t **) &existing_cache_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert cache entry into tree.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid template definition cache - entry already set.",
+		 function );
+
+		goto on_error;
+	}
+	/* Only take over management of the template definition after the entry was inserted
+	 */
+	cache_entry->template_definition = template_definition;
+
+	return( 1 );
+
+on_error:
+	if( cache_entry != NULL )
+	{
+		template_definition_cache_entry_free(
+		 &cache_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,121 @@
+/*
+ * Template definition cache
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _TEMPLATE_DEFINITION_CACHE_H )
+#define _TEMPLATE_DEFINITION_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "evtxtools_libcdata.h"
+#include "evtxtools_libcerror.h"
+#include "evtxtools_libevtx.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct template_definition_cache_entry template_definition_cache_entry_t;
+
+struct template_definition_cache_entry
+{
+	/* The name of the resource file that contains the template definition
+	 */
+	system_character_t *resource_file_name;
+
+	/* The resource file name size
+	 */
+	size_t resource_file_name_size;
+
+	/* The provider identifier
+	 */
+	uint8_t provider_identifier[ 16 ];
+
+	/* The event identifier
+	 */
+	uint32_t event_identifier;
+
+	/* The template definition or NULL if the event has no template definition
+	 */
+	libevtx_template_definition_t *template_definition;
+};
+
+typedef struct template_definition_cache template_definition_cache_t;
+
+struct template_definition_cache
+{
+	/* The entries tree
+	 */
+	libcdata_btree_t *entries_tree;
+};
+
+int template_definition_cache_entry_initialize(
+     template_definition_cache_entry_t **cache_entry,
+     const system_character_t *resource_file_name,
+     size_t resource_file_name_length,
+     const uint8_t *provider_identifier,
+     size_t provider_identifier_size,
+     uint32_t event_identifier,
+     libcerror_error_t **error );
+
+int template_definition_cache_entry_free(
+     template_definition_cache_entry_t **cache_entry,
+     libcerror_error_t **error );
+
+int template_definition_cache_entry_compare(
+     template_definition_cache_entry_t *first_cache_entry,
+     template_definition_cache_entry_t *second_cache_entry,
+     libcerror_error_t **error );
+
+int template_definition_cache_initialize(
+     template_definition_cache_t **template_definition_cache,
+     libcerror_error_t **error );
+
+int template_definition_cache_free(
+     template_definition_cache_t **template_definition_cache,
+     libcerror_error_t **error );
+
+int template_definition_cache_get_template_definition(
+     template_definition_cache_t *template_definition_cache,
+     const system_character_t *resource_file_name,
+     size_t resource_file_name_length,
+     const uint8_t *provider_identifier,
+     size_t provider_identifier_size,
+     uint32_t event_identifier,
+     libevtx_template_definition_t **template_definition,
+     libcerror_error_t **error );
+
+int template_definition_cache_insert_template_definition(
+     template_definition_cache_t *template_definition_cache,
+     const system_character_t *resource_file_name,
+     size_t resource_file_name_length,
+     const uint8_t *provider_identifier,
+     size_t provider_identifier_size,
+     uint32_t event_identifier,
+     libevtx_template_definition_t *template_definition,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _TEMPLATE_DEFINITION_CACHE_H ) */
+
@@ -0,0 +1,171 @@
+/*
+ * The index file definition of a Windows XML Event Log (EVTX) file
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _EVTX_INDEX_FILE_H )
+#define _EVTX_INDEX_FILE_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct evtx_index_file_header evtx_index_file_header_t;
+
+struct evtx_index_file_header
+{
+	/* The signature
+	 * Consists of 8 bytes
+	 * Consists of: "EvtxIdx\x00"
+	 */
+	uint8_t signature[ 8 ];
+
+	/* The format version
+	 * Consists of 4 bytes
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* The IO handle flags
+	 * Consists of 4 bytes
+	 */
+	uint8_t flags[ 4 ];
+
+	/* The size of the EVTX file
+	 * Consists of 8 bytes
+	 */
+	uint8_t file_size[ 8 ];
+
+	/* The checksum of the EVTX file header
+	 * Consists of 4 bytes
+	 */
+	uint8_t file_header_checksum[ 4 ];
+
+	/* The chunk size
+	 * Consists of 4 bytes
+	 */
+	uint8_t chunk_size[ 4 ];
+
+	/* The chunks data size
+	 * Consists of 8 bytes
+	 */
+	uint8_t chunks_data_size[ 8 ];
+
+	/* The first record identifier
+	 * Consists of 8 bytes
+	 */
+	uint8_t first_record_identifier[ 8 ];
+
+	/* The last record identifier
+	 * Consists of 8 bytes
+	 */
+	uint8_t last_record_identifier[ 8 ];
+
+	/* The number of chunk entries
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_chunk_entries[ 4 ];
+
+	/* The number of record entries
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_record_entries[ 4 ];
+
+	/* The number of recovered record entries
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_recovered_record_entries[ 4 ];
+
+	/* The checksum
+	 * Consists of 4 bytes
+	 * Contains a CRC32 of the preceding bytes of the header
+	 */
+	uint8_t checksum[ 4 ];
+};
+
+typedef struct evtx_index_file_chunk_entry evtx_index_file_chunk_entry_t;
+
+struct evtx_index_file_chunk_entry
+{
+	/* The checksum of the chunk header
+	 * Consists of 4 bytes
+	 */
+	uint8_t header_checksum[ 4 ];
+
+	/* The chunk flags
+	 * Consists of 4 bytes
+	 */
+	uint8_t flags[ 4 ];
+
+	/* The first record identifier
+	 * Consists of 8 bytes
+	 */
+	uint8_t first_record_identifier[ 8 ];
+
+	/* The last record identifier
+	 * Consists of 8 bytes
+	 */
+	uint8_t last_record_identifier[ 8 ];
+
+	/* The first written time
+	 * Consists of 8 bytes
+	 * Contains a FILETIME
+	 */
+	uint8_t first_written_time[ 8 ];
+
+	/* The last written time
+	 * Consists of 8 bytes
+	 * Contains a FILETIME
+	 */
+	uint8_t last_written_time[ 8 ];
+};
+
+typedef struct evtx_index_file_record_entry evtx_index_file_record_entry_t;
+
+struct evtx_index_file_record_entry
+{
+	/* The chunk index
+	 * Consists of 2 bytes
+	 */
+	uint8_t chunk_index[ 2 ];
+
+	/* The chunk data offset
+	 * Consists of 2 bytes
+	 */
+	uint8_t chunk_data_offset[ 2 ];
+
+	/* The chunk record index
+	 * Consists of 2 bytes
+	 */
+	uint8_t chunk_record_index[ 2 ];
+
+	/* The flags
+	 * Consists of 2 bytes
+	 */
+	uint8_t flags[ 2 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _EVTX_INDEX_FILE_H ) */
+
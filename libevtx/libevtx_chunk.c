@@ -33,6 +33,8 @@
 #include "libevtx_libcerror.h"
 #include "libevtx_libcnotify.h"
 #include "libevtx_record_values.h"
+#include "libevtx_statistics.h"
+#include "libevtx_trace.h"
 
 #include "evtx_chunk.h"
 #include "evtx_event_record.h"
@@ -231,8 +233,6 @@ int libevtx_chunk_read(
 	static char *function                       = "libevtx_chunk_read";
 	size_t chunk_data_offset                    = 0;
 	size_t chunk_data_size                      = 0;
-	size_t xml_data_offset                      = 0;
-	size_t xml_data_size                        = 0;
 	ssize_t read_count                          = 0;
 	uint64_t calculated_number_of_event_records = 0;
 	uint64_t first_event_record_identifier      = 0;
@@ -253,7 +253,6 @@ int libevtx_chunk_read(
 	uint64_t calculated_chunk_number            = 0;
 #endif
 #if defined( HAVE_DEBUG_OUTPUT )
-	ssize_t free_space_size                     = 0;
 	uint32_t value_32bit                        = 0;
 #endif
 
@@ -304,22 +303,14 @@ int libevtx_chunk_read(
 		 file_offset );
 	}
 #endif
-	if( libbfio_handle_seek_offset(
-	     file_io_handle,
-	     file_offset,
-	     SEEK_SET,
-	     error ) == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek chunk offset: %" PRIi64 ".",
-		 function,
-		 file_offset );
+	libevtx_trace_begin(
+	 LIBEVTX_TRACE_EVENT_TYPE_CHUNK_READ,
+	 libevtx_trace_get_chunk_index(
+	  io_handle,
+	  file_offset ),
+	 file_offset,
+	 io_handle->chunk_size );
 
-		goto on_error;
-	}
 	chunk->file_offset = file_offset;
 
 	chunk->data = (uint8_t *) memory_allocate(
@@ -338,8 +329,10 @@ int libevtx_chunk_read(
 	}
 	chunk->data_size = (size_t) io_handle->chunk_size;
 
-	read_count = libbfio_handle_read_buffer(
+	read_count = libevtx_io_handle_read_data_at_offset(
+	              io_handle,
 	              file_io_handle,
+	              file_offset,
 	              chunk->data,
 	              chunk->data_size,
 	              error );
@@ -350,11 +343,20 @@ int libevtx_chunk_read(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read chunk data.",
-		 function );
+		 "%s: unable to read chunk data at offset: %" PRIi64 ".",
+		 function,
+		 file_offset );
 
 		goto on_error;
 	}
+	libevtx_statistics_counter_add(
+	 io_handle->statistics_counters.number_of_chunks_read,
+	 1 );
+
+	libevtx_statistics_counter_add(
+	 io_handle->statistics_counters.number_of_bytes_read,
+	 read_count );
+
 	chunk_data      = chunk->data;
 	chunk_data_size = chunk->data_size;
 
@@ -388,6 +390,14 @@ int libevtx_chunk_read(
 	}
 	else if( result != 0 )
 	{
+		libevtx_trace_end(
+		 LIBEVTX_TRACE_EVENT_TYPE_CHUNK_READ,
+		 libevtx_trace_get_chunk_index(
+		  io_handle,
+		  file_offset ),
+		 file_offset,
+		 io_handle->chunk_size );
+
 		return( 0 );
 	}
 	if( memory_compare(
@@ -581,6 +591,10 @@ int libevtx_chunk_read(
 			}
 #endif
 			chunk->flags |= LIBEVTX_CHUNK_FLAG_IS_CORRUPTED;
+
+			libevtx_statistics_counter_add(
+			 io_handle->statistics_counters.number_of_checksum_mismatches,
+			 1 );
 		}
 		chunk_data_offset = sizeof( evtx_chunk_header_t );
 
@@ -641,6 +655,10 @@ int libevtx_chunk_read(
 			}
 #endif
 			chunk->flags |= LIBEVTX_CHUNK_FLAG_IS_CORRUPTED;
+
+			libevtx_statistics_counter_add(
+			 io_handle->statistics_counters.number_of_checksum_mismatches,
+			 1 );
 		}
 		while( chunk_data_offset <= last_event_record_offset )
 		{
@@ -723,6 +741,10 @@ int libevtx_chunk_read(
 			record_values = NULL;
 
 			number_of_event_records++;
+
+			libevtx_statistics_counter_add(
+			 io_handle->statistics_counters.number_of_records_parsed,
+			 1 );
 		}
 		if( first_event_record_number > last_event_record_number )
 		{
@@ -784,154 +806,283 @@ int libevtx_chunk_read(
 			/* TODO mark this as corruption ? */
 		}
 	}
-	if( chunk_data_offset < chunk_data_size )
+	if( record_values != NULL )
 	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		free_space_size = chunk_data_size - chunk_data_offset;
+		if( libevtx_record_values_free(
+		     &record_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record values.",
+			 function );
 
-		if( libcnotify_verbose != 0 )
+			goto on_error;
+		}
+	}
+	if( chunk_data_offset < chunk_data_size )
+	{
+		if( libevtx_chunk_read_recovered_records(
+		     chunk,
+		     io_handle,
+		     chunk_data_offset,
+		     error ) != 1 )
 		{
-			libcnotify_printf(
-			 "%s: free space data:\n",
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read recovered records.",
 			 function );
-			libcnotify_print_data(
-			 &( chunk_data[ chunk_data_offset ] ),
-			 free_space_size,
-			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+
+			goto on_error;
 		}
+	}
+	libevtx_trace_end(
+	 LIBEVTX_TRACE_EVENT_TYPE_CHUNK_READ,
+	 libevtx_trace_get_chunk_index(
+	  io_handle,
+	  file_offset ),
+	 file_offset,
+	 io_handle->chunk_size );
+
+	return( 1 );
+
+on_error:
+	if( record_values != NULL )
+	{
+		libevtx_record_values_free(
+		 &record_values,
+		 NULL );
+	}
+	if( chunk->data != NULL )
+	{
+		memory_free(
+		 chunk->data );
+
+		chunk->data = NULL;
+	}
+	libevtx_trace_end(
+	 LIBEVTX_TRACE_EVENT_TYPE_CHUNK_READ,
+	 libevtx_trace_get_chunk_index(
+	  io_handle,
+	  file_offset ),
+	 file_offset,
+	 io_handle->chunk_size );
+
+	return( -1 );
+}
+
+/* Reads the recovered records from the free space of the chunk data
+ * The free space is scanned for event record signatures on a 4-byte alignment
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunk_read_recovered_records(
+     libevtx_chunk_t *chunk,
+     libevtx_io_handle_t *io_handle,
+     size_t chunk_data_offset,
+     libcerror_error_t **error )
+{
+	libevtx_record_values_t *record_values = NULL;
+	uint8_t *chunk_data                    = NULL;
+	static char *function                  = "libevtx_chunk_read_recovered_records";
+	size_t chunk_data_size                 = 0;
+	size_t xml_data_offset                 = 0;
+	size_t xml_data_size                   = 0;
+	int entry_index                        = 0;
+	int result                             = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	ssize_t free_space_size                = 0;
 #endif
-		while( chunk_data_offset < chunk_data_size )
-		{
-/* TODO optimize scan ? */
-			if( memory_compare(
-			     &( chunk_data[ chunk_data_offset ] ),
-			     evtx_event_record_signature,
-			     4 ) == 0 )
-			{
-				if( record_values == NULL )
-				{
-					if( libevtx_record_values_initialize(
-					     &record_values,
-					     error ) != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-						 "%s: unable to create record values.",
-						 function );
 
-						goto on_error;
-					}
-				}
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid chunk - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	chunk_data      = chunk->data;
+	chunk_data_size = chunk->data_size;
+
+	if( chunk_data_offset > chunk_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_DEBUG_OUTPUT )
-				if( libcnotify_verbose != 0 )
-				{
-					libcnotify_printf(
-					 "%s: reading recovered record at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
-					 function,
-					 file_offset + chunk_data_offset,
-					 file_offset + chunk_data_offset );
-				}
+	free_space_size = chunk_data_size - chunk_data_offset;
+
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: free space data:\n",
+		 function );
+		libcnotify_print_data(
+		 &( chunk_data[ chunk_data_offset ] ),
+		 free_space_size,
+		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+	}
 #endif
-				if( libevtx_record_values_read_header(
-				     record_values,
-				     io_handle,
-				     chunk_data,
-				     chunk_data_size,
-				     chunk_data_offset,
+	while( chunk_data_offset < chunk_data_size )
+	{
+/* TODO optimize scan ? */
+		if( memory_compare(
+		     &( chunk_data[ chunk_data_offset ] ),
+		     evtx_event_record_signature,
+		     4 ) == 0 )
+		{
+			if( record_values == NULL )
+			{
+				if( libevtx_record_values_initialize(
+				     &record_values,
 				     error ) != 1 )
 				{
 					libcerror_error_set(
 					 error,
-					 LIBCERROR_ERROR_DOMAIN_IO,
-					 LIBCERROR_IO_ERROR_READ_FAILED,
-					 "%s: unable to read record values header at offset: %" PRIi64 ".",
-					 function,
-					 file_offset + chunk_data_offset );
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to create record values.",
+					 function );
+
+					goto on_error;
+				}
+			}
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: reading recovered record at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+				 function,
+				 chunk->file_offset + chunk_data_offset,
+				 chunk->file_offset + chunk_data_offset );
+			}
+#endif
+			if( libevtx_record_values_read_header(
+			     record_values,
+			     io_handle,
+			     chunk_data,
+			     chunk_data_size,
+			     chunk_data_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read record values header at offset: %" PRIi64 ".",
+				 function,
+				 chunk->file_offset + chunk_data_offset );
 
 #if defined( HAVE_DEBUG_OUTPUT )
-					if( libcnotify_verbose != 0 )
+				if( libcnotify_verbose != 0 )
+				{
+					if( ( error != NULL )
+					 && ( *error != NULL ) )
 					{
-						if( ( error != NULL )
-						 && ( *error != NULL ) )
-						{
-							libcnotify_print_error_backtrace(
-							 *error );
-						}
+						libcnotify_print_error_backtrace(
+						 *error );
 					}
-#endif
-					libcerror_error_free(
-					 error );
 				}
-				else
+#endif
+				libcerror_error_free(
+				 error );
+			}
+			else
+			{
+				xml_data_offset = chunk_data_offset + sizeof( evtx_event_record_header_t );
+				xml_data_size   = 0;
+
+				if( record_values->data_size > ( sizeof( evtx_event_record_header_t ) + 4 ) )
 				{
-					xml_data_offset = chunk_data_offset + sizeof( evtx_event_record_header_t );
-					xml_data_size   = 0;
+					xml_data_size = record_values->data_size - ( sizeof( evtx_event_record_header_t ) + 4 );
+				}
+				result = 0;
 
-					if( record_values->data_size > ( sizeof( evtx_event_record_header_t ) + 4 ) )
+				if( xml_data_size > 0 )
+				{
+					if( ( xml_data_size >= 5 )
+					 && ( chunk_data[ xml_data_offset ] == 0x0a ) )
 					{
-						xml_data_size = record_values->data_size - ( sizeof( evtx_event_record_header_t ) + 4 );
+						result = 1;
 					}
-					result = 0;
-
-					if( xml_data_size > 0 )
+					else if( ( xml_data_size >= 4 )
+					      && ( chunk_data[ xml_data_offset ] == 0x0f )
+					      && ( chunk_data[ xml_data_offset + 1 ] == 0x01 )
+					      && ( chunk_data[ xml_data_offset + 2 ] == 0x01 )
+					      && ( chunk_data[ xml_data_offset + 3 ] == 0x00 ) )
 					{
-						if( ( xml_data_size >= 5 )
-						 && ( chunk_data[ xml_data_offset ] == 0x0a ) )
-						{
-							result = 1;
-						}
-						else if( ( xml_data_size >= 4 )
-						      && ( chunk_data[ xml_data_offset ] == 0x0f )
-						      && ( chunk_data[ xml_data_offset + 1 ] == 0x01 )
-						      && ( chunk_data[ xml_data_offset + 2 ] == 0x01 )
-						      && ( chunk_data[ xml_data_offset + 3 ] == 0x00 ) )
-						{
-							result = 1;
-						}
-/* TODO what about 0x00 allow it ? */
+						result = 1;
 					}
-					if( result != 0 )
+/* TODO what about 0x00 allow it ? */
+				}
+				if( result != 0 )
+				{
+					chunk_data_offset += record_values->data_size - 4;
+
+					if( libcdata_array_append_entry(
+					     chunk->recovered_records_array,
+					     &entry_index,
+					     (intptr_t *) record_values,
+					     error ) != 1 )
 					{
-						chunk_data_offset += record_values->data_size - 4;
-
-						if( libcdata_array_append_entry(
-						     chunk->recovered_records_array,
-						     &entry_index,
-						     (intptr_t *) record_values,
-						     error ) != 1 )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-							 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-							 "%s: unable to append record values to recovered records array.",
-							 function );
-
-							goto on_error;
-						}
-						record_values = NULL;
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+						 "%s: unable to append record values to recovered records array.",
+						 function );
+
+						goto on_error;
 					}
+					record_values = NULL;
+
+					libevtx_statistics_counter_add(
+					 io_handle->statistics_counters.number_of_recovered_records_parsed,
+					 1 );
 				}
 			}
-			chunk_data_offset += 4;
 		}
-		if( record_values != NULL )
+		chunk_data_offset += 4;
+	}
+	if( record_values != NULL )
+	{
+		if( libevtx_record_values_free(
+		     &record_values,
+		     error ) != 1 )
 		{
-			if( libevtx_record_values_free(
-			     &record_values,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free record values.",
-				 function );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record values.",
+			 function );
 
-				goto on_error;
-			}
+			goto on_error;
 		}
 	}
 	return( 1 );
@@ -943,13 +1094,6 @@ on_error:
 		 &record_values,
 		 NULL );
 	}
-	if( chunk->data != NULL )
-	{
-		memory_free(
-		 chunk->data );
-
-		chunk->data = NULL;
-	}
 	return( -1 );
 }
 
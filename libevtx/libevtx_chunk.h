@@ -79,6 +79,12 @@ int libevtx_chunk_read(
      off64_t file_offset,
      libcerror_error_t **error );
 
+int libevtx_chunk_read_recovered_records(
+     libevtx_chunk_t *chunk,
+     libevtx_io_handle_t *io_handle,
+     size_t chunk_data_offset,
+     libcerror_error_t **error );
+
 int libevtx_chunk_get_number_of_records(
      libevtx_chunk_t *chunk,
      uint16_t *number_of_records,
@@ -25,13 +25,16 @@
 
 #include "libevtx_chunk.h"
 #include "libevtx_chunks_table.h"
+#include "libevtx_definitions.h"
 #include "libevtx_io_handle.h"
 #include "libevtx_libbfio.h"
 #include "libevtx_libcerror.h"
 #include "libevtx_libfcache.h"
 #include "libevtx_libfdata.h"
+#include "libevtx_record_index.h"
 #include "libevtx_record_values.h"
-#include "libevtx_unused.h"
+#include "libevtx_statistics.h"
+#include "libevtx_trace.h"
 
 /* Creates a chunks table
  * Make sure the value chunks_table is referencing, is set to NULL
@@ -156,129 +159,145 @@ int libevtx_chunks_table_free(
 	return( result );
 }
 
-/* Reads a chunk
- * Callback function for the chunk vector
+/* Reads the record values of a specific record index entry
  * Returns 1 if successful or -1 on error
  */
 int libevtx_chunks_table_read_record(
-     intptr_t *io_handle,
+     libevtx_chunks_table_t *chunks_table,
      libbfio_handle_t *file_io_handle,
-     libfdata_list_element_t *list_element,
-     libfcache_cache_t *cache,
-     int data_range_file_index LIBEVTX_ATTRIBUTE_UNUSED,
-     off64_t data_range_offset,
-     size64_t data_range_size,
-     uint32_t data_range_flags LIBEVTX_ATTRIBUTE_UNUSED,
-     uint8_t read_flags LIBEVTX_ATTRIBUTE_UNUSED,
+     libevtx_record_index_entry_t *entry,
+     libevtx_record_values_t **record_values,
      libcerror_error_t **error )
 {
 	libevtx_chunk_t *chunk                       = NULL;
-	libevtx_chunks_table_t *chunks_table         = NULL;
 	libevtx_record_values_t *chunk_record_values = NULL;
-	libevtx_record_values_t *record_values       = NULL;
-	static char *function                        = "libevtx_io_handle_read_chunk";
-	size_t calculated_chunk_data_offset          = 0;
-	size_t chunk_data_offset                     = 0;
-	uint16_t number_of_records                   = 0;
-	uint16_t record_index                        = 0;
+	static char *function                        = "libevtx_chunks_table_read_record";
+	off64_t record_file_offset                   = 0;
+	uint64_t start_time                          = 0;
 
-	LIBEVTX_UNREFERENCED_PARAMETER( data_range_file_index );
-	LIBEVTX_UNREFERENCED_PARAMETER( data_range_flags );
-	LIBEVTX_UNREFERENCED_PARAMETER( read_flags );
-
-	if( io_handle == NULL )
+	if( chunks_table == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid IO handle.",
+		 "%s: invalid chunks table.",
 		 function );
 
 		return( -1 );
 	}
-	chunks_table = (libevtx_chunks_table_t *) io_handle;
-
-	/* The chunk index is stored in the data range size
-	*/
-	if( data_range_size > (uint64_t) UINT16_MAX )
+	if( chunks_table->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid data range size value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid chunks table - missing IO handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libfdata_vector_get_element_value_by_index(
-	     chunks_table->chunks_vector,
-	     (intptr_t *) file_io_handle,
-	     chunks_table->chunks_cache,
-	     (uint16_t) data_range_size,
-	     (intptr_t **) &chunk,
-	     0,
-	     error ) != 1 )
+	if( entry == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve chunk: %" PRIu64 ".",
-		 function,
-		 data_range_size );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record index entry.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( chunk == NULL )
+	if( ( entry->flags & LIBEVTX_RECORD_INDEX_ENTRY_FLAG_IS_REMOVED ) != 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing chunk: %" PRIu64 ".",
-		 function,
-		 data_range_size );
+		 "%s: invalid record index entry - record was removed.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( ( data_range_offset < chunk->file_offset )
-	 || ( data_range_offset >= (off64_t) ( chunk->file_offset + chunk->data_size ) ) )
+	if( record_values == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid chunk file offset value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	calculated_chunk_data_offset = (size_t) ( data_range_offset - chunk->file_offset );
+	if( *record_values != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record values value already set.",
+		 function );
+
+		return( -1 );
+	}
+	record_file_offset = chunks_table->io_handle->chunks_data_offset
+	                   + ( (off64_t) entry->chunk_index * chunks_table->io_handle->chunk_size )
+	                   + entry->chunk_data_offset;
+
+	libevtx_trace_begin(
+	 LIBEVTX_TRACE_EVENT_TYPE_RECORD_READ,
+	 (int) entry->chunk_index,
+	 record_file_offset,
+	 0 );
 
-	if( libevtx_chunk_get_number_of_records(
-	     chunk,
-	     &number_of_records,
+	libevtx_statistics_counter_add(
+	 chunks_table->io_handle->statistics_counters.number_of_record_cache_misses,
+	 1 );
+
+	libevtx_statistics_counter_add(
+	 chunks_table->io_handle->statistics_counters.number_of_chunk_lookups,
+	 1 );
+
+	if( libfdata_vector_get_element_value_by_index(
+	     chunks_table->chunks_vector,
+	     (intptr_t *) file_io_handle,
+	     chunks_table->chunks_cache,
+	     (int) entry->chunk_index,
+	     (intptr_t **) &chunk,
+	     0,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of records from chunk.",
-		 function );
+		 "%s: unable to retrieve chunk: %" PRIu16 ".",
+		 function,
+		 entry->chunk_index );
 
 		goto on_error;
 	}
-/* TODO optimize determining the corresponding record */
-	for( record_index = 0;
-	     record_index < number_of_records;
-	     record_index++ )
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing chunk: %" PRIu16 ".",
+		 function,
+		 entry->chunk_index );
+
+		goto on_error;
+	}
+	/* The record index entry refers to the record directly, hence the records
+	 * of the chunk do not need to be searched for one at a matching offset
+	 */
+	if( ( entry->flags & LIBEVTX_RECORD_INDEX_ENTRY_FLAG_IS_RECOVERED ) == 0 )
 	{
 		if( libevtx_chunk_get_record(
 		     chunk,
-		     record_index,
+		     entry->chunk_record_index,
 		     &chunk_record_values,
 		     error ) != 1 )
 		{
@@ -286,89 +305,48 @@ int libevtx_chunks_table_read_record(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve record: %" PRIu16 " from chunk.",
-			 function,
-			 record_index );
-
-			goto on_error;
-		}
-		if( chunk_record_values == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing record: %" PRIu16 ".",
+			 "%s: unable to retrieve record: %" PRIu16 " from chunk: %" PRIu16 ".",
 			 function,
-			 record_index );
+			 entry->chunk_record_index,
+			 entry->chunk_index );
 
 			goto on_error;
 		}
-		chunk_data_offset = chunk_record_values->chunk_data_offset;
-
-		if( calculated_chunk_data_offset == chunk_data_offset )
-		{
-			break;
-		}
 	}
-/* TODO allow to control look up in normal vs recovered */
-	if( calculated_chunk_data_offset != chunk_data_offset )
+	else
 	{
-		if( libevtx_chunk_get_number_of_recovered_records(
+		if( libevtx_chunk_get_recovered_record(
 		     chunk,
-		     &number_of_records,
+		     entry->chunk_record_index,
+		     &chunk_record_values,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of recovered records from chunk.",
-			 function );
+			 "%s: unable to retrieve recovered record: %" PRIu16 " from chunk: %" PRIu16 ".",
+			 function,
+			 entry->chunk_record_index,
+			 entry->chunk_index );
 
 			goto on_error;
 		}
-		for( record_index = 0;
-		     record_index < number_of_records;
-		     record_index++ )
-		{
-			if( libevtx_chunk_get_recovered_record(
-			     chunk,
-			     record_index,
-			     &chunk_record_values,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve recovered record: %" PRIu16 " from chunk.",
-				 function,
-				 record_index );
-
-				goto on_error;
-			}
-			if( chunk_record_values == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-				 "%s: missing recovered record: %" PRIu16 ".",
-				 function,
-				 record_index );
-
-				goto on_error;
-			}
-			chunk_data_offset = chunk_record_values->chunk_data_offset;
+	}
+	if( chunk_record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing record: %" PRIu16 " in chunk: %" PRIu16 ".",
+		 function,
+		 entry->chunk_record_index,
+		 entry->chunk_index );
 
-			if( calculated_chunk_data_offset == chunk_data_offset )
-			{
-				break;
-			}
-		}
+		goto on_error;
 	}
-	if( calculated_chunk_data_offset != chunk_data_offset )
+	if( chunk_record_values->chunk_data_offset != (size_t) entry->chunk_data_offset )
 	{
 		libcerror_error_set(
 		 error,
@@ -376,16 +354,16 @@ int libevtx_chunks_table_read_record(
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
 		 "%s: no record found at offset: %" PRIi64 ".",
 		 function,
-		 data_range_offset );
+		 record_file_offset );
 
 		goto on_error;
 	}
 	/* The record values are managed by the chunk and freed after usage
 	 * A copy is created to make sure that the records values that are passed
-	 * to the records list can be managed by the list
+	 * to the records cache can be managed by the cache
 	 */
 	if( libevtx_record_values_clone(
-	     &record_values,
+	     record_values,
 	     chunk_record_values,
 	     error ) != 1 )
 	{
@@ -398,8 +376,12 @@ int libevtx_chunks_table_read_record(
 
 		goto on_error;
 	}
+	( *record_values )->offset = record_file_offset;
+
+	start_time = libevtx_statistics_get_time();
+
 	if( libevtx_record_values_read_xml_document(
-	     record_values,
+	     *record_values,
 	     chunks_table->io_handle,
 	     chunk->data,
 	     chunk->data_size,
@@ -414,33 +396,229 @@ int libevtx_chunks_table_read_record(
 
 		goto on_error;
 	}
-	if( libfdata_list_element_set_element_value(
-	     list_element,
-	     (intptr_t *) file_io_handle,
-	     cache,
-	     (intptr_t *) record_values,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libevtx_record_values_free,
-	     LIBFDATA_LIST_ELEMENT_VALUE_FLAG_MANAGED,
+	libevtx_statistics_counter_add(
+	 chunks_table->io_handle->statistics_counters.xml_parse_time,
+	 libevtx_statistics_get_time() - start_time );
+
+	libevtx_statistics_counter_add(
+	 chunks_table->io_handle->statistics_counters.number_of_xml_documents_read,
+	 1 );
+
+	libevtx_trace_end(
+	 LIBEVTX_TRACE_EVENT_TYPE_RECORD_READ,
+	 (int) entry->chunk_index,
+	 record_file_offset,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	if( *record_values != NULL )
+	{
+		libevtx_record_values_free(
+		 record_values,
+		 NULL );
+	}
+	libevtx_trace_end(
+	 LIBEVTX_TRACE_EVENT_TYPE_RECORD_READ,
+	 (int) entry->chunk_index,
+	 record_file_offset,
+	 0 );
+
+	return( -1 );
+}
+
+/* Retrieves the record values of a specific entry of a record index
+ * The record values are read on demand and stored in the records cache
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunks_table_get_record_values_by_index(
+     libevtx_chunks_table_t *chunks_table,
+     libbfio_handle_t *file_io_handle,
+     libfcache_cache_t *records_cache,
+     libevtx_record_index_t *record_index,
+     int entry_index,
+     libevtx_record_values_t **record_values,
+     libcerror_error_t **error )
+{
+	libevtx_record_index_entry_t *entry    = NULL;
+	libevtx_record_values_t *cached_values = NULL;
+	libfcache_cache_value_t *cache_value   = NULL;
+	static char *function                  = "libevtx_chunks_table_get_record_values_by_index";
+	off64_t cache_value_offset             = 0;
+	int64_t cache_value_timestamp          = 0;
+	int cache_entry_index                  = 0;
+	int cache_value_file_index             = 0;
+	int number_of_cache_entries            = 0;
+
+	if( record_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record index.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_record_index_get_entry_by_index(
+	     record_index,
+	     entry_index,
+	     &entry,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set record values as element value.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record index entry: %d.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	if( libfcache_cache_get_number_of_entries(
+	     records_cache,
+	     &number_of_cache_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of cache entries.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	return( 1 );
+	if( number_of_cache_entries <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of cache entries value out of bounds.",
+		 function );
 
-on_error:
-	if( record_values != NULL )
+		return( -1 );
+	}
+	cache_entry_index = entry_index % number_of_cache_entries;
+
+	if( libfcache_cache_get_value_by_index(
+	     records_cache,
+	     cache_entry_index,
+	     &cache_value,
+	     error ) != 1 )
 	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cache entry: %d value.",
+		 function,
+		 cache_entry_index );
+
+		return( -1 );
+	}
+	if( cache_value != NULL )
+	{
+		if( libfcache_cache_value_get_identifier(
+		     cache_value,
+		     &cache_value_file_index,
+		     &cache_value_offset,
+		     &cache_value_timestamp,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve cache value identifier.",
+			 function );
+
+			return( -1 );
+		}
+		/* The entry index is used as the offset of the cache value identifier
+		 */
+		if( ( cache_value_file_index == record_index->cache_identifier )
+		 && ( cache_value_offset == (off64_t) entry_index ) )
+		{
+			if( libfcache_cache_value_get_value(
+			     cache_value,
+			     (intptr_t **) record_values,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve record values from cache value.",
+				 function );
+
+				return( -1 );
+			}
+			if( *record_values != NULL )
+			{
+				return( 1 );
+			}
+		}
+	}
+	if( libevtx_chunks_table_read_record(
+	     chunks_table,
+	     file_io_handle,
+	     entry,
+	     &cached_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read record: %d.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	if( libfcache_cache_set_value_by_index(
+	     records_cache,
+	     cache_entry_index,
+	     record_index->cache_identifier,
+	     (off64_t) entry_index,
+	     0,
+	     (intptr_t *) cached_values,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libevtx_record_values_free,
+	     LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set record values in cache entry: %d.",
+		 function,
+		 cache_entry_index );
+
 		libevtx_record_values_free(
-		 &record_values,
+		 &cached_values,
 		 NULL );
+
+		return( -1 );
 	}
-	return( -1 );
+	*record_values = cached_values;
+
+	return( 1 );
 }
 
@@ -30,6 +30,8 @@
 #include "libevtx_libcerror.h"
 #include "libevtx_libfcache.h"
 #include "libevtx_libfdata.h"
+#include "libevtx_record_index.h"
+#include "libevtx_record_values.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -64,15 +66,19 @@ int libevtx_chunks_table_free(
      libcerror_error_t **error );
 
 int libevtx_chunks_table_read_record(
-     intptr_t *io_handle,
+     libevtx_chunks_table_t *chunks_table,
      libbfio_handle_t *file_io_handle,
-     libfdata_list_element_t *list_element,
-     libfcache_cache_t *cache,
-     int data_range_file_index,
-     off64_t data_range_offset,
-     size64_t data_range_size,
-     uint32_t data_range_flags,
-     uint8_t read_flags,
+     libevtx_record_index_entry_t *entry,
+     libevtx_record_values_t **record_values,
+     libcerror_error_t **error );
+
+int libevtx_chunks_table_get_record_values_by_index(
+     libevtx_chunks_table_t *chunks_table,
+     libbfio_handle_t *file_io_handle,
+     libfcache_cache_t *records_cache,
+     libevtx_record_index_t *record_index,
+     int entry_index,
+     libevtx_record_values_t **record_values,
      libcerror_error_t **error );
 
 #if defined( __cplusplus )
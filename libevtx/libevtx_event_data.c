@@ -0,0 +1,860 @@
+/*
+ * Event data functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevtx_definitions.h"
+#include "libevtx_event_data.h"
+#include "libevtx_libcdata.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_libfvalue.h"
+#include "libevtx_libfwevt.h"
+#include "libevtx_names_table.h"
+
+/* Creates event data
+ * Make sure the value event_data is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_event_data_initialize(
+     libevtx_event_data_t **event_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_event_data_initialize";
+
+	if( event_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid event data.",
+		 function );
+
+		return( -1 );
+	}
+	if( *event_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid event data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*event_data = memory_allocate_structure(
+	               libevtx_event_data_t );
+
+	if( *event_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create event data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *event_data,
+	     0,
+	     sizeof( libevtx_event_data_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear event data.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *event_data != NULL )
+	{
+		memory_free(
+		 *event_data );
+
+		*event_data = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees event data
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_event_data_free(
+     libevtx_event_data_t **event_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_event_data_free";
+
+	if( event_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid event data.",
+		 function );
+
+		return( -1 );
+	}
+	if( *event_data != NULL )
+	{
+		/* The names are referenced and freed elsewhere
+		 */
+		if( ( *event_data )->utf8_names != NULL )
+		{
+			memory_free(
+			 ( *event_data )->utf8_names );
+		}
+		if( ( *event_data )->utf8_values != NULL )
+		{
+			memory_free(
+			 ( *event_data )->utf8_values );
+		}
+		if( ( *event_data )->value_types != NULL )
+		{
+			memory_free(
+			 ( *event_data )->value_types );
+		}
+		if( ( *event_data )->integer_values != NULL )
+		{
+			memory_free(
+			 ( *event_data )->integer_values );
+		}
+		if( ( *event_data )->utf8_values_data != NULL )
+		{
+			memory_free(
+			 ( *event_data )->utf8_values_data );
+		}
+		memory_free(
+		 *event_data );
+
+		*event_data = NULL;
+	}
+	return( 1 );
+}
+
+/* Retrieves the value type of a XML tag
+ * The integer value is set for integer and boolean value types, otherwise it is 0
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_event_data_get_value_type(
+     libfwevt_xml_tag_t *xml_tag,
+     uint8_t *value_type,
+     uint64_t *integer_value,
+     libcerror_error_t **error )
+{
+	libfvalue_value_t *value = NULL;
+	static char *function    = "libevtx_event_data_get_value_type";
+	int fvalue_value_type    = 0;
+	int result               = 0;
+
+	if( value_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value type.",
+		 function );
+
+		return( -1 );
+	}
+	if( integer_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid integer value.",
+		 function );
+
+		return( -1 );
+	}
+	*value_type    = LIBEVTX_EVENT_DATA_VALUE_TYPE_NULL;
+	*integer_value = 0;
+
+	if( libfwevt_xml_tag_get_value(
+	     xml_tag,
+	     &value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		return( 1 );
+	}
+	result = libfvalue_value_has_data(
+	          value,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if value has data.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 1 );
+	}
+	if( libfvalue_value_get_type(
+	     value,
+	     &fvalue_value_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value type.",
+		 function );
+
+		return( -1 );
+	}
+	switch( fvalue_value_type )
+	{
+		case LIBFVALUE_VALUE_TYPE_STRING_BYTE_STREAM:
+		case LIBFVALUE_VALUE_TYPE_STRING_UTF8:
+		case LIBFVALUE_VALUE_TYPE_STRING_UTF16:
+		case LIBFVALUE_VALUE_TYPE_STRING_UTF32:
+			*value_type = LIBEVTX_EVENT_DATA_VALUE_TYPE_STRING;
+			break;
+
+		case LIBFVALUE_VALUE_TYPE_INTEGER_8BIT:
+		case LIBFVALUE_VALUE_TYPE_INTEGER_16BIT:
+		case LIBFVALUE_VALUE_TYPE_INTEGER_32BIT:
+		case LIBFVALUE_VALUE_TYPE_INTEGER_64BIT:
+			*value_type = LIBEVTX_EVENT_DATA_VALUE_TYPE_SIGNED_INTEGER;
+			break;
+
+		case LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_8BIT:
+		case LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_16BIT:
+		case LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_32BIT:
+		case LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_64BIT:
+			*value_type = LIBEVTX_EVENT_DATA_VALUE_TYPE_UNSIGNED_INTEGER;
+			break;
+
+		case LIBFVALUE_VALUE_TYPE_FLOATING_POINT_32BIT:
+		case LIBFVALUE_VALUE_TYPE_FLOATING_POINT_64BIT:
+			*value_type = LIBEVTX_EVENT_DATA_VALUE_TYPE_FLOATING_POINT;
+			break;
+
+		case LIBFVALUE_VALUE_TYPE_BOOLEAN:
+			*value_type = LIBEVTX_EVENT_DATA_VALUE_TYPE_BOOLEAN;
+			break;
+
+		case LIBFVALUE_VALUE_TYPE_BINARY_DATA:
+			*value_type = LIBEVTX_EVENT_DATA_VALUE_TYPE_BINARY_DATA;
+			break;
+
+		case LIBFVALUE_VALUE_TYPE_GUID:
+			*value_type = LIBEVTX_EVENT_DATA_VALUE_TYPE_GUID;
+			break;
+
+		case LIBFVALUE_VALUE_TYPE_FILETIME:
+			*value_type = LIBEVTX_EVENT_DATA_VALUE_TYPE_FILETIME;
+			break;
+
+		case LIBFVALUE_VALUE_TYPE_SYSTEMTIME:
+			*value_type = LIBEVTX_EVENT_DATA_VALUE_TYPE_SYSTEMTIME;
+			break;
+
+		case LIBFVALUE_VALUE_TYPE_NT_SECURITY_IDENTIFIER:
+			*value_type = LIBEVTX_EVENT_DATA_VALUE_TYPE_NT_SECURITY_IDENTIFIER;
+			break;
+
+		default:
+			*value_type = LIBEVTX_EVENT_DATA_VALUE_TYPE_UNDEFINED;
+			break;
+	}
+	if( ( *value_type == LIBEVTX_EVENT_DATA_VALUE_TYPE_SIGNED_INTEGER )
+	 || ( *value_type == LIBEVTX_EVENT_DATA_VALUE_TYPE_UNSIGNED_INTEGER )
+	 || ( *value_type == LIBEVTX_EVENT_DATA_VALUE_TYPE_BOOLEAN ) )
+	{
+		if( libfvalue_value_copy_to_64bit(
+		     value,
+		     0,
+		     integer_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy value to 64-bit integer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Reads the event data from the strings array
+ * The name of a value is the Name attribute of a Data element or otherwise
+ * the name of the element or attribute that contains the value
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_event_data_read(
+     libevtx_event_data_t *event_data,
+     libcdata_array_t *strings_array,
+     libevtx_names_table_t *names_table,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_tag_t *name_xml_tag   = NULL;
+	libfwevt_xml_tag_t *string_xml_tag = NULL;
+	uint8_t *name_string               = NULL;
+	uint8_t *reallocation              = NULL;
+	size_t *utf8_value_sizes           = NULL;
+	static char *function              = "libevtx_event_data_read";
+	size_t name_string_size            = 0;
+	size_t name_size                   = 0;
+	size_t utf8_values_data_offset     = 0;
+	int number_of_values               = 0;
+	int result                         = 0;
+	int value_index                    = 0;
+
+	if( event_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid event data.",
+		 function );
+
+		return( -1 );
+	}
+	if( event_data->utf8_names != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid event data - UTF-8 names value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     strings_array,
+	     &number_of_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of strings.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_values == 0 )
+	{
+		return( 1 );
+	}
+	if( ( number_of_values < 0 )
+	 || ( (size_t) number_of_values > ( (size_t) SSIZE_MAX / sizeof( uint64_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of values value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	event_data->utf8_names = (const uint8_t **) memory_allocate(
+	                                             sizeof( const uint8_t * ) * number_of_values );
+
+	if( event_data->utf8_names == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create UTF-8 names.",
+		 function );
+
+		goto on_error;
+	}
+	event_data->utf8_values = (const uint8_t **) memory_allocate(
+	                                              sizeof( const uint8_t * ) * number_of_values );
+
+	if( event_data->utf8_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create UTF-8 values.",
+		 function );
+
+		goto on_error;
+	}
+	event_data->value_types = (uint8_t *) memory_allocate(
+	                                       sizeof( uint8_t ) * number_of_values );
+
+	if( event_data->value_types == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create value types.",
+		 function );
+
+		goto on_error;
+	}
+	event_data->integer_values = (uint64_t *) memory_allocate(
+	                                           sizeof( uint64_t ) * number_of_values );
+
+	if( event_data->integer_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create integer values.",
+		 function );
+
+		goto on_error;
+	}
+	utf8_value_sizes = (size_t *) memory_allocate(
+	                               sizeof( size_t ) * number_of_values );
+
+	if( utf8_value_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create UTF-8 value sizes.",
+		 function );
+
+		goto on_error;
+	}
+	/* Determine the names, value types and the size of the values data
+	 */
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     strings_array,
+		     value_index,
+		     (intptr_t **) &string_xml_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve string: %d.",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+		if( libfwevt_xml_tag_get_utf8_name_size(
+		     string_xml_tag,
+		     &name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve string: %d name size.",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+		if( ( name_size == 0 )
+		 || ( name_size > (size_t) SSIZE_MAX ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid string: %d name size value out of bounds.",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+		if( name_string_size < name_size )
+		{
+			reallocation = (uint8_t *) memory_reallocate(
+			                            name_string,
+			                            sizeof( uint8_t ) * name_size );
+
+			if( reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize name string.",
+				 function );
+
+				goto on_error;
+			}
+			name_string      = reallocation;
+			name_string_size = name_size;
+		}
+		if( libfwevt_xml_tag_get_utf8_name(
+		     string_xml_tag,
+		     name_string,
+		     name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve string: %d name.",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+		/* Data elements are named by their Name attribute
+		 */
+		result = 0;
+
+		if( ( name_size == 5 )
+		 && ( memory_compare(
+		       name_string,
+		       "Data",
+		       4 ) == 0 ) )
+		{
+			result = libfwevt_xml_tag_get_attribute_by_utf8_name(
+			          string_xml_tag,
+			          (uint8_t *) "Name",
+			          4,
+			          &name_xml_tag,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve string: %d Name attribute.",
+				 function,
+				 value_index );
+
+				goto on_error;
+			}
+		}
+		if( result != 0 )
+		{
+			if( libfwevt_xml_tag_get_utf8_value_size(
+			     name_xml_tag,
+			     &name_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve string: %d Name attribute value size.",
+				 function,
+				 value_index );
+
+				goto on_error;
+			}
+			if( ( name_size == 0 )
+			 || ( name_size > (size_t) SSIZE_MAX ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid string: %d name size value out of bounds.",
+				 function,
+				 value_index );
+
+				goto on_error;
+			}
+			if( name_string_size < name_size )
+			{
+				reallocation = (uint8_t *) memory_reallocate(
+				                            name_string,
+				                            sizeof( uint8_t ) * name_size );
+
+				if( reallocation == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to resize name string.",
+					 function );
+
+					goto on_error;
+				}
+				name_string      = reallocation;
+				name_string_size = name_size;
+			}
+			if( libfwevt_xml_tag_get_utf8_value(
+			     name_xml_tag,
+			     name_string,
+			     name_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve string: %d Name attribute value.",
+				 function,
+				 value_index );
+
+				goto on_error;
+			}
+		}
+		if( libevtx_names_table_get_utf8_name(
+		     names_table,
+		     name_string,
+		     name_size,
+		     &( event_data->utf8_names[ value_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve string: %d interned name.",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+		if( libevtx_event_data_get_value_type(
+		     string_xml_tag,
+		     &( event_data->value_types[ value_index ] ),
+		     &( event_data->integer_values[ value_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve string: %d value type.",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+		utf8_value_sizes[ value_index ] = 0;
+
+		if( event_data->value_types[ value_index ] != LIBEVTX_EVENT_DATA_VALUE_TYPE_NULL )
+		{
+			if( libfwevt_xml_tag_get_utf8_value_size(
+			     string_xml_tag,
+			     &( utf8_value_sizes[ value_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve string: %d value size.",
+				 function,
+				 value_index );
+
+				goto on_error;
+			}
+		}
+		/* Values without data are stored as an empty string
+		 */
+		if( utf8_value_sizes[ value_index ] == 0 )
+		{
+			utf8_value_sizes[ value_index ] = 1;
+		}
+		if( utf8_value_sizes[ value_index ] > ( (size_t) SSIZE_MAX - event_data->utf8_values_data_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid UTF-8 values data size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		event_data->utf8_values_data_size += utf8_value_sizes[ value_index ];
+	}
+	memory_free(
+	 name_string );
+
+	name_string = NULL;
+
+	/* All values are stored in a single buffer
+	 */
+	event_data->utf8_values_data = (uint8_t *) memory_allocate(
+	                                            sizeof( uint8_t ) * event_data->utf8_values_data_size );
+
+	if( event_data->utf8_values_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create UTF-8 values data.",
+		 function );
+
+		goto on_error;
+	}
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		event_data->utf8_values[ value_index ] = &( event_data->utf8_values_data[ utf8_values_data_offset ] );
+
+		if( utf8_value_sizes[ value_index ] == 1 )
+		{
+			event_data->utf8_values_data[ utf8_values_data_offset ] = 0;
+		}
+		else
+		{
+			if( libcdata_array_get_entry_by_index(
+			     strings_array,
+			     value_index,
+			     (intptr_t **) &string_xml_tag,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve string: %d.",
+				 function,
+				 value_index );
+
+				goto on_error;
+			}
+			if( libfwevt_xml_tag_get_utf8_value(
+			     string_xml_tag,
+			     &( event_data->utf8_values_data[ utf8_values_data_offset ] ),
+			     utf8_value_sizes[ value_index ],
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve string: %d value.",
+				 function,
+				 value_index );
+
+				goto on_error;
+			}
+		}
+		utf8_values_data_offset += utf8_value_sizes[ value_index ];
+	}
+	memory_free(
+	 utf8_value_sizes );
+
+	event_data->number_of_values = number_of_values;
+
+	return( 1 );
+
+on_error:
+	if( utf8_value_sizes != NULL )
+	{
+		memory_free(
+		 utf8_value_sizes );
+	}
+	if( name_string != NULL )
+	{
+		memory_free(
+		 name_string );
+	}
+	if( event_data->utf8_values_data != NULL )
+	{
+		memory_free(
+		 event_data->utf8_values_data );
+
+		event_data->utf8_values_data = NULL;
+	}
+	if( event_data->integer_values != NULL )
+	{
+		memory_free(
+		 event_data->integer_values );
+
+		event_data->integer_values = NULL;
+	}
+	if( event_data->value_types != NULL )
+	{
+		memory_free(
+		 event_data->value_types );
+
+		event_data->value_types = NULL;
+	}
+	if( event_data->utf8_values != NULL )
+	{
+		memory_free(
+		 event_data->utf8_values );
+
+		event_data->utf8_values = NULL;
+	}
+	if( event_data->utf8_names != NULL )
+	{
+		memory_free(
+		 event_data->utf8_names );
+
+		event_data->utf8_names = NULL;
+	}
+	event_data->utf8_values_data_size = 0;
+
+	return( -1 );
+}
+
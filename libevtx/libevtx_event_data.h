@@ -0,0 +1,97 @@
+/*
+ * Event data functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_EVENT_DATA_H )
+#define _LIBEVTX_EVENT_DATA_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_libcdata.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_libfwevt.h"
+#include "libevtx_names_table.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libevtx_event_data libevtx_event_data_t;
+
+struct libevtx_event_data
+{
+	/* The number of values
+	 */
+	int number_of_values;
+
+	/* The UTF-8 encoded names
+	 * The names are references to the names table
+	 */
+	const uint8_t **utf8_names;
+
+	/* The UTF-8 encoded values
+	 * The values are references to the values data
+	 */
+	const uint8_t **utf8_values;
+
+	/* The value types
+	 */
+	uint8_t *value_types;
+
+	/* The integer values
+	 */
+	uint64_t *integer_values;
+
+	/* The UTF-8 encoded values data
+	 */
+	uint8_t *utf8_values_data;
+
+	/* The UTF-8 encoded values data size
+	 */
+	size_t utf8_values_data_size;
+};
+
+int libevtx_event_data_initialize(
+     libevtx_event_data_t **event_data,
+     libcerror_error_t **error );
+
+int libevtx_event_data_free(
+     libevtx_event_data_t **event_data,
+     libcerror_error_t **error );
+
+int libevtx_event_data_get_value_type(
+     libfwevt_xml_tag_t *xml_tag,
+     uint8_t *value_type,
+     uint64_t *integer_value,
+     libcerror_error_t **error );
+
+int libevtx_event_data_read(
+     libevtx_event_data_t *event_data,
+     libcdata_array_t *strings_array,
+     libevtx_names_table_t *names_table,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_EVENT_DATA_H ) */
+
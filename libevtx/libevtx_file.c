@@ -20,6 +20,7 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <memory.h>
 #include <narrow_string.h>
 #include <types.h>
@@ -31,6 +32,7 @@
 #include "libevtx_debug.h"
 #include "libevtx_definitions.h"
 #include "libevtx_i18n.h"
+#include "libevtx_index_file.h"
 #include "libevtx_io_handle.h"
 #include "libevtx_file.h"
 #include "libevtx_libbfio.h"
@@ -38,8 +40,15 @@
 #include "libevtx_libcnotify.h"
 #include "libevtx_libfcache.h"
 #include "libevtx_libfdata.h"
+#include "libevtx_names_table.h"
 #include "libevtx_record.h"
+#include "libevtx_record_index.h"
 #include "libevtx_record_values.h"
+#include "libevtx_statistics.h"
+#include "libevtx_trace.h"
+#include "libevtx_types.h"
+
+#include "evtx_chunk.h"
 
 /* Creates a file
  * Make sure the value file is referencing, is set to NULL
@@ -193,6 +202,22 @@ int libevtx_file_free(
 		}
 		*file = NULL;
 
+		if( internal_file->index_file_io_handle != NULL )
+		{
+			if( libbfio_handle_free(
+			     &( internal_file->index_file_io_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free index file IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( libevtx_io_handle_free(
 		     &( internal_file->io_handle ),
 		     error ) != 1 )
@@ -543,8 +568,10 @@ int libevtx_file_open_file_io_handle(
 	libevtx_internal_file_t *internal_file = NULL;
 	static char *function                  = "libevtx_file_open_file_io_handle";
 	int bfio_access_flags                  = 0;
+	uint64_t start_time                    = 0;
 	int file_io_handle_is_open             = 0;
 	int file_io_handle_opened_in_library   = 0;
+	int result                             = 0;
 
 	if( file == NULL )
 	{
@@ -641,10 +668,26 @@ int libevtx_file_open_file_io_handle(
 		}
 		file_io_handle_opened_in_library = 1;
 	}
-	if( libevtx_file_open_read(
-	     internal_file,
-	     file_io_handle,
-	     error ) != 1 )
+	start_time = libevtx_statistics_get_time();
+
+	libevtx_trace_begin(
+	 LIBEVTX_TRACE_EVENT_TYPE_FILE_OPEN,
+	 -1,
+	 0,
+	 0 );
+
+	result = libevtx_file_open_read(
+	          internal_file,
+	          file_io_handle,
+	          error );
+
+	libevtx_trace_end(
+	 LIBEVTX_TRACE_EVENT_TYPE_FILE_OPEN,
+	 -1,
+	 0,
+	 0 );
+
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -655,6 +698,10 @@ int libevtx_file_open_file_io_handle(
 
 		goto on_error;
 	}
+	libevtx_statistics_counter_add(
+	 internal_file->io_handle->statistics_counters.open_time,
+	 libevtx_statistics_get_time() - start_time );
+
 	internal_file->file_io_handle                   = file_io_handle;
 	internal_file->file_io_handle_opened_in_library = file_io_handle_opened_in_library;
 
@@ -670,6 +717,254 @@ on_error:
 	return( -1 );
 }
 
+/* Sets the filename of the index file
+ * The index file contains the records index of the file, which allows to skip
+ * scanning the chunks when the file is opened again and has not changed.
+ * The index file is read on open, if it exists, and (re)written otherwise.
+ * This function must be called before the file is opened
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_set_index_filename(
+     libevtx_file_t *file,
+     const char *filename,
+     size_t filename_length,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *index_file_io_handle = NULL;
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_set_index_filename";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( filename_length == 0 )
+	 || ( filename_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid filename length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &index_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_set_name(
+	     index_file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_file->index_file_io_handle != NULL )
+	{
+		if( libbfio_handle_free(
+		     &( internal_file->index_file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free index file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	internal_file->index_file_io_handle = index_file_io_handle;
+
+	return( 1 );
+
+on_error:
+	if( index_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &index_file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Sets the filename of the index file
+ * The index file contains the records index of the file, which allows to skip
+ * scanning the chunks when the file is opened again and has not changed.
+ * The index file is read on open, if it exists, and (re)written otherwise.
+ * This function must be called before the file is opened
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_set_index_filename_wide(
+     libevtx_file_t *file,
+     const wchar_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *index_file_io_handle = NULL;
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_set_index_filename_wide";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( filename_length == 0 )
+	 || ( filename_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid filename length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &index_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_set_name_wide(
+	     index_file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_file->index_file_io_handle != NULL )
+	{
+		if( libbfio_handle_free(
+		     &( internal_file->index_file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free index file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	internal_file->index_file_io_handle = index_file_io_handle;
+
+	return( 1 );
+
+on_error:
+	if( index_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &index_file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
 /* Closes a file
  * Returns 0 if successful or -1 on error
  */
@@ -775,28 +1070,54 @@ int libevtx_file_close(
 
 		result = -1;
 	}
-	if( libfdata_list_free(
-	     &( internal_file->recovered_records_list ),
+	if( libevtx_index_file_free(
+	     &( internal_file->index_file ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free index file.",
+		 function );
+
+		result = -1;
+	}
+	if( libevtx_record_index_free(
+	     &( internal_file->recovered_records_index ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free recovered records index.",
+		 function );
+
+		result = -1;
+	}
+	if( libevtx_record_index_free(
+	     &( internal_file->records_index ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free recovered records list.",
+		 "%s: unable to free records index.",
 		 function );
 
 		result = -1;
 	}
-	if( libfdata_list_free(
-	     &( internal_file->records_list ),
+	if( libevtx_chunks_table_free(
+	     &( internal_file->chunks_table ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free records list.",
+		 "%s: unable to free chunks table.",
 		 function );
 
 		result = -1;
@@ -851,28 +1172,10 @@ int libevtx_file_open_read(
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error )
 {
-	libevtx_chunk_t *chunk                 = NULL;
-	libevtx_record_values_t *record_values = NULL;
-	libevtx_chunks_table_t *chunks_table   = NULL;
-	static char *function                  = "libevtx_file_open_read";
-	off64_t file_offset                    = 0;
-	size64_t file_size                     = 0;
-	uint16_t chunk_index                   = 0;
-	uint16_t number_of_chunks              = 0;
-	uint16_t number_of_records             = 0;
-	uint16_t record_index                  = 0;
-	int element_index                      = 0;
-	int result                             = 0;
-	int segment_index                      = 0;
-
-#if defined( HAVE_VERBOSE_OUTPUT )
-	uint64_t previous_record_identifier    = 0;
-#endif
-#if defined( HAVE_DEBUG_OUTPUT )
-	uint8_t *trailing_data                 = NULL;
-	size_t trailing_data_size              = 0;
-	ssize_t read_count                     = 0;
-#endif
+	static char *function = "libevtx_file_open_read";
+	size64_t file_size    = 0;
+	int result            = 0;
+	int segment_index     = 0;
 
 	if( internal_file == NULL )
 	{
@@ -918,24 +1221,46 @@ int libevtx_file_open_read(
 
 		return( -1 );
 	}
-	if( internal_file->records_list != NULL )
+	if( internal_file->chunks_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - chunks table already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->records_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - records index already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->recovered_records_index != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - records list already set.",
+		 "%s: invalid file - recovered records index already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_file->recovered_records_list != NULL )
+	if( internal_file->index_file != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - recovered records list already set.",
+		 "%s: invalid file - index file already set.",
 		 function );
 
 		return( -1 );
@@ -951,6 +1276,17 @@ int libevtx_file_open_read(
 
 		return( -1 );
 	}
+	if( internal_file->io_handle->names_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - names table already set.",
+		 function );
+
+		return( -1 );
+	}
 	if( libbfio_handle_get_size(
 	     file_io_handle,
 	     &file_size,
@@ -990,6 +1326,23 @@ int libevtx_file_open_read(
 	internal_file->io_handle->chunks_data_size = file_size
 	                                           - internal_file->io_handle->chunks_data_offset;
 
+	/* The names table is created before any record can be retrieved
+	 * since it is shared by the records of the file
+	 */
+	if( libevtx_names_table_initialize(
+	     &( internal_file->io_handle->names_table ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create names table.",
+		 function );
+
+		goto on_error;
+	}
+
 /* TODO clone function ? */
 	if( libfdata_vector_initialize(
 	     &( internal_file->chunks_vector ),
@@ -1051,7 +1404,7 @@ int libevtx_file_open_read(
 	}
 #endif
 	if( libevtx_chunks_table_initialize(
-	     &chunks_table,
+	     &( internal_file->chunks_table ),
 	     internal_file->io_handle,
 	     internal_file->chunks_vector,
 	     internal_file->chunks_cache,
@@ -1066,51 +1419,37 @@ int libevtx_file_open_read(
 
 		goto on_error;
 	}
-/* TODO clone function ? */
-	if( libfdata_list_initialize(
-	     &( internal_file->records_list ),
-	     (intptr_t *) chunks_table,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libevtx_chunks_table_free,
-	     NULL,
-	     (int (*)(intptr_t *, intptr_t *, libfdata_list_element_t *, libfcache_cache_t *, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libevtx_chunks_table_read_record,
-	     NULL,
-	     LIBFDATA_DATA_HANDLE_FLAG_MANAGED,
+	/* The records and recovered records share the records cache
+	 * hence their indexes use a different cache identifier
+	 */
+	if( libevtx_record_index_initialize(
+	     &( internal_file->records_index ),
+	     0,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create records list.",
+		 "%s: unable to create records index.",
 		 function );
 
 		goto on_error;
 	}
-	/* The chunks_table is managed by the list */
-
-	if( libfdata_list_initialize(
-	     &( internal_file->recovered_records_list ),
-	     (intptr_t *) chunks_table,
-	     NULL,
-	     NULL,
-	     (int (*)(intptr_t *, intptr_t *, libfdata_list_element_t *, libfcache_cache_t *, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libevtx_chunks_table_read_record,
-	     NULL,
-	     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+	if( libevtx_record_index_initialize(
+	     &( internal_file->recovered_records_index ),
+	     1,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create recovered records list.",
+		 "%s: unable to create recovered records index.",
 		 function );
 
-		chunks_table = NULL;
-
 		goto on_error;
 	}
-	chunks_table = NULL;
-
 	if( libfcache_cache_initialize(
 	     &( internal_file->records_cache ),
 	     LIBEVTX_MAXIMUM_CACHE_ENTRIES_RECORDS,
@@ -1125,6 +1464,218 @@ int libevtx_file_open_read(
 
 		goto on_error;
 	}
+	if( libevtx_index_file_initialize(
+	     &( internal_file->index_file ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create index file.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_file->index_file_io_handle != NULL )
+	{
+		result = libevtx_index_file_read(
+		          internal_file->index_file,
+		          internal_file->io_handle,
+		          file_io_handle,
+		          file_size,
+		          internal_file->records_index,
+		          internal_file->recovered_records_index,
+		          internal_file->index_file_io_handle,
+		          error );
+
+		/* A missing, stale or unreadable index file is not fatal
+		 * since the chunks can be scanned instead
+		 */
+		if( result == -1 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+#endif
+			libcerror_error_free(
+			 error );
+
+			result = 0;
+		}
+	}
+	if( result == 0 )
+	{
+		if( libevtx_file_read_chunks(
+		     internal_file,
+		     file_io_handle,
+		     file_size,
+		     internal_file->index_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read chunks.",
+			 function );
+
+			goto on_error;
+		}
+		if( internal_file->index_file_io_handle != NULL )
+		{
+			if( libevtx_index_file_write(
+			     internal_file->index_file,
+			     internal_file->io_handle,
+			     file_size,
+			     internal_file->records_index,
+			     internal_file->recovered_records_index,
+			     internal_file->index_file_io_handle,
+			     error ) != 1 )
+			{
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
+#endif
+				libcerror_error_free(
+				 error );
+			}
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( internal_file->index_file != NULL )
+	{
+		libevtx_index_file_free(
+		 &( internal_file->index_file ),
+		 NULL );
+	}
+	if( internal_file->records_cache != NULL )
+	{
+		libfcache_cache_free(
+		 &( internal_file->records_cache ),
+		 NULL );
+	}
+	if( internal_file->recovered_records_index != NULL )
+	{
+		libevtx_record_index_free(
+		 &( internal_file->recovered_records_index ),
+		 NULL );
+	}
+	if( internal_file->records_index != NULL )
+	{
+		libevtx_record_index_free(
+		 &( internal_file->records_index ),
+		 NULL );
+	}
+	if( internal_file->chunks_table != NULL )
+	{
+		libevtx_chunks_table_free(
+		 &( internal_file->chunks_table ),
+		 NULL );
+	}
+	if( internal_file->chunks_cache != NULL )
+	{
+		libfcache_cache_free(
+		 &( internal_file->chunks_cache ),
+		 NULL );
+	}
+	if( internal_file->chunks_vector != NULL )
+	{
+		libfdata_vector_free(
+		 &( internal_file->chunks_vector ),
+		 NULL );
+	}
+	if( internal_file->io_handle->names_table != NULL )
+	{
+		libevtx_names_table_free(
+		 &( internal_file->io_handle->names_table ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the chunks and fills the records indexes
+ * The index file is optional and when set receives an entry for every chunk read
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_read_chunks(
+     libevtx_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     size64_t file_size,
+     libevtx_index_file_t *index_file,
+     libcerror_error_t **error )
+{
+	libevtx_chunk_t *chunk                 = NULL;
+	libevtx_record_values_t *record_values = NULL;
+	static char *function                  = "libevtx_file_read_chunks";
+	off64_t file_offset                    = 0;
+	uint16_t chunk_index                   = 0;
+	uint16_t number_of_chunks              = 0;
+	uint16_t number_of_records             = 0;
+	uint16_t record_index                  = 0;
+	int result                             = 0;
+
+#if defined( HAVE_VERBOSE_OUTPUT )
+	uint64_t previous_record_identifier    = 0;
+#endif
+#if defined( HAVE_DEBUG_OUTPUT )
+	uint8_t *trailing_data                 = NULL;
+	size_t trailing_data_size              = 0;
+	ssize_t read_count                     = 0;
+#endif
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->records_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing records index.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->recovered_records_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing recovered records index.",
+		 function );
+
+		return( -1 );
+	}
 	file_offset = internal_file->io_handle->chunks_data_offset;
 
 	while( ( file_offset + internal_file->io_handle->chunk_size ) <= (off64_t) file_size )
@@ -1282,17 +1833,14 @@ int libevtx_file_open_read(
 					}
 				}
 #endif
-				/* The chunk index is stored in the element data size
-				 */
 				if( ( chunk_index < internal_file->io_handle->number_of_chunks )
 				 || ( ( internal_file->io_handle->file_flags & LIBEVTX_FILE_FLAG_IS_DIRTY ) != 0 ) )
 				{
-					if( libfdata_list_append_element(
-					     internal_file->records_list,
-					     &element_index,
-					     0,
-					     file_offset + record_values->chunk_data_offset,
-					     (size64_t) chunk_index,
+					if( libevtx_record_index_append_entry(
+					     internal_file->records_index,
+					     chunk_index,
+					     record_values->chunk_data_offset,
+					     record_index,
 					     0,
 					     error ) != 1 )
 					{
@@ -1300,7 +1848,7 @@ int libevtx_file_open_read(
 						 error,
 						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 						 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-						 "%s: unable to append element to records list.",
+						 "%s: unable to append entry to records index.",
 						 function );
 
 						goto on_error;
@@ -1311,12 +1859,11 @@ int libevtx_file_open_read(
 					/* If the file is not dirty, records found in chunks outside the indicated
 					 * range are considered recovered
 					 */
-					if( libfdata_list_append_element(
-					     internal_file->recovered_records_list,
-					     &element_index,
-					     0,
-					     file_offset + record_values->chunk_data_offset,
-					     (size64_t) chunk_index,
+					if( libevtx_record_index_append_entry(
+					     internal_file->recovered_records_index,
+					     chunk_index,
+					     record_values->chunk_data_offset,
+					     record_index,
 					     0,
 					     error ) != 1 )
 					{
@@ -1324,7 +1871,7 @@ int libevtx_file_open_read(
 						 error,
 						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 						 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-						 "%s: unable to append element to recovered records list.",
+						 "%s: unable to append entry to recovered records index.",
 						 function );
 
 						goto on_error;
@@ -1382,168 +1929,1007 @@ int libevtx_file_open_read(
 					goto on_error;
 				}
 /* TODO check for and remove duplicate identifiers ? */
-				/* The chunk index is stored in the element data size
-				 */
-				if( libfdata_list_append_element(
-				     internal_file->recovered_records_list,
-				     &element_index,
-				     0,
-				     file_offset + record_values->chunk_data_offset,
-				     (size64_t) chunk_index,
-				     0,
+				if( libevtx_record_index_append_entry(
+				     internal_file->recovered_records_index,
+				     chunk_index,
+				     record_values->chunk_data_offset,
+				     record_index,
+				     LIBEVTX_RECORD_INDEX_ENTRY_FLAG_IS_RECOVERED,
 				     error ) != 1 )
 				{
 					libcerror_error_set(
 					 error,
 					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-					 "%s: unable to append element to recovered records list.",
+					 "%s: unable to append entry to recovered records index.",
 					 function );
 
 					goto on_error;
 				}
 			}
 		}
-		file_offset += chunk->data_size;
+		if( index_file != NULL )
+		{
+			if( libevtx_index_file_append_chunk_entry(
+			     index_file,
+			     chunk,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append chunk: %" PRIu16 " entry to index file.",
+				 function,
+				 chunk_index );
+
+				goto on_error;
+			}
+		}
+		file_offset += chunk->data_size;
+
+		if( libevtx_chunk_free(
+		     &chunk,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free chunk: %" PRIu16 ".",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		chunk_index++;
+	}
+	internal_file->io_handle->chunks_data_size = file_offset
+	                                           - internal_file->io_handle->chunks_data_offset;
+
+	if( number_of_chunks != internal_file->io_handle->number_of_chunks )
+	{
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: mismatch in number of chunks ( %" PRIu16 " != %" PRIu16 " ).\n",
+			 function,
+			 internal_file->io_handle->number_of_chunks,
+			 chunk_index );
+		}
+#endif
+		internal_file->io_handle->flags |= LIBEVTX_IO_HANDLE_FLAG_IS_CORRUPTED;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		if( file_offset < (off64_t) file_size )
+		{
+			trailing_data_size = (size_t) ( file_size - file_offset );
+
+			trailing_data = (uint8_t *) memory_allocate(
+			                             sizeof( uint8_t ) * trailing_data_size );
+
+			if( trailing_data == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create trailing data.",
+				 function );
+
+				goto on_error;
+			}
+			read_count = libevtx_io_handle_read_data_at_offset(
+				      internal_file->io_handle,
+				      file_io_handle,
+				      file_offset,
+				      trailing_data,
+				      trailing_data_size,
+				      error );
+
+			if( read_count != (ssize_t) trailing_data_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read trailing data.",
+				 function );
+
+				memory_free(
+				 trailing_data );
+
+				goto on_error;
+			}
+			file_offset += read_count;
+
+			libcnotify_printf(
+			 "%s: trailing data:\n",
+			 function );
+			libcnotify_print_data(
+			 trailing_data,
+			 trailing_data_size,
+			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+
+			memory_free(
+			 trailing_data );
+
+			trailing_data = NULL;
+		}
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( trailing_data != NULL )
+	{
+		memory_free(
+		 trailing_data );
+	}
+#endif
+	if( chunk != NULL )
+	{
+		libevtx_chunk_free(
+		 &chunk,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads a chunk if it was added or changed since it was last read
+ * The was in range value indicates if the records of the chunk were previously
+ * stored in the records index instead of the recovered records index
+ * Returns 1 if the chunk was read, 0 if the chunk was not changed or -1 on error
+ */
+int libevtx_file_read_changed_chunk(
+     libevtx_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     uint16_t chunk_index,
+     off64_t file_offset,
+     uint8_t was_in_range,
+     libcerror_error_t **error )
+{
+	uint8_t header_checksum_data[ 4 ];
+
+	libevtx_chunk_t *chunk                        = NULL;
+	libevtx_index_file_chunk_entry_t *chunk_entry = NULL;
+	libevtx_record_values_t *record_values        = NULL;
+	static char *function                         = "libevtx_file_read_changed_chunk";
+	off64_t header_checksum_offset                = 0;
+	ssize_t read_count                            = 0;
+	uint64_t previous_first_record_identifier     = 0;
+	uint32_t header_checksum                      = 0;
+	uint16_t number_of_records                    = 0;
+	uint16_t record_index                         = 0;
+	uint8_t is_in_range                           = 0;
+	int number_of_indexed_records                 = 0;
+	int recovered_records_entry_index             = 0;
+	int records_entry_index                       = 0;
+	int result                                    = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->index_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing index file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->records_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing records index.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->recovered_records_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing recovered records index.",
+		 function );
+
+		return( -1 );
+	}
+	if( (int) chunk_index > internal_file->index_file->number_of_chunk_entries )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunk_index < internal_file->io_handle->number_of_chunks )
+	 || ( ( internal_file->io_handle->file_flags & LIBEVTX_FILE_FLAG_IS_DIRTY ) != 0 ) )
+	{
+		is_in_range = 1;
+	}
+	if( (int) chunk_index < internal_file->index_file->number_of_chunk_entries )
+	{
+		if( libevtx_index_file_get_chunk_entry_by_index(
+		     internal_file->index_file,
+		     (int) chunk_index,
+		     &chunk_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve chunk: %" PRIu16 " entry.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		header_checksum_offset = file_offset
+		                       + (off64_t) offsetof( evtx_chunk_header_t, checksum );
+
+		read_count = libevtx_io_handle_read_data_at_offset(
+		              internal_file->io_handle,
+		              file_io_handle,
+		              header_checksum_offset,
+		              header_checksum_data,
+		              4,
+		              error );
+
+		if( read_count != (ssize_t) 4 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read chunk: %" PRIu16 " header checksum.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 header_checksum_data,
+		 header_checksum );
+
+		if( ( header_checksum == chunk_entry->header_checksum )
+		 && ( is_in_range == was_in_range ) )
+		{
+			return( 0 );
+		}
+		previous_first_record_identifier = chunk_entry->first_record_identifier;
+	}
+	if( libevtx_chunk_initialize(
+	     &chunk,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create chunk: %" PRIu16 ".",
+		 function,
+		 chunk_index );
+
+		goto on_error;
+	}
+	result = libevtx_chunk_read(
+	          chunk,
+	          internal_file->io_handle,
+	          file_io_handle,
+	          file_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read chunk: %" PRIu16 ".",
+		 function,
+		 chunk_index );
+
+		goto on_error;
+	}
+	if( chunk_index < internal_file->io_handle->number_of_chunks )
+	{
+		if( ( result == 0 )
+		 || ( ( chunk->flags & LIBEVTX_CHUNK_FLAG_IS_CORRUPTED ) != 0 ) )
+		{
+#if defined( HAVE_VERBOSE_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: corruption detected in chunk: %" PRIu16 ".\n",
+				 function,
+				 chunk_index );
+			}
+#endif
+			internal_file->io_handle->flags |= LIBEVTX_IO_HANDLE_FLAG_IS_CORRUPTED;
+		}
+	}
+	if( (int) chunk_index < internal_file->index_file->number_of_chunk_entries )
+	{
+		if( libevtx_index_file_set_chunk_entry_by_index(
+		     internal_file->index_file,
+		     (int) chunk_index,
+		     chunk,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set chunk: %" PRIu16 " entry in index file.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		if( libevtx_index_file_append_chunk_entry(
+		     internal_file->index_file,
+		     chunk,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append chunk: %" PRIu16 " entry to index file.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+	}
+	if( libevtx_index_file_get_chunk_entry_by_index(
+	     internal_file->index_file,
+	     (int) chunk_index,
+	     &chunk_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve chunk: %" PRIu16 " entry.",
+		 function,
+		 chunk_index );
+
+		goto on_error;
+	}
+	/* The recovered records of the chunk are determined again, their entries
+	 * are marked as removed and replaced in place, so that the entries of other
+	 * chunks retain their index
+	 */
+	if( libevtx_record_index_remove_entries_by_chunk_index(
+	     internal_file->recovered_records_index,
+	     chunk_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove chunk: %" PRIu16 " entries from recovered records index.",
+		 function,
+		 chunk_index );
+
+		goto on_error;
+	}
+	/* A chunk that still starts with the same record was extended with new records,
+	 * the records that were already indexed keep their index. Otherwise the chunk
+	 * was reused and the records previously indexed for the chunk are replaced
+	 * in place by the records it now contains
+	 */
+	if( ( was_in_range != 0 )
+	 && ( is_in_range != 0 )
+	 && ( chunk_entry->first_record_identifier == previous_first_record_identifier ) )
+	{
+		if( libevtx_record_index_get_number_of_entries_by_chunk_index(
+		     internal_file->records_index,
+		     chunk_index,
+		     &number_of_indexed_records,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve chunk: %" PRIu16 " number of entries in records index.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		if( libevtx_record_index_remove_entries_by_chunk_index(
+		     internal_file->records_index,
+		     chunk_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove chunk: %" PRIu16 " entries from records index.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+	}
+	if( result != 0 )
+	{
+		if( libevtx_chunk_get_number_of_records(
+		     chunk,
+		     &number_of_records,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve chunk: %" PRIu16 " number of records.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		for( record_index = (uint16_t) number_of_indexed_records;
+		     record_index < number_of_records;
+		     record_index++ )
+		{
+			if( libevtx_chunk_get_record(
+			     chunk,
+			     record_index,
+			     &record_values,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve chunk: %" PRIu16 " record: %" PRIu16 ".",
+				 function,
+				 chunk_index,
+				 record_index );
+
+				goto on_error;
+			}
+			if( record_values == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing chunk: %" PRIu16 " record: %" PRIu16 ".",
+				 function,
+				 chunk_index,
+				 record_index );
+
+				goto on_error;
+			}
+			if( record_values->identifier < internal_file->io_handle->first_record_identifier )
+			{
+				internal_file->io_handle->first_record_identifier = record_values->identifier;
+			}
+			if( record_values->identifier > internal_file->io_handle->last_record_identifier )
+			{
+				internal_file->io_handle->last_record_identifier = record_values->identifier;
+			}
+			/* If the file is not dirty, records found in chunks outside the indicated
+			 * range are considered recovered
+			 */
+			if( is_in_range != 0 )
+			{
+				result = libevtx_record_index_replace_entry(
+				          internal_file->records_index,
+				          &records_entry_index,
+				          chunk_index,
+				          record_values->chunk_data_offset,
+				          record_index,
+				          0,
+				          error );
+			}
+			else
+			{
+				result = libevtx_record_index_replace_entry(
+				          internal_file->recovered_records_index,
+				          &recovered_records_entry_index,
+				          chunk_index,
+				          record_values->chunk_data_offset,
+				          record_index,
+				          0,
+				          error );
+			}
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set chunk: %" PRIu16 " record: %" PRIu16 " entry in records index.",
+				 function,
+				 chunk_index,
+				 record_index );
+
+				goto on_error;
+			}
+		}
+		if( libevtx_chunk_get_number_of_recovered_records(
+		     chunk,
+		     &number_of_records,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve chunk: %" PRIu16 " number of recovered records.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		for( record_index = 0;
+		     record_index < number_of_records;
+		     record_index++ )
+		{
+			if( libevtx_chunk_get_recovered_record(
+			     chunk,
+			     record_index,
+			     &record_values,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve chunk: %" PRIu16 " recovered record: %" PRIu16 ".",
+				 function,
+				 chunk_index,
+				 record_index );
+
+				goto on_error;
+			}
+			if( record_values == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing chunk: %" PRIu16 " recovered record: %" PRIu16 ".",
+				 function,
+				 chunk_index,
+				 record_index );
+
+				goto on_error;
+			}
+			if( libevtx_record_index_replace_entry(
+			     internal_file->recovered_records_index,
+			     &recovered_records_entry_index,
+			     chunk_index,
+			     record_values->chunk_data_offset,
+			     record_index,
+			     LIBEVTX_RECORD_INDEX_ENTRY_FLAG_IS_RECOVERED,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set chunk: %" PRIu16 " recovered record: %" PRIu16 " entry in recovered records index.",
+				 function,
+				 chunk_index,
+				 record_index );
+
+				goto on_error;
+			}
+		}
+	}
+	if( libevtx_chunk_free(
+	     &chunk,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free chunk: %" PRIu16 ".",
+		 function,
+		 chunk_index );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( chunk != NULL )
+	{
+		libevtx_chunk_free(
+		 &chunk,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Refreshes the file
+ * Re-reads the file header and reads the chunks that were added or changed
+ * since the file was opened or last refreshed, so that only the changes are read
+ * for a file that is still being written. The records of a chunk that was extended
+ * are appended to the records index, hence existing records keep their index.
+ * The records of a chunk that was reused replace the records previously stored
+ * at the indexes of the chunk, if the chunk now contains fewer records the remaining
+ * indexes are removed and the index of the records that follow them decreases.
+ * Records retrieved before the refresh should be freed before calling this function
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_refresh(
+     libevtx_file_t *file,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_refresh";
+	size64_t file_size                     = 0;
+	off64_t file_offset                    = 0;
+	off64_t previous_chunks_data_offset    = 0;
+	uint32_t previous_chunk_size           = 0;
+	uint32_t previous_file_flags           = 0;
+	uint16_t chunk_index                   = 0;
+	uint16_t previous_number_of_chunks     = 0;
+	uint8_t was_in_range                   = 0;
+	int number_of_changed_chunks           = 0;
+	int result                             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->index_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing index file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     internal_file->file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		return( -1 );
+	}
+	previous_chunks_data_offset = internal_file->io_handle->chunks_data_offset;
+	previous_chunk_size         = internal_file->io_handle->chunk_size;
+	previous_file_flags         = internal_file->io_handle->file_flags;
+	previous_number_of_chunks   = internal_file->io_handle->number_of_chunks;
+
+	if( libevtx_io_handle_read_file_header(
+	     internal_file->io_handle,
+	     internal_file->file_io_handle,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( internal_file->io_handle->chunks_data_offset != previous_chunks_data_offset )
+	 || ( internal_file->io_handle->chunk_size != previous_chunk_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported change in chunks data offset or chunk size.",
+		 function );
+
+		goto on_error;
+	}
+	file_offset = internal_file->io_handle->chunks_data_offset;
+
+	while( ( file_offset + internal_file->io_handle->chunk_size ) <= (off64_t) file_size )
+	{
+		if( ( chunk_index < previous_number_of_chunks )
+		 || ( ( previous_file_flags & LIBEVTX_FILE_FLAG_IS_DIRTY ) != 0 ) )
+		{
+			was_in_range = 1;
+		}
+		else
+		{
+			was_in_range = 0;
+		}
+		result = libevtx_file_read_changed_chunk(
+		          internal_file,
+		          internal_file->file_io_handle,
+		          chunk_index,
+		          file_offset,
+		          was_in_range,
+		          error );
 
-		if( libevtx_chunk_free(
-		     &chunk,
-		     error ) != 1 )
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free chunk: %" PRIu16 ".",
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read chunk: %" PRIu16 ".",
 			 function,
 			 chunk_index );
 
+			/* The chunks read before the failing chunk, and the failing chunk
+			 * itself, can have changed the record indexes
+			 */
+			libevtx_file_update_chunks(
+			 internal_file,
+			 file_size,
+			 NULL );
+
 			goto on_error;
 		}
+		else if( result != 0 )
+		{
+			number_of_changed_chunks++;
+		}
+		file_offset += internal_file->io_handle->chunk_size;
+
 		chunk_index++;
 	}
 	internal_file->io_handle->chunks_data_size = file_offset
 	                                           - internal_file->io_handle->chunks_data_offset;
 
-	if( number_of_chunks != internal_file->io_handle->number_of_chunks )
+	if( number_of_changed_chunks == 0 )
 	{
-#if defined( HAVE_VERBOSE_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: mismatch in number of chunks ( %" PRIu16 " != %" PRIu16 " ).\n",
-			 function,
-			 internal_file->io_handle->number_of_chunks,
-			 chunk_index );
-		}
-#endif
-		internal_file->io_handle->flags |= LIBEVTX_IO_HANDLE_FLAG_IS_CORRUPTED;
+		return( 1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
+#if defined( HAVE_VERBOSE_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
-		if( file_offset < (off64_t) file_size )
-		{
-			trailing_data_size = (size_t) ( file_size - file_offset );
-
-			trailing_data = (uint8_t *) memory_allocate(
-			                             sizeof( uint8_t ) * trailing_data_size );
-
-			if( trailing_data == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-				 "%s: unable to create trailing data.",
-				 function );
-
-				goto on_error;
-			}
-			read_count = libbfio_handle_read_buffer(
-				      file_io_handle,
-				      trailing_data,
-				      trailing_data_size,
-				      error );
+		libcnotify_printf(
+		 "%s: number of changed chunks: %d.\n",
+		 function,
+		 number_of_changed_chunks );
+	}
+#endif
+	if( libevtx_file_update_chunks(
+	     internal_file,
+	     file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update chunks.",
+		 function );
 
-			if( read_count != (ssize_t) trailing_data_size )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read trailing data.",
-				 function );
+		goto on_error;
+	}
+	return( 1 );
 
-				memory_free(
-				 trailing_data );
+on_error:
+	/* The file header is only applied when the file could be refreshed
+	 */
+	internal_file->io_handle->chunks_data_offset = previous_chunks_data_offset;
+	internal_file->io_handle->chunk_size         = previous_chunk_size;
+	internal_file->io_handle->file_flags         = previous_file_flags;
+	internal_file->io_handle->number_of_chunks   = previous_number_of_chunks;
 
-				goto on_error;
-			}
-			file_offset += read_count;
+	return( -1 );
+}
 
-			libcnotify_printf(
-			 "%s: trailing data:\n",
-			 function );
-			libcnotify_print_data(
-			 trailing_data,
-			 trailing_data_size,
-			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+/* Updates the chunks vector, discards the removed record index entries and
+ * clears the chunks and records caches after the record indexes were changed
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_update_chunks(
+     libevtx_internal_file_t *internal_file,
+     size64_t file_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_file_update_chunks";
+	int result            = 1;
 
-			memory_free(
-			 trailing_data );
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
 
-			trailing_data = NULL;
-		}
+		return( -1 );
 	}
-#endif
-	return( 1 );
-
-on_error:
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( trailing_data != NULL )
+	if( internal_file->io_handle == NULL )
 	{
-		memory_free(
-		 trailing_data );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
 	}
-#endif
-	if( chunk != NULL )
+	if( file_size < (size64_t) internal_file->io_handle->chunks_data_offset )
 	{
-		libevtx_chunk_free(
-		 &chunk,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file size value out of bounds.",
+		 function );
+
+		return( -1 );
 	}
-	if( internal_file->records_cache != NULL )
+	if( libfdata_vector_set_segment_by_index(
+	     internal_file->chunks_vector,
+	     0,
+	     0,
+	     internal_file->io_handle->chunks_data_offset,
+	     file_size - internal_file->io_handle->chunks_data_offset,
+	     0,
+	     error ) != 1 )
 	{
-		libfcache_cache_free(
-		 &( internal_file->records_cache ),
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set segment in chunks vector.",
+		 function );
+
+		result = -1;
 	}
-	if( internal_file->records_list != NULL )
+	/* Entries that were not reused by the chunks read during the refresh
+	 * would otherwise remain as indexes that cannot be retrieved
+	 */
+	if( libevtx_record_index_compact(
+	     internal_file->records_index,
+	     error ) != 1 )
 	{
-		libfdata_list_free(
-		 &( internal_file->records_list ),
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to compact records index.",
+		 function );
+
+		result = -1;
 	}
-	if( chunks_table != NULL )
+	if( libevtx_record_index_compact(
+	     internal_file->recovered_records_index,
+	     error ) != 1 )
 	{
-		libevtx_chunks_table_free(
-		 &chunks_table,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to compact recovered records index.",
+		 function );
+
+		result = -1;
 	}
-	if( internal_file->chunks_cache != NULL )
+	/* The cached chunks can be out of date and the cached records are stored
+	 * by the index of their entry, which can refer to another record now.
+	 * The caches are cleared even if the segment could not be set
+	 */
+	if( libfcache_cache_clear(
+	     internal_file->chunks_cache,
+	     error ) != 1 )
 	{
-		libfcache_cache_free(
-		 &( internal_file->chunks_cache ),
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear chunks cache.",
+		 function );
+
+		result = -1;
 	}
-	if( internal_file->chunks_vector != NULL )
+	if( libfcache_cache_clear(
+	     internal_file->records_cache,
+	     error ) != 1 )
 	{
-		libfdata_vector_free(
-		 &( internal_file->chunks_vector ),
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear records cache.",
+		 function );
+
+		result = -1;
 	}
-	return( -1 );
+	return( result );
 }
 
 /* Determine if the file corrupted
@@ -1906,8 +3292,8 @@ int libevtx_file_get_number_of_records(
 	}
 	internal_file = (libevtx_internal_file_t *) file;
 
-	if( libfdata_list_get_number_of_elements(
-	     internal_file->records_list,
+	if( libevtx_record_index_get_number_of_entries(
+	     internal_file->records_index,
 	     number_of_records,
 	     error ) != 1 )
 	{
@@ -1960,13 +3346,17 @@ int libevtx_file_get_record(
 
 		return( -1 );
 	}
-	if( libfdata_list_get_element_value_by_index(
-	     internal_file->records_list,
-	     (intptr_t *) internal_file->file_io_handle,
+	libevtx_statistics_counter_add(
+	 internal_file->io_handle->statistics_counters.number_of_record_lookups,
+	 1 );
+
+	if( libevtx_chunks_table_get_record_values_by_index(
+	     internal_file->chunks_table,
+	     internal_file->file_io_handle,
 	     internal_file->records_cache,
+	     internal_file->records_index,
 	     record_index,
-	     (intptr_t **) &record_values,
-	     0,
+	     &record_values,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -2036,13 +3426,17 @@ int libevtx_file_get_record_by_index(
 
 		return( -1 );
 	}
-	if( libfdata_list_get_element_value_by_index(
-	     internal_file->records_list,
-	     (intptr_t *) internal_file->file_io_handle,
+	libevtx_statistics_counter_add(
+	 internal_file->io_handle->statistics_counters.number_of_record_lookups,
+	 1 );
+
+	if( libevtx_chunks_table_get_record_values_by_index(
+	     internal_file->chunks_table,
+	     internal_file->file_io_handle,
 	     internal_file->records_cache,
+	     internal_file->records_index,
 	     record_index,
-	     (intptr_t **) &record_values,
-	     0,
+	     &record_values,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -2099,8 +3493,8 @@ int libevtx_file_get_number_of_recovered_records(
 	}
 	internal_file = (libevtx_internal_file_t *) file;
 
-	if( libfdata_list_get_number_of_elements(
-	     internal_file->recovered_records_list,
+	if( libevtx_record_index_get_number_of_entries(
+	     internal_file->recovered_records_index,
 	     number_of_records,
 	     error ) != 1 )
 	{
@@ -2153,13 +3547,17 @@ int libevtx_file_get_recovered_record(
 
 		return( -1 );
 	}
-	if( libfdata_list_get_element_value_by_index(
-	     internal_file->recovered_records_list,
-	     (intptr_t *) internal_file->file_io_handle,
+	libevtx_statistics_counter_add(
+	 internal_file->io_handle->statistics_counters.number_of_record_lookups,
+	 1 );
+
+	if( libevtx_chunks_table_get_record_values_by_index(
+	     internal_file->chunks_table,
+	     internal_file->file_io_handle,
 	     internal_file->records_cache,
+	     internal_file->recovered_records_index,
 	     record_index,
-	     (intptr_t **) &record_values,
-	     0,
+	     &record_values,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -2229,13 +3627,17 @@ int libevtx_file_get_recovered_record_by_index(
 
 		return( -1 );
 	}
-	if( libfdata_list_get_element_value_by_index(
-	     internal_file->recovered_records_list,
-	     (intptr_t *) internal_file->file_io_handle,
+	libevtx_statistics_counter_add(
+	 internal_file->io_handle->statistics_counters.number_of_record_lookups,
+	 1 );
+
+	if( libevtx_chunks_table_get_record_values_by_index(
+	     internal_file->chunks_table,
+	     internal_file->file_io_handle,
 	     internal_file->records_cache,
+	     internal_file->recovered_records_index,
 	     record_index,
-	     (intptr_t **) &record_values,
-	     0,
+	     &record_values,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -2268,3 +3670,57 @@ int libevtx_file_get_recovered_record_by_index(
 	return( 1 );
 }
 
+/* Retrieves the statistics
+ * The statistics are accumulated since the file was opened
+ * The size of the statistics must be set to sizeof( libevtx_statistics_t ) before calling this function
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_statistics(
+     libevtx_file_t *file,
+     libevtx_statistics_t *statistics,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_get_statistics";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_statistics_counters_get_statistics(
+	     &( internal_file->io_handle->statistics_counters ),
+	     statistics,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve statistics.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
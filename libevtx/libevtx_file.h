@@ -25,12 +25,16 @@
 #include <common.h>
 #include <types.h>
 
+#include "libevtx_chunks_table.h"
 #include "libevtx_extern.h"
+#include "libevtx_index_file.h"
 #include "libevtx_io_handle.h"
 #include "libevtx_libbfio.h"
 #include "libevtx_libcerror.h"
 #include "libevtx_libfcache.h"
 #include "libevtx_libfdata.h"
+#include "libevtx_record_index.h"
+#include "libevtx_types.h"
 
 #if defined( _MSC_VER ) || defined( __BORLANDC__ ) || defined( __MINGW32_VERSION ) || defined( __MINGW64_VERSION_MAJOR )
 
@@ -72,17 +76,30 @@ struct libevtx_internal_file
 	 */
 	libfcache_cache_t *chunks_cache;
 
-	/* The records list
+	/* The chunks table
 	 */
-	libfdata_list_t *records_list;
+	libevtx_chunks_table_t *chunks_table;
 
-	/* The recovered records list
+	/* The records index
 	 */
-	libfdata_list_t *recovered_records_list;
+	libevtx_record_index_t *records_index;
+
+	/* The recovered records index
+	 */
+	libevtx_record_index_t *recovered_records_index;
+
+	/* The index file, which contains an entry per chunk
+	 * used to detect changed chunks
+	 */
+	libevtx_index_file_t *index_file;
 
 	/* The records cache
 	 */
 	libfcache_cache_t *records_cache;
+
+	/* The index file IO handle
+	 */
+	libbfio_handle_t *index_file_io_handle;
 };
 
 LIBEVTX_EXTERN \
@@ -125,6 +142,24 @@ int libevtx_file_open_file_io_handle(
      int access_flags,
      libcerror_error_t **error );
 
+LIBEVTX_EXTERN \
+int libevtx_file_set_index_filename(
+     libevtx_file_t *file,
+     const char *filename,
+     size_t filename_length,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBEVTX_EXTERN \
+int libevtx_file_set_index_filename_wide(
+     libevtx_file_t *file,
+     const wchar_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
 LIBEVTX_EXTERN \
 int libevtx_file_close(
      libevtx_file_t *file,
@@ -135,6 +170,31 @@ int libevtx_file_open_read(
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error );
 
+int libevtx_file_read_chunks(
+     libevtx_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     size64_t file_size,
+     libevtx_index_file_t *index_file,
+     libcerror_error_t **error );
+
+int libevtx_file_read_changed_chunk(
+     libevtx_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     uint16_t chunk_index,
+     off64_t file_offset,
+     uint8_t was_in_range,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_refresh(
+     libevtx_file_t *file,
+     libcerror_error_t **error );
+
+int libevtx_file_update_chunks(
+     libevtx_internal_file_t *internal_file,
+     size64_t file_size,
+     libcerror_error_t **error );
+
 LIBEVTX_EXTERN \
 int libevtx_file_is_corrupted(
      libevtx_file_t *file,
@@ -212,6 +272,12 @@ int libevtx_file_get_recovered_record_by_index(
      libevtx_record_t **record,
      libcerror_error_t **error );
 
+LIBEVTX_EXTERN \
+int libevtx_file_get_statistics(
+     libevtx_file_t *file,
+     libevtx_statistics_t *statistics,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,1780 @@
+/*
+ * Index file functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevtx_checksum.h"
+#include "libevtx_chunk.h"
+#include "libevtx_definitions.h"
+#include "libevtx_index_file.h"
+#include "libevtx_io_handle.h"
+#include "libevtx_libbfio.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_libcnotify.h"
+#include "libevtx_record_index.h"
+#include "libevtx_record_values.h"
+
+#include "evtx_chunk.h"
+#include "evtx_index_file.h"
+
+const uint8_t *evtx_index_file_signature = (uint8_t *) "EvtxIdx";
+
+/* Creates an index file
+ * Make sure the value index_file is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_index_file_initialize(
+     libevtx_index_file_t **index_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_index_file_initialize";
+
+	if( index_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *index_file != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid index file value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*index_file = memory_allocate_structure(
+	               libevtx_index_file_t );
+
+	if( *index_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create index file.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *index_file,
+	     0,
+	     sizeof( libevtx_index_file_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear index file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *index_file != NULL )
+	{
+		memory_free(
+		 *index_file );
+
+		*index_file = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an index file
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_index_file_free(
+     libevtx_index_file_t **index_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_index_file_free";
+
+	if( index_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *index_file != NULL )
+	{
+		if( ( *index_file )->chunk_entries != NULL )
+		{
+			memory_free(
+			 ( *index_file )->chunk_entries );
+		}
+		memory_free(
+		 *index_file );
+
+		*index_file = NULL;
+	}
+	return( 1 );
+}
+
+/* Resizes the chunk entries
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_index_file_resize_chunk_entries(
+     libevtx_index_file_t *index_file,
+     int number_of_chunk_entries,
+     libcerror_error_t **error )
+{
+	libevtx_index_file_chunk_entry_t *reallocation = NULL;
+	static char *function                          = "libevtx_index_file_resize_chunk_entries";
+
+	if( index_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index file.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_chunk_entries <= 0 )
+	 || ( (size_t) number_of_chunk_entries > (size_t) ( SSIZE_MAX / sizeof( libevtx_index_file_chunk_entry_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of chunk entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_chunk_entries <= index_file->number_of_allocated_chunk_entries )
+	{
+		return( 1 );
+	}
+	reallocation = (libevtx_index_file_chunk_entry_t *) memory_reallocate(
+	                index_file->chunk_entries,
+	                sizeof( libevtx_index_file_chunk_entry_t ) * number_of_chunk_entries );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize chunk entries.",
+		 function );
+
+		return( -1 );
+	}
+	index_file->chunk_entries                     = reallocation;
+	index_file->number_of_allocated_chunk_entries = number_of_chunk_entries;
+
+	return( 1 );
+}
+
+/* Appends a chunk entry to the index file
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_index_file_append_chunk_entry(
+     libevtx_index_file_t *index_file,
+     libevtx_chunk_t *chunk,
+     libcerror_error_t **error )
+{
+	static char *function                 = "libevtx_index_file_append_chunk_entry";
+	int number_of_allocated_chunk_entries = 0;
+
+	if( index_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index file.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( index_file->number_of_chunk_entries >= index_file->number_of_allocated_chunk_entries )
+	{
+		if( index_file->number_of_allocated_chunk_entries == 0 )
+		{
+			number_of_allocated_chunk_entries = 64;
+		}
+		else if( index_file->number_of_allocated_chunk_entries > ( INT_MAX / 2 ) )
+		{
+			number_of_allocated_chunk_entries = INT_MAX;
+		}
+		else
+		{
+			number_of_allocated_chunk_entries = 2 * index_file->number_of_allocated_chunk_entries;
+		}
+		if( index_file->number_of_chunk_entries == INT_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of chunk entries value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		if( libevtx_index_file_resize_chunk_entries(
+		     index_file,
+		     number_of_allocated_chunk_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize chunk entries.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	index_file->number_of_chunk_entries += 1;
+
+	if( libevtx_index_file_set_chunk_entry_by_index(
+	     index_file,
+	     index_file->number_of_chunk_entries - 1,
+	     chunk,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set chunk entry: %d.",
+		 function,
+		 index_file->number_of_chunk_entries - 1 );
+
+		index_file->number_of_chunk_entries -= 1;
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets a specific chunk entry from a chunk
+ * The entry contains the chunk header checksum, used to detect if the chunk
+ * changed, and the ranges of the record identifiers and written times of
+ * the records in the chunk
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_index_file_set_chunk_entry_by_index(
+     libevtx_index_file_t *index_file,
+     int chunk_entry_index,
+     libevtx_chunk_t *chunk,
+     libcerror_error_t **error )
+{
+	libevtx_index_file_chunk_entry_t *chunk_entry = NULL;
+	libevtx_record_values_t *record_values        = NULL;
+	static char *function                         = "libevtx_index_file_set_chunk_entry_by_index";
+	uint16_t number_of_records                    = 0;
+	uint16_t record_index                         = 0;
+
+	if( index_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index file.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunk_entry_index < 0 )
+	 || ( chunk_entry_index >= index_file->number_of_chunk_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	chunk_entry = &( index_file->chunk_entries[ chunk_entry_index ] );
+
+	if( memory_set(
+	     chunk_entry,
+	     0,
+	     sizeof( libevtx_index_file_chunk_entry_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear chunk entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunk->data != NULL )
+	 && ( chunk->data_size >= sizeof( evtx_chunk_header_t ) ) )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (evtx_chunk_header_t *) chunk->data )->checksum,
+		 chunk_entry->header_checksum );
+	}
+	chunk_entry->flags = chunk->flags;
+
+	if( chunk->records_array != NULL )
+	{
+		if( libevtx_chunk_get_number_of_records(
+		     chunk,
+		     &number_of_records,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of records.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		if( libevtx_chunk_get_record(
+		     chunk,
+		     record_index,
+		     &record_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record: %" PRIu16 ".",
+			 function,
+			 record_index );
+
+			return( -1 );
+		}
+		if( record_values == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing record: %" PRIu16 ".",
+			 function,
+			 record_index );
+
+			return( -1 );
+		}
+		if( ( record_index == 0 )
+		 || ( record_values->identifier < chunk_entry->first_record_identifier ) )
+		{
+			chunk_entry->first_record_identifier = record_values->identifier;
+		}
+		if( ( record_index == 0 )
+		 || ( record_values->identifier > chunk_entry->last_record_identifier ) )
+		{
+			chunk_entry->last_record_identifier = record_values->identifier;
+		}
+		if( ( record_index == 0 )
+		 || ( record_values->written_time < chunk_entry->first_written_time ) )
+		{
+			chunk_entry->first_written_time = record_values->written_time;
+		}
+		if( ( record_index == 0 )
+		 || ( record_values->written_time > chunk_entry->last_written_time ) )
+		{
+			chunk_entry->last_written_time = record_values->written_time;
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific chunk entry
+ * The entry is managed by the index file and is only valid until the next entry is appended
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_index_file_get_chunk_entry_by_index(
+     libevtx_index_file_t *index_file,
+     int chunk_entry_index,
+     libevtx_index_file_chunk_entry_t **chunk_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_index_file_get_chunk_entry_by_index";
+
+	if( index_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index file.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunk_entry_index < 0 )
+	 || ( chunk_entry_index >= index_file->number_of_chunk_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk entry.",
+		 function );
+
+		return( -1 );
+	}
+	*chunk_entry = &( index_file->chunk_entries[ chunk_entry_index ] );
+
+	return( 1 );
+}
+
+/* Copies the entries of a record index to the index file data
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_index_file_copy_record_entries_to_data(
+     libevtx_record_index_t *record_index,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libevtx_record_index_entry_t *entry = NULL;
+	static char *function               = "libevtx_index_file_copy_record_entries_to_data";
+	size_t data_offset                  = 0;
+	int entry_index                     = 0;
+
+	if( record_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record index.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size > (size_t) SSIZE_MAX )
+	 || ( ( data_size / sizeof( evtx_index_file_record_entry_t ) ) < (size_t) record_index->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < record_index->number_of_entries;
+	     entry_index++ )
+	{
+		entry = &( record_index->entries[ entry_index ] );
+
+		byte_stream_copy_from_uint16_little_endian(
+		 ( (evtx_index_file_record_entry_t *) &( data[ data_offset ] ) )->chunk_index,
+		 entry->chunk_index );
+
+		byte_stream_copy_from_uint16_little_endian(
+		 ( (evtx_index_file_record_entry_t *) &( data[ data_offset ] ) )->chunk_data_offset,
+		 entry->chunk_data_offset );
+
+		byte_stream_copy_from_uint16_little_endian(
+		 ( (evtx_index_file_record_entry_t *) &( data[ data_offset ] ) )->chunk_record_index,
+		 entry->chunk_record_index );
+
+		byte_stream_copy_from_uint16_little_endian(
+		 ( (evtx_index_file_record_entry_t *) &( data[ data_offset ] ) )->flags,
+		 entry->flags );
+
+		data_offset += sizeof( evtx_index_file_record_entry_t );
+	}
+	return( 1 );
+}
+
+/* Copies the entries of a record index from the index file data
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_index_file_copy_record_entries_from_data(
+     libevtx_record_index_t *record_index,
+     const uint8_t *data,
+     size_t data_size,
+     int number_of_entries,
+     libcerror_error_t **error )
+{
+	const evtx_index_file_record_entry_t *record_entry_data = NULL;
+	static char *function                                   = "libevtx_index_file_copy_record_entries_from_data";
+	size_t data_offset                                      = 0;
+	uint16_t chunk_data_offset                              = 0;
+	uint16_t chunk_index                                    = 0;
+	uint16_t chunk_record_index                             = 0;
+	uint16_t flags                                          = 0;
+	int entry_index                                         = 0;
+
+	if( record_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record index.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of entries value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size > (size_t) SSIZE_MAX )
+	 || ( ( data_size / sizeof( evtx_index_file_record_entry_t ) ) < (size_t) number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		record_entry_data = (const evtx_index_file_record_entry_t *) &( data[ data_offset ] );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 record_entry_data->chunk_index,
+		 chunk_index );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 record_entry_data->chunk_data_offset,
+		 chunk_data_offset );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 record_entry_data->chunk_record_index,
+		 chunk_record_index );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 record_entry_data->flags,
+		 flags );
+
+		if( libevtx_record_index_append_entry(
+		     record_index,
+		     chunk_index,
+		     (size_t) chunk_data_offset,
+		     chunk_record_index,
+		     flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append entry: %d to record index.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		data_offset += sizeof( evtx_index_file_record_entry_t );
+	}
+	return( 1 );
+}
+
+/* Writes the index file
+ * The index file is (re)created and contains the state of the file after the chunks were scanned
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_index_file_write(
+     libevtx_index_file_t *index_file,
+     libevtx_io_handle_t *io_handle,
+     size64_t file_size,
+     libevtx_record_index_t *records_index,
+     libevtx_record_index_t *recovered_records_index,
+     libbfio_handle_t *index_file_io_handle,
+     libcerror_error_t **error )
+{
+	libevtx_index_file_chunk_entry_t *chunk_entry   = NULL;
+	evtx_index_file_chunk_entry_t *chunk_entry_data = NULL;
+	evtx_index_file_header_t *header_data           = NULL;
+	uint8_t *index_data                             = NULL;
+	static char *function                           = "libevtx_index_file_write";
+	size64_t calculated_index_data_size             = 0;
+	size_t data_offset                              = 0;
+	size_t index_data_size                          = 0;
+	ssize_t write_count                             = 0;
+	uint32_t calculated_checksum                    = 0;
+	int chunk_entry_index                           = 0;
+	int index_file_io_handle_is_open                = 0;
+
+	if( index_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index file.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( records_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records index.",
+		 function );
+
+		return( -1 );
+	}
+	if( recovered_records_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid recovered records index.",
+		 function );
+
+		return( -1 );
+	}
+	calculated_index_data_size = (size64_t) sizeof( evtx_index_file_header_t )
+	                           + ( (size64_t) index_file->number_of_chunk_entries * sizeof( evtx_index_file_chunk_entry_t ) )
+	                           + ( (size64_t) records_index->number_of_entries * sizeof( evtx_index_file_record_entry_t ) )
+	                           + ( (size64_t) recovered_records_index->number_of_entries * sizeof( evtx_index_file_record_entry_t ) )
+	                           + 4;
+
+	if( calculated_index_data_size > (size64_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid index data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	index_data_size = (size_t) calculated_index_data_size;
+
+	index_data = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * index_data_size );
+
+	if( index_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create index data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     index_data,
+	     0,
+	     index_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear index data.",
+		 function );
+
+		goto on_error;
+	}
+	header_data = (evtx_index_file_header_t *) index_data;
+
+	if( memory_copy(
+	     header_data->signature,
+	     evtx_index_file_signature,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 header_data->format_version,
+	 LIBEVTX_INDEX_FILE_FORMAT_VERSION );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 header_data->flags,
+	 io_handle->flags );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 header_data->file_size,
+	 file_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 header_data->file_header_checksum,
+	 io_handle->file_header_checksum );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 header_data->chunk_size,
+	 io_handle->chunk_size );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 header_data->chunks_data_size,
+	 io_handle->chunks_data_size );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 header_data->first_record_identifier,
+	 io_handle->first_record_identifier );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 header_data->last_record_identifier,
+	 io_handle->last_record_identifier );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 header_data->number_of_chunk_entries,
+	 index_file->number_of_chunk_entries );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 header_data->number_of_record_entries,
+	 records_index->number_of_entries );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 header_data->number_of_recovered_record_entries,
+	 recovered_records_index->number_of_entries );
+
+	if( libevtx_checksum_calculate_little_endian_crc32(
+	     &calculated_checksum,
+	     index_data,
+	     sizeof( evtx_index_file_header_t ) - 4,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate CRC-32 checksum.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 header_data->checksum,
+	 calculated_checksum );
+
+	data_offset = sizeof( evtx_index_file_header_t );
+
+	for( chunk_entry_index = 0;
+	     chunk_entry_index < index_file->number_of_chunk_entries;
+	     chunk_entry_index++ )
+	{
+		chunk_entry      = &( index_file->chunk_entries[ chunk_entry_index ] );
+		chunk_entry_data = (evtx_index_file_chunk_entry_t *) &( index_data[ data_offset ] );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 chunk_entry_data->header_checksum,
+		 chunk_entry->header_checksum );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 chunk_entry_data->flags,
+		 chunk_entry->flags );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 chunk_entry_data->first_record_identifier,
+		 chunk_entry->first_record_identifier );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 chunk_entry_data->last_record_identifier,
+		 chunk_entry->last_record_identifier );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 chunk_entry_data->first_written_time,
+		 chunk_entry->first_written_time );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 chunk_entry_data->last_written_time,
+		 chunk_entry->last_written_time );
+
+		data_offset += sizeof( evtx_index_file_chunk_entry_t );
+	}
+	if( libevtx_index_file_copy_record_entries_to_data(
+	     records_index,
+	     &( index_data[ data_offset ] ),
+	     index_data_size - data_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy record entries to index data.",
+		 function );
+
+		goto on_error;
+	}
+	data_offset += (size_t) records_index->number_of_entries * sizeof( evtx_index_file_record_entry_t );
+
+	if( libevtx_index_file_copy_record_entries_to_data(
+	     recovered_records_index,
+	     &( index_data[ data_offset ] ),
+	     index_data_size - data_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy recovered record entries to index data.",
+		 function );
+
+		goto on_error;
+	}
+	data_offset += (size_t) recovered_records_index->number_of_entries * sizeof( evtx_index_file_record_entry_t );
+
+	if( libevtx_checksum_calculate_little_endian_crc32(
+	     &calculated_checksum,
+	     &( index_data[ sizeof( evtx_index_file_header_t ) ] ),
+	     data_offset - sizeof( evtx_index_file_header_t ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate CRC-32 checksum.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( index_data[ data_offset ] ),
+	 calculated_checksum );
+
+	if( libbfio_handle_open(
+	     index_file_io_handle,
+	     LIBBFIO_OPEN_WRITE_TRUNCATE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open index file.",
+		 function );
+
+		goto on_error;
+	}
+	index_file_io_handle_is_open = 1;
+
+	write_count = libbfio_handle_write_buffer(
+	               index_file_io_handle,
+	               index_data,
+	               index_data_size,
+	               error );
+
+	if( write_count != (ssize_t) index_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write index data.",
+		 function );
+
+		goto on_error;
+	}
+	index_file_io_handle_is_open = 0;
+
+	if( libbfio_handle_close(
+	     index_file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close index file.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 index_data );
+
+	return( 1 );
+
+on_error:
+	if( index_file_io_handle_is_open != 0 )
+	{
+		libbfio_handle_close(
+		 index_file_io_handle,
+		 NULL );
+	}
+	if( index_data != NULL )
+	{
+		memory_free(
+		 index_data );
+	}
+	return( -1 );
+}
+
+/* Reads the index file data
+ * The data is only used if it matches the current state of the file
+ * Returns 1 if successful, 0 if the data is invalid or stale or -1 on error
+ */
+int libevtx_index_file_read_data(
+     libevtx_index_file_t *index_file,
+     libevtx_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     size64_t file_size,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	uint8_t chunk_header_checksum_data[ 4 ];
+
+	libevtx_index_file_chunk_entry_t *chunk_entry           = NULL;
+	const evtx_index_file_chunk_entry_t *chunk_entry_data   = NULL;
+	const evtx_index_file_record_entry_t *record_entry_data = NULL;
+	static char *function                                   = "libevtx_index_file_read_data";
+	size64_t calculated_data_size                           = 0;
+	size64_t stored_chunks_data_size                        = 0;
+	size64_t stored_file_size                               = 0;
+	size_t data_offset                                      = 0;
+	ssize_t read_count                                      = 0;
+	off64_t chunk_checksum_offset                           = 0;
+	uint32_t calculated_checksum                            = 0;
+	uint32_t format_version                                 = 0;
+	uint32_t number_of_chunk_entries                        = 0;
+	uint32_t number_of_record_entries                       = 0;
+	uint32_t stored_checksum                                = 0;
+	uint32_t value_32bit                                    = 0;
+	uint32_t entry_index                                    = 0;
+	uint16_t chunk_data_offset                              = 0;
+	uint16_t chunk_index                                    = 0;
+
+	if( index_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index file.",
+		 function );
+
+		return( -1 );
+	}
+	if( index_file->number_of_chunk_entries != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid index file - chunk entries already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->chunk_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - missing chunk size.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size < ( sizeof( evtx_index_file_header_t ) + 4 ) )
+	{
+		return( 0 );
+	}
+	if( memory_compare(
+	     ( (evtx_index_file_header_t *) data )->signature,
+	     evtx_index_file_signature,
+	     8 ) != 0 )
+	{
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unsupported index file signature.\n",
+			 function );
+		}
+#endif
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evtx_index_file_header_t *) data )->format_version,
+	 format_version );
+
+	if( format_version != LIBEVTX_INDEX_FILE_FORMAT_VERSION )
+	{
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unsupported index file format version: %" PRIu32 ".\n",
+			 function,
+			 format_version );
+		}
+#endif
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evtx_index_file_header_t *) data )->checksum,
+	 stored_checksum );
+
+	if( libevtx_checksum_calculate_little_endian_crc32(
+	     &calculated_checksum,
+	     (uint8_t *) data,
+	     sizeof( evtx_index_file_header_t ) - 4,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate CRC-32 checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( stored_checksum != calculated_checksum )
+	{
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: mismatch in index file header CRC-32 checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).\n",
+			 function,
+			 stored_checksum,
+			 calculated_checksum );
+		}
+#endif
+		return( 0 );
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (evtx_index_file_header_t *) data )->file_size,
+	 stored_file_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evtx_index_file_header_t *) data )->file_header_checksum,
+	 stored_checksum );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evtx_index_file_header_t *) data )->chunk_size,
+	 value_32bit );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (evtx_index_file_header_t *) data )->chunks_data_size,
+	 stored_chunks_data_size );
+
+	/* The index file is stale if the file was changed since the index file was written
+	 */
+	if( ( stored_file_size != file_size )
+	 || ( stored_checksum != io_handle->file_header_checksum )
+	 || ( value_32bit != io_handle->chunk_size ) )
+	{
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: index file is stale.\n",
+			 function );
+		}
+#endif
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evtx_index_file_header_t *) data )->number_of_chunk_entries,
+	 number_of_chunk_entries );
+
+	if( ( number_of_chunk_entries > ( (uint32_t) UINT16_MAX + 1 ) )
+	 || ( ( (size64_t) io_handle->chunks_data_offset + stored_chunks_data_size ) > file_size )
+	 || ( stored_chunks_data_size != ( (size64_t) number_of_chunk_entries * io_handle->chunk_size ) ) )
+	{
+		return( 0 );
+	}
+	calculated_data_size = (size64_t) sizeof( evtx_index_file_header_t )
+	                     + ( (size64_t) number_of_chunk_entries * sizeof( evtx_index_file_chunk_entry_t ) );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evtx_index_file_header_t *) data )->number_of_record_entries,
+	 number_of_record_entries );
+
+	if( number_of_record_entries > (uint32_t) INT_MAX )
+	{
+		return( 0 );
+	}
+	calculated_data_size += (size64_t) number_of_record_entries * sizeof( evtx_index_file_record_entry_t );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evtx_index_file_header_t *) data )->number_of_recovered_record_entries,
+	 number_of_record_entries );
+
+	if( number_of_record_entries > (uint32_t) INT_MAX )
+	{
+		return( 0 );
+	}
+	calculated_data_size += (size64_t) number_of_record_entries * sizeof( evtx_index_file_record_entry_t );
+
+	if( ( calculated_data_size + 4 ) != (size64_t) data_size )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ data_size - 4 ] ),
+	 stored_checksum );
+
+	if( libevtx_checksum_calculate_little_endian_crc32(
+	     &calculated_checksum,
+	     (uint8_t *) &( data[ sizeof( evtx_index_file_header_t ) ] ),
+	     data_size - sizeof( evtx_index_file_header_t ) - 4,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate CRC-32 checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( stored_checksum != calculated_checksum )
+	{
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: mismatch in index file entries CRC-32 checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).\n",
+			 function,
+			 stored_checksum,
+			 calculated_checksum );
+		}
+#endif
+		return( 0 );
+	}
+	/* The record entries must reference the chunks in the index file
+	 */
+	data_offset = sizeof( evtx_index_file_header_t )
+	            + ( (size_t) number_of_chunk_entries * sizeof( evtx_index_file_chunk_entry_t ) );
+
+	while( data_offset < ( data_size - 4 ) )
+	{
+		record_entry_data = (const evtx_index_file_record_entry_t *) &( data[ data_offset ] );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 record_entry_data->chunk_index,
+		 chunk_index );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 record_entry_data->chunk_data_offset,
+		 chunk_data_offset );
+
+		if( ( (uint32_t) chunk_index >= number_of_chunk_entries )
+		 || ( (uint32_t) chunk_data_offset >= io_handle->chunk_size ) )
+		{
+			return( 0 );
+		}
+		data_offset += sizeof( evtx_index_file_record_entry_t );
+	}
+	if( number_of_chunk_entries > 0 )
+	{
+		if( libevtx_index_file_resize_chunk_entries(
+		     index_file,
+		     (int) number_of_chunk_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize chunk entries.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* The chunks are compared using their header checksum, which covers
+	 * the checksum of the event records data, to detect records written
+	 * since the index file was written
+	 */
+	data_offset           = sizeof( evtx_index_file_header_t );
+	chunk_checksum_offset = io_handle->chunks_data_offset
+	                      + (off64_t) offsetof( evtx_chunk_header_t, checksum );
+
+	for( entry_index = 0;
+	     entry_index < number_of_chunk_entries;
+	     entry_index++ )
+	{
+		chunk_entry_data = (const evtx_index_file_chunk_entry_t *) &( data[ data_offset ] );
+
+		if( libbfio_handle_seek_offset(
+		     file_io_handle,
+		     chunk_checksum_offset,
+		     SEEK_SET,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek chunk: %" PRIu32 " header checksum offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 entry_index,
+			 chunk_checksum_offset,
+			 chunk_checksum_offset );
+
+			return( -1 );
+		}
+		read_count = libbfio_handle_read_buffer(
+		              file_io_handle,
+		              chunk_header_checksum_data,
+		              4,
+		              error );
+
+		if( read_count != (ssize_t) 4 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read chunk: %" PRIu32 " header checksum.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( memory_compare(
+		     chunk_entry_data->header_checksum,
+		     chunk_header_checksum_data,
+		     4 ) != 0 )
+		{
+#if defined( HAVE_VERBOSE_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: index file is stale - chunk: %" PRIu32 " was changed.\n",
+				 function,
+				 entry_index );
+			}
+#endif
+			return( 0 );
+		}
+		chunk_entry = &( index_file->chunk_entries[ entry_index ] );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 chunk_entry_data->header_checksum,
+		 chunk_entry->header_checksum );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 chunk_entry_data->flags,
+		 chunk_entry->flags );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 chunk_entry_data->first_record_identifier,
+		 chunk_entry->first_record_identifier );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 chunk_entry_data->last_record_identifier,
+		 chunk_entry->last_record_identifier );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 chunk_entry_data->first_written_time,
+		 chunk_entry->first_written_time );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 chunk_entry_data->last_written_time,
+		 chunk_entry->last_written_time );
+
+		data_offset           += sizeof( evtx_index_file_chunk_entry_t );
+		chunk_checksum_offset += io_handle->chunk_size;
+	}
+	index_file->number_of_chunk_entries = (int) number_of_chunk_entries;
+
+	return( 1 );
+}
+
+/* Reads the index file
+ * The records indexes are only filled if the index file exists and matches the current state of the file
+ * Returns 1 if successful, 0 if no usable index file was found or -1 on error
+ */
+int libevtx_index_file_read(
+     libevtx_index_file_t *index_file,
+     libevtx_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     size64_t file_size,
+     libevtx_record_index_t *records_index,
+     libevtx_record_index_t *recovered_records_index,
+     libbfio_handle_t *index_file_io_handle,
+     libcerror_error_t **error )
+{
+	uint8_t *index_data               = NULL;
+	static char *function             = "libevtx_index_file_read";
+	size64_t index_file_size          = 0;
+	size_t data_offset                = 0;
+	size_t index_data_size            = 0;
+	ssize_t read_count                = 0;
+	uint32_t number_of_chunk_entries  = 0;
+	uint32_t number_of_record_entries = 0;
+	uint32_t value_32bit              = 0;
+	int index_file_io_handle_is_open  = 0;
+	int result                        = 0;
+
+	if( index_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index file.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( records_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records index.",
+		 function );
+
+		return( -1 );
+	}
+	if( records_index->number_of_entries != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid records index - entries already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( recovered_records_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid recovered records index.",
+		 function );
+
+		return( -1 );
+	}
+	if( recovered_records_index->number_of_entries != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid recovered records index - entries already set.",
+		 function );
+
+		return( -1 );
+	}
+	result = libbfio_handle_exists(
+	          index_file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to determine if index file exists.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libbfio_handle_open(
+	     index_file_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open index file.",
+		 function );
+
+		goto on_error;
+	}
+	index_file_io_handle_is_open = 1;
+
+	if( libbfio_handle_get_size(
+	     index_file_io_handle,
+	     &index_file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve index file size.",
+		 function );
+
+		goto on_error;
+	}
+	/* An index file contains at most 8-byte entries for the records in the file
+	 * hence it cannot be significantly larger than the file itself
+	 */
+	if( ( index_file_size < ( sizeof( evtx_index_file_header_t ) + 4 ) )
+	 || ( index_file_size > (size64_t) SSIZE_MAX )
+	 || ( index_file_size > ( file_size + ( (size64_t) UINT16_MAX + 1 ) * sizeof( evtx_index_file_chunk_entry_t ) + sizeof( evtx_index_file_header_t ) + 4 ) ) )
+	{
+		result = 0;
+	}
+	else
+	{
+		index_data_size = (size_t) index_file_size;
+
+		index_data = (uint8_t *) memory_allocate(
+		                          sizeof( uint8_t ) * index_data_size );
+
+		if( index_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create index data.",
+			 function );
+
+			goto on_error;
+		}
+		read_count = libbfio_handle_read_buffer(
+		              index_file_io_handle,
+		              index_data,
+		              index_data_size,
+		              error );
+
+		if( read_count != (ssize_t) index_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read index data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	index_file_io_handle_is_open = 0;
+
+	if( libbfio_handle_close(
+	     index_file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close index file.",
+		 function );
+
+		goto on_error;
+	}
+	if( index_data != NULL )
+	{
+		result = libevtx_index_file_read_data(
+		          index_file,
+		          io_handle,
+		          file_io_handle,
+		          file_size,
+		          index_data,
+		          index_data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read index data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( result != 0 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (evtx_index_file_header_t *) index_data )->number_of_chunk_entries,
+		 number_of_chunk_entries );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (evtx_index_file_header_t *) index_data )->number_of_record_entries,
+		 number_of_record_entries );
+
+		data_offset = sizeof( evtx_index_file_header_t )
+		            + ( (size_t) number_of_chunk_entries * sizeof( evtx_index_file_chunk_entry_t ) );
+
+		if( libevtx_index_file_copy_record_entries_from_data(
+		     records_index,
+		     &( index_data[ data_offset ] ),
+		     index_data_size - data_offset,
+		     (int) number_of_record_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy record entries from index data.",
+			 function );
+
+			goto on_error;
+		}
+		data_offset += (size_t) number_of_record_entries * sizeof( evtx_index_file_record_entry_t );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (evtx_index_file_header_t *) index_data )->number_of_recovered_record_entries,
+		 number_of_record_entries );
+
+		if( libevtx_index_file_copy_record_entries_from_data(
+		     recovered_records_index,
+		     &( index_data[ data_offset ] ),
+		     index_data_size - data_offset,
+		     (int) number_of_record_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy recovered record entries from index data.",
+			 function );
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (evtx_index_file_header_t *) index_data )->flags,
+		 value_32bit );
+
+		io_handle->flags |= (uint8_t) value_32bit;
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (evtx_index_file_header_t *) index_data )->chunks_data_size,
+		 io_handle->chunks_data_size );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (evtx_index_file_header_t *) index_data )->first_record_identifier,
+		 io_handle->first_record_identifier );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (evtx_index_file_header_t *) index_data )->last_record_identifier,
+		 io_handle->last_record_identifier );
+	}
+	if( index_data != NULL )
+	{
+		memory_free(
+		 index_data );
+	}
+	return( result );
+
+on_error:
+	if( index_file_io_handle_is_open != 0 )
+	{
+		libbfio_handle_close(
+		 index_file_io_handle,
+		 NULL );
+	}
+	if( index_data != NULL )
+	{
+		memory_free(
+		 index_data );
+	}
+	/* Make sure the file falls back to scanning the chunks
+	 */
+	index_file->number_of_chunk_entries        = 0;
+	records_index->number_of_entries           = 0;
+	recovered_records_index->number_of_entries = 0;
+
+	return( -1 );
+}
+
@@ -0,0 +1,162 @@
+/*
+ * Index file functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_INDEX_FILE_H )
+#define _LIBEVTX_INDEX_FILE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_chunk.h"
+#include "libevtx_io_handle.h"
+#include "libevtx_libbfio.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_record_index.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+extern const uint8_t *evtx_index_file_signature;
+
+typedef struct libevtx_index_file_chunk_entry libevtx_index_file_chunk_entry_t;
+
+struct libevtx_index_file_chunk_entry
+{
+	/* The checksum of the chunk header
+	 */
+	uint32_t header_checksum;
+
+	/* The chunk flags
+	 */
+	uint32_t flags;
+
+	/* The first record identifier
+	 */
+	uint64_t first_record_identifier;
+
+	/* The last record identifier
+	 */
+	uint64_t last_record_identifier;
+
+	/* The first written time
+	 */
+	uint64_t first_written_time;
+
+	/* The last written time
+	 */
+	uint64_t last_written_time;
+};
+
+typedef struct libevtx_index_file libevtx_index_file_t;
+
+struct libevtx_index_file
+{
+	/* The chunk entries
+	 */
+	libevtx_index_file_chunk_entry_t *chunk_entries;
+
+	/* The number of chunk entries
+	 */
+	int number_of_chunk_entries;
+
+	/* The number of allocated chunk entries
+	 */
+	int number_of_allocated_chunk_entries;
+};
+
+int libevtx_index_file_initialize(
+     libevtx_index_file_t **index_file,
+     libcerror_error_t **error );
+
+int libevtx_index_file_free(
+     libevtx_index_file_t **index_file,
+     libcerror_error_t **error );
+
+int libevtx_index_file_resize_chunk_entries(
+     libevtx_index_file_t *index_file,
+     int number_of_chunk_entries,
+     libcerror_error_t **error );
+
+int libevtx_index_file_append_chunk_entry(
+     libevtx_index_file_t *index_file,
+     libevtx_chunk_t *chunk,
+     libcerror_error_t **error );
+
+int libevtx_index_file_set_chunk_entry_by_index(
+     libevtx_index_file_t *index_file,
+     int chunk_entry_index,
+     libevtx_chunk_t *chunk,
+     libcerror_error_t **error );
+
+int libevtx_index_file_get_chunk_entry_by_index(
+     libevtx_index_file_t *index_file,
+     int chunk_entry_index,
+     libevtx_index_file_chunk_entry_t **chunk_entry,
+     libcerror_error_t **error );
+
+int libevtx_index_file_copy_record_entries_to_data(
+     libevtx_record_index_t *record_index,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libevtx_index_file_copy_record_entries_from_data(
+     libevtx_record_index_t *record_index,
+     const uint8_t *data,
+     size_t data_size,
+     int number_of_entries,
+     libcerror_error_t **error );
+
+int libevtx_index_file_write(
+     libevtx_index_file_t *index_file,
+     libevtx_io_handle_t *io_handle,
+     size64_t file_size,
+     libevtx_record_index_t *records_index,
+     libevtx_record_index_t *recovered_records_index,
+     libbfio_handle_t *index_file_io_handle,
+     libcerror_error_t **error );
+
+int libevtx_index_file_read_data(
+     libevtx_index_file_t *index_file,
+     libevtx_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     size64_t file_size,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libevtx_index_file_read(
+     libevtx_index_file_t *index_file,
+     libevtx_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     size64_t file_size,
+     libevtx_record_index_t *records_index,
+     libevtx_record_index_t *recovered_records_index,
+     libbfio_handle_t *index_file_io_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_INDEX_FILE_H ) */
+
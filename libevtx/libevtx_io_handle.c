@@ -33,8 +33,11 @@
 #include "libevtx_libbfio.h"
 #include "libevtx_libcerror.h"
 #include "libevtx_libcnotify.h"
+#include "libevtx_libcthreads.h"
 #include "libevtx_libfcache.h"
 #include "libevtx_libfdata.h"
+#include "libevtx_names_table.h"
+#include "libevtx_statistics.h"
 #include "libevtx_unused.h"
 
 #include "evtx_file_header.h"
@@ -104,6 +107,21 @@ int libevtx_io_handle_initialize(
 	( *io_handle )->chunk_size     = 0x00010000UL;
 	( *io_handle )->ascii_codepage = LIBEVTX_CODEPAGE_WINDOWS_1252;
 
+#if defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *io_handle )->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
 	return( 1 );
 
 on_error:
@@ -140,6 +158,37 @@ int libevtx_io_handle_free(
 	}
 	if( *io_handle != NULL )
 	{
+		if( ( *io_handle )->names_table != NULL )
+		{
+			if( libevtx_names_table_free(
+			     &( ( *io_handle )->names_table ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free names table.",
+				 function );
+
+				result = -1;
+			}
+		}
+#if defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( ( *io_handle )->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
 		memory_free(
 		 *io_handle );
 
@@ -157,6 +206,10 @@ int libevtx_io_handle_clear(
 {
 	static char *function = "libevtx_io_handle_clear";
 
+#if defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_t *read_write_lock = NULL;
+#endif
+
 	if( io_handle == NULL )
 	{
 		libcerror_error_set(
@@ -168,6 +221,25 @@ int libevtx_io_handle_clear(
 
 		return( -1 );
 	}
+	if( io_handle->names_table != NULL )
+	{
+		if( libevtx_names_table_free(
+		     &( io_handle->names_table ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free names table.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#if defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT )
+	read_write_lock = io_handle->read_write_lock;
+#endif
 	if( memory_set(
 	     io_handle,
 	     0,
@@ -185,9 +257,116 @@ int libevtx_io_handle_clear(
 	io_handle->chunk_size     = 0x00010000UL;
 	io_handle->ascii_codepage = LIBEVTX_CODEPAGE_WINDOWS_1252;
 
+#if defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT )
+	io_handle->read_write_lock = read_write_lock;
+#endif
 	return( 1 );
 }
 
+/* Reads data at a specific offset
+ * The file IO handle is shared by the file and its records, hence the seek
+ * and read are done while holding the read/write lock
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libevtx_io_handle_read_data_at_offset(
+         libevtx_io_handle_t *io_handle,
+         libbfio_handle_t *file_io_handle,
+         off64_t offset,
+         uint8_t *data,
+         size_t data_size,
+         libcerror_error_t **error )
+{
+	static char *function = "libevtx_io_handle_read_data_at_offset";
+	ssize_t read_count    = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     io_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libbfio_handle_seek_offset(
+	     file_io_handle,
+	     offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		goto on_error;
+	}
+	read_count = libbfio_handle_read_buffer(
+	              file_io_handle,
+	              data,
+	              data_size,
+	              error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     io_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( read_count );
+
+on_error:
+#if defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 io_handle->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
 /* Reads the file (or database) header
  * Returns 1 if successful or -1 on error
  */
@@ -232,22 +411,6 @@ int libevtx_io_handle_read_file_header(
 		 file_offset );
 	}
 #endif
-	if( libbfio_handle_seek_offset(
-	     file_io_handle,
-	     file_offset,
-	     SEEK_SET,
-	     error ) == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek file header offset: %" PRIi64 ".",
-		 function,
-		 file_offset );
-
-		return( -1 );
-	}
 	file_header_data = (uint8_t *) memory_allocate(
 	                                sizeof( uint8_t ) * read_size );
 
@@ -262,8 +425,10 @@ int libevtx_io_handle_read_file_header(
 
 		return( -1 );
 	}
-	read_count = libbfio_handle_read_buffer(
+	read_count = libevtx_io_handle_read_data_at_offset(
+	              io_handle,
 	              file_io_handle,
+	              file_offset,
 	              file_header_data,
 	              read_size,
 	              error );
@@ -274,11 +439,16 @@ int libevtx_io_handle_read_file_header(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read file header.",
-		 function );
+		 "%s: unable to read file header at offset: %" PRIi64 ".",
+		 function,
+		 file_offset );
 
 		goto on_error;
 	}
+	libevtx_statistics_counter_add(
+	 io_handle->statistics_counters.number_of_bytes_read,
+	 read_count );
+
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -440,6 +610,8 @@ int libevtx_io_handle_read_file_header(
 
 		goto on_error;
 	}
+	io_handle->file_header_checksum = stored_checksum;
+
 	if( stored_checksum != calculated_checksum )
 	{
 #if defined( HAVE_VERBOSE_OUTPUT )
@@ -529,6 +701,7 @@ int libevtx_io_handle_read_chunk(
 {
 	libevtx_chunk_t *chunk = NULL;
 	static char *function  = "libevtx_io_handle_read_chunk";
+	uint64_t start_time    = 0;
 
 	LIBEVTX_UNREFERENCED_PARAMETER( element_data_file_index );
 	LIBEVTX_UNREFERENCED_PARAMETER( element_data_size );
@@ -548,6 +721,8 @@ int libevtx_io_handle_read_chunk(
 
 		goto on_error;
 	}
+	start_time = libevtx_statistics_get_time();
+
 	if( libevtx_chunk_read(
 	     chunk,
 	     io_handle,
@@ -564,6 +739,14 @@ int libevtx_io_handle_read_chunk(
 
 		goto on_error;
 	}
+	libevtx_statistics_counter_add(
+	 io_handle->statistics_counters.chunk_read_time,
+	 libevtx_statistics_get_time() - start_time );
+
+	libevtx_statistics_counter_add(
+	 io_handle->statistics_counters.number_of_chunk_cache_misses,
+	 1 );
+
 	if( libfdata_vector_set_element_value_by_index(
 	     vector,
 	     (intptr_t *) file_io_handle,
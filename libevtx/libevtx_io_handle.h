@@ -27,8 +27,11 @@
 
 #include "libevtx_libbfio.h"
 #include "libevtx_libcerror.h"
+#include "libevtx_libcthreads.h"
 #include "libevtx_libfcache.h"
 #include "libevtx_libfdata.h"
+#include "libevtx_names_table.h"
+#include "libevtx_statistics.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -64,6 +67,10 @@ struct libevtx_io_handle
 	 */
 	uint32_t file_flags;
 
+	/* The file header checksum
+	 */
+	uint32_t file_header_checksum;
+
 	/* The chunk size
 	 */
 	uint32_t chunk_size;
@@ -84,9 +91,23 @@ struct libevtx_io_handle
 	 */
 	int ascii_codepage;
 
+	/* The names table, which contains the event data names of the records
+	 */
+	libevtx_names_table_t *names_table;
+
+	/* The statistics counters
+	 */
+	libevtx_statistics_counters_t statistics_counters;
+
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
+
+#if defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT )
+	/* The read/write lock, that serializes the seek and read of the file IO handle
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
 };
 
 int libevtx_io_handle_initialize(
@@ -101,6 +122,14 @@ int libevtx_io_handle_clear(
      libevtx_io_handle_t *io_handle,
      libcerror_error_t **error );
 
+ssize_t libevtx_io_handle_read_data_at_offset(
+     libevtx_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t offset,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
 int libevtx_io_handle_read_file_header(
      libevtx_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
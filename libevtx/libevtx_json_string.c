@@ -0,0 +1,1858 @@
+/*
+ * JSON string functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevtx_json_string.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_libfvalue.h"
+#include "libevtx_libfwevt.h"
+
+/* Creates a JSON string
+ * Make sure the value json_string is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_json_string_initialize(
+     libevtx_json_string_t **json_string,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_json_string_initialize";
+
+	if( json_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid JSON string.",
+		 function );
+
+		return( -1 );
+	}
+	if( *json_string != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid JSON string value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*json_string = memory_allocate_structure(
+	                libevtx_json_string_t );
+
+	if( *json_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create JSON string.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *json_string,
+	     0,
+	     sizeof( libevtx_json_string_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear JSON string.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *json_string != NULL )
+	{
+		memory_free(
+		 *json_string );
+
+		*json_string = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a JSON string
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_json_string_free(
+     libevtx_json_string_t **json_string,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_json_string_free";
+
+	if( json_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid JSON string.",
+		 function );
+
+		return( -1 );
+	}
+	if( *json_string != NULL )
+	{
+		if( ( *json_string )->string != NULL )
+		{
+			memory_free(
+			 ( *json_string )->string );
+		}
+		if( ( *json_string )->value_string != NULL )
+		{
+			memory_free(
+			 ( *json_string )->value_string );
+		}
+		if( ( *json_string )->name_string != NULL )
+		{
+			memory_free(
+			 ( *json_string )->name_string );
+		}
+		memory_free(
+		 *json_string );
+
+		*json_string = NULL;
+	}
+	return( 1 );
+}
+
+/* Resizes the JSON string so that it can contain at least string size bytes
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_json_string_resize(
+     libevtx_json_string_t *json_string,
+     size_t string_size,
+     libcerror_error_t **error )
+{
+	uint8_t *reallocation = NULL;
+	static char *function = "libevtx_json_string_resize";
+
+	if( json_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid JSON string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size <= json_string->string_size )
+	{
+		return( 1 );
+	}
+	/* Grow the string at least twofold to limit the number of reallocations
+	 */
+	if( string_size < ( 2 * json_string->string_size ) )
+	{
+		string_size = 2 * json_string->string_size;
+	}
+	if( string_size < 1024 )
+	{
+		string_size = 1024;
+	}
+	if( string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	reallocation = (uint8_t *) memory_reallocate(
+	                            json_string->string,
+	                            sizeof( uint8_t ) * string_size );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize string.",
+		 function );
+
+		return( -1 );
+	}
+	json_string->string      = reallocation;
+	json_string->string_size = string_size;
+
+	return( 1 );
+}
+
+/* Appends data to the JSON string
+ * The data is appended as-is and should not contain an end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_json_string_append_data(
+     libevtx_json_string_t *json_string,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_json_string_append_data";
+
+	if( json_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid JSON string.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_json_string_resize(
+	     json_string,
+	     json_string->string_length + data_size + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize string.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     &( json_string->string[ json_string->string_length ] ),
+	     data,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy data.",
+		 function );
+
+		return( -1 );
+	}
+	json_string->string_length += data_size;
+
+	json_string->string[ json_string->string_length ] = 0;
+
+	return( 1 );
+}
+
+/* Appends an UTF-8 string to the JSON string as a quoted and escaped JSON string
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_json_string_append_utf8_string(
+     libevtx_json_string_t *json_string,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error )
+{
+	static char *function    = "libevtx_json_string_append_utf8_string";
+	size_t string_index      = 0;
+	size_t utf8_string_index = 0;
+	uint8_t character_value  = 0;
+	uint8_t nibble           = 0;
+
+	if( json_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid JSON string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_string == NULL )
+	 && ( utf8_string_length > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) ( SSIZE_MAX / 6 ) - 3 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* Reserve space for the quotes, the end of string character and
+	 * the worst case escape sequence \u00## for every character
+	 */
+	if( libevtx_json_string_resize(
+	     json_string,
+	     json_string->string_length + ( 6 * utf8_string_length ) + 3,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize string.",
+		 function );
+
+		return( -1 );
+	}
+	string_index = json_string->string_length;
+
+	json_string->string[ string_index++ ] = (uint8_t) '"';
+
+	for( utf8_string_index = 0;
+	     utf8_string_index < utf8_string_length;
+	     utf8_string_index++ )
+	{
+		character_value = utf8_string[ utf8_string_index ];
+
+		if( ( character_value == (uint8_t) '"' )
+		 || ( character_value == (uint8_t) '\\' ) )
+		{
+			json_string->string[ string_index++ ] = (uint8_t) '\\';
+			json_string->string[ string_index++ ] = character_value;
+		}
+		else if( character_value == (uint8_t) '\n' )
+		{
+			json_string->string[ string_index++ ] = (uint8_t) '\\';
+			json_string->string[ string_index++ ] = (uint8_t) 'n';
+		}
+		else if( character_value == (uint8_t) '\r' )
+		{
+			json_string->string[ string_index++ ] = (uint8_t) '\\';
+			json_string->string[ string_index++ ] = (uint8_t) 'r';
+		}
+		else if( character_value == (uint8_t) '\t' )
+		{
+			json_string->string[ string_index++ ] = (uint8_t) '\\';
+			json_string->string[ string_index++ ] = (uint8_t) 't';
+		}
+		else if( character_value < 0x20 )
+		{
+			json_string->string[ string_index++ ] = (uint8_t) '\\';
+			json_string->string[ string_index++ ] = (uint8_t) 'u';
+			json_string->string[ string_index++ ] = (uint8_t) '0';
+			json_string->string[ string_index++ ] = (uint8_t) '0';
+
+			nibble = character_value >> 4;
+
+			json_string->string[ string_index++ ] = (uint8_t) '0' + nibble;
+
+			nibble = character_value & 0x0f;
+
+			if( nibble < 10 )
+			{
+				json_string->string[ string_index++ ] = (uint8_t) '0' + nibble;
+			}
+			else
+			{
+				json_string->string[ string_index++ ] = (uint8_t) 'a' + nibble - 10;
+			}
+		}
+		else
+		{
+			json_string->string[ string_index++ ] = character_value;
+		}
+	}
+	json_string->string[ string_index++ ] = (uint8_t) '"';
+
+	json_string->string[ string_index ] = 0;
+
+	json_string->string_length = string_index;
+
+	return( 1 );
+}
+
+/* Copies the UTF-8 encoded name of a XML tag into a (re)allocated buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_json_string_copy_xml_tag_name(
+     libfwevt_xml_tag_t *xml_tag,
+     uint8_t **name,
+     size_t *name_size,
+     size_t *name_length,
+     libcerror_error_t **error )
+{
+	uint8_t *reallocation = NULL;
+	static char *function = "libevtx_json_string_copy_xml_tag_name";
+	size_t utf8_name_size = 0;
+
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name size.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name length.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_tag_get_utf8_name_size(
+	     xml_tag,
+	     &utf8_name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 name size of XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_name_size == 0 )
+	{
+		*name_length = 0;
+
+		return( 1 );
+	}
+	if( utf8_name_size > *name_size )
+	{
+		reallocation = (uint8_t *) memory_reallocate(
+		                            *name,
+		                            sizeof( uint8_t ) * utf8_name_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize name.",
+			 function );
+
+			return( -1 );
+		}
+		*name      = reallocation;
+		*name_size = utf8_name_size;
+	}
+	if( libfwevt_xml_tag_get_utf8_name(
+	     xml_tag,
+	     *name,
+	     utf8_name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 name of XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	*name_length = utf8_name_size - 1;
+
+	return( 1 );
+}
+
+/* Compares the names of two XML tags
+ * Returns 1 if the names are equal, 0 if not or -1 on error
+ */
+int libevtx_json_string_compare_xml_tag_names(
+     libevtx_json_string_t *json_string,
+     libfwevt_xml_tag_t *first_xml_tag,
+     libfwevt_xml_tag_t *second_xml_tag,
+     libcerror_error_t **error )
+{
+	static char *function     = "libevtx_json_string_compare_xml_tag_names";
+	size_t first_name_length  = 0;
+	size_t second_name_length = 0;
+
+	if( json_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid JSON string.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_json_string_copy_xml_tag_name(
+	     first_xml_tag,
+	     &( json_string->name_string ),
+	     &( json_string->name_string_size ),
+	     &first_name_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy name of first XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_json_string_copy_xml_tag_name(
+	     second_xml_tag,
+	     &( json_string->value_string ),
+	     &( json_string->value_string_size ),
+	     &second_name_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy name of second XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_name_length != second_name_length )
+	{
+		return( 0 );
+	}
+	if( first_name_length == 0 )
+	{
+		return( 1 );
+	}
+	if( memory_compare(
+	     json_string->name_string,
+	     json_string->value_string,
+	     first_name_length ) != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Compares the name of a XML tag with an UTF-8 encoded name
+ * Returns 1 if the names are equal, 0 if not or -1 on error
+ */
+int libevtx_json_string_compare_xml_tag_name(
+     libevtx_json_string_t *json_string,
+     libfwevt_xml_tag_t *xml_tag,
+     const uint8_t *name,
+     size_t name_length,
+     libcerror_error_t **error )
+{
+	static char *function      = "libevtx_json_string_compare_xml_tag_name";
+	size_t xml_tag_name_length = 0;
+
+	if( json_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid JSON string.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_json_string_copy_xml_tag_name(
+	     xml_tag,
+	     &( json_string->name_string ),
+	     &( json_string->name_string_size ),
+	     &xml_tag_name_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy name of XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( xml_tag_name_length != name_length )
+	{
+		return( 0 );
+	}
+	if( memory_compare(
+	     json_string->name_string,
+	     name,
+	     name_length ) != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Appends the name of a XML tag to the JSON string as a quoted JSON string
+ * The name prefix is prepended to the name unless it is 0
+ * XML names cannot contain characters that require escaping in JSON
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_json_string_append_xml_tag_name(
+     libevtx_json_string_t *json_string,
+     libfwevt_xml_tag_t *xml_tag,
+     uint8_t name_prefix,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_json_string_append_xml_tag_name";
+	size_t name_size      = 0;
+	size_t string_index   = 0;
+
+	if( json_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid JSON string.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_tag_get_utf8_name_size(
+	     xml_tag,
+	     &name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 name size of XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_json_string_resize(
+	     json_string,
+	     json_string->string_length + name_size + 4,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize string.",
+		 function );
+
+		return( -1 );
+	}
+	string_index = json_string->string_length;
+
+	json_string->string[ string_index++ ] = (uint8_t) '"';
+
+	if( name_prefix != 0 )
+	{
+		json_string->string[ string_index++ ] = name_prefix;
+	}
+	if( name_size > 1 )
+	{
+		if( libfwevt_xml_tag_get_utf8_name(
+		     xml_tag,
+		     &( json_string->string[ string_index ] ),
+		     name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-8 name of XML tag.",
+			 function );
+
+			return( -1 );
+		}
+		string_index += name_size - 1;
+	}
+	json_string->string[ string_index++ ] = (uint8_t) '"';
+
+	json_string->string[ string_index ] = 0;
+
+	json_string->string_length = string_index;
+
+	return( 1 );
+}
+
+/* Appends the value of a XML tag to the JSON string as a quoted JSON string
+ * A value with multiple value entries is concatenated into a single JSON string
+ * Returns 1 if successful, 0 if the XML tag has no value or -1 on error
+ */
+int libevtx_json_string_append_xml_tag_value(
+     libevtx_json_string_t *json_string,
+     libfwevt_xml_tag_t *xml_tag,
+     libcerror_error_t **error )
+{
+	libfvalue_value_t *value    = NULL;
+	uint8_t *reallocation       = NULL;
+	static char *function       = "libevtx_json_string_append_xml_tag_value";
+	size_t value_string_length  = 0;
+	size_t value_string_size    = 0;
+	int number_of_value_entries = 0;
+	int result                  = 0;
+	int value_entry_index       = 0;
+
+	if( json_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid JSON string.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_tag_get_value(
+	     xml_tag,
+	     &value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value of XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		return( 0 );
+	}
+	result = libfvalue_value_has_data(
+	          value,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if value has data.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libfvalue_value_get_number_of_value_entries(
+	     value,
+	     &number_of_value_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of value entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_value_entries == 0 )
+	{
+		number_of_value_entries = 1;
+	}
+	/* A value with multiple value entries, such as text that contains
+	 * character or entity references, is concatenated into a single string
+	 */
+	for( value_entry_index = 0;
+	     value_entry_index < number_of_value_entries;
+	     value_entry_index++ )
+	{
+		if( libfvalue_value_get_utf8_string_size(
+		     value,
+		     value_entry_index,
+		     &value_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-8 string size of value entry: %d.",
+			 function,
+			 value_entry_index );
+
+			return( -1 );
+		}
+		if( value_string_size == 0 )
+		{
+			continue;
+		}
+		if( value_string_size > ( (size_t) SSIZE_MAX - value_string_length ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid value string size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		value_string_size += value_string_length;
+
+		if( value_string_size > json_string->value_string_size )
+		{
+			reallocation = (uint8_t *) memory_reallocate(
+			                            json_string->value_string,
+			                            sizeof( uint8_t ) * value_string_size );
+
+			if( reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize value string.",
+				 function );
+
+				return( -1 );
+			}
+			json_string->value_string      = reallocation;
+			json_string->value_string_size = value_string_size;
+		}
+		if( libfvalue_value_copy_to_utf8_string(
+		     value,
+		     value_entry_index,
+		     &( json_string->value_string[ value_string_length ] ),
+		     value_string_size - value_string_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy value entry: %d to UTF-8 string.",
+			 function,
+			 value_entry_index );
+
+			return( -1 );
+		}
+		while( value_string_length < value_string_size )
+		{
+			if( json_string->value_string[ value_string_length ] == 0 )
+			{
+				break;
+			}
+			value_string_length++;
+		}
+	}
+	if( libevtx_json_string_append_utf8_string(
+	     json_string,
+	     json_string->value_string,
+	     value_string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append value.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends an EventData XML tag to the JSON string as an object of Name/Value pairs
+ * This mapping is only applied when every sub element is a Data element with
+ * a single Name attribute and no sub elements
+ * Returns 1 if successful, 0 if the mapping does not apply or -1 on error
+ */
+int libevtx_json_string_append_event_data_xml_tag(
+     libevtx_json_string_t *json_string,
+     libfwevt_xml_tag_t *xml_tag,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_tag_t *data_xml_tag = NULL;
+	libfwevt_xml_tag_t *name_xml_tag = NULL;
+	static char *function            = "libevtx_json_string_append_event_data_xml_tag";
+	int data_number_of_attributes    = 0;
+	int data_number_of_elements      = 0;
+	int element_index                = 0;
+	int number_of_attributes         = 0;
+	int number_of_elements           = 0;
+	int result                       = 0;
+
+	if( json_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid JSON string.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_tag_get_number_of_attributes(
+	     xml_tag,
+	     &number_of_attributes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of attributes.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_tag_get_number_of_elements(
+	     xml_tag,
+	     &number_of_elements,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of elements.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_attributes != 0 )
+	 || ( number_of_elements == 0 ) )
+	{
+		return( 0 );
+	}
+	for( element_index = 0;
+	     element_index < number_of_elements;
+	     element_index++ )
+	{
+		if( libfwevt_xml_tag_get_element_by_index(
+		     xml_tag,
+		     element_index,
+		     &data_xml_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve element: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		result = libevtx_json_string_compare_xml_tag_name(
+		          json_string,
+		          data_xml_tag,
+		          (uint8_t *) "Data",
+		          4,
+		          error );
+
+		if( result != 1 )
+		{
+			break;
+		}
+		if( libfwevt_xml_tag_get_number_of_attributes(
+		     data_xml_tag,
+		     &data_number_of_attributes,
+		     error ) != 1 )
+		{
+			result = -1;
+
+			break;
+		}
+		if( libfwevt_xml_tag_get_number_of_elements(
+		     data_xml_tag,
+		     &data_number_of_elements,
+		     error ) != 1 )
+		{
+			result = -1;
+
+			break;
+		}
+		if( ( data_number_of_attributes != 1 )
+		 || ( data_number_of_elements != 0 ) )
+		{
+			result = 0;
+
+			break;
+		}
+		result = libfwevt_xml_tag_get_attribute_by_utf8_name(
+		          data_xml_tag,
+		          (uint8_t *) "Name",
+		          4,
+		          &name_xml_tag,
+		          error );
+
+		if( result != 1 )
+		{
+			break;
+		}
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if element: %d is a named Data element.",
+		 function,
+		 element_index );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libevtx_json_string_append_data(
+	     json_string,
+	     (uint8_t *) "{",
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append object start.",
+		 function );
+
+		return( -1 );
+	}
+	for( element_index = 0;
+	     element_index < number_of_elements;
+	     element_index++ )
+	{
+		if( element_index > 0 )
+		{
+			if( libevtx_json_string_append_data(
+			     json_string,
+			     (uint8_t *) ",",
+			     1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append member separator.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( libfwevt_xml_tag_get_element_by_index(
+		     xml_tag,
+		     element_index,
+		     &data_xml_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve element: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		if( libfwevt_xml_tag_get_attribute_by_utf8_name(
+		     data_xml_tag,
+		     (uint8_t *) "Name",
+		     4,
+		     &name_xml_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve Name attribute of element: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		result = libevtx_json_string_append_xml_tag_value(
+		          json_string,
+		          name_xml_tag,
+		          error );
+
+		if( result == 0 )
+		{
+			result = libevtx_json_string_append_data(
+			          json_string,
+			          (uint8_t *) "\"\"",
+			          2,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append name of element: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		if( libevtx_json_string_append_data(
+		     json_string,
+		     (uint8_t *) ":",
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append name separator.",
+			 function );
+
+			return( -1 );
+		}
+		result = libevtx_json_string_append_xml_tag_value(
+		          json_string,
+		          data_xml_tag,
+		          error );
+
+		if( result == 0 )
+		{
+			result = libevtx_json_string_append_data(
+			          json_string,
+			          (uint8_t *) "null",
+			          4,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append value of element: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+	}
+	if( libevtx_json_string_append_data(
+	     json_string,
+	     (uint8_t *) "}",
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append object end.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a XML tag to the JSON string
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_json_string_append_xml_tag(
+     libevtx_json_string_t *json_string,
+     libfwevt_xml_tag_t *xml_tag,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_tag_t *attribute_xml_tag    = NULL;
+	libfwevt_xml_tag_t *element_xml_tag      = NULL;
+	libfwevt_xml_tag_t *next_element_xml_tag = NULL;
+	static char *function                    = "libevtx_json_string_append_xml_tag";
+	size_t string_length                     = 0;
+	int attribute_index                      = 0;
+	int element_index                        = 0;
+	int in_array                             = 0;
+	int number_of_attributes                 = 0;
+	int number_of_elements                   = 0;
+	int number_of_members                    = 0;
+	int result                               = 0;
+	int same_name_as_next                    = 0;
+
+	if( json_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid JSON string.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_tag_get_number_of_attributes(
+	     xml_tag,
+	     &number_of_attributes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of attributes.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_tag_get_number_of_elements(
+	     xml_tag,
+	     &number_of_elements,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of elements.",
+		 function );
+
+		return( -1 );
+	}
+	/* An element without attributes and sub elements is mapped to its value
+	 */
+	if( ( number_of_attributes == 0 )
+	 && ( number_of_elements == 0 ) )
+	{
+		result = libevtx_json_string_append_xml_tag_value(
+		          json_string,
+		          xml_tag,
+		          error );
+
+		if( result == 0 )
+		{
+			result = libevtx_json_string_append_data(
+			          json_string,
+			          (uint8_t *) "null",
+			          4,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append value.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	result = libevtx_json_string_compare_xml_tag_name(
+	          json_string,
+	          xml_tag,
+	          (uint8_t *) "EventData",
+	          9,
+	          error );
+
+	if( result == 1 )
+	{
+		result = libevtx_json_string_append_event_data_xml_tag(
+		          json_string,
+		          xml_tag,
+		          error );
+
+		if( result == 1 )
+		{
+			return( 1 );
+		}
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append EventData.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_json_string_append_data(
+	     json_string,
+	     (uint8_t *) "{",
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append object start.",
+		 function );
+
+		return( -1 );
+	}
+	for( attribute_index = 0;
+	     attribute_index < number_of_attributes;
+	     attribute_index++ )
+	{
+		if( libfwevt_xml_tag_get_attribute_by_index(
+		     xml_tag,
+		     attribute_index,
+		     &attribute_xml_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve attribute: %d.",
+			 function,
+			 attribute_index );
+
+			return( -1 );
+		}
+		if( number_of_members > 0 )
+		{
+			if( libevtx_json_string_append_data(
+			     json_string,
+			     (uint8_t *) ",",
+			     1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append member separator.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( libevtx_json_string_append_xml_tag_name(
+		     json_string,
+		     attribute_xml_tag,
+		     (uint8_t) '@',
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append name of attribute: %d.",
+			 function,
+			 attribute_index );
+
+			return( -1 );
+		}
+		if( libevtx_json_string_append_data(
+		     json_string,
+		     (uint8_t *) ":",
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append name separator.",
+			 function );
+
+			return( -1 );
+		}
+		result = libevtx_json_string_append_xml_tag_value(
+		          json_string,
+		          attribute_xml_tag,
+		          error );
+
+		if( result == 0 )
+		{
+			result = libevtx_json_string_append_data(
+			          json_string,
+			          (uint8_t *) "null",
+			          4,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append value of attribute: %d.",
+			 function,
+			 attribute_index );
+
+			return( -1 );
+		}
+		number_of_members++;
+	}
+	if( number_of_elements == 0 )
+	{
+		/* The #text member is removed again if the element has no value
+		 */
+		string_length = json_string->string_length;
+
+		if( libevtx_json_string_append_data(
+		     json_string,
+		     (uint8_t *) ",\"#text\":",
+		     9,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append text name.",
+			 function );
+
+			return( -1 );
+		}
+		result = libevtx_json_string_append_xml_tag_value(
+		          json_string,
+		          xml_tag,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append text value.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			json_string->string_length = string_length;
+
+			json_string->string[ string_length ] = 0;
+		}
+	}
+	/* Consecutive sub elements with the same name are grouped into an array
+	 */
+	for( element_index = 0;
+	     element_index < number_of_elements;
+	     element_index++ )
+	{
+		if( element_index == 0 )
+		{
+			if( libfwevt_xml_tag_get_element_by_index(
+			     xml_tag,
+			     element_index,
+			     &element_xml_tag,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve element: %d.",
+				 function,
+				 element_index );
+
+				return( -1 );
+			}
+		}
+		else
+		{
+			element_xml_tag = next_element_xml_tag;
+		}
+		same_name_as_next = 0;
+
+		if( ( element_index + 1 ) < number_of_elements )
+		{
+			if( libfwevt_xml_tag_get_element_by_index(
+			     xml_tag,
+			     element_index + 1,
+			     &next_element_xml_tag,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve element: %d.",
+				 function,
+				 element_index + 1 );
+
+				return( -1 );
+			}
+			same_name_as_next = libevtx_json_string_compare_xml_tag_names(
+			                     json_string,
+			                     element_xml_tag,
+			                     next_element_xml_tag,
+			                     error );
+
+			if( same_name_as_next == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compare names of elements: %d and %d.",
+				 function,
+				 element_index,
+				 element_index + 1 );
+
+				return( -1 );
+			}
+		}
+		if( in_array == 0 )
+		{
+			if( number_of_members > 0 )
+			{
+				if( libevtx_json_string_append_data(
+				     json_string,
+				     (uint8_t *) ",",
+				     1,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append member separator.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			if( libevtx_json_string_append_xml_tag_name(
+			     json_string,
+			     element_xml_tag,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append name of element: %d.",
+				 function,
+				 element_index );
+
+				return( -1 );
+			}
+			if( same_name_as_next != 0 )
+			{
+				result = libevtx_json_string_append_data(
+				          json_string,
+				          (uint8_t *) ":[",
+				          2,
+				          error );
+			}
+			else
+			{
+				result = libevtx_json_string_append_data(
+				          json_string,
+				          (uint8_t *) ":",
+				          1,
+				          error );
+			}
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append name separator.",
+				 function );
+
+				return( -1 );
+			}
+			number_of_members++;
+		}
+		if( libevtx_json_string_append_xml_tag(
+		     json_string,
+		     element_xml_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append element: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		result = 1;
+
+		if( same_name_as_next != 0 )
+		{
+			result = libevtx_json_string_append_data(
+			          json_string,
+			          (uint8_t *) ",",
+			          1,
+			          error );
+		}
+		else if( in_array != 0 )
+		{
+			result = libevtx_json_string_append_data(
+			          json_string,
+			          (uint8_t *) "]",
+			          1,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append array separator.",
+			 function );
+
+			return( -1 );
+		}
+		in_array = same_name_as_next;
+	}
+	if( libevtx_json_string_append_data(
+	     json_string,
+	     (uint8_t *) "}",
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append object end.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a XML document to the JSON string
+ *
+ * The XML document is mapped to JSON as follows:
+ * - the document is an object with a single member named after the root element
+ * - an element without attributes and sub elements is its value as a string,
+ *   or null if it has no value
+ * - any other element is an object where:
+ *   - attributes are members named "@" followed by the attribute name
+ *   - the value of an element without sub elements is the member "#text"
+ *   - sub elements are members named after the element, consecutive sub elements
+ *     with the same name are grouped into an array
+ * - an EventData element of which every sub element is a Data element with only
+ *   a Name attribute is an object of Name and value pairs
+ * - values are strings, the entries of a value with multiple entries are
+ *   concatenated into a single string
+ *
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_json_string_append_xml_document(
+     libevtx_json_string_t *json_string,
+     libfwevt_xml_document_t *xml_document,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_tag_t *root_xml_tag = NULL;
+	static char *function            = "libevtx_json_string_append_xml_document";
+
+	if( json_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid JSON string.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_document_get_root_xml_tag(
+	     xml_document,
+	     &root_xml_tag,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve root XML element.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_json_string_append_data(
+	     json_string,
+	     (uint8_t *) "{",
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append object start.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_json_string_append_xml_tag_name(
+	     json_string,
+	     root_xml_tag,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append name of root XML element.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_json_string_append_data(
+	     json_string,
+	     (uint8_t *) ":",
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append name separator.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_json_string_append_xml_tag(
+	     json_string,
+	     root_xml_tag,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append root XML element.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_json_string_append_data(
+	     json_string,
+	     (uint8_t *) "}",
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append object end.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
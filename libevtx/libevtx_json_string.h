@@ -0,0 +1,144 @@
+/*
+ * JSON string functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_JSON_STRING_H )
+#define _LIBEVTX_JSON_STRING_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_libcerror.h"
+#include "libevtx_libfwevt.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libevtx_json_string libevtx_json_string_t;
+
+struct libevtx_json_string
+{
+	/* The UTF-8 encoded JSON string
+	 */
+	uint8_t *string;
+
+	/* The allocated size of the string
+	 */
+	size_t string_size;
+
+	/* The length of the string without the end of string character
+	 */
+	size_t string_length;
+
+	/* The value string buffer
+	 */
+	uint8_t *value_string;
+
+	/* The value string buffer size
+	 */
+	size_t value_string_size;
+
+	/* The name string buffer
+	 */
+	uint8_t *name_string;
+
+	/* The name string buffer size
+	 */
+	size_t name_string_size;
+};
+
+int libevtx_json_string_initialize(
+     libevtx_json_string_t **json_string,
+     libcerror_error_t **error );
+
+int libevtx_json_string_free(
+     libevtx_json_string_t **json_string,
+     libcerror_error_t **error );
+
+int libevtx_json_string_resize(
+     libevtx_json_string_t *json_string,
+     size_t string_size,
+     libcerror_error_t **error );
+
+int libevtx_json_string_append_data(
+     libevtx_json_string_t *json_string,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libevtx_json_string_append_utf8_string(
+     libevtx_json_string_t *json_string,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error );
+
+int libevtx_json_string_copy_xml_tag_name(
+     libfwevt_xml_tag_t *xml_tag,
+     uint8_t **name,
+     size_t *name_size,
+     size_t *name_length,
+     libcerror_error_t **error );
+
+int libevtx_json_string_compare_xml_tag_names(
+     libevtx_json_string_t *json_string,
+     libfwevt_xml_tag_t *first_xml_tag,
+     libfwevt_xml_tag_t *second_xml_tag,
+     libcerror_error_t **error );
+
+int libevtx_json_string_compare_xml_tag_name(
+     libevtx_json_string_t *json_string,
+     libfwevt_xml_tag_t *xml_tag,
+     const uint8_t *name,
+     size_t name_length,
+     libcerror_error_t **error );
+
+int libevtx_json_string_append_xml_tag_name(
+     libevtx_json_string_t *json_string,
+     libfwevt_xml_tag_t *xml_tag,
+     uint8_t name_prefix,
+     libcerror_error_t **error );
+
+int libevtx_json_string_append_xml_tag_value(
+     libevtx_json_string_t *json_string,
+     libfwevt_xml_tag_t *xml_tag,
+     libcerror_error_t **error );
+
+int libevtx_json_string_append_event_data_xml_tag(
+     libevtx_json_string_t *json_string,
+     libfwevt_xml_tag_t *xml_tag,
+     libcerror_error_t **error );
+
+int libevtx_json_string_append_xml_tag(
+     libevtx_json_string_t *json_string,
+     libfwevt_xml_tag_t *xml_tag,
+     libcerror_error_t **error );
+
+int libevtx_json_string_append_xml_document(
+     libevtx_json_string_t *json_string,
+     libfwevt_xml_document_t *xml_document,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_JSON_STRING_H ) */
+
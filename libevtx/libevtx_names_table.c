@@ -0,0 +1,525 @@
+/*
+ * Names table functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevtx_libcdata.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_libcthreads.h"
+#include "libevtx_names_table.h"
+
+/* The maximum number of values per names tree node
+ */
+#define LIBEVTX_NAMES_TABLE_MAXIMUM_NUMBER_OF_VALUES	257
+
+/* Frees a names table entry
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_names_table_entry_free(
+     libevtx_names_table_entry_t **names_table_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_names_table_entry_free";
+
+	if( names_table_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid names table entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *names_table_entry != NULL )
+	{
+		if( ( *names_table_entry )->utf8_name != NULL )
+		{
+			memory_free(
+			 ( *names_table_entry )->utf8_name );
+		}
+		memory_free(
+		 *names_table_entry );
+
+		*names_table_entry = NULL;
+	}
+	return( 1 );
+}
+
+/* Compares two names table entries
+ * Returns LIBCDATA_COMPARE_LESS, LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
+ */
+int libevtx_names_table_entry_compare(
+     libevtx_names_table_entry_t *first_names_table_entry,
+     libevtx_names_table_entry_t *second_names_table_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_names_table_entry_compare";
+	size_t compare_size   = 0;
+	int result            = 0;
+
+	if( first_names_table_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first names table entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( second_names_table_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second names table entry.",
+		 function );
+
+		return( -1 );
+	}
+	compare_size = first_names_table_entry->utf8_name_size;
+
+	if( compare_size > second_names_table_entry->utf8_name_size )
+	{
+		compare_size = second_names_table_entry->utf8_name_size;
+	}
+	result = memory_compare(
+	          first_names_table_entry->utf8_name,
+	          second_names_table_entry->utf8_name,
+	          compare_size );
+
+	if( result < 0 )
+	{
+		return( LIBCDATA_COMPARE_LESS );
+	}
+	else if( result > 0 )
+	{
+		return( LIBCDATA_COMPARE_GREATER );
+	}
+	if( first_names_table_entry->utf8_name_size < second_names_table_entry->utf8_name_size )
+	{
+		return( LIBCDATA_COMPARE_LESS );
+	}
+	else if( first_names_table_entry->utf8_name_size > second_names_table_entry->utf8_name_size )
+	{
+		return( LIBCDATA_COMPARE_GREATER );
+	}
+	return( LIBCDATA_COMPARE_EQUAL );
+}
+
+/* Creates a names table
+ * Make sure the value names_table is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_names_table_initialize(
+     libevtx_names_table_t **names_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_names_table_initialize";
+
+	if( names_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid names table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *names_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid names table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*names_table = memory_allocate_structure(
+	                libevtx_names_table_t );
+
+	if( *names_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create names table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *names_table,
+	     0,
+	     sizeof( libevtx_names_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear names table.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_btree_initialize(
+	     &( ( *names_table )->names_tree ),
+	     LIBEVTX_NAMES_TABLE_MAXIMUM_NUMBER_OF_VALUES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create names tree.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *names_table )->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *names_table != NULL )
+	{
+		if( ( *names_table )->names_tree != NULL )
+		{
+			libcdata_btree_free(
+			 &( ( *names_table )->names_tree ),
+			 (int (*)(intptr_t **, libcerror_error_t **)) &libevtx_names_table_entry_free,
+			 NULL );
+		}
+		memory_free(
+		 *names_table );
+
+		*names_table = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a names table
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_names_table_free(
+     libevtx_names_table_t **names_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_names_table_free";
+	int result            = 1;
+
+	if( names_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid names table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *names_table != NULL )
+	{
+		if( libcdata_btree_free(
+		     &( ( *names_table )->names_tree ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libevtx_names_table_entry_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free names tree.",
+			 function );
+
+			result = -1;
+		}
+#if defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( ( *names_table )->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 *names_table );
+
+		*names_table = NULL;
+	}
+	return( result );
+}
+
+/* Retrieves the interned copy of an UTF-8 encoded name
+ * The name is added to the names table if not present
+ * The interned name is end of string character terminated and remains valid until the names table is freed
+ * The lookup and insert are done while holding the names table lock, if multi-thread support is enabled
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_names_table_get_utf8_name(
+     libevtx_names_table_t *names_table,
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     const uint8_t **utf8_name,
+     libcerror_error_t **error )
+{
+	libevtx_names_table_entry_t lookup_entry;
+
+	libcdata_tree_node_t *upper_node               = NULL;
+	libevtx_names_table_entry_t *existing_entry    = NULL;
+	libevtx_names_table_entry_t *names_table_entry = NULL;
+	static char *function                          = "libevtx_names_table_get_utf8_name";
+	int result                                     = 0;
+	int value_index                                = 0;
+
+	if( names_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid names table.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_string_size == 0 )
+	 || ( utf8_string_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 string size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 name.",
+		 function );
+
+		return( -1 );
+	}
+	/* The end of string character is not part of the comparison
+	 */
+	if( utf8_string[ utf8_string_size - 1 ] == 0 )
+	{
+		utf8_string_size -= 1;
+	}
+	lookup_entry.utf8_name      = (uint8_t *) utf8_string;
+	lookup_entry.utf8_name_size = utf8_string_size;
+
+#if defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     names_table->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+
+	result = libcdata_btree_get_value_by_value(
+	          names_table->names_tree,
+	          (intptr_t *) &lookup_entry,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libevtx_names_table_entry_compare,
+	          &upper_node,
+	          (intptr_t **) &existing_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve name from tree.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		*utf8_name = existing_entry->utf8_name;
+
+		goto on_exit;
+	}
+	names_table_entry = memory_allocate_structure(
+	                     libevtx_names_table_entry_t );
+
+	if( names_table_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create names table entry.",
+		 function );
+
+		goto on_error;
+	}
+	names_table_entry->utf8_name_size = utf8_string_size;
+
+	names_table_entry->utf8_name = (uint8_t *) memory_allocate(
+	                                            sizeof( uint8_t ) * ( utf8_string_size + 1 ) );
+
+	if( names_table_entry->utf8_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create UTF-8 name.",
+		 function );
+
+		goto on_error;
+	}
+	if( utf8_string_size > 0 )
+	{
+		if( memory_copy(
+		     names_table_entry->utf8_name,
+		     utf8_string,
+		     utf8_string_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy UTF-8 name.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	names_table_entry->utf8_name[ utf8_string_size ] = 0;
+
+	result = libcdata_btree_insert_value(
+	          names_table->names_tree,
+	          &value_index,
+	          (intptr_t *) names_table_entry,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libevtx_names_table_entry_compare,
+	          &upper_node,
+	          (intptr_t **) &existing_entry,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert name into tree.",
+		 function );
+
+		goto on_error;
+	}
+	names_table->number_of_names += 1;
+
+	*utf8_name = names_table_entry->utf8_name;
+
+on_exit:
+#if defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     names_table->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( names_table_entry != NULL )
+	{
+		libevtx_names_table_entry_free(
+		 &names_table_entry,
+		 NULL );
+	}
+#if defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 names_table->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
@@ -0,0 +1,97 @@
+/*
+ * Names table functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_NAMES_TABLE_H )
+#define _LIBEVTX_NAMES_TABLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_libcdata.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libevtx_names_table_entry libevtx_names_table_entry_t;
+
+struct libevtx_names_table_entry
+{
+	/* The UTF-8 encoded name
+	 */
+	uint8_t *utf8_name;
+
+	/* The UTF-8 encoded name size
+	 */
+	size_t utf8_name_size;
+};
+
+typedef struct libevtx_names_table libevtx_names_table_t;
+
+struct libevtx_names_table
+{
+	/* The names tree
+	 */
+	libcdata_btree_t *names_tree;
+
+	/* The number of names
+	 */
+	int number_of_names;
+
+#if defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+int libevtx_names_table_entry_free(
+     libevtx_names_table_entry_t **names_table_entry,
+     libcerror_error_t **error );
+
+int libevtx_names_table_entry_compare(
+     libevtx_names_table_entry_t *first_names_table_entry,
+     libevtx_names_table_entry_t *second_names_table_entry,
+     libcerror_error_t **error );
+
+int libevtx_names_table_initialize(
+     libevtx_names_table_t **names_table,
+     libcerror_error_t **error );
+
+int libevtx_names_table_free(
+     libevtx_names_table_t **names_table,
+     libcerror_error_t **error );
+
+int libevtx_names_table_get_utf8_name(
+     libevtx_names_table_t *names_table,
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     const uint8_t **utf8_name,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_NAMES_TABLE_H ) */
+
@@ -27,6 +27,7 @@
 #include "libevtx_io_handle.h"
 #include "libevtx_libbfio.h"
 #include "libevtx_libcerror.h"
+#include "libevtx_libcthreads.h"
 #include "libevtx_record.h"
 #include "libevtx_record_values.h"
 
@@ -210,6 +211,11 @@ int libevtx_record_free(
 
 		/* The io_handle and record_values references are freed elsewhere
 		 */
+		if( internal_record->raw_data != NULL )
+		{
+			memory_free(
+			 internal_record->raw_data );
+		}
 		if( ( internal_record->flags & LIBEVTX_RECORD_FLAG_MANAGED_FILE_IO_HANDLE ) != 0 )
 		{
 			if( internal_record->file_io_handle != NULL )
@@ -1273,9 +1279,10 @@ int libevtx_record_parse_data_with_template_definition(
      libevtx_template_definition_t *template_definition,
      libcerror_error_t **error )
 {
-	libevtx_internal_record_t *internal_record = NULL;
-	static char *function                      = "libevtx_record_parse_data_with_template_definition";
-	int result                                 = 0;
+	libevtx_internal_template_definition_t *internal_template_definition = NULL;
+	libevtx_internal_record_t *internal_record                           = NULL;
+	static char *function                                                = "libevtx_record_parse_data_with_template_definition";
+	int result                                                           = 0;
 
 	if( record == NULL )
 	{
@@ -1301,10 +1308,30 @@ int libevtx_record_parse_data_with_template_definition(
 
 		return( -1 );
 	}
+	internal_template_definition = (libevtx_internal_template_definition_t *) template_definition;
+
+#if defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT )
+	/* The XML document of the template definition is read on first use
+	 * hence records that share the template definition are parsed one at a time
+	 */
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_template_definition->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 	result = libevtx_record_values_parse_data(
 	          internal_record->record_values,
 	          internal_record->io_handle,
-	          (libevtx_internal_template_definition_t *) template_definition,
+	          internal_template_definition,
 	          error );
 
 	if( result == -1 )
@@ -1315,9 +1342,22 @@ int libevtx_record_parse_data_with_template_definition(
 		 LIBCERROR_RUNTIME_ERROR_GENERIC,
 		 "%s: unable to parse data.",
 		 function );
+	}
+#if defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_template_definition->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
 
 		return( -1 );
 	}
+#endif
 	return( result );
 }
 
@@ -1551,6 +1591,240 @@ int libevtx_record_get_utf16_string(
 	return( 1 );
 }
 
+/* Retrieves the size of all UTF-8 encoded strings
+ * The returned size includes the end of string characters
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_get_utf8_strings_size(
+     libevtx_record_t *record,
+     size_t *utf8_strings_size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_get_utf8_strings_size";
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	if( libevtx_record_values_get_utf8_strings_size(
+	     internal_record->record_values,
+	     internal_record->io_handle,
+	     utf8_strings_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size of UTF-8 strings.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves all UTF-8 encoded strings
+ * The size should include the end of string characters
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_get_utf8_strings(
+     libevtx_record_t *record,
+     uint8_t *utf8_strings,
+     size_t utf8_strings_size,
+     size_t *utf8_string_offsets,
+     int number_of_offsets,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_get_utf8_strings";
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	if( libevtx_record_values_get_utf8_strings(
+	     internal_record->record_values,
+	     internal_record->io_handle,
+	     utf8_strings,
+	     utf8_strings_size,
+	     utf8_string_offsets,
+	     number_of_offsets,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to retrieve UTF-8 strings.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of all UTF-16 encoded strings
+ * The returned size includes the end of string characters
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_get_utf16_strings_size(
+     libevtx_record_t *record,
+     size_t *utf16_strings_size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_get_utf16_strings_size";
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	if( libevtx_record_values_get_utf16_strings_size(
+	     internal_record->record_values,
+	     internal_record->io_handle,
+	     utf16_strings_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size of UTF-16 strings.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves all UTF-16 encoded strings
+ * The size should include the end of string characters
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_get_utf16_strings(
+     libevtx_record_t *record,
+     uint16_t *utf16_strings,
+     size_t utf16_strings_size,
+     size_t *utf16_string_offsets,
+     int number_of_offsets,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_get_utf16_strings";
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	if( libevtx_record_values_get_utf16_strings(
+	     internal_record->record_values,
+	     internal_record->io_handle,
+	     utf16_strings,
+	     utf16_strings_size,
+	     utf16_string_offsets,
+	     number_of_offsets,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to retrieve UTF-16 strings.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the event data
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_get_utf8_event_data(
+     libevtx_record_t *record,
+     int *number_of_values,
+     const uint8_t ***utf8_names,
+     const uint8_t ***utf8_values,
+     const uint8_t **value_types,
+     const uint64_t **integer_values,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_get_utf8_event_data";
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	if( libevtx_record_values_get_utf8_event_data(
+	     internal_record->record_values,
+	     internal_record->io_handle,
+	     number_of_values,
+	     utf8_names,
+	     utf8_values,
+	     value_types,
+	     integer_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Retrieves the size of the data
  * Returns 1 if successful, 0 if not available or -1 on error
  */
@@ -1643,6 +1917,136 @@ int libevtx_record_get_data(
 	return( result );
 }
 
+/* Retrieves a pointer to the binary data
+ * The data is owned by the record values, which are shared with the records cache of the file
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_get_binary_data_pointer(
+     libevtx_record_t *record,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_get_binary_data_pointer";
+	int result                                 = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	result = libevtx_record_values_get_binary_data_pointer(
+	          internal_record->record_values,
+	          internal_record->io_handle,
+	          data,
+	          data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve binary data pointer.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves a pointer to the raw event record data
+ * The data is read from the file into a copy the first time it is requested
+ * and is owned by the record
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_get_raw_data_pointer(
+     libevtx_record_t *record,
+     const uint8_t **raw_data,
+     size_t *raw_data_size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_get_raw_data_pointer";
+	int result                                 = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	if( raw_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid raw data.",
+		 function );
+
+		return( -1 );
+	}
+	if( raw_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid raw data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record->raw_data == NULL )
+	{
+		result = libevtx_record_values_read_raw_data(
+		          internal_record->record_values,
+		          internal_record->io_handle,
+		          internal_record->file_io_handle,
+		          &( internal_record->raw_data ),
+		          &( internal_record->raw_data_size ),
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read raw data.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+	}
+	*raw_data      = internal_record->raw_data;
+	*raw_data_size = internal_record->raw_data_size;
+
+	return( 1 );
+}
+
 /* Retrieves the size of the UTF-8 encoded XML string
  * The returned size includes the end of string character
  * Returns 1 if successful or -1 on error
@@ -1815,3 +2219,184 @@ int libevtx_record_get_utf16_xml_string(
 	return( 1 );
 }
 
+/* Retrieves the UTF-8 encoded XML string using a growable buffer
+ * The buffer is allocated or resized when it is too small to contain the XML string
+ * and must be freed by the caller with free() when no longer needed
+ * The buffer size contains the allocated size and the string length excludes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_get_utf8_xml_string_buffer(
+     libevtx_record_t *record,
+     uint8_t **utf8_string,
+     size_t *utf8_string_size,
+     size_t *utf8_string_length,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_get_utf8_xml_string_buffer";
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	if( libevtx_record_values_get_utf8_xml_string_buffer(
+	     internal_record->record_values,
+	     utf8_string,
+	     utf8_string_size,
+	     utf8_string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy event XML to UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-16 encoded XML string using a growable buffer
+ * The buffer is allocated or resized when it is too small to contain the XML string
+ * and must be freed by the caller with free() when no longer needed
+ * The buffer size contains the allocated size and the string length excludes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_get_utf16_xml_string_buffer(
+     libevtx_record_t *record,
+     uint16_t **utf16_string,
+     size_t *utf16_string_size,
+     size_t *utf16_string_length,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_get_utf16_xml_string_buffer";
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	if( libevtx_record_values_get_utf16_xml_string_buffer(
+	     internal_record->record_values,
+	     utf16_string,
+	     utf16_string_size,
+	     utf16_string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy event XML to UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-8 encoded JSON string
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_get_utf8_json_string_size(
+     libevtx_record_t *record,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_get_utf8_json_string_size";
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	if( libevtx_record_values_get_utf8_json_string_size(
+	     internal_record->record_values,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string size of event JSON.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 encoded JSON string
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_get_utf8_json_string(
+     libevtx_record_t *record,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_get_utf8_json_string";
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	if( libevtx_record_values_get_utf8_json_string(
+	     internal_record->record_values,
+	     utf8_string,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy event JSON to UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
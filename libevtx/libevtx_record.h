@@ -52,6 +52,15 @@ struct libevtx_internal_record
 	 */
 	libevtx_record_values_t *record_values;
 
+	/* The raw event record data
+	 * Read from the file the first time it is requested
+	 */
+	uint8_t *raw_data;
+
+	/* The raw event record data size
+	 */
+	size_t raw_data_size;
+
 	/* The flags
 	 */
 	uint8_t flags;
@@ -252,6 +261,46 @@ int libevtx_record_get_utf16_string(
      size_t utf16_string_size,
      libcerror_error_t **error );
 
+LIBEVTX_EXTERN \
+int libevtx_record_get_utf8_strings_size(
+     libevtx_record_t *record,
+     size_t *utf8_strings_size,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_record_get_utf8_strings(
+     libevtx_record_t *record,
+     uint8_t *utf8_strings,
+     size_t utf8_strings_size,
+     size_t *utf8_string_offsets,
+     int number_of_offsets,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_record_get_utf16_strings_size(
+     libevtx_record_t *record,
+     size_t *utf16_strings_size,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_record_get_utf16_strings(
+     libevtx_record_t *record,
+     uint16_t *utf16_strings,
+     size_t utf16_strings_size,
+     size_t *utf16_string_offsets,
+     int number_of_offsets,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_record_get_utf8_event_data(
+     libevtx_record_t *record,
+     int *number_of_values,
+     const uint8_t ***utf8_names,
+     const uint8_t ***utf8_values,
+     const uint8_t **value_types,
+     const uint64_t **integer_values,
+     libcerror_error_t **error );
+
 LIBEVTX_EXTERN \
 int libevtx_record_get_data_size(
      libevtx_record_t *record,
@@ -265,6 +314,20 @@ int libevtx_record_get_data(
      size_t data_size,
      libcerror_error_t **error );
 
+LIBEVTX_EXTERN \
+int libevtx_record_get_binary_data_pointer(
+     libevtx_record_t *record,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_record_get_raw_data_pointer(
+     libevtx_record_t *record,
+     const uint8_t **raw_data,
+     size_t *raw_data_size,
+     libcerror_error_t **error );
+
 LIBEVTX_EXTERN \
 int libevtx_record_get_utf8_xml_string_size(
      libevtx_record_t *record,
@@ -291,6 +354,35 @@ int libevtx_record_get_utf16_xml_string(
      size_t utf16_string_size,
      libcerror_error_t **error );
 
+LIBEVTX_EXTERN \
+int libevtx_record_get_utf8_xml_string_buffer(
+     libevtx_record_t *record,
+     uint8_t **utf8_string,
+     size_t *utf8_string_size,
+     size_t *utf8_string_length,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_record_get_utf16_xml_string_buffer(
+     libevtx_record_t *record,
+     uint16_t **utf16_string,
+     size_t *utf16_string_size,
+     size_t *utf16_string_length,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_record_get_utf8_json_string_size(
+     libevtx_record_t *record,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_record_get_utf8_json_string(
+     libevtx_record_t *record,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
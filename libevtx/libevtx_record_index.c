@@ -0,0 +1,558 @@
+/*
+ * Record index functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevtx_definitions.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_record_index.h"
+
+/* Creates a record index
+ * Make sure the value record_index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_index_initialize(
+     libevtx_record_index_t **record_index,
+     int cache_identifier,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_record_index_initialize";
+
+	if( record_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*record_index = memory_allocate_structure(
+	                 libevtx_record_index_t );
+
+	if( *record_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *record_index,
+	     0,
+	     sizeof( libevtx_record_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear record index.",
+		 function );
+
+		goto on_error;
+	}
+	( *record_index )->cache_identifier = cache_identifier;
+
+	return( 1 );
+
+on_error:
+	if( *record_index != NULL )
+	{
+		memory_free(
+		 *record_index );
+
+		*record_index = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a record index
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_index_free(
+     libevtx_record_index_t **record_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_record_index_free";
+
+	if( record_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_index != NULL )
+	{
+		if( ( *record_index )->entries != NULL )
+		{
+			memory_free(
+			 ( *record_index )->entries );
+		}
+		memory_free(
+		 *record_index );
+
+		*record_index = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends an entry to the record index
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_index_append_entry(
+     libevtx_record_index_t *record_index,
+     uint16_t chunk_index,
+     size_t chunk_data_offset,
+     uint16_t chunk_record_index,
+     uint16_t flags,
+     libcerror_error_t **error )
+{
+	libevtx_record_index_entry_t *entry        = NULL;
+	libevtx_record_index_entry_t *reallocation = NULL;
+	static char *function                      = "libevtx_record_index_append_entry";
+	int number_of_allocated_entries            = 0;
+
+	if( record_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record index.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data_offset > (size_t) UINT16_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_index->number_of_entries >= record_index->number_of_allocated_entries )
+	{
+		/* Grow the entries at least twofold to limit the number of reallocations
+		 */
+		if( record_index->number_of_allocated_entries == 0 )
+		{
+			number_of_allocated_entries = LIBEVTX_RECORD_INDEX_INITIAL_NUMBER_OF_ENTRIES;
+		}
+		else if( record_index->number_of_allocated_entries > ( INT_MAX / 2 ) )
+		{
+			number_of_allocated_entries = INT_MAX;
+		}
+		else
+		{
+			number_of_allocated_entries = 2 * record_index->number_of_allocated_entries;
+		}
+		if( ( record_index->number_of_entries == INT_MAX )
+		 || ( (size_t) number_of_allocated_entries > (size_t) ( SSIZE_MAX / sizeof( libevtx_record_index_entry_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of entries value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = (libevtx_record_index_entry_t *) memory_reallocate(
+		                record_index->entries,
+		                sizeof( libevtx_record_index_entry_t ) * number_of_allocated_entries );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entries.",
+			 function );
+
+			return( -1 );
+		}
+		record_index->entries                     = reallocation;
+		record_index->number_of_allocated_entries = number_of_allocated_entries;
+	}
+	entry = &( record_index->entries[ record_index->number_of_entries ] );
+
+	entry->chunk_index        = chunk_index;
+	entry->chunk_data_offset  = (uint16_t) chunk_data_offset;
+	entry->chunk_record_index = chunk_record_index;
+	entry->flags              = flags;
+
+	record_index->number_of_entries += 1;
+
+	return( 1 );
+}
+
+/* Retrieves the number of entries
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_index_get_number_of_entries(
+     libevtx_record_index_t *record_index,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_record_index_get_number_of_entries";
+
+	if( record_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record index.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_entries = record_index->number_of_entries;
+
+	return( 1 );
+}
+
+/* Retrieves a specific entry
+ * The entry is managed by the record index and is only valid until the next entry is appended
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_index_get_entry_by_index(
+     libevtx_record_index_t *record_index,
+     int entry_index,
+     libevtx_record_index_entry_t **entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_record_index_get_entry_by_index";
+
+	if( record_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_index < 0 )
+	 || ( entry_index >= record_index->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	*entry = &( record_index->entries[ entry_index ] );
+
+	return( 1 );
+}
+
+/* Retrieves the number of entries of a specific chunk
+ * Entries that were removed are not included
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_index_get_number_of_entries_by_chunk_index(
+     libevtx_record_index_t *record_index,
+     uint16_t chunk_index,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_record_index_get_number_of_entries_by_chunk_index";
+	int entry_index       = 0;
+
+	if( record_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record index.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_entries = 0;
+
+	for( entry_index = 0;
+	     entry_index < record_index->number_of_entries;
+	     entry_index++ )
+	{
+		if( ( record_index->entries[ entry_index ].chunk_index == chunk_index )
+		 && ( ( record_index->entries[ entry_index ].flags & LIBEVTX_RECORD_INDEX_ENTRY_FLAG_IS_REMOVED ) == 0 ) )
+		{
+			*number_of_entries += 1;
+		}
+	}
+	return( 1 );
+}
+
+/* Removes the entries of a specific chunk
+ * The entries are marked as removed instead of being compacted, hence the other
+ * entries retain their index. Removed entries are reused by
+ * libevtx_record_index_replace_entry and the remaining removed entries are
+ * discarded by libevtx_record_index_compact
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_index_remove_entries_by_chunk_index(
+     libevtx_record_index_t *record_index,
+     uint16_t chunk_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_record_index_remove_entries_by_chunk_index";
+	int entry_index       = 0;
+
+	if( record_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record index.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < record_index->number_of_entries;
+	     entry_index++ )
+	{
+		if( record_index->entries[ entry_index ].chunk_index == chunk_index )
+		{
+			record_index->entries[ entry_index ].flags |= LIBEVTX_RECORD_INDEX_ENTRY_FLAG_IS_REMOVED;
+		}
+	}
+	return( 1 );
+}
+
+/* Replaces a removed entry of a specific chunk or appends the entry if the chunk has no removed entries left
+ * The search for a removed entry starts at the entry index, on return the entry index
+ * is set to the index after the replaced or appended entry, so that a chunk can be
+ * replaced entry by entry in a single pass
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_index_replace_entry(
+     libevtx_record_index_t *record_index,
+     int *entry_index,
+     uint16_t chunk_index,
+     size_t chunk_data_offset,
+     uint16_t chunk_record_index,
+     uint16_t flags,
+     libcerror_error_t **error )
+{
+	libevtx_record_index_entry_t *entry = NULL;
+	static char *function               = "libevtx_record_index_replace_entry";
+	int search_index                    = 0;
+
+	if( record_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record index.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *entry_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data_offset > (size_t) UINT16_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( search_index = *entry_index;
+	     search_index < record_index->number_of_entries;
+	     search_index++ )
+	{
+		entry = &( record_index->entries[ search_index ] );
+
+		if( ( entry->chunk_index == chunk_index )
+		 && ( ( entry->flags & LIBEVTX_RECORD_INDEX_ENTRY_FLAG_IS_REMOVED ) != 0 ) )
+		{
+			entry->chunk_data_offset  = (uint16_t) chunk_data_offset;
+			entry->chunk_record_index = chunk_record_index;
+			entry->flags              = flags;
+
+			*entry_index = search_index + 1;
+
+			return( 1 );
+		}
+	}
+	if( libevtx_record_index_append_entry(
+	     record_index,
+	     chunk_index,
+	     chunk_data_offset,
+	     chunk_record_index,
+	     flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append entry.",
+		 function );
+
+		return( -1 );
+	}
+	*entry_index = record_index->number_of_entries;
+
+	return( 1 );
+}
+
+/* Discards the entries that are marked as removed
+ * The entries that follow a removed entry are moved to close the gap, hence
+ * their index changes
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_index_compact(
+     libevtx_record_index_t *record_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_record_index_compact";
+	int entry_index       = 0;
+	int number_of_entries = 0;
+
+	if( record_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record index.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < record_index->number_of_entries;
+	     entry_index++ )
+	{
+		if( ( record_index->entries[ entry_index ].flags & LIBEVTX_RECORD_INDEX_ENTRY_FLAG_IS_REMOVED ) != 0 )
+		{
+			continue;
+		}
+		if( number_of_entries != entry_index )
+		{
+			record_index->entries[ number_of_entries ] = record_index->entries[ entry_index ];
+		}
+		number_of_entries++;
+	}
+	record_index->number_of_entries = number_of_entries;
+
+	return( 1 );
+}
+
@@ -0,0 +1,134 @@
+/*
+ * Record index functions
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_RECORD_INDEX_H )
+#define _LIBEVTX_RECORD_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libevtx_record_index_entry libevtx_record_index_entry_t;
+
+struct libevtx_record_index_entry
+{
+	/* The index of the chunk that contains the record
+	 */
+	uint16_t chunk_index;
+
+	/* The offset of the record relative to the start of the chunk
+	 */
+	uint16_t chunk_data_offset;
+
+	/* The index of the record in the records or recovered records of the chunk
+	 */
+	uint16_t chunk_record_index;
+
+	/* The flags
+	 */
+	uint16_t flags;
+};
+
+typedef struct libevtx_record_index libevtx_record_index_t;
+
+struct libevtx_record_index
+{
+	/* The entries
+	 */
+	libevtx_record_index_entry_t *entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The number of allocated entries
+	 */
+	int number_of_allocated_entries;
+
+	/* The cache identifier, used to distinguish the records of different
+	 * indexes that share the same records cache
+	 */
+	int cache_identifier;
+};
+
+int libevtx_record_index_initialize(
+     libevtx_record_index_t **record_index,
+     int cache_identifier,
+     libcerror_error_t **error );
+
+int libevtx_record_index_free(
+     libevtx_record_index_t **record_index,
+     libcerror_error_t **error );
+
+int libevtx_record_index_append_entry(
+     libevtx_record_index_t *record_index,
+     uint16_t chunk_index,
+     size_t chunk_data_offset,
+     uint16_t chunk_record_index,
+     uint16_t flags,
+     libcerror_error_t **error );
+
+int libevtx_record_index_get_number_of_entries(
+     libevtx_record_index_t *record_index,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+int libevtx_record_index_get_entry_by_index(
+     libevtx_record_index_t *record_index,
+     int entry_index,
+     libevtx_record_index_entry_t **entry,
+     libcerror_error_t **error );
+
+int libevtx_record_index_get_number_of_entries_by_chunk_index(
+     libevtx_record_index_t *record_index,
+     uint16_t chunk_index,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+int libevtx_record_index_remove_entries_by_chunk_index(
+     libevtx_record_index_t *record_index,
+     uint16_t chunk_index,
+     libcerror_error_t **error );
+
+int libevtx_record_index_replace_entry(
+     libevtx_record_index_t *record_index,
+     int *entry_index,
+     uint16_t chunk_index,
+     size_t chunk_data_offset,
+     uint16_t chunk_record_index,
+     uint16_t flags,
+     libcerror_error_t **error );
+
+int libevtx_record_index_compact(
+     libevtx_record_index_t *record_index,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_RECORD_INDEX_H ) */
+
@@ -26,14 +26,19 @@
 #include <types.h>
 
 #include "libevtx_byte_stream.h"
+#include "libevtx_event_data.h"
 #include "libevtx_io_handle.h"
+#include "libevtx_json_string.h"
+#include "libevtx_libbfio.h"
 #include "libevtx_libcerror.h"
 #include "libevtx_libcnotify.h"
 #include "libevtx_libfdatetime.h"
 #include "libevtx_libfvalue.h"
 #include "libevtx_libfwevt.h"
+#include "libevtx_names_table.h"
 #include "libevtx_record_values.h"
 #include "libevtx_template_definition.h"
+#include "libevtx_trace.h"
 
 #include "evtx_event_record.h"
 
@@ -185,6 +190,38 @@ int libevtx_record_values_free(
 				result = -1;
 			}
 		}
+		if( ( *record_values )->json_string != NULL )
+		{
+			if( libevtx_json_string_free(
+			     &( ( *record_values )->json_string ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free JSON string.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *record_values )->event_data != NULL )
+		{
+			if( libevtx_event_data_free(
+			     &( ( *record_values )->event_data ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free event data.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 *record_values );
 
@@ -260,6 +297,8 @@ int libevtx_record_values_clone(
 		goto on_error;
 	}
 	( *destination_record_values )->xml_document = NULL;
+	( *destination_record_values )->json_string  = NULL;
+	( *destination_record_values )->event_data   = NULL;
 
 	if( source_record_values->xml_document != NULL )
 	{
@@ -651,6 +690,14 @@ int libevtx_record_values_read_xml_document(
 
 		return( -1 );
 	}
+	libevtx_trace_begin(
+	 LIBEVTX_TRACE_EVENT_TYPE_XML_DOCUMENT_READ,
+	 libevtx_trace_get_chunk_index(
+	  io_handle,
+	  record_values->offset ),
+	 record_values->offset,
+	 record_values->data_size );
+
 	if( chunk_data_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
@@ -700,6 +747,19 @@ int libevtx_record_values_read_xml_document(
 
 		goto on_error;
 	}
+	if( ( record_values->data_size == 0 )
+	 || ( (size_t) record_values->data_size > chunk_data_size )
+	 || ( record_values->chunk_data_offset > ( chunk_data_size - record_values->data_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record values - data size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
 	if( libfwevt_xml_document_initialize(
 	     &( record_values->xml_document ),
 	     error ) != 1 )
@@ -768,6 +828,14 @@ int libevtx_record_values_read_xml_document(
 		}
 	}
 #endif
+	libevtx_trace_end(
+	 LIBEVTX_TRACE_EVENT_TYPE_XML_DOCUMENT_READ,
+	 libevtx_trace_get_chunk_index(
+	  io_handle,
+	  record_values->offset ),
+	 record_values->offset,
+	 record_values->data_size );
+
 	return( 1 );
 
 on_error:
@@ -777,6 +845,14 @@ on_error:
 		 &( record_values->xml_document ),
 		 NULL );
 	}
+	libevtx_trace_end(
+	 LIBEVTX_TRACE_EVENT_TYPE_XML_DOCUMENT_READ,
+	 libevtx_trace_get_chunk_index(
+	  io_handle,
+	  record_values->offset ),
+	 record_values->offset,
+	 record_values->data_size );
+
 	return( -1 );
 }
 
@@ -4106,6 +4182,14 @@ int libevtx_record_values_parse_data(
 
 		return( -1 );
 	}
+	libevtx_trace_begin(
+	 LIBEVTX_TRACE_EVENT_TYPE_DATA_PARSE,
+	 libevtx_trace_get_chunk_index(
+	  io_handle,
+	  record_values->offset ),
+	 record_values->offset,
+	 record_values->data_size );
+
 	if( libcdata_array_initialize(
 	     &( record_values->string_identifiers_array ),
 	     0,
@@ -4322,6 +4406,14 @@ int libevtx_record_values_parse_data(
 	}
 	record_values->data_parsed = 1;
 
+	libevtx_trace_end(
+	 LIBEVTX_TRACE_EVENT_TYPE_DATA_PARSE,
+	 libevtx_trace_get_chunk_index(
+	  io_handle,
+	  record_values->offset ),
+	 record_values->offset,
+	 record_values->data_size );
+
 	return( result );
 
 on_error:
@@ -4339,6 +4431,14 @@ on_error:
 		 NULL,
 		 NULL );
 	}
+	libevtx_trace_end(
+	 LIBEVTX_TRACE_EVENT_TYPE_DATA_PARSE,
+	 libevtx_trace_get_chunk_index(
+	  io_handle,
+	  record_values->offset ),
+	 record_values->offset,
+	 record_values->data_size );
+
 	return( -1 );
 }
 
@@ -4766,20 +4866,23 @@ int libevtx_record_values_get_utf16_string(
 	return( 1 );
 }
 
-/* Retrieves the size of the data
- * Returns 1 if successful, 0 if not available or -1 on error
+/* Retrieves the size of all UTF-8 encoded strings
+ * The strings are stored consecutively and each string is terminated by an end of string character
+ * The returned size includes the end of string characters
+ * Returns 1 if successful or -1 on error
  */
-int libevtx_record_values_get_data_size(
+int libevtx_record_values_get_utf8_strings_size(
      libevtx_record_values_t *record_values,
      libevtx_io_handle_t *io_handle,
-     size_t *data_size,
+     size_t *utf8_strings_size,
      libcerror_error_t **error )
 {
-	libfwevt_xml_tag_t *binary_data_tag    = NULL;
-	libfwevt_xml_tag_t *event_data_xml_tag = NULL;
-	libfwevt_xml_tag_t *root_xml_tag       = NULL;
-	static char *function                  = "libevtx_record_values_get_data_size";
-	int result                             = 0;
+	libfwevt_xml_tag_t *string_xml_tag = NULL;
+	static char *function              = "libevtx_record_values_get_utf8_strings_size";
+	size_t safe_utf8_strings_size      = 0;
+	size_t utf8_string_size            = 0;
+	int number_of_strings              = 0;
+	int string_index                   = 0;
 
 	if( record_values == NULL )
 	{
@@ -4803,6 +4906,17 @@ int libevtx_record_values_get_data_size(
 
 		return( -1 );
 	}
+	if( utf8_strings_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 strings size.",
+		 function );
+
+		return( -1 );
+	}
 	if( record_values->data_parsed == 0 )
 	{
 		if( libevtx_record_values_parse_data(
@@ -4821,113 +4935,102 @@ int libevtx_record_values_get_data_size(
 			return( -1 );
 		}
 	}
-	if( record_values->binary_data_value == NULL )
+	if( libcdata_array_get_number_of_entries(
+	     record_values->strings_array,
+	     &number_of_strings,
+	     error ) != 1 )
 	{
-		if( libfwevt_xml_document_get_root_xml_tag(
-		     record_values->xml_document,
-		     &root_xml_tag,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve root XML element.",
-			 function );
-
-			return( -1 );
-		}
-		result = libfwevt_xml_tag_get_element_by_utf8_name(
-			  root_xml_tag,
-			  (uint8_t *) "EventData",
-			  9,
-			  &event_data_xml_tag,
-			  error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of strings.",
+		 function );
 
-		if( result == -1 )
+		return( -1 );
+	}
+	for( string_index = 0;
+	     string_index < number_of_strings;
+	     string_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     record_values->strings_array,
+		     string_index,
+		     (intptr_t **) &string_xml_tag,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve EventData XML element.",
-			 function );
+			 "%s: unable to retrieve string: %d.",
+			 function,
+			 string_index );
 
 			return( -1 );
 		}
-		else if( result == 0 )
-		{
-			return( 0 );
-		}
-		result = libfwevt_xml_tag_get_element_by_utf8_name(
-			  event_data_xml_tag,
-			  (uint8_t *) "BinaryData",
-			  10,
-			  &binary_data_tag,
-			  error );
-
-		if( result == -1 )
+		if( libfwevt_xml_tag_get_utf8_value_size(
+		     string_xml_tag,
+		     &utf8_string_size,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve BinaryData XML element.",
-			 function );
+			 "%s: unable to retrieve string: %d value size.",
+			 function,
+			 string_index );
 
 			return( -1 );
 		}
-		else if( result == 0 )
+		/* A string without a value is stored as an empty string
+		 */
+		if( utf8_string_size == 0 )
 		{
-			return( 0 );
+			utf8_string_size = 1;
 		}
-		if( libfwevt_xml_tag_get_value(
-		     binary_data_tag,
-		     &( record_values->binary_data_value ),
-		     error ) != 1 )
+		if( utf8_string_size > ( (size_t) SSIZE_MAX - safe_utf8_strings_size ) )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve BinaryData XML element value.",
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid UTF-8 strings size value exceeds maximum.",
 			 function );
 
 			return( -1 );
 		}
+		safe_utf8_strings_size += utf8_string_size;
 	}
-	if( libfvalue_value_get_data_size(
-	     record_values->binary_data_value,
-	     data_size,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve size of binary data.",
-		 function );
+	*utf8_strings_size = safe_utf8_strings_size;
 
-		return( -1 );
-	}
 	return( 1 );
 }
 
-/* Retrieves the data
- * Returns 1 if successful, 0 if not available or -1 on error
+/* Retrieves all UTF-8 encoded strings
+ * The strings are stored consecutively and each string is terminated by an end of string character
+ * The offset of the start of each string is stored in the offsets array, that must
+ * contain at least as many entries as there are strings
+ * A string without a value is stored as an empty string
+ * The size should include the end of string characters
+ * Returns 1 if successful or -1 on error
  */
-int libevtx_record_values_get_data(
+int libevtx_record_values_get_utf8_strings(
      libevtx_record_values_t *record_values,
      libevtx_io_handle_t *io_handle,
-     uint8_t *data,
-     size_t data_size,
+     uint8_t *utf8_strings,
+     size_t utf8_strings_size,
+     size_t *utf8_string_offsets,
+     int number_of_offsets,
      libcerror_error_t **error )
 {
-	libfwevt_xml_tag_t *binary_data_tag    = NULL;
-	libfwevt_xml_tag_t *event_data_xml_tag = NULL;
-	libfwevt_xml_tag_t *root_xml_tag       = NULL;
-	static char *function                  = "libevtx_record_values_get_data";
-	int result                             = 0;
+	libfwevt_xml_tag_t *string_xml_tag = NULL;
+	static char *function              = "libevtx_record_values_get_utf8_strings";
+	size_t utf8_string_offset          = 0;
+	size_t utf8_string_size            = 0;
+	int number_of_strings              = 0;
+	int string_index                   = 0;
 
 	if( record_values == NULL )
 	{
@@ -4951,6 +5054,50 @@ int libevtx_record_values_get_data(
 
 		return( -1 );
 	}
+	if( utf8_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_strings_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 strings size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_offsets < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of offsets value less than zero.",
+		 function );
+
+		return( -1 );
+	}
 	if( record_values->data_parsed == 0 )
 	{
 		if( libevtx_record_values_parse_data(
@@ -4969,109 +5116,1589 @@ int libevtx_record_values_get_data(
 			return( -1 );
 		}
 	}
-	if( record_values->binary_data_value == NULL )
+	if( libcdata_array_get_number_of_entries(
+	     record_values->strings_array,
+	     &number_of_strings,
+	     error ) != 1 )
 	{
-		if( libfwevt_xml_document_get_root_xml_tag(
-		     record_values->xml_document,
-		     &root_xml_tag,
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_offsets < number_of_strings )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid number of offsets value too small.",
+		 function );
+
+		return( -1 );
+	}
+	for( string_index = 0;
+	     string_index < number_of_strings;
+	     string_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     record_values->strings_array,
+		     string_index,
+		     (intptr_t **) &string_xml_tag,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve root XML element.",
-			 function );
+			 "%s: unable to retrieve string: %d.",
+			 function,
+			 string_index );
 
 			return( -1 );
 		}
-		result = libfwevt_xml_tag_get_element_by_utf8_name(
-			  root_xml_tag,
-			  (uint8_t *) "EventData",
-			  9,
-			  &event_data_xml_tag,
-			  error );
-
-		if( result == -1 )
+		if( libfwevt_xml_tag_get_utf8_value_size(
+		     string_xml_tag,
+		     &utf8_string_size,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve EventData XML element.",
-			 function );
+			 "%s: unable to retrieve string: %d value size.",
+			 function,
+			 string_index );
 
 			return( -1 );
 		}
-		else if( result == 0 )
+		if( utf8_string_offset >= utf8_strings_size )
 		{
-			return( 0 );
-		}
-		result = libfwevt_xml_tag_get_element_by_utf8_name(
-			  event_data_xml_tag,
-			  (uint8_t *) "BinaryData",
-			  10,
-			  &binary_data_tag,
-			  error );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: UTF-8 strings size value too small.",
+			 function );
 
-		if( result == -1 )
+			return( -1 );
+		}
+		if( utf8_string_size > ( utf8_strings_size - utf8_string_offset ) )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve BinaryData XML element.",
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: UTF-8 strings size value too small.",
 			 function );
 
 			return( -1 );
 		}
-		else if( result == 0 )
+		utf8_string_offsets[ string_index ] = utf8_string_offset;
+
+		if( utf8_string_size == 0 )
 		{
-			return( 0 );
+			utf8_strings[ utf8_string_offset ] = 0;
+
+			utf8_string_size = 1;
 		}
-		if( libfwevt_xml_tag_get_value(
-		     binary_data_tag,
-		     &( record_values->binary_data_value ),
-		     error ) != 1 )
+		else if( libfwevt_xml_tag_get_utf8_value(
+		          string_xml_tag,
+		          &( utf8_strings[ utf8_string_offset ] ),
+		          utf8_string_size,
+		          error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve BinaryData XML element value.",
-			 function );
+			 "%s: unable to retrieve string: %d value.",
+			 function,
+			 string_index );
+
+			return( -1 );
+		}
+		utf8_string_offset += utf8_string_size;
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of all UTF-16 encoded strings
+ * The strings are stored consecutively and each string is terminated by an end of string character
+ * The returned size includes the end of string characters
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_values_get_utf16_strings_size(
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     size_t *utf16_strings_size,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_tag_t *string_xml_tag = NULL;
+	static char *function              = "libevtx_record_values_get_utf16_strings_size";
+	size_t safe_utf16_strings_size     = 0;
+	size_t utf16_string_size           = 0;
+	int number_of_strings              = 0;
+	int string_index                   = 0;
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record values - missing XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_strings_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 strings size.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->data_parsed == 0 )
+	{
+		if( libevtx_record_values_parse_data(
+		     record_values,
+		     io_handle,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to parse data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libcdata_array_get_number_of_entries(
+	     record_values->strings_array,
+	     &number_of_strings,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of strings.",
+		 function );
+
+		return( -1 );
+	}
+	for( string_index = 0;
+	     string_index < number_of_strings;
+	     string_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     record_values->strings_array,
+		     string_index,
+		     (intptr_t **) &string_xml_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve string: %d.",
+			 function,
+			 string_index );
+
+			return( -1 );
+		}
+		if( libfwevt_xml_tag_get_utf16_value_size(
+		     string_xml_tag,
+		     &utf16_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve string: %d value size.",
+			 function,
+			 string_index );
+
+			return( -1 );
+		}
+		/* A string without a value is stored as an empty string
+		 */
+		if( utf16_string_size == 0 )
+		{
+			utf16_string_size = 1;
+		}
+		if( utf16_string_size > ( (size_t) SSIZE_MAX - safe_utf16_strings_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid UTF-16 strings size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		safe_utf16_strings_size += utf16_string_size;
+	}
+	*utf16_strings_size = safe_utf16_strings_size;
+
+	return( 1 );
+}
+
+/* Retrieves all UTF-16 encoded strings
+ * The strings are stored consecutively and each string is terminated by an end of string character
+ * The offset of the start of each string is stored in the offsets array, that must
+ * contain at least as many entries as there are strings
+ * A string without a value is stored as an empty string
+ * The size should include the end of string characters
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_values_get_utf16_strings(
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     uint16_t *utf16_strings,
+     size_t utf16_strings_size,
+     size_t *utf16_string_offsets,
+     int number_of_offsets,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_tag_t *string_xml_tag = NULL;
+	static char *function              = "libevtx_record_values_get_utf16_strings";
+	size_t utf16_string_offset         = 0;
+	size_t utf16_string_size           = 0;
+	int number_of_strings              = 0;
+	int string_index                   = 0;
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record values - missing XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_strings_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 strings size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_offsets < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of offsets value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->data_parsed == 0 )
+	{
+		if( libevtx_record_values_parse_data(
+		     record_values,
+		     io_handle,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to parse data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libcdata_array_get_number_of_entries(
+	     record_values->strings_array,
+	     &number_of_strings,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_offsets < number_of_strings )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid number of offsets value too small.",
+		 function );
+
+		return( -1 );
+	}
+	for( string_index = 0;
+	     string_index < number_of_strings;
+	     string_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     record_values->strings_array,
+		     string_index,
+		     (intptr_t **) &string_xml_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve string: %d.",
+			 function,
+			 string_index );
+
+			return( -1 );
+		}
+		if( libfwevt_xml_tag_get_utf16_value_size(
+		     string_xml_tag,
+		     &utf16_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve string: %d value size.",
+			 function,
+			 string_index );
+
+			return( -1 );
+		}
+		if( utf16_string_offset >= utf16_strings_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: UTF-16 strings size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( utf16_string_size > ( utf16_strings_size - utf16_string_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: UTF-16 strings size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		utf16_string_offsets[ string_index ] = utf16_string_offset;
+
+		if( utf16_string_size == 0 )
+		{
+			utf16_strings[ utf16_string_offset ] = 0;
+
+			utf16_string_size = 1;
+		}
+		else if( libfwevt_xml_tag_get_utf16_value(
+		          string_xml_tag,
+		          &( utf16_strings[ utf16_string_offset ] ),
+		          utf16_string_size,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve string: %d value.",
+			 function,
+			 string_index );
+
+			return( -1 );
+		}
+		utf16_string_offset += utf16_string_size;
+	}
+	return( 1 );
+}
+
+/* Reads the raw event record data
+ * The raw data consists of the event record header, the binary XML and
+ * the copy of the size. The data is read from the file into a copy, since
+ * the chunk that contains the event record can be evicted from the chunks cache
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_values_read_raw_data(
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint8_t **raw_data,
+     size_t *raw_data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *data         = NULL;
+	static char *function = "libevtx_record_values_read_raw_data";
+	ssize_t read_count    = 0;
+	uint32_t copy_of_size = 0;
+	uint32_t size         = 0;
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( raw_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid raw data.",
+		 function );
+
+		return( -1 );
+	}
+	if( *raw_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid raw data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( raw_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid raw data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->data_size == 0 )
+	{
+		return( 0 );
+	}
+	if( ( record_values->data_size < ( sizeof( evtx_event_record_header_t ) + 4 ) )
+	 || ( (size_t) record_values->data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record values - data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * record_values->data_size );
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create raw data.",
+		 function );
+
+		goto on_error;
+	}
+	/* The file IO handle is shared with the file, the read/write lock of the IO handle
+	 * makes sure the seek and read are not interleaved with those of other threads
+	 */
+	read_count = libevtx_io_handle_read_data_at_offset(
+	              io_handle,
+	              file_io_handle,
+	              record_values->offset,
+	              data,
+	              (size_t) record_values->data_size,
+	              error );
+
+	if( read_count != (ssize_t) record_values->data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read event record data.",
+		 function );
+
+		goto on_error;
+	}
+	/* Make sure the data still contains the same event record
+	 */
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evtx_event_record_header_t *) data )->size,
+	 size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ record_values->data_size - 4 ] ),
+	 copy_of_size );
+
+	if( ( memory_compare(
+	       ( (evtx_event_record_header_t *) data )->signature,
+	       evtx_event_record_signature,
+	       4 ) != 0 )
+	 || ( size != record_values->data_size )
+	 || ( copy_of_size != record_values->data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+		 "%s: mismatch in event record data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 record_values->offset,
+		 record_values->offset );
+
+		goto on_error;
+	}
+	*raw_data      = data;
+	*raw_data_size = (size_t) record_values->data_size;
+
+	return( 1 );
+
+on_error:
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( -1 );
+}
+
+/* Retrieves the size of the data
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_values_get_data_size(
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_tag_t *binary_data_tag    = NULL;
+	libfwevt_xml_tag_t *event_data_xml_tag = NULL;
+	libfwevt_xml_tag_t *root_xml_tag       = NULL;
+	static char *function                  = "libevtx_record_values_get_data_size";
+	int result                             = 0;
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record values - missing XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->data_parsed == 0 )
+	{
+		if( libevtx_record_values_parse_data(
+		     record_values,
+		     io_handle,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to parse data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( record_values->binary_data_value == NULL )
+	{
+		if( libfwevt_xml_document_get_root_xml_tag(
+		     record_values->xml_document,
+		     &root_xml_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve root XML element.",
+			 function );
+
+			return( -1 );
+		}
+		result = libfwevt_xml_tag_get_element_by_utf8_name(
+			  root_xml_tag,
+			  (uint8_t *) "EventData",
+			  9,
+			  &event_data_xml_tag,
+			  error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve EventData XML element.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+		result = libfwevt_xml_tag_get_element_by_utf8_name(
+			  event_data_xml_tag,
+			  (uint8_t *) "BinaryData",
+			  10,
+			  &binary_data_tag,
+			  error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve BinaryData XML element.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+		if( libfwevt_xml_tag_get_value(
+		     binary_data_tag,
+		     &( record_values->binary_data_value ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve BinaryData XML element value.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libfvalue_value_get_data_size(
+	     record_values->binary_data_value,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size of binary data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the data
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_values_get_data(
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_tag_t *binary_data_tag    = NULL;
+	libfwevt_xml_tag_t *event_data_xml_tag = NULL;
+	libfwevt_xml_tag_t *root_xml_tag       = NULL;
+	static char *function                  = "libevtx_record_values_get_data";
+	int result                             = 0;
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record values - missing XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->data_parsed == 0 )
+	{
+		if( libevtx_record_values_parse_data(
+		     record_values,
+		     io_handle,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to parse data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( record_values->binary_data_value == NULL )
+	{
+		if( libfwevt_xml_document_get_root_xml_tag(
+		     record_values->xml_document,
+		     &root_xml_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve root XML element.",
+			 function );
+
+			return( -1 );
+		}
+		result = libfwevt_xml_tag_get_element_by_utf8_name(
+			  root_xml_tag,
+			  (uint8_t *) "EventData",
+			  9,
+			  &event_data_xml_tag,
+			  error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve EventData XML element.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+		result = libfwevt_xml_tag_get_element_by_utf8_name(
+			  event_data_xml_tag,
+			  (uint8_t *) "BinaryData",
+			  10,
+			  &binary_data_tag,
+			  error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve BinaryData XML element.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+		if( libfwevt_xml_tag_get_value(
+		     binary_data_tag,
+		     &( record_values->binary_data_value ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve BinaryData XML element value.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libfvalue_value_copy_data(
+	     record_values->binary_data_value,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy binary data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a pointer to the data
+ * The data is the value of the BinaryData element and is owned by the record values
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_values_get_binary_data_pointer(
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *value_data   = NULL;
+	static char *function = "libevtx_record_values_get_binary_data_pointer";
+	size_t value_size     = 0;
+	int encoding          = 0;
+	int result            = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	/* Retrieving the size also looks up the BinaryData value
+	 */
+	result = libevtx_record_values_get_data_size(
+	          record_values,
+	          io_handle,
+	          &value_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size of binary data.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libfvalue_value_get_data(
+	     record_values->binary_data_value,
+	     &value_data,
+	     &value_size,
+	     &encoding,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve binary data.",
+		 function );
+
+		return( -1 );
+	}
+	*data      = value_data;
+	*data_size = value_size;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-8 encoded XML string
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_values_get_utf8_xml_string_size(
+     libevtx_record_values_t *record_values,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_record_values_get_utf8_xml_string_size";
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_document_get_utf8_xml_string_size(
+	     record_values->xml_document,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string size of XML document.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 encoded XML string
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_values_get_utf8_xml_string(
+     libevtx_record_values_t *record_values,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_record_values_get_utf8_xml_string";
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_document_get_utf8_xml_string(
+	     record_values->xml_document,
+	     utf8_string,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string of XML document.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-16 encoded XML string
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_values_get_utf16_xml_string_size(
+     libevtx_record_values_t *record_values,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_record_values_get_utf16_xml_string_size";
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_document_get_utf16_xml_string_size(
+	     record_values->xml_document,
+	     utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 string size of XML document.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-16 encoded XML string
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_values_get_utf16_xml_string(
+     libevtx_record_values_t *record_values,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_record_values_get_utf16_xml_string";
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_document_get_utf16_xml_string(
+	     record_values->xml_document,
+	     utf16_string,
+	     utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 string of XML document.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 encoded XML string using a growable buffer
+ * The buffer is (re)allocated when it is too small to contain the XML string
+ * Reusing the buffer for subsequent records allows the XML string to be rendered
+ * only once per record, instead of once for the size and once for the string
+ * The buffer size contains the allocated size and the string length excludes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_values_get_utf8_xml_string_buffer(
+     libevtx_record_values_t *record_values,
+     uint8_t **utf8_string,
+     size_t *utf8_string_size,
+     size_t *utf8_string_length,
+     libcerror_error_t **error )
+{
+	uint8_t *reallocation = NULL;
+	static char *function = "libevtx_record_values_get_utf8_xml_string_buffer";
+	size_t string_length  = 0;
+	size_t string_size    = 0;
+	int result            = 0;
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string length.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( *utf8_string != NULL )
+	 && ( *utf8_string_size > 0 ) )
+	{
+		/* Try to render the XML string directly into the existing buffer
+		 * this fails if the buffer is too small
+		 */
+		result = libfwevt_xml_document_get_utf8_xml_string(
+		          record_values->xml_document,
+		          *utf8_string,
+		          *utf8_string_size,
+		          NULL );
+	}
+	if( result != 1 )
+	{
+		if( libfwevt_xml_document_get_utf8_xml_string_size(
+		     record_values->xml_document,
+		     &string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-8 string size of XML document.",
+			 function );
+
+			return( -1 );
+		}
+		if( string_size == 0 )
+		{
+			*utf8_string_length = 0;
+
+			return( 1 );
+		}
+		if( string_size > *utf8_string_size )
+		{
+			/* Grow the buffer at least twofold to limit the number of reallocations
+			 */
+			if( string_size < ( 2 * *utf8_string_size ) )
+			{
+				string_size = 2 * *utf8_string_size;
+			}
+			if( string_size > (size_t) ( SSIZE_MAX / sizeof( uint8_t ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid UTF-8 string size value exceeds maximum.",
+				 function );
+
+				return( -1 );
+			}
+			reallocation = (uint8_t *) memory_reallocate(
+			                *utf8_string,
+			                sizeof( uint8_t ) * string_size );
+
+			if( reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize UTF-8 string.",
+				 function );
+
+				return( -1 );
+			}
+			*utf8_string      = reallocation;
+			*utf8_string_size = string_size;
+		}
+		if( libfwevt_xml_document_get_utf8_xml_string(
+		     record_values->xml_document,
+		     *utf8_string,
+		     *utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-8 string of XML document.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	while( string_length < *utf8_string_size )
+	{
+		if( ( *utf8_string )[ string_length ] == 0 )
+		{
+			break;
+		}
+		string_length++;
+	}
+	*utf8_string_length = string_length;
+
+	return( 1 );
+}
+
+/* Retrieves the UTF-16 encoded XML string using a growable buffer
+ * The buffer is (re)allocated when it is too small to contain the XML string
+ * Reusing the buffer for subsequent records allows the XML string to be rendered
+ * only once per record, instead of once for the size and once for the string
+ * The buffer size contains the allocated size and the string length excludes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_values_get_utf16_xml_string_buffer(
+     libevtx_record_values_t *record_values,
+     uint16_t **utf16_string,
+     size_t *utf16_string_size,
+     size_t *utf16_string_length,
+     libcerror_error_t **error )
+{
+	uint16_t *reallocation = NULL;
+	static char *function  = "libevtx_record_values_get_utf16_xml_string_buffer";
+	size_t string_length   = 0;
+	size_t string_size     = 0;
+	int result             = 0;
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string length.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( *utf16_string != NULL )
+	 && ( *utf16_string_size > 0 ) )
+	{
+		/* Try to render the XML string directly into the existing buffer
+		 * this fails if the buffer is too small
+		 */
+		result = libfwevt_xml_document_get_utf16_xml_string(
+		          record_values->xml_document,
+		          *utf16_string,
+		          *utf16_string_size,
+		          NULL );
+	}
+	if( result != 1 )
+	{
+		if( libfwevt_xml_document_get_utf16_xml_string_size(
+		     record_values->xml_document,
+		     &string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-16 string size of XML document.",
+			 function );
+
+			return( -1 );
+		}
+		if( string_size == 0 )
+		{
+			*utf16_string_length = 0;
+
+			return( 1 );
+		}
+		if( string_size > *utf16_string_size )
+		{
+			/* Grow the buffer at least twofold to limit the number of reallocations
+			 */
+			if( string_size < ( 2 * *utf16_string_size ) )
+			{
+				string_size = 2 * *utf16_string_size;
+			}
+			if( string_size > (size_t) ( SSIZE_MAX / sizeof( uint16_t ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid UTF-16 string size value exceeds maximum.",
+				 function );
+
+				return( -1 );
+			}
+			reallocation = (uint16_t *) memory_reallocate(
+			                *utf16_string,
+			                sizeof( uint16_t ) * string_size );
+
+			if( reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize UTF-16 string.",
+				 function );
+
+				return( -1 );
+			}
+			*utf16_string      = reallocation;
+			*utf16_string_size = string_size;
+		}
+		if( libfwevt_xml_document_get_utf16_xml_string(
+		     record_values->xml_document,
+		     *utf16_string,
+		     *utf16_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-16 string of XML document.",
+			 function );
 
 			return( -1 );
 		}
 	}
-	if( libfvalue_value_copy_data(
-	     record_values->binary_data_value,
-	     data,
-	     data_size,
-	     error ) != 1 )
+	while( string_length < *utf16_string_size )
+	{
+		if( ( *utf16_string )[ string_length ] == 0 )
+		{
+			break;
+		}
+		string_length++;
+	}
+	*utf16_string_length = string_length;
+
+	return( 1 );
+}
+
+/* Renders the JSON string of the XML document if not already available
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_values_render_json_string(
+     libevtx_record_values_t *record_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_record_values_render_json_string";
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->xml_document == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy binary data.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record values - missing XML document.",
 		 function );
 
 		return( -1 );
 	}
+	if( record_values->json_string != NULL )
+	{
+		return( 1 );
+	}
+	if( libevtx_json_string_initialize(
+	     &( record_values->json_string ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create JSON string.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_json_string_append_xml_document(
+	     record_values->json_string,
+	     record_values->xml_document,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append XML document to JSON string.",
+		 function );
+
+		goto on_error;
+	}
 	return( 1 );
+
+on_error:
+	if( record_values->json_string != NULL )
+	{
+		libevtx_json_string_free(
+		 &( record_values->json_string ),
+		 NULL );
+	}
+	return( -1 );
 }
 
-/* Retrieves the size of the UTF-8 encoded XML string
+/* Retrieves the size of the UTF-8 encoded JSON string
+ * The JSON string is rendered once and retained by the record values
  * The returned size includes the end of string character
  * Returns 1 if successful or -1 on error
  */
-int libevtx_record_values_get_utf8_xml_string_size(
+int libevtx_record_values_get_utf8_json_string_size(
      libevtx_record_values_t *record_values,
      size_t *utf8_string_size,
      libcerror_error_t **error )
 {
-	static char *function = "libevtx_record_values_get_utf8_xml_string_size";
+	static char *function = "libevtx_record_values_get_utf8_json_string_size";
 
 	if( record_values == NULL )
 	{
@@ -5084,34 +6711,46 @@ int libevtx_record_values_get_utf8_xml_string_size(
 
 		return( -1 );
 	}
-	if( libfwevt_xml_document_get_utf8_xml_string_size(
-	     record_values->xml_document,
-	     utf8_string_size,
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_record_values_render_json_string(
+	     record_values,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-8 string size of XML document.",
+		 "%s: unable to render JSON string.",
 		 function );
 
 		return( -1 );
 	}
+	*utf8_string_size = record_values->json_string->string_length + 1;
+
 	return( 1 );
 }
 
-/* Retrieves the UTF-8 encoded XML string
+/* Retrieves the UTF-8 encoded JSON string
  * The size should include the end of string character
  * Returns 1 if successful or -1 on error
  */
-int libevtx_record_values_get_utf8_xml_string(
+int libevtx_record_values_get_utf8_json_string(
      libevtx_record_values_t *record_values,
      uint8_t *utf8_string,
      size_t utf8_string_size,
      libcerror_error_t **error )
 {
-	static char *function = "libevtx_record_values_get_utf8_xml_string";
+	static char *function = "libevtx_record_values_get_utf8_json_string";
 
 	if( record_values == NULL )
 	{
@@ -5124,34 +6763,83 @@ int libevtx_record_values_get_utf8_xml_string(
 
 		return( -1 );
 	}
-	if( libfwevt_xml_document_get_utf8_xml_string(
-	     record_values->xml_document,
-	     utf8_string,
-	     utf8_string_size,
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_record_values_render_json_string(
+	     record_values,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-8 string of XML document.",
+		 "%s: unable to render JSON string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size < ( record_values->json_string->string_length + 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: UTF-8 string size value too small.",
 		 function );
 
 		return( -1 );
 	}
+	if( record_values->json_string->string_length > 0 )
+	{
+		if( memory_copy(
+		     utf8_string,
+		     record_values->json_string->string,
+		     record_values->json_string->string_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy JSON string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	utf8_string[ record_values->json_string->string_length ] = 0;
+
 	return( 1 );
 }
 
-/* Retrieves the size of the UTF-16 encoded XML string
- * The returned size includes the end of string character
+/* Reads the event data if not already available
  * Returns 1 if successful or -1 on error
  */
-int libevtx_record_values_get_utf16_xml_string_size(
+int libevtx_record_values_read_event_data(
      libevtx_record_values_t *record_values,
-     size_t *utf16_string_size,
+     libevtx_io_handle_t *io_handle,
      libcerror_error_t **error )
 {
-	static char *function = "libevtx_record_values_get_utf16_xml_string_size";
+	static char *function = "libevtx_record_values_read_event_data";
 
 	if( record_values == NULL )
 	{
@@ -5164,34 +6852,120 @@ int libevtx_record_values_get_utf16_xml_string_size(
 
 		return( -1 );
 	}
-	if( libfwevt_xml_document_get_utf16_xml_string_size(
-	     record_values->xml_document,
-	     utf16_string_size,
-	     error ) != 1 )
+	if( record_values->xml_document == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-16 string size of XML document.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record values - missing XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->names_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - missing names table.",
 		 function );
 
 		return( -1 );
 	}
+	if( record_values->event_data != NULL )
+	{
+		return( 1 );
+	}
+	if( record_values->data_parsed == 0 )
+	{
+		if( libevtx_record_values_parse_data(
+		     record_values,
+		     io_handle,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to parse data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* The names table is shared by all the records of the file
+	 * and guarded by its own lock
+	 */
+	if( libevtx_event_data_initialize(
+	     &( record_values->event_data ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create event data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_event_data_read(
+	     record_values->event_data,
+	     record_values->strings_array,
+	     io_handle->names_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read event data.",
+		 function );
+
+		goto on_error;
+	}
 	return( 1 );
+
+on_error:
+	if( record_values->event_data != NULL )
+	{
+		libevtx_event_data_free(
+		 &( record_values->event_data ),
+		 NULL );
+	}
+	return( -1 );
 }
 
-/* Retrieves the UTF-16 encoded XML string
- * The size should include the end of string character
+/* Retrieves the event data
+ * The names, values, value types and integer values are arrays of number of values entries
+ * that are owned by the record values
  * Returns 1 if successful or -1 on error
  */
-int libevtx_record_values_get_utf16_xml_string(
+int libevtx_record_values_get_utf8_event_data(
      libevtx_record_values_t *record_values,
-     uint16_t *utf16_string,
-     size_t utf16_string_size,
+     libevtx_io_handle_t *io_handle,
+     int *number_of_values,
+     const uint8_t ***utf8_names,
+     const uint8_t ***utf8_values,
+     const uint8_t **value_types,
+     const uint64_t **integer_values,
      libcerror_error_t **error )
 {
-	static char *function = "libevtx_record_values_get_utf16_xml_string";
+	static char *function = "libevtx_record_values_get_utf8_event_data";
 
 	if( record_values == NULL )
 	{
@@ -5204,21 +6978,64 @@ int libevtx_record_values_get_utf16_xml_string(
 
 		return( -1 );
 	}
-	if( libfwevt_xml_document_get_utf16_xml_string(
-	     record_values->xml_document,
-	     utf16_string,
-	     utf16_string_size,
+	if( number_of_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of values.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_names == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 names.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 values.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_record_values_read_event_data(
+	     record_values,
+	     io_handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-16 string of XML document.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read event data.",
 		 function );
 
 		return( -1 );
 	}
+	*number_of_values = record_values->event_data->number_of_values;
+	*utf8_names       = record_values->event_data->utf8_names;
+	*utf8_values      = record_values->event_data->utf8_values;
+
+	if( value_types != NULL )
+	{
+		*value_types = record_values->event_data->value_types;
+	}
+	if( integer_values != NULL )
+	{
+		*integer_values = record_values->event_data->integer_values;
+	}
 	return( 1 );
 }
-
@@ -25,7 +25,10 @@
 #include <common.h>
 #include <types.h>
 
+#include "libevtx_event_data.h"
 #include "libevtx_io_handle.h"
+#include "libevtx_json_string.h"
+#include "libevtx_libbfio.h"
 #include "libevtx_libcdata.h"
 #include "libevtx_libcerror.h"
 #include "libevtx_libfvalue.h"
@@ -126,6 +129,14 @@ struct libevtx_record_values
 	/* Value to indicate the data was parsed
 	 */
 	uint8_t data_parsed;
+
+	/* The JSON string
+	 */
+	libevtx_json_string_t *json_string;
+
+	/* The event data
+	 */
+	libevtx_event_data_t *event_data;
 };
 
 int libevtx_record_values_initialize(
@@ -301,6 +312,44 @@ int libevtx_record_values_get_utf16_string(
      size_t utf16_string_size,
      libcerror_error_t **error );
 
+int libevtx_record_values_get_utf8_strings_size(
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     size_t *utf8_strings_size,
+     libcerror_error_t **error );
+
+int libevtx_record_values_get_utf8_strings(
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     uint8_t *utf8_strings,
+     size_t utf8_strings_size,
+     size_t *utf8_string_offsets,
+     int number_of_offsets,
+     libcerror_error_t **error );
+
+int libevtx_record_values_get_utf16_strings_size(
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     size_t *utf16_strings_size,
+     libcerror_error_t **error );
+
+int libevtx_record_values_get_utf16_strings(
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     uint16_t *utf16_strings,
+     size_t utf16_strings_size,
+     size_t *utf16_string_offsets,
+     int number_of_offsets,
+     libcerror_error_t **error );
+
+int libevtx_record_values_read_raw_data(
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint8_t **raw_data,
+     size_t *raw_data_size,
+     libcerror_error_t **error );
+
 int libevtx_record_values_get_data_size(
      libevtx_record_values_t *record_values,
      libevtx_io_handle_t *io_handle,
@@ -314,6 +363,13 @@ int libevtx_record_values_get_data(
      size_t data_size,
      libcerror_error_t **error );
 
+int libevtx_record_values_get_binary_data_pointer(
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
 int libevtx_record_values_get_utf8_xml_string_size(
      libevtx_record_values_t *record_values,
      size_t *utf8_string_size,
@@ -336,6 +392,50 @@ int libevtx_record_values_get_utf16_xml_string(
      size_t utf16_string_size,
      libcerror_error_t **error );
 
+int libevtx_record_values_get_utf8_xml_string_buffer(
+     libevtx_record_values_t *record_values,
+     uint8_t **utf8_string,
+     size_t *utf8_string_size,
+     size_t *utf8_string_length,
+     libcerror_error_t **error );
+
+int libevtx_record_values_get_utf16_xml_string_buffer(
+     libevtx_record_values_t *record_values,
+     uint16_t **utf16_string,
+     size_t *utf16_string_size,
+     size_t *utf16_string_length,
+     libcerror_error_t **error );
+
+int libevtx_record_values_render_json_string(
+     libevtx_record_values_t *record_values,
+     libcerror_error_t **error );
+
+int libevtx_record_values_get_utf8_json_string_size(
+     libevtx_record_values_t *record_values,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+int libevtx_record_values_get_utf8_json_string(
+     libevtx_record_values_t *record_values,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+int libevtx_record_values_read_event_data(
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+int libevtx_record_values_get_utf8_event_data(
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     int *number_of_values,
+     const uint8_t ***utf8_names,
+     const uint8_t ***utf8_values,
+     const uint8_t **value_types,
+     const uint64_t **integer_values,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,193 @@
+/*
+ * Statistics functions
+ *
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_SYS_TIME_H )
+#include <sys/time.h>
+#endif
+
+#if defined( HAVE_TIME_H )
+#include <time.h>
+#endif
+
+#include "libevtx_libcerror.h"
+#include "libevtx_statistics.h"
+#include "libevtx_types.h"
+
+/* Retrieves the current time of a monotonic clock
+ * The time is in nanoseconds and is only meaningful relative to another time
+ * retrieved by this function
+ * Returns the current time or 0 if not available
+ */
+uint64_t libevtx_statistics_get_time(
+          void )
+{
+#if defined( WINAPI )
+	static LARGE_INTEGER performance_frequency = { 0 };
+	LARGE_INTEGER performance_count;
+
+	if( performance_frequency.QuadPart == 0 )
+	{
+		if( QueryPerformanceFrequency(
+		     &performance_frequency ) == 0 )
+		{
+			return( 0 );
+		}
+	}
+	if( QueryPerformanceCounter(
+	     &performance_count ) == 0 )
+	{
+		return( 0 );
+	}
+	return( (uint64_t) ( ( (double) performance_count.QuadPart * 1000000000.0 ) / (double) performance_frequency.QuadPart ) );
+
+#elif defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+	struct timespec time_specification;
+
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_specification ) != 0 )
+	{
+		return( 0 );
+	}
+	return( ( (uint64_t) time_specification.tv_sec * 1000000000 ) + (uint64_t) time_specification.tv_nsec );
+
+#elif defined( HAVE_GETTIMEOFDAY )
+	struct timeval time_value;
+
+	if( gettimeofday(
+	     &time_value,
+	     NULL ) != 0 )
+	{
+		return( 0 );
+	}
+	return( ( (uint64_t) time_value.tv_sec * 1000000000 ) + ( (uint64_t) time_value.tv_usec * 1000 ) );
+
+#else
+	return( 0 );
+#endif
+}
+
+/* Retrieves the statistics from the statistics counters
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_statistics_counters_get_statistics(
+     libevtx_statistics_counters_t *statistics_counters,
+     libevtx_statistics_t *statistics,
+     libcerror_error_t **error )
+{
+	static char *function      = "libevtx_statistics_counters_get_statistics";
+	size_t statistics_size     = 0;
+	uint64_t number_of_lookups = 0;
+	uint64_t number_of_misses  = 0;
+
+	if( statistics_counters == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics counters.",
+		 function );
+
+		return( -1 );
+	}
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	/* The statistics of this version are the smallest supported set,
+	 * a larger size originates from a caller that knows of newer statistics
+	 * which are left untouched
+	 */
+	if( statistics->size < sizeof( libevtx_statistics_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported statistics size.",
+		 function );
+
+		return( -1 );
+	}
+	statistics_size = statistics->size;
+
+	if( memory_set(
+	     statistics,
+	     0,
+	     sizeof( libevtx_statistics_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear statistics.",
+		 function );
+
+		return( -1 );
+	}
+	statistics->size                               = statistics_size;
+	statistics->number_of_chunks_read              = libevtx_statistics_counter_get( statistics_counters->number_of_chunks_read );
+	statistics->number_of_bytes_read               = libevtx_statistics_counter_get( statistics_counters->number_of_bytes_read );
+	statistics->number_of_checksum_mismatches      = libevtx_statistics_counter_get( statistics_counters->number_of_checksum_mismatches );
+	statistics->number_of_records_parsed           = libevtx_statistics_counter_get( statistics_counters->number_of_records_parsed );
+	statistics->number_of_recovered_records_parsed = libevtx_statistics_counter_get( statistics_counters->number_of_recovered_records_parsed );
+	statistics->number_of_xml_documents_read       = libevtx_statistics_counter_get( statistics_counters->number_of_xml_documents_read );
+	statistics->open_time                          = libevtx_statistics_counter_get( statistics_counters->open_time );
+	statistics->chunk_read_time                    = libevtx_statistics_counter_get( statistics_counters->chunk_read_time );
+	statistics->xml_parse_time                     = libevtx_statistics_counter_get( statistics_counters->xml_parse_time );
+
+	/* A cache miss is a lookup that needed a read hence the number of cache hits
+	 * is derived from the number of lookups and the number of reads
+	 */
+	number_of_lookups = libevtx_statistics_counter_get( statistics_counters->number_of_chunk_lookups );
+	number_of_misses  = libevtx_statistics_counter_get( statistics_counters->number_of_chunk_cache_misses );
+
+	if( number_of_lookups > number_of_misses )
+	{
+		statistics->number_of_chunk_cache_hits = number_of_lookups - number_of_misses;
+	}
+	statistics->number_of_chunk_cache_misses = number_of_misses;
+
+	number_of_lookups = libevtx_statistics_counter_get( statistics_counters->number_of_record_lookups );
+	number_of_misses  = libevtx_statistics_counter_get( statistics_counters->number_of_record_cache_misses );
+
+	if( number_of_lookups > number_of_misses )
+	{
+		statistics->number_of_record_cache_hits = number_of_lookups - number_of_misses;
+	}
+	statistics->number_of_record_cache_misses = number_of_misses;
+
+	return( 1 );
+}
+
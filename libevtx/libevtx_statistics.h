@@ -0,0 +1,133 @@
+/*
+ * Statistics functions
+ *
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_STATISTICS_H )
+#define _LIBEVTX_STATISTICS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_definitions.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The counters are updated with relaxed atomic operations where available
+ * since records of the same file can be parsed by multiple threads
+ */
+#if defined( __GNUC__ ) && defined( __ATOMIC_RELAXED )
+#define libevtx_statistics_counter_add( counter, value ) \
+	__atomic_fetch_add( &( counter ), (uint64_t) ( value ), __ATOMIC_RELAXED )
+
+#define libevtx_statistics_counter_get( counter ) \
+	__atomic_load_n( &( counter ), __ATOMIC_RELAXED )
+
+#elif defined( WINAPI ) && ( WINVER >= 0x0600 )
+#define libevtx_statistics_counter_add( counter, value ) \
+	InterlockedExchangeAdd64( (LONGLONG volatile *) &( counter ), (LONGLONG) ( value ) )
+
+#define libevtx_statistics_counter_get( counter ) \
+	(uint64_t) InterlockedCompareExchange64( (LONGLONG volatile *) &( counter ), 0, 0 )
+
+#else
+#define libevtx_statistics_counter_add( counter, value ) \
+	( counter ) += (uint64_t) ( value )
+
+#define libevtx_statistics_counter_get( counter ) \
+	( counter )
+
+#endif
+
+typedef struct libevtx_statistics_counters libevtx_statistics_counters_t;
+
+struct libevtx_statistics_counters
+{
+	/* The number of chunks read
+	 */
+	uint64_t number_of_chunks_read;
+
+	/* The number of bytes read
+	 */
+	uint64_t number_of_bytes_read;
+
+	/* The number of chunk lookups in the chunks cache
+	 */
+	uint64_t number_of_chunk_lookups;
+
+	/* The number of chunks read into the chunks cache
+	 */
+	uint64_t number_of_chunk_cache_misses;
+
+	/* The number of record lookups in the records cache
+	 */
+	uint64_t number_of_record_lookups;
+
+	/* The number of records read into the records cache
+	 */
+	uint64_t number_of_record_cache_misses;
+
+	/* The number of CRC-32 checksum mismatches
+	 */
+	uint64_t number_of_checksum_mismatches;
+
+	/* The number of record headers parsed
+	 */
+	uint64_t number_of_records_parsed;
+
+	/* The number of recovered record headers parsed
+	 */
+	uint64_t number_of_recovered_records_parsed;
+
+	/* The number of XML documents read
+	 */
+	uint64_t number_of_xml_documents_read;
+
+	/* The time spent opening the file in nanoseconds
+	 */
+	uint64_t open_time;
+
+	/* The time spent reading chunks in nanoseconds
+	 */
+	uint64_t chunk_read_time;
+
+	/* The time spent parsing XML documents in nanoseconds
+	 */
+	uint64_t xml_parse_time;
+};
+
+uint64_t libevtx_statistics_get_time(
+          void );
+
+int libevtx_statistics_counters_get_statistics(
+     libevtx_statistics_counters_t *statistics_counters,
+     libevtx_statistics_t *statistics,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_STATISTICS_H ) */
+
@@ -27,6 +27,7 @@
 #include "libevtx_libcdata.h"
 #include "libevtx_libcerror.h"
 #include "libevtx_libcnotify.h"
+#include "libevtx_libcthreads.h"
 #include "libevtx_libfwevt.h"
 #include "libevtx_template_definition.h"
 
@@ -104,6 +105,21 @@ int libevtx_template_definition_initialize(
 
 		goto on_error;
 	}
+#if defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_template_definition->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
 	*template_definition = (libevtx_template_definition_t *) internal_template_definition;
 
 	return( 1 );
@@ -111,6 +127,12 @@ int libevtx_template_definition_initialize(
 on_error:
 	if( internal_template_definition != NULL )
 	{
+		if( internal_template_definition->wevt_template != NULL )
+		{
+			libfwevt_template_free(
+			 &( internal_template_definition->wevt_template ),
+			 NULL );
+		}
 		memory_free(
 		 internal_template_definition );
 	}
@@ -173,6 +195,21 @@ int libevtx_template_definition_free(
 				result = -1;
 			}
 		}
+#if defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( internal_template_definition->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
 		memory_free(
 		 internal_template_definition );
 	}
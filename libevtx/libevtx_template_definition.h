@@ -29,6 +29,7 @@
 #include "libevtx_io_handle.h"
 #include "libevtx_libcdata.h"
 #include "libevtx_libcerror.h"
+#include "libevtx_libcthreads.h"
 #include "libevtx_libfwevt.h"
 #include "libevtx_types.h"
 
@@ -47,6 +48,12 @@ struct libevtx_internal_template_definition
 	/* The XML document
 	 */
 	libfwevt_xml_document_t *xml_document;
+
+#if defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT )
+	/* The read/write lock, that serializes the parsing of records with the template definition
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
 };
 
 LIBEVTX_EXTERN \
@@ -0,0 +1,118 @@
+/*
+ * Trace functions
+ *
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_io_handle.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_trace.h"
+#include "libevtx_unused.h"
+
+/* The trace begin callback
+ */
+void (*libevtx_trace_begin_callback)(
+      int event_type,
+      int chunk_index,
+      off64_t offset,
+      size64_t size,
+      intptr_t *user_data ) = NULL;
+
+/* The trace end callback
+ */
+void (*libevtx_trace_end_callback)(
+      int event_type,
+      int chunk_index,
+      off64_t offset,
+      size64_t size,
+      intptr_t *user_data ) = NULL;
+
+/* The trace user data
+ */
+intptr_t *libevtx_trace_user_data = NULL;
+
+/* Sets the trace callbacks
+ * The callbacks are invoked at the begin and the end of opening a file, reading a chunk,
+ * reading a record, reading a record XML document and parsing the record data
+ * The callbacks apply to all files and should be set before a file is opened,
+ * use NULL to remove a callback
+ * The callbacks are not guarded by a lock, this function must not be called while
+ * any file is being opened or read
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_set_trace_callbacks(
+     void (*begin_callback)(
+            int event_type,
+            int chunk_index,
+            off64_t offset,
+            size64_t size,
+            intptr_t *user_data ),
+     void (*end_callback)(
+            int event_type,
+            int chunk_index,
+            off64_t offset,
+            size64_t size,
+            intptr_t *user_data ),
+     intptr_t *user_data,
+     libcerror_error_t **error LIBEVTX_ATTRIBUTE_UNUSED )
+{
+	LIBEVTX_UNREFERENCED_PARAMETER( error )
+
+	/* Remove the callbacks before changing the user data so that
+	 * a callback is never invoked with the wrong user data
+	 */
+	libevtx_trace_begin_callback = NULL;
+	libevtx_trace_end_callback   = NULL;
+	libevtx_trace_user_data      = user_data;
+	libevtx_trace_begin_callback = begin_callback;
+	libevtx_trace_end_callback   = end_callback;
+
+	return( 1 );
+}
+
+/* Determines the index of the chunk that contains a specific offset
+ * Returns the chunk index or -1 if not available
+ */
+int libevtx_trace_get_chunk_index(
+     libevtx_io_handle_t *io_handle,
+     off64_t offset )
+{
+	off64_t chunk_index = 0;
+
+	if( io_handle == NULL )
+	{
+		return( -1 );
+	}
+	if( ( io_handle->chunk_size == 0 )
+	 || ( offset < io_handle->chunks_data_offset ) )
+	{
+		return( -1 );
+	}
+	chunk_index = ( offset - io_handle->chunks_data_offset ) / io_handle->chunk_size;
+
+	if( chunk_index > (off64_t) INT_MAX )
+	{
+		return( -1 );
+	}
+	return( (int) chunk_index );
+}
+
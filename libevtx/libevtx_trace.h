@@ -0,0 +1,119 @@
+/*
+ * Trace functions
+ *
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_TRACE_H )
+#define _LIBEVTX_TRACE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_definitions.h"
+#include "libevtx_extern.h"
+#include "libevtx_io_handle.h"
+#include "libevtx_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+extern void (*libevtx_trace_begin_callback)(
+             int event_type,
+             int chunk_index,
+             off64_t offset,
+             size64_t size,
+             intptr_t *user_data );
+
+extern void (*libevtx_trace_end_callback)(
+             int event_type,
+             int chunk_index,
+             off64_t offset,
+             size64_t size,
+             intptr_t *user_data );
+
+extern intptr_t *libevtx_trace_user_data;
+
+/* The trace callbacks are checked with a branch that is predicted to be
+ * not taken, hence without callbacks the cost of a trace point is a load
+ * and a compare. The arguments are only evaluated when a callback is set
+ */
+#if defined( __GNUC__ )
+#define libevtx_trace_callback_is_set( callback ) \
+	__builtin_expect( ( callback ) != NULL, 0 )
+
+#else
+#define libevtx_trace_callback_is_set( callback ) \
+	( ( callback ) != NULL )
+
+#endif
+
+/* The trace points are single statements, so they can be used like a function call.
+ * The callback is loaded once so it is not changed between the check and the call
+ */
+#define libevtx_trace_begin( event_type, chunk_index, offset, size ) \
+	do \
+	{ \
+		void (*libevtx_trace_callback)( int, int, off64_t, size64_t, intptr_t * ) = libevtx_trace_begin_callback; \
+		if( libevtx_trace_callback_is_set( libevtx_trace_callback ) ) \
+		{ \
+			libevtx_trace_callback( event_type, chunk_index, (off64_t) ( offset ), (size64_t) ( size ), libevtx_trace_user_data ); \
+		} \
+	} \
+	while( 0 )
+
+#define libevtx_trace_end( event_type, chunk_index, offset, size ) \
+	do \
+	{ \
+		void (*libevtx_trace_callback)( int, int, off64_t, size64_t, intptr_t * ) = libevtx_trace_end_callback; \
+		if( libevtx_trace_callback_is_set( libevtx_trace_callback ) ) \
+		{ \
+			libevtx_trace_callback( event_type, chunk_index, (off64_t) ( offset ), (size64_t) ( size ), libevtx_trace_user_data ); \
+		} \
+	} \
+	while( 0 )
+
+LIBEVTX_EXTERN \
+int libevtx_set_trace_callbacks(
+     void (*begin_callback)(
+            int event_type,
+            int chunk_index,
+            off64_t offset,
+            size64_t size,
+            intptr_t *user_data ),
+     void (*end_callback)(
+            int event_type,
+            int chunk_index,
+            off64_t offset,
+            size64_t size,
+            intptr_t *user_data ),
+     intptr_t *user_data,
+     libcerror_error_t **error );
+
+int libevtx_trace_get_chunk_index(
+     libevtx_io_handle_t *io_handle,
+     off64_t offset );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_TRACE_H ) */
+
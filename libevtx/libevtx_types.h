@@ -45,6 +45,65 @@ typedef intptr_t libevtx_template_definition_t;
 
 #endif /* defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI ) */
 
+/* The file statistics
+ */
+typedef struct libevtx_statistics libevtx_statistics_t;
+
+struct libevtx_statistics
+{
+	/* The number of chunks read
+	 */
+	uint64_t number_of_chunks_read;
+
+	/* The number of bytes read
+	 */
+	uint64_t number_of_bytes_read;
+
+	/* The number of chunk cache hits
+	 */
+	uint64_t number_of_chunk_cache_hits;
+
+	/* The number of chunk cache misses
+	 */
+	uint64_t number_of_chunk_cache_misses;
+
+	/* The number of record cache hits
+	 */
+	uint64_t number_of_record_cache_hits;
+
+	/* The number of record cache misses
+	 */
+	uint64_t number_of_record_cache_misses;
+
+	/* The number of CRC-32 checksum mismatches
+	 */
+	uint64_t number_of_checksum_mismatches;
+
+	/* The number of records parsed
+	 */
+	uint64_t number_of_records_parsed;
+
+	/* The number of recovered records parsed
+	 */
+	uint64_t number_of_recovered_records_parsed;
+
+	/* The number of XML documents read
+	 */
+	uint64_t number_of_xml_documents_read;
+
+	/* The cumulative time spent opening the file in nanoseconds
+	 */
+	uint64_t open_time;
+
+	/* The cumulative time spent reading chunks in nanoseconds
+	 */
+	uint64_t chunk_read_time;
+
+	/* The cumulative time spent parsing XML documents in nanoseconds
+	 */
+	uint64_t xml_parse_time;
+};
+
 #endif /* defined( HAVE_LOCAL_LIBEVTX ) */
 
 /* The largest primary (or scalar) available
@@ -38,7 +38,6 @@
 #include "pyevtx_python.h"
 #include "pyevtx_record.h"
 #include "pyevtx_records.h"
-#include "pyevtx_strings.h"
 #include "pyevtx_unused.h"
 
 #if !defined( LIBEVTX_HAVE_BFIO )
@@ -625,23 +624,6 @@ PyMODINIT_FUNC initpyevtx(
 	 "records",
 	 (PyObject *) &pyevtx_records_type_object );
 
-	/* Setup the strings type object
-	 */
-	pyevtx_strings_type_object.tp_new = PyType_GenericNew;
-
-	if( PyType_Ready(
-	     &pyevtx_strings_type_object ) < 0 )
-	{
-		goto on_error;
-	}
-	Py_IncRef(
-	 (PyObject * ) &pyevtx_strings_type_object );
-
-	PyModule_AddObject(
-	 module,
-	 "strings",
-	 (PyObject *) &pyevtx_strings_type_object );
-
 	PyGILState_Release(
 	 gil_state );
 
@@ -31,6 +31,7 @@
 #include "pyevtx_error.h"
 #include "pyevtx_file.h"
 #include "pyevtx_file_object_io_handle.h"
+#include "pyevtx_integer.h"
 #include "pyevtx_libbfio.h"
 #include "pyevtx_libcerror.h"
 #include "pyevtx_libclocale.h"
@@ -81,6 +82,13 @@ PyMethodDef pyevtx_file_object_methods[] = {
 	  "\n"
 	  "Closes a file." },
 
+	{ "refresh",
+	  (PyCFunction) pyevtx_file_refresh,
+	  METH_NOARGS,
+	  "refresh() -> None\n"
+	  "\n"
+	  "Refreshes the file to include the records written since it was opened." },
+
 	{ "is_corrupted",
 	  (PyCFunction) pyevtx_file_is_corrupted,
 	  METH_NOARGS,
@@ -138,6 +146,14 @@ PyMethodDef pyevtx_file_object_methods[] = {
 	  "\n"
 	  "Retrieves the recovered record specified by the index." },
 
+	{ "get_statistics",
+	  (PyCFunction) pyevtx_file_get_statistics,
+	  METH_NOARGS,
+	  "get_statistics() -> Dictionary\n"
+	  "\n"
+	  "Retrieves the statistics, such as the number of chunks read, the cache hits\n"
+	  "and misses and the time spent in nanoseconds, since the file was opened." },
+
 	/* Sentinel */
 	{ NULL, NULL, 0, NULL }
 };
@@ -180,6 +196,12 @@ PyGetSetDef pyevtx_file_object_get_set_definitions[] = {
 	  "The recovered records.",
 	  NULL },
 
+	{ "statistics",
+	  (getter) pyevtx_file_get_statistics,
+	  (setter) 0,
+	  "The statistics.",
+	  NULL },
+
 	/* Sentinel */
 	{ NULL, NULL, NULL, NULL, NULL }
 };
@@ -823,6 +845,55 @@ PyObject *pyevtx_file_close(
 	return( Py_None );
 }
 
+/* Refreshes the file
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyevtx_file_refresh(
+           pyevtx_file_t *pyevtx_file,
+           PyObject *arguments PYEVTX_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "pyevtx_file_refresh";
+	int result               = 0;
+
+	PYEVTX_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyevtx_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libevtx_file_refresh(
+	          pyevtx_file->file,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyevtx_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to refresh file.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 Py_None );
+
+	return( Py_None );
+}
+
 /* Determines if the file is corrupted
  * Returns a Python object if successful or NULL on error
  */
@@ -1723,3 +1794,141 @@ PyObject *pyevtx_file_get_recovered_records(
 	return( sequence_object );
 }
 
+/* Retrieves the statistics
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyevtx_file_get_statistics(
+           pyevtx_file_t *pyevtx_file,
+           PyObject *arguments PYEVTX_ATTRIBUTE_UNUSED )
+{
+	libevtx_statistics_t statistics;
+
+	const char *value_names[ 13 ] = {
+		"number_of_chunks_read",
+		"number_of_bytes_read",
+		"number_of_chunk_cache_hits",
+		"number_of_chunk_cache_misses",
+		"number_of_record_cache_hits",
+		"number_of_record_cache_misses",
+		"number_of_checksum_mismatches",
+		"number_of_records_parsed",
+		"number_of_recovered_records_parsed",
+		"number_of_xml_documents_read",
+		"open_time",
+		"chunk_read_time",
+		"xml_parse_time" };
+
+	uint64_t values[ 13 ];
+
+	PyObject *dictionary_object = NULL;
+	PyObject *integer_object    = NULL;
+	libcerror_error_t *error    = NULL;
+	static char *function       = "pyevtx_file_get_statistics";
+	int result                  = 0;
+	int value_index             = 0;
+
+	PYEVTX_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyevtx_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file.",
+		 function );
+
+		return( NULL );
+	}
+	statistics.size = sizeof( libevtx_statistics_t );
+
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libevtx_file_get_statistics(
+	          pyevtx_file->file,
+	          &statistics,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyevtx_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve statistics.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	values[ 0 ]  = statistics.number_of_chunks_read;
+	values[ 1 ]  = statistics.number_of_bytes_read;
+	values[ 2 ]  = statistics.number_of_chunk_cache_hits;
+	values[ 3 ]  = statistics.number_of_chunk_cache_misses;
+	values[ 4 ]  = statistics.number_of_record_cache_hits;
+	values[ 5 ]  = statistics.number_of_record_cache_misses;
+	values[ 6 ]  = statistics.number_of_checksum_mismatches;
+	values[ 7 ]  = statistics.number_of_records_parsed;
+	values[ 8 ]  = statistics.number_of_recovered_records_parsed;
+	values[ 9 ]  = statistics.number_of_xml_documents_read;
+	values[ 10 ] = statistics.open_time;
+	values[ 11 ] = statistics.chunk_read_time;
+	values[ 12 ] = statistics.xml_parse_time;
+
+	dictionary_object = PyDict_New();
+
+	if( dictionary_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create dictionary object.",
+		 function );
+
+		goto on_error;
+	}
+	for( value_index = 0;
+	     value_index < 13;
+	     value_index++ )
+	{
+		integer_object = pyevtx_integer_unsigned_new_from_64bit(
+		                  values[ value_index ] );
+
+		if( integer_object == NULL )
+		{
+			goto on_error;
+		}
+		if( PyDict_SetItemString(
+		     dictionary_object,
+		     value_names[ value_index ],
+		     integer_object ) != 0 )
+		{
+			PyErr_Format(
+			 PyExc_MemoryError,
+			 "%s: unable to set value: %s in dictionary object.",
+			 function,
+			 value_names[ value_index ] );
+
+			goto on_error;
+		}
+		Py_DecRef(
+		 integer_object );
+
+		integer_object = NULL;
+	}
+	return( dictionary_object );
+
+on_error:
+	if( integer_object != NULL )
+	{
+		Py_DecRef(
+		 integer_object );
+	}
+	if( dictionary_object != NULL )
+	{
+		Py_DecRef(
+		 dictionary_object );
+	}
+	return( NULL );
+}
+
@@ -77,6 +77,10 @@ PyObject *pyevtx_file_close(
            pyevtx_file_t *pyevtx_file,
            PyObject *arguments );
 
+PyObject *pyevtx_file_refresh(
+           pyevtx_file_t *pyevtx_file,
+           PyObject *arguments );
+
 PyObject *pyevtx_file_is_corrupted(
            pyevtx_file_t *pyevtx_file,
            PyObject *arguments );
@@ -137,6 +141,10 @@ PyObject *pyevtx_file_get_recovered_records(
            pyevtx_file_t *pyevtx_file,
            PyObject *arguments );
 
+PyObject *pyevtx_file_get_statistics(
+           pyevtx_file_t *pyevtx_file,
+           PyObject *arguments );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -33,7 +33,6 @@
 #include "pyevtx_libevtx.h"
 #include "pyevtx_python.h"
 #include "pyevtx_record.h"
-#include "pyevtx_strings.h"
 #include "pyevtx_unused.h"
 
 PyMethodDef pyevtx_record_object_methods[] = {
@@ -136,6 +135,13 @@ PyMethodDef pyevtx_record_object_methods[] = {
 	  "\n"
 	  "Retrieves the data." },
 
+	{ "get_raw_data",
+	  (PyCFunction) pyevtx_record_get_raw_data,
+	  METH_NOARGS,
+	  "get_raw_data() -> Binary string or None\n"
+	  "\n"
+	  "Retrieves the raw event record data." },
+
 	{ "get_xml_string",
 	  (PyCFunction) pyevtx_record_get_xml_string,
 	  METH_NOARGS,
@@ -218,7 +224,7 @@ PyGetSetDef pyevtx_record_object_get_set_definitions[] = {
 	{ "strings",
 	  (getter) pyevtx_record_get_strings,
 	  (setter) 0,
-	  "The strings.",
+	  "The strings as a list.",
 	  NULL },
 
 	{ "data",
@@ -227,6 +233,12 @@ PyGetSetDef pyevtx_record_object_get_set_definitions[] = {
 	  "The data.",
 	  NULL },
 
+	{ "raw_data",
+	  (getter) pyevtx_record_get_raw_data,
+	  (setter) 0,
+	  "The raw event record data.",
+	  NULL },
+
 	{ "xml_string",
 	  (getter) pyevtx_record_get_xml_string,
 	  (setter) 0,
@@ -1591,18 +1603,29 @@ PyObject *pyevtx_record_get_string(
 	return( string_object );
 }
 
-/* Retrieves a sequence and iterator object for the strings
+/* Retrieves a list of the strings
+ * All strings are retrieved with a single call to libevtx_record_get_utf8_strings
+ * A string without a value is None and an empty string is an empty Unicode object,
+ * like the strings retrieved by index
  * Returns a Python object if successful or NULL on error
  */
 PyObject *pyevtx_record_get_strings(
            pyevtx_record_t *pyevtx_record,
            PyObject *arguments PYEVTX_ATTRIBUTE_UNUSED )
 {
-	PyObject *sequence_object = NULL;
-	libcerror_error_t *error  = NULL;
-	static char *function     = "pyevtx_record_get_strings";
-	int number_of_strings     = 0;
-	int result                = 0;
+	PyObject *list_object       = NULL;
+	PyObject *string_object     = NULL;
+	libcerror_error_t *error    = NULL;
+	uint8_t *utf8_strings       = NULL;
+	const char *errors          = NULL;
+	static char *function       = "pyevtx_record_get_strings";
+	size_t *utf8_string_offsets = NULL;
+	size_t utf8_string_length   = 0;
+	size_t utf8_string_size     = 0;
+	size_t utf8_strings_size    = 0;
+	int number_of_strings       = 0;
+	int result                  = 0;
+	int string_index            = 0;
 
 	PYEVTX_UNREFERENCED_PARAMETER( arguments )
 
@@ -1622,6 +1645,14 @@ PyObject *pyevtx_record_get_strings(
 	          &number_of_strings,
 	          &error );
 
+	if( ( result == 1 )
+	 && ( number_of_strings > 0 ) )
+	{
+		result = libevtx_record_get_utf8_strings_size(
+		          pyevtx_record->record,
+		          &utf8_strings_size,
+		          &error );
+	}
 	Py_END_ALLOW_THREADS
 
 	if( result != 1 )
@@ -1629,29 +1660,187 @@ PyObject *pyevtx_record_get_strings(
 		pyevtx_error_raise(
 		 error,
 		 PyExc_IOError,
-		 "%s: unable to retrieve number of strings.",
+		 "%s: unable to retrieve strings size.",
 		 function );
 
 		libcerror_error_free(
 		 &error );
 
-		return( NULL );
+		goto on_error;
 	}
-	sequence_object = pyevtx_strings_new(
-	                   (PyObject *) pyevtx_record,
-	                   &pyevtx_record_get_string_by_index,
-	                   number_of_strings );
+	list_object = PyList_New(
+	               (Py_ssize_t) number_of_strings );
 
-	if( sequence_object == NULL )
+	if( list_object == NULL )
 	{
 		PyErr_Format(
 		 PyExc_MemoryError,
-		 "%s: unable to create sequence object.",
+		 "%s: unable to create list object.",
 		 function );
 
-		return( NULL );
+		goto on_error;
+	}
+	if( number_of_strings == 0 )
+	{
+		return( list_object );
+	}
+	utf8_strings = (uint8_t *) PyMem_Malloc(
+	                            sizeof( uint8_t ) * utf8_strings_size );
+
+	if( utf8_strings == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create UTF-8 strings.",
+		 function );
+
+		goto on_error;
+	}
+	utf8_string_offsets = (size_t *) PyMem_Malloc(
+	                                  sizeof( size_t ) * number_of_strings );
+
+	if( utf8_string_offsets == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create UTF-8 string offsets.",
+		 function );
+
+		goto on_error;
 	}
-	return( sequence_object );
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libevtx_record_get_utf8_strings(
+	          pyevtx_record->record,
+	          utf8_strings,
+	          utf8_strings_size,
+	          utf8_string_offsets,
+	          number_of_strings,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyevtx_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve strings as UTF-8 strings.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	for( string_index = 0;
+	     string_index < number_of_strings;
+	     string_index++ )
+	{
+		if( string_index < ( number_of_strings - 1 ) )
+		{
+			utf8_string_length = utf8_string_offsets[ string_index + 1 ];
+		}
+		else
+		{
+			utf8_string_length = utf8_strings_size;
+		}
+		utf8_string_length -= utf8_string_offsets[ string_index ] + 1;
+
+		/* An empty string is stored for both a string without a value
+		 * and an empty string value, which are distinguished by the size
+		 * of the individual string
+		 */
+		utf8_string_size = 1;
+
+		if( utf8_string_length == 0 )
+		{
+			Py_BEGIN_ALLOW_THREADS
+
+			result = libevtx_record_get_utf8_string_size(
+			          pyevtx_record->record,
+			          string_index,
+			          &utf8_string_size,
+			          &error );
+
+			Py_END_ALLOW_THREADS
+
+			if( result == -1 )
+			{
+				pyevtx_error_raise(
+				 error,
+				 PyExc_IOError,
+				 "%s: unable to determine size of string: %d as UTF-8 string.",
+				 function,
+				 string_index );
+
+				libcerror_error_free(
+				 &error );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				utf8_string_size = 0;
+			}
+		}
+		if( utf8_string_size == 0 )
+		{
+			Py_IncRef(
+			 Py_None );
+
+			string_object = Py_None;
+		}
+		else
+		{
+			string_object = PyUnicode_DecodeUTF8(
+			                 (char *) &( utf8_strings[ utf8_string_offsets[ string_index ] ] ),
+			                 (Py_ssize_t) utf8_string_length,
+			                 errors );
+
+			if( string_object == NULL )
+			{
+				PyErr_Format(
+				 PyExc_IOError,
+				 "%s: unable to convert UTF-8 string: %d into Unicode object.",
+				 function,
+				 string_index );
+
+				goto on_error;
+			}
+		}
+		/* PyList_SetItem steals the reference to the string object
+		 */
+		PyList_SetItem(
+		 list_object,
+		 (Py_ssize_t) string_index,
+		 string_object );
+	}
+	PyMem_Free(
+	 utf8_string_offsets );
+
+	PyMem_Free(
+	 utf8_strings );
+
+	return( list_object );
+
+on_error:
+	if( list_object != NULL )
+	{
+		Py_DecRef(
+		 list_object );
+	}
+	if( utf8_string_offsets != NULL )
+	{
+		PyMem_Free(
+		 utf8_string_offsets );
+	}
+	if( utf8_strings != NULL )
+	{
+		PyMem_Free(
+		 utf8_strings );
+	}
+	return( NULL );
 }
 
 /* Retrieves the data
@@ -1663,7 +1852,7 @@ PyObject *pyevtx_record_get_data(
 {
 	PyObject *bytes_object   = NULL;
 	libcerror_error_t *error = NULL;
-	char *data               = NULL;
+	const uint8_t *data      = NULL;
 	static char *function    = "pyevtx_record_get_data";
 	size_t data_size         = 0;
 	int result               = 0;
@@ -1681,8 +1870,9 @@ PyObject *pyevtx_record_get_data(
 	}
 	Py_BEGIN_ALLOW_THREADS
 
-	result = libevtx_record_get_data_size(
+	result = libevtx_record_get_binary_data_pointer(
 	          pyevtx_record->record,
+	          &data,
 	          &data_size,
 	          &error );
 
@@ -1693,13 +1883,13 @@ PyObject *pyevtx_record_get_data(
 		pyevtx_error_raise(
 		 error,
 		 PyExc_IOError,
-		 "%s: unable to retrieve data size.",
+		 "%s: unable to retrieve data.",
 		 function );
 
 		libcerror_error_free(
 		 &error );
 
-		goto on_error;
+		return( NULL );
 	}
 	else if( ( result == 0 )
 	      || ( data_size == 0 ) )
@@ -1709,73 +1899,106 @@ PyObject *pyevtx_record_get_data(
 
 		return( Py_None );
 	}
-	data = (char *) PyMem_Malloc(
-	                 sizeof( char ) * data_size );
+	/* This is a binary string so include the full size
+	 */
+#if PY_MAJOR_VERSION >= 3
+	bytes_object = PyBytes_FromStringAndSize(
+	                (char *) data,
+	                (Py_ssize_t) data_size );
+#else
+	bytes_object = PyString_FromStringAndSize(
+	                (char *) data,
+	                (Py_ssize_t) data_size );
+#endif
+	if( bytes_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_IOError,
+		 "%s: unable to convert data into Bytes object.",
+		 function );
 
-	if( data == NULL )
+		return( NULL );
+	}
+	return( bytes_object );
+}
+
+/* Retrieves the raw data
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyevtx_record_get_raw_data(
+           pyevtx_record_t *pyevtx_record,
+           PyObject *arguments PYEVTX_ATTRIBUTE_UNUSED )
+{
+	PyObject *bytes_object   = NULL;
+	libcerror_error_t *error = NULL;
+	const uint8_t *data      = NULL;
+	static char *function    = "pyevtx_record_get_raw_data";
+	size_t data_size         = 0;
+	int result               = 0;
+
+	PYEVTX_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyevtx_record == NULL )
 	{
 		PyErr_Format(
-		 PyExc_MemoryError,
-		 "%s: unable to create data.",
+		 PyExc_ValueError,
+		 "%s: invalid record.",
 		 function );
 
-		goto on_error;
+		return( NULL );
 	}
 	Py_BEGIN_ALLOW_THREADS
 
-	result = libevtx_record_get_data(
+	result = libevtx_record_get_raw_data_pointer(
 	          pyevtx_record->record,
-	          (uint8_t *) data,
-	          data_size,
+	          &data,
+	          &data_size,
 	          &error );
 
 	Py_END_ALLOW_THREADS
 
-	if( result != 1 )
+	if( result == -1 )
 	{
 		pyevtx_error_raise(
 		 error,
 		 PyExc_IOError,
-		 "%s: unable to retrieve data.",
+		 "%s: unable to retrieve raw data.",
 		 function );
 
 		libcerror_error_free(
 		 &error );
 
-		goto on_error;
+		return( NULL );
+	}
+	else if( ( result == 0 )
+	      || ( data_size == 0 ) )
+	{
+		Py_IncRef(
+		 Py_None );
+
+		return( Py_None );
 	}
 	/* This is a binary string so include the full size
 	 */
 #if PY_MAJOR_VERSION >= 3
 	bytes_object = PyBytes_FromStringAndSize(
-	                data,
+	                (char *) data,
 	                (Py_ssize_t) data_size );
 #else
 	bytes_object = PyString_FromStringAndSize(
-	                data,
+	                (char *) data,
 	                (Py_ssize_t) data_size );
 #endif
 	if( bytes_object == NULL )
 	{
 		PyErr_Format(
 		 PyExc_IOError,
-		 "%s: unable to convert data into Bytes object.",
+		 "%s: unable to convert raw data into Bytes object.",
 		 function );
 
-		goto on_error;
+		return( NULL );
 	}
-	PyMem_Free(
-	 data );
-
 	return( bytes_object );
-
-on_error:
-	if( data != NULL )
-	{
-		PyMem_Free(
-		 data );
-	}
-	return( NULL );
 }
 
 /* Retrieves the xml string
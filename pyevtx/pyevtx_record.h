@@ -127,6 +127,10 @@ PyObject *pyevtx_record_get_data(
            pyevtx_record_t *pyevtx_record,
            PyObject *arguments );
 
+PyObject *pyevtx_record_get_raw_data(
+           pyevtx_record_t *pyevtx_record,
+           PyObject *arguments );
+
 PyObject *pyevtx_record_get_xml_string(
            pyevtx_record_t *pyevtx_record,
            PyObject *arguments );
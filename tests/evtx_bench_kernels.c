@@ -0,0 +1,1081 @@
+/*
+ * Library hot kernels benchmark program
+ *
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_getopt.h"
+#include "evtx_test_libcerror.h"
+#include "evtx_test_libevtx.h"
+#include "evtx_test_unused.h"
+
+#include "../evtxtools/evtxtools_profile.h"
+#include "../libevtx/libevtx_byte_stream.h"
+#include "../libevtx/libevtx_checksum.h"
+#include "../libevtx/libevtx_chunk.h"
+#include "../libevtx/libevtx_io_handle.h"
+#include "../libevtx/libevtx_record_values.h"
+
+#define EVTX_BENCH_KERNELS_CHUNK_SIZE			65536
+#define EVTX_BENCH_KERNELS_FILE_HEADER_SIZE		4096
+#define EVTX_BENCH_KERNELS_MAXIMUM_NUMBER_OF_RECORDS	2048
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+/* The benchmark context
+ */
+typedef struct evtx_bench_kernels_context evtx_bench_kernels_context_t;
+
+struct evtx_bench_kernels_context
+{
+	/* The IO handle
+	 */
+	libevtx_io_handle_t *io_handle;
+
+	/* The chunk data
+	 */
+	uint8_t chunk_data[ EVTX_BENCH_KERNELS_CHUNK_SIZE ];
+
+	/* The 0-byte filled data
+	 */
+	uint8_t zero_data[ EVTX_BENCH_KERNELS_CHUNK_SIZE ];
+
+	/* The free space offset
+	 */
+	uint32_t free_space_offset;
+
+	/* The offsets of the records in the chunk data
+	 */
+	size_t record_offsets[ EVTX_BENCH_KERNELS_MAXIMUM_NUMBER_OF_RECORDS ];
+
+	/* The number of records
+	 */
+	int number_of_records;
+
+	/* The number of warm-up runs
+	 */
+	int number_of_warm_up_runs;
+
+	/* The number of repetitions
+	 */
+	int number_of_repetitions;
+
+	/* The samples, one per repetition, in nanoseconds per unit
+	 */
+	double *samples;
+};
+
+/* Compares two samples
+ * Returns -1, 0 or 1
+ */
+int evtx_bench_kernels_compare_samples(
+     const void *first_sample,
+     const void *second_sample )
+{
+	double first_value  = *( (const double *) first_sample );
+	double second_value = *( (const double *) second_sample );
+
+	if( first_value < second_value )
+	{
+		return( -1 );
+	}
+	else if( first_value > second_value )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Prints the median and 99th percentile of the samples of a kernel
+ */
+void evtx_bench_kernels_samples_fprint(
+      evtx_bench_kernels_context_t *context,
+      const char *kernel_name,
+      const char *unit_name,
+      uint64_t number_of_units )
+{
+	int p99_index = 0;
+
+	qsort(
+	 context->samples,
+	 (size_t) context->number_of_repetitions,
+	 sizeof( double ),
+	 &evtx_bench_kernels_compare_samples );
+
+	p99_index = ( ( context->number_of_repetitions * 99 ) + 99 ) / 100 - 1;
+
+	fprintf(
+	 stdout,
+	 "%-32s : median: %10.3f ns/%s, p99: %10.3f ns/%s (%" PRIu64 " %ss)\n",
+	 kernel_name,
+	 context->samples[ context->number_of_repetitions / 2 ],
+	 unit_name,
+	 context->samples[ p99_index ],
+	 unit_name,
+	 number_of_units,
+	 unit_name );
+}
+
+/* Benchmarks libevtx_checksum_calculate_little_endian_crc32 on the event records data of the chunk
+ * Returns 1 if successful or -1 on error
+ */
+int evtx_bench_kernels_crc32(
+     evtx_bench_kernels_context_t *context,
+     libcerror_error_t **error )
+{
+	static char *function = "evtx_bench_kernels_crc32";
+	size_t data_size      = 0;
+	uint64_t start_time   = 0;
+	uint32_t crc32        = 0;
+	int run_index         = 0;
+
+	data_size = context->free_space_offset - 512;
+
+	for( run_index = 0;
+	     run_index < ( context->number_of_warm_up_runs + context->number_of_repetitions );
+	     run_index++ )
+	{
+		start_time = evtxtools_profile_get_time();
+
+		if( libevtx_checksum_calculate_little_endian_crc32(
+		     &crc32,
+		     &( context->chunk_data[ 512 ] ),
+		     data_size,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to calculate CRC-32.",
+			 function );
+
+			return( -1 );
+		}
+		if( run_index >= context->number_of_warm_up_runs )
+		{
+			context->samples[ run_index - context->number_of_warm_up_runs ] =
+				(double) ( evtxtools_profile_get_time() - start_time ) / (double) data_size;
+		}
+	}
+	evtx_bench_kernels_samples_fprint(
+	 context,
+	 "crc32",
+	 "byte",
+	 (uint64_t) data_size );
+
+	return( 1 );
+}
+
+/* Benchmarks libevtx_byte_stream_check_for_zero_byte_fill on 0-byte filled chunk data,
+ * which is the worst case since every byte is checked
+ * Returns 1 if successful or -1 on error
+ */
+int evtx_bench_kernels_zero_byte_fill(
+     evtx_bench_kernels_context_t *context,
+     libcerror_error_t **error )
+{
+	static char *function = "evtx_bench_kernels_zero_byte_fill";
+	uint64_t start_time   = 0;
+	int run_index         = 0;
+
+	for( run_index = 0;
+	     run_index < ( context->number_of_warm_up_runs + context->number_of_repetitions );
+	     run_index++ )
+	{
+		start_time = evtxtools_profile_get_time();
+
+		if( libevtx_byte_stream_check_for_zero_byte_fill(
+		     context->zero_data,
+		     EVTX_BENCH_KERNELS_CHUNK_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if data is 0-byte filled.",
+			 function );
+
+			return( -1 );
+		}
+		if( run_index >= context->number_of_warm_up_runs )
+		{
+			context->samples[ run_index - context->number_of_warm_up_runs ] =
+				(double) ( evtxtools_profile_get_time() - start_time ) / (double) EVTX_BENCH_KERNELS_CHUNK_SIZE;
+		}
+	}
+	evtx_bench_kernels_samples_fprint(
+	 context,
+	 "zero_byte_fill",
+	 "byte",
+	 (uint64_t) EVTX_BENCH_KERNELS_CHUNK_SIZE );
+
+	return( 1 );
+}
+
+/* Benchmarks the recovered records scan of the free space of the chunk
+ * Returns 1 if successful, 0 if the chunk has no free space or -1 on error
+ */
+int evtx_bench_kernels_recovered_records_scan(
+     evtx_bench_kernels_context_t *context,
+     libcerror_error_t **error )
+{
+	libevtx_chunk_t *chunk = NULL;
+	static char *function  = "evtx_bench_kernels_recovered_records_scan";
+	size_t data_size       = 0;
+	uint64_t start_time    = 0;
+	uint64_t stop_time     = 0;
+	int run_index          = 0;
+
+	data_size = EVTX_BENCH_KERNELS_CHUNK_SIZE - context->free_space_offset;
+
+	if( data_size == 0 )
+	{
+		return( 0 );
+	}
+	for( run_index = 0;
+	     run_index < ( context->number_of_warm_up_runs + context->number_of_repetitions );
+	     run_index++ )
+	{
+		/* The chunk is recreated for every run to discard the recovered records
+		 */
+		if( libevtx_chunk_initialize(
+		     &chunk,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create chunk.",
+			 function );
+
+			goto on_error;
+		}
+		chunk->data = (uint8_t *) memory_allocate(
+		                           EVTX_BENCH_KERNELS_CHUNK_SIZE );
+
+		if( chunk->data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create chunk data.",
+			 function );
+
+			goto on_error;
+		}
+		chunk->data_size = EVTX_BENCH_KERNELS_CHUNK_SIZE;
+
+		if( memory_copy(
+		     chunk->data,
+		     context->chunk_data,
+		     EVTX_BENCH_KERNELS_CHUNK_SIZE ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy chunk data.",
+			 function );
+
+			goto on_error;
+		}
+		start_time = evtxtools_profile_get_time();
+
+		if( libevtx_chunk_read_recovered_records(
+		     chunk,
+		     context->io_handle,
+		     (size_t) context->free_space_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read recovered records.",
+			 function );
+
+			goto on_error;
+		}
+		stop_time = evtxtools_profile_get_time();
+
+		if( libevtx_chunk_free(
+		     &chunk,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free chunk.",
+			 function );
+
+			goto on_error;
+		}
+		if( run_index >= context->number_of_warm_up_runs )
+		{
+			context->samples[ run_index - context->number_of_warm_up_runs ] =
+				(double) ( stop_time - start_time ) / (double) data_size;
+		}
+	}
+	evtx_bench_kernels_samples_fprint(
+	 context,
+	 "recovered_records_scan",
+	 "byte",
+	 (uint64_t) data_size );
+
+	return( 1 );
+
+on_error:
+	if( chunk != NULL )
+	{
+		libevtx_chunk_free(
+		 &chunk,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Benchmarks libevtx_record_values_read_header on the records of the chunk
+ * Returns 1 if successful or -1 on error
+ */
+int evtx_bench_kernels_record_values_read_header(
+     evtx_bench_kernels_context_t *context,
+     libcerror_error_t **error )
+{
+	libevtx_record_values_t *record_values = NULL;
+	static char *function                  = "evtx_bench_kernels_record_values_read_header";
+	uint64_t start_time                    = 0;
+	int record_index                       = 0;
+	int run_index                          = 0;
+
+	if( libevtx_record_values_initialize(
+	     &record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record values.",
+		 function );
+
+		goto on_error;
+	}
+	for( run_index = 0;
+	     run_index < ( context->number_of_warm_up_runs + context->number_of_repetitions );
+	     run_index++ )
+	{
+		start_time = evtxtools_profile_get_time();
+
+		for( record_index = 0;
+		     record_index < context->number_of_records;
+		     record_index++ )
+		{
+			if( libevtx_record_values_read_header(
+			     record_values,
+			     context->io_handle,
+			     context->chunk_data,
+			     EVTX_BENCH_KERNELS_CHUNK_SIZE,
+			     context->record_offsets[ record_index ],
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read record: %d header.",
+				 function,
+				 record_index );
+
+				goto on_error;
+			}
+		}
+		if( run_index >= context->number_of_warm_up_runs )
+		{
+			context->samples[ run_index - context->number_of_warm_up_runs ] =
+				(double) ( evtxtools_profile_get_time() - start_time ) / (double) context->number_of_records;
+		}
+	}
+	if( libevtx_record_values_free(
+	     &record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free record values.",
+		 function );
+
+		goto on_error;
+	}
+	evtx_bench_kernels_samples_fprint(
+	 context,
+	 "record_values_read_header",
+	 "record",
+	 (uint64_t) context->number_of_records );
+
+	return( 1 );
+
+on_error:
+	if( record_values != NULL )
+	{
+		libevtx_record_values_free(
+		 &record_values,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Benchmarks libevtx_record_values_read_xml_document on the records of the chunk
+ * Only the time spent in libevtx_record_values_read_xml_document is measured
+ * Returns 1 if successful or -1 on error
+ */
+int evtx_bench_kernels_record_values_read_xml_document(
+     evtx_bench_kernels_context_t *context,
+     libcerror_error_t **error )
+{
+	libevtx_record_values_t *record_values = NULL;
+	static char *function                  = "evtx_bench_kernels_record_values_read_xml_document";
+	uint64_t elapsed_time                  = 0;
+	uint64_t start_time                    = 0;
+	int record_index                       = 0;
+	int run_index                          = 0;
+
+	for( run_index = 0;
+	     run_index < ( context->number_of_warm_up_runs + context->number_of_repetitions );
+	     run_index++ )
+	{
+		elapsed_time = 0;
+
+		for( record_index = 0;
+		     record_index < context->number_of_records;
+		     record_index++ )
+		{
+			if( libevtx_record_values_initialize(
+			     &record_values,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create record values.",
+				 function );
+
+				goto on_error;
+			}
+			if( libevtx_record_values_read_header(
+			     record_values,
+			     context->io_handle,
+			     context->chunk_data,
+			     EVTX_BENCH_KERNELS_CHUNK_SIZE,
+			     context->record_offsets[ record_index ],
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read record: %d header.",
+				 function,
+				 record_index );
+
+				goto on_error;
+			}
+			start_time = evtxtools_profile_get_time();
+
+			if( libevtx_record_values_read_xml_document(
+			     record_values,
+			     context->io_handle,
+			     context->chunk_data,
+			     EVTX_BENCH_KERNELS_CHUNK_SIZE,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read record: %d XML document.",
+				 function,
+				 record_index );
+
+				goto on_error;
+			}
+			elapsed_time += evtxtools_profile_get_time() - start_time;
+
+			if( libevtx_record_values_free(
+			     &record_values,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free record values.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( run_index >= context->number_of_warm_up_runs )
+		{
+			context->samples[ run_index - context->number_of_warm_up_runs ] =
+				(double) elapsed_time / (double) context->number_of_records;
+		}
+	}
+	evtx_bench_kernels_samples_fprint(
+	 context,
+	 "record_values_read_xml_document",
+	 "record",
+	 (uint64_t) context->number_of_records );
+
+	return( 1 );
+
+on_error:
+	if( record_values != NULL )
+	{
+		libevtx_record_values_free(
+		 &record_values,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads a chunk from a file and determines the offsets of its records
+ * Returns 1 if successful or -1 on error
+ */
+int evtx_bench_kernels_read_chunk(
+     evtx_bench_kernels_context_t *context,
+     const system_character_t *source,
+     int chunk_index,
+     libcerror_error_t **error )
+{
+	libevtx_record_values_t *record_values = NULL;
+	FILE *file_stream                      = NULL;
+	static char *function                  = "evtx_bench_kernels_read_chunk";
+	size_t chunk_data_offset               = 0;
+	uint32_t last_record_offset            = 0;
+	int result                             = 0;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	file_stream = file_stream_open_wide(
+	               source,
+	               _SYSTEM_STRING( FILE_STREAM_BINARY_OPEN_READ ) );
+#else
+	file_stream = file_stream_open(
+	               source,
+	               FILE_STREAM_BINARY_OPEN_READ );
+#endif
+	if( file_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open source file.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_stream_seek_offset(
+	     file_stream,
+	     (off64_t) EVTX_BENCH_KERNELS_FILE_HEADER_SIZE + ( (off64_t) chunk_index * EVTX_BENCH_KERNELS_CHUNK_SIZE ),
+	     SEEK_SET ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek chunk: %d offset.",
+		 function,
+		 chunk_index );
+
+		goto on_error;
+	}
+	if( file_stream_read(
+	     file_stream,
+	     context->chunk_data,
+	     EVTX_BENCH_KERNELS_CHUNK_SIZE ) != EVTX_BENCH_KERNELS_CHUNK_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read chunk: %d.",
+		 function,
+		 chunk_index );
+
+		goto on_error;
+	}
+	if( file_stream_close(
+	     file_stream ) != 0 )
+	{
+		file_stream = NULL;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close source file.",
+		 function );
+
+		goto on_error;
+	}
+	file_stream = NULL;
+
+	if( memory_compare(
+	     context->chunk_data,
+	     "ElfChnk",
+	     8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_SIGNATURE_MISMATCH,
+		 "%s: unsupported chunk: %d signature.",
+		 function,
+		 chunk_index );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( context->chunk_data[ 44 ] ),
+	 last_record_offset );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( context->chunk_data[ 48 ] ),
+	 context->free_space_offset );
+
+	if( ( context->free_space_offset < 512 )
+	 || ( context->free_space_offset > EVTX_BENCH_KERNELS_CHUNK_SIZE )
+	 || ( last_record_offset >= context->free_space_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk: %d free space or last record offset value out of bounds.",
+		 function,
+		 chunk_index );
+
+		goto on_error;
+	}
+	if( libevtx_record_values_initialize(
+	     &record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record values.",
+		 function );
+
+		goto on_error;
+	}
+	chunk_data_offset = 512;
+
+	while( ( chunk_data_offset <= last_record_offset )
+	    && ( context->number_of_records < EVTX_BENCH_KERNELS_MAXIMUM_NUMBER_OF_RECORDS ) )
+	{
+		result = libevtx_record_values_read_header(
+		          record_values,
+		          context->io_handle,
+		          context->chunk_data,
+		          EVTX_BENCH_KERNELS_CHUNK_SIZE,
+		          chunk_data_offset,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read record header at offset: %" PRIzd ".",
+			 function,
+			 chunk_data_offset );
+
+			goto on_error;
+		}
+		context->record_offsets[ context->number_of_records++ ] = chunk_data_offset;
+
+		chunk_data_offset += record_values->data_size;
+	}
+	if( libevtx_record_values_free(
+	     &record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free record values.",
+		 function );
+
+		goto on_error;
+	}
+	if( context->number_of_records == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing records in chunk: %d.",
+		 function,
+		 chunk_index );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( record_values != NULL )
+	{
+		libevtx_record_values_free(
+		 &record_values,
+		 NULL );
+	}
+	if( file_stream != NULL )
+	{
+		file_stream_close(
+		 file_stream );
+	}
+	return( -1 );
+}
+
+/* Copies a decimal option value from a string
+ * Returns 1 if successful or 0 if unsupported value
+ */
+int evtx_bench_kernels_copy_option_from_string(
+     const system_character_t *string,
+     int *value )
+{
+	size_t string_index = 0;
+	int decimal_value   = 0;
+
+	for( string_index = 0;
+	     string[ string_index ] != 0;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] < (system_character_t) '0' )
+		 || ( string[ string_index ] > (system_character_t) '9' )
+		 || ( decimal_value > 1000000 ) )
+		{
+			return( 0 );
+		}
+		decimal_value *= 10;
+		decimal_value += (int) ( string[ string_index ] - (system_character_t) '0' );
+	}
+	if( string_index == 0 )
+	{
+		return( 0 );
+	}
+	*value = decimal_value;
+
+	return( 1 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+	evtx_bench_kernels_context_t *context = NULL;
+	libcerror_error_t *error              = NULL;
+	system_character_t *source            = NULL;
+	system_integer_t option               = 0;
+	int chunk_index                       = 0;
+	int number_of_repetitions             = 101;
+	int number_of_warm_up_runs            = 10;
+
+	while( ( option = evtx_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "c:r:w:" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'c':
+				if( evtx_bench_kernels_copy_option_from_string(
+				     optarg,
+				     &chunk_index ) != 1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unsupported chunk index.\n" );
+
+					return( EXIT_FAILURE );
+				}
+				break;
+
+			case (system_integer_t) 'r':
+				if( ( evtx_bench_kernels_copy_option_from_string(
+				       optarg,
+				       &number_of_repetitions ) != 1 )
+				 || ( number_of_repetitions == 0 ) )
+				{
+					fprintf(
+					 stderr,
+					 "Unsupported number of repetitions.\n" );
+
+					return( EXIT_FAILURE );
+				}
+				break;
+
+			case (system_integer_t) 'w':
+				if( evtx_bench_kernels_copy_option_from_string(
+				     optarg,
+				     &number_of_warm_up_runs ) != 1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unsupported number of warm-up runs.\n" );
+
+					return( EXIT_FAILURE );
+				}
+				break;
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Usage: evtx_bench_kernels [ -c chunk_index ] [ -r repetitions ] [ -w warm_up_runs ] source\n" );
+
+		return( EXIT_FAILURE );
+	}
+	source = argv[ optind ];
+
+	context = (evtx_bench_kernels_context_t *) memory_allocate(
+	                                            sizeof( evtx_bench_kernels_context_t ) );
+
+	if( context == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create context.\n" );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     context,
+	     0,
+	     sizeof( evtx_bench_kernels_context_t ) ) == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to clear context.\n" );
+
+		memory_free(
+		 context );
+
+		context = NULL;
+
+		goto on_error;
+	}
+	context->number_of_repetitions  = number_of_repetitions;
+	context->number_of_warm_up_runs = number_of_warm_up_runs;
+
+	context->samples = (double *) memory_allocate(
+	                               sizeof( double ) * number_of_repetitions );
+
+	if( context->samples == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create samples.\n" );
+
+		goto on_error;
+	}
+	if( libevtx_io_handle_initialize(
+	     &( context->io_handle ),
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create IO handle.\n" );
+
+		goto on_error;
+	}
+	if( evtx_bench_kernels_read_chunk(
+	     context,
+	     source,
+	     chunk_index,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to read chunk: %d from: %" PRIs_SYSTEM ".\n",
+		 chunk_index,
+		 source );
+
+		goto on_error;
+	}
+	fprintf(
+	 stdout,
+	 "Chunk: %d with %d records, free space offset: %" PRIu32 ", %d warm-up runs, %d repetitions\n\n",
+	 chunk_index,
+	 context->number_of_records,
+	 context->free_space_offset,
+	 number_of_warm_up_runs,
+	 number_of_repetitions );
+
+	if( evtx_bench_kernels_crc32(
+	     context,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to benchmark: crc32.\n" );
+
+		goto on_error;
+	}
+	if( evtx_bench_kernels_zero_byte_fill(
+	     context,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to benchmark: zero_byte_fill.\n" );
+
+		goto on_error;
+	}
+	if( evtx_bench_kernels_recovered_records_scan(
+	     context,
+	     &error ) == -1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to benchmark: recovered_records_scan.\n" );
+
+		goto on_error;
+	}
+	if( evtx_bench_kernels_record_values_read_header(
+	     context,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to benchmark: record_values_read_header.\n" );
+
+		goto on_error;
+	}
+	if( evtx_bench_kernels_record_values_read_xml_document(
+	     context,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to benchmark: record_values_read_xml_document.\n" );
+
+		goto on_error;
+	}
+	if( libevtx_io_handle_free(
+	     &( context->io_handle ),
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free IO handle.\n" );
+
+		goto on_error;
+	}
+	memory_free(
+	 context->samples );
+	memory_free(
+	 context );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	if( context != NULL )
+	{
+		if( context->io_handle != NULL )
+		{
+			libevtx_io_handle_free(
+			 &( context->io_handle ),
+			 NULL );
+		}
+		if( context->samples != NULL )
+		{
+			memory_free(
+			 context->samples );
+		}
+		memory_free(
+		 context );
+	}
+	return( EXIT_FAILURE );
+
+#else
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+	fprintf(
+	 stderr,
+	 "Benchmarking the library internals is not supported on this platform.\n" );
+
+	return( EXIT_SUCCESS );
+#endif
+}
+
@@ -102,6 +102,8 @@ int main(
 
 	/* TODO: add tests for libevtx_chunks_table_read_record */
 
+	/* TODO: add tests for libevtx_chunks_table_get_record_values_by_index */
+
 #endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
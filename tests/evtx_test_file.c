@@ -20,6 +20,7 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <file_stream.h>
 #include <narrow_string.h>
 #include <system_string.h>
@@ -39,6 +40,8 @@
 #include "evtx_test_memory.h"
 #include "evtx_test_unused.h"
 
+#include "../libevtx/evtx_chunk.h"
+#include "../libevtx/libevtx_checksum.h"
 #include "../libevtx/libevtx_file.h"
 
 #if !defined( LIBEVTX_HAVE_BFIO )
@@ -1181,6 +1184,267 @@ on_error:
 	return( 0 );
 }
 
+/* Tests opening a file twice with the same index file
+ * The first open writes the index file and the second open reads it
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_open_with_index_file(
+     const system_character_t *source )
+{
+	char narrow_source[ 256 ];
+
+	uint64_t last_record_identifier[ 2 ];
+	int number_of_recovered_records[ 2 ];
+	int number_of_records[ 2 ];
+
+	FILE *index_file_stream    = NULL;
+	libcerror_error_t *error   = NULL;
+	libevtx_file_t *file       = NULL;
+	libevtx_record_t *record   = NULL;
+	const char *index_filename = "evtx_test_file_index.tmp";
+	int open_index             = 0;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	result = evtx_test_get_narrow_source(
+	          source,
+	          narrow_source,
+	          256,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	remove(
+	 index_filename );
+
+	for( open_index = 0;
+	     open_index < 2;
+	     open_index++ )
+	{
+		last_record_identifier[ open_index ] = 0;
+
+		result = libevtx_file_initialize(
+		          &file,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "file",
+		 file );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_file_set_index_filename(
+		          file,
+		          index_filename,
+		          narrow_string_length(
+		           index_filename ),
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_file_open(
+		          file,
+		          narrow_source,
+		          LIBEVTX_OPEN_READ,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_file_get_number_of_records(
+		          file,
+		          &( number_of_records[ open_index ] ),
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_file_get_number_of_recovered_records(
+		          file,
+		          &( number_of_recovered_records[ open_index ] ),
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( number_of_records[ open_index ] > 0 )
+		{
+			result = libevtx_file_get_record_by_index(
+			          file,
+			          number_of_records[ open_index ] - 1,
+			          &record,
+			          &error );
+
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libevtx_record_get_identifier(
+			          record,
+			          &( last_record_identifier[ open_index ] ),
+			          &error );
+
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libevtx_record_free(
+			          &record,
+			          &error );
+
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		result = libevtx_file_close(
+		          file,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_file_free(
+		          &file,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* The first open should have written the index file
+		 */
+		index_file_stream = file_stream_open(
+		                     index_filename,
+		                     "rb" );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "index_file_stream",
+		 index_file_stream );
+
+		file_stream_close(
+		 index_file_stream );
+
+		index_file_stream = NULL;
+	}
+	/* Test if the records read using the index file match those read by scanning the chunks
+	 */
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "number_of_records",
+	 number_of_records[ 1 ],
+	 number_of_records[ 0 ] );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "number_of_recovered_records",
+	 number_of_recovered_records[ 1 ],
+	 number_of_recovered_records[ 0 ] );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "last_record_identifier",
+	 last_record_identifier[ 1 ],
+	 last_record_identifier[ 0 ] );
+
+	/* Clean up
+	 */
+	remove(
+	 index_filename );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( index_file_stream != NULL )
+	{
+		file_stream_close(
+		 index_file_stream );
+	}
+	if( record != NULL )
+	{
+		libevtx_record_free(
+		 &record,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libevtx_file_free(
+		 &file,
+		 NULL );
+	}
+	remove(
+	 index_filename );
+
+	return( 0 );
+}
+
 /* Tests the libevtx_file_signal_abort function
  * Returns 1 if successful or 0 if not
  */
@@ -1190,10 +1454,1189 @@ int evtx_test_file_signal_abort(
 	libcerror_error_t *error = NULL;
 	int result               = 0;
 
-	/* Test regular cases
+	/* Test regular cases
+	 */
+	result = libevtx_file_signal_abort(
+	          file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_file_signal_abort(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_file_refresh function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_refresh(
+     libevtx_file_t *file )
+{
+	libcerror_error_t *error            = NULL;
+	int number_of_records               = 0;
+	int number_of_records_after_refresh = 0;
+	int result                          = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_refresh(
+	          file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* An unchanged file should retain its records
+	 */
+	result = libevtx_file_get_number_of_records(
+	          file,
+	          &number_of_records_after_refresh,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "number_of_records_after_refresh",
+	 number_of_records_after_refresh,
+	 number_of_records );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_file_refresh(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+/* Reads the data of a source file
+ * Returns 1 if successful or -1 on error
+ */
+int evtx_test_file_read_source_data(
+     libbfio_handle_t *file_io_handle,
+     uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "evtx_test_file_read_source_data";
+	size64_t file_size    = 0;
+	ssize_t read_count    = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_open(
+	     file_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( file_size == 0 )
+	 || ( file_size > (size64_t) ( 64 * 1024 * 1024 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	*data = (uint8_t *) memory_allocate(
+	                     sizeof( uint8_t ) * (size_t) file_size );
+
+	if( *data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_seek_offset(
+	     file_io_handle,
+	     0,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek start of file.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libbfio_handle_read_buffer(
+	              file_io_handle,
+	              *data,
+	              (size_t) file_size,
+	              error );
+
+	if( read_count != (ssize_t) file_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_close(
+	     file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	*data_size = (size_t) file_size;
+
+	return( 1 );
+
+on_error:
+	if( *data != NULL )
+	{
+		memory_free(
+		 *data );
+
+		*data = NULL;
+	}
+	libbfio_handle_close(
+	 file_io_handle,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Retrieves the identifier of a specific record
+ * Returns 1 if successful or -1 on error
+ */
+int evtx_test_file_get_record_identifier(
+     libevtx_file_t *file,
+     int record_index,
+     uint64_t *identifier,
+     libcerror_error_t **error )
+{
+	libevtx_record_t *record = NULL;
+	static char *function    = "evtx_test_file_get_record_identifier";
+
+	if( libevtx_file_get_record_by_index(
+	     file,
+	     record_index,
+	     &record,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record: %d.",
+		 function,
+		 record_index );
+
+		goto on_error;
+	}
+	if( libevtx_record_get_identifier(
+	     record,
+	     identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record: %d identifier.",
+		 function,
+		 record_index );
+
+		goto on_error;
+	}
+	if( libevtx_record_free(
+	     &record,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free record: %d.",
+		 function,
+		 record_index );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( record != NULL )
+	{
+		libevtx_record_free(
+		 &record,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Checks if the records of a file have specific identifiers
+ * Returns 1 if the identifiers match, 0 if not or -1 on error
+ */
+int evtx_test_file_compare_record_identifiers(
+     libevtx_file_t *file,
+     uint64_t *record_identifiers,
+     int number_of_records,
+     libcerror_error_t **error )
+{
+	static char *function = "evtx_test_file_compare_record_identifiers";
+	uint64_t identifier   = 0;
+	int record_index      = 0;
+
+	if( record_identifiers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record identifiers.",
+		 function );
+
+		return( -1 );
+	}
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		if( evtx_test_file_get_record_identifier(
+		     file,
+		     record_index,
+		     &identifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record: %d identifier.",
+			 function,
+			 record_index );
+
+			return( -1 );
+		}
+		if( identifier != record_identifiers[ record_index ] )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
+/* Writes a chunk that only contains the first records of another chunk
+ * The chunk is written as a file that is still being written would contain it
+ * Returns 1 if successful or -1 on error
+ */
+int evtx_test_file_truncate_chunk(
+     uint8_t *chunk_data,
+     size_t chunk_data_size,
+     uint16_t number_of_records,
+     libcerror_error_t **error )
+{
+	static char *function           = "evtx_test_file_truncate_chunk";
+	uint64_t first_record_number    = 0;
+	uint64_t last_record_identifier = 0;
+	uint32_t calculated_checksum    = 0;
+	uint32_t last_record_offset     = 0;
+	uint32_t record_data_offset     = 512;
+	uint32_t record_data_size       = 0;
+	uint16_t record_index           = 0;
+
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunk_data_size < 512 )
+	 || ( chunk_data_size > (size_t) UINT32_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		if( ( (size_t) record_data_offset + 24 ) > chunk_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid record: %" PRIu16 " data offset value out of bounds.",
+			 function,
+			 record_index );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 &( chunk_data[ record_data_offset + 4 ] ),
+		 record_data_size );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 &( chunk_data[ record_data_offset + 8 ] ),
+		 last_record_identifier );
+
+		if( ( record_data_size < 24 )
+		 || ( record_data_size > ( chunk_data_size - record_data_offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid record: %" PRIu16 " data size value out of bounds.",
+			 function,
+			 record_index );
+
+			return( -1 );
+		}
+		last_record_offset  = record_data_offset;
+		record_data_offset += record_data_size;
+	}
+	if( memory_set(
+	     &( chunk_data[ record_data_offset ] ),
+	     0,
+	     chunk_data_size - record_data_offset ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (evtx_chunk_header_t *) chunk_data )->first_event_record_number,
+	 first_record_number );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (evtx_chunk_header_t *) chunk_data )->last_event_record_number,
+	 first_record_number + number_of_records - 1 );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (evtx_chunk_header_t *) chunk_data )->last_event_record_identifier,
+	 last_record_identifier );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (evtx_chunk_header_t *) chunk_data )->last_event_record_offset,
+	 last_record_offset );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (evtx_chunk_header_t *) chunk_data )->free_space_offset,
+	 record_data_offset );
+
+	if( libevtx_checksum_calculate_little_endian_crc32(
+	     &calculated_checksum,
+	     &( chunk_data[ 512 ] ),
+	     record_data_offset - 512,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate event records CRC-32 checksum.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (evtx_chunk_header_t *) chunk_data )->event_records_checksum,
+	 calculated_checksum );
+
+	if( libevtx_checksum_calculate_little_endian_crc32(
+	     &calculated_checksum,
+	     chunk_data,
+	     120,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate header CRC-32 checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_checksum_calculate_little_endian_crc32(
+	     &calculated_checksum,
+	     &( chunk_data[ 128 ] ),
+	     384,
+	     calculated_checksum,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate header CRC-32 checksum.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (evtx_chunk_header_t *) chunk_data )->checksum,
+	 calculated_checksum );
+
+	return( 1 );
+}
+
+/* Tests the libevtx_file_refresh function on a file that changes
+ * The changes are made to a copy of the source file in memory, that contains
+ * a chunk that is being written, a chunk that is reused and a file header
+ * that cannot be refreshed
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_refresh_changes(
+     libbfio_handle_t *source_file_io_handle )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libevtx_file_t *file             = NULL;
+	uint64_t *record_identifiers     = NULL;
+	uint8_t *chunk_data              = NULL;
+	uint8_t *source_data             = NULL;
+	uint8_t *test_data               = NULL;
+	void *memcpy_result              = NULL;
+	void *memset_result              = NULL;
+	size_t chunk_data_offset         = 0;
+	size_t data_size                 = 0;
+	uint64_t identifier              = 0;
+	uint64_t last_identifier         = 0;
+	uint32_t last_record_offset      = 0;
+	uint32_t record_data_offset      = 0;
+	uint32_t record_data_size        = 0;
+	uint16_t chunk_index             = 0;
+	uint16_t header_block_size       = 0;
+	uint16_t last_chunk_index        = 0;
+	uint16_t number_of_chunk_records = 0;
+	uint16_t number_of_chunks        = 0;
+	int number_of_records            = 0;
+	int number_of_reused_records     = 0;
+	int number_of_source_records     = 0;
+	int record_index                 = 0;
+	int result                       = 0;
+	int reused_record_index          = 0;
+
+	/* Initialize test
+	 */
+	result = evtx_test_file_read_source_data(
+	          source_file_io_handle,
+	          &source_data,
+	          &data_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( data_size < ( 4096 + ( 2 * 65536 ) ) )
+	{
+		/* The source file does not contain enough chunks for this test
+		 */
+		memory_free(
+		 source_data );
+
+		return( 1 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 &( source_data[ 40 ] ),
+	 header_block_size );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( source_data[ 42 ] ),
+	 number_of_chunks );
+
+	if( header_block_size != 4096 )
+	{
+		memory_free(
+		 source_data );
+
+		return( 1 );
+	}
+	/* Determine the last chunk in range that contains at least 2 records
+	 */
+	number_of_chunk_records = 0;
+
+	for( chunk_index = 0;
+	     chunk_index < number_of_chunks;
+	     chunk_index++ )
+	{
+		chunk_data_offset = 4096 + ( (size_t) chunk_index * 65536 );
+
+		if( ( chunk_data_offset + 65536 ) > data_size )
+		{
+			break;
+		}
+		chunk_data = &( source_data[ chunk_data_offset ] );
+
+		if( memory_compare(
+		     chunk_data,
+		     "ElfChnk",
+		     8 ) != 0 )
+		{
+			break;
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (evtx_chunk_header_t *) chunk_data )->last_event_record_offset,
+		 last_record_offset );
+
+		result = 0;
+
+		for( record_data_offset = 512;
+		     record_data_offset <= last_record_offset;
+		     record_data_offset += record_data_size )
+		{
+			if( ( record_data_offset + 8 ) > 65536 )
+			{
+				break;
+			}
+			byte_stream_copy_to_uint32_little_endian(
+			 &( chunk_data[ record_data_offset + 4 ] ),
+			 record_data_size );
+
+			if( record_data_size < 24 )
+			{
+				break;
+			}
+			result++;
+		}
+		if( result >= 2 )
+		{
+			last_chunk_index        = chunk_index;
+			number_of_chunk_records = (uint16_t) result;
+		}
+	}
+	if( number_of_chunk_records == 0 )
+	{
+		memory_free(
+		 source_data );
+
+		return( 1 );
+	}
+	test_data = (uint8_t *) memory_allocate(
+	                         sizeof( uint8_t ) * data_size );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "test_data",
+	 test_data );
+
+	memcpy_result = memory_copy(
+	                 test_data,
+	                 source_data,
+	                 data_size );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "memcpy_result",
+	 memcpy_result );
+
+	/* Determine the records of the unmodified file
+	 */
+	result = evtx_test_open_file_io_handle(
+	          &file_io_handle,
+	          test_data,
+	          data_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = evtx_test_file_open_source(
+	          &file,
+	          file_io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_get_number_of_records(
+	          file,
+	          &number_of_source_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_GREATER_THAN_INT(
+	 "number_of_source_records",
+	 number_of_source_records,
+	 0 );
+
+	record_identifiers = (uint64_t *) memory_allocate(
+	                                   sizeof( uint64_t ) * number_of_source_records );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "record_identifiers",
+	 record_identifiers );
+
+	for( record_index = 0;
+	     record_index < number_of_source_records;
+	     record_index++ )
+	{
+		result = evtx_test_file_get_record_identifier(
+		          file,
+		          record_index,
+		          &( record_identifiers[ record_index ] ),
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = evtx_test_file_close_source(
+	          &file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a chunk that is extended in place
+	 */
+	chunk_data_offset = 4096 + ( (size_t) last_chunk_index * 65536 );
+
+	result = evtx_test_file_truncate_chunk(
+	          &( test_data[ chunk_data_offset ] ),
+	          65536,
+	          number_of_chunk_records / 2,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = evtx_test_file_open_source(
+	          &file,
+	          file_io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "number_of_records",
+	 number_of_records,
+	 number_of_source_records - ( number_of_chunk_records - ( number_of_chunk_records / 2 ) ) );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memcpy_result = memory_copy(
+	                 &( test_data[ chunk_data_offset ] ),
+	                 &( source_data[ chunk_data_offset ] ),
+	                 65536 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "memcpy_result",
+	 memcpy_result );
+
+	result = libevtx_file_refresh(
+	          file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "number_of_records",
+	 number_of_records,
+	 number_of_source_records );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The existing records retain their index and the new records are appended
+	 */
+	result = evtx_test_file_compare_record_identifiers(
+	          file,
+	          record_identifiers,
+	          number_of_source_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a chunk that is cleared and written again
+	 */
+	memset_result = memory_set(
+	                 &( test_data[ chunk_data_offset ] ),
+	                 0,
+	                 65536 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	result = libevtx_file_refresh(
+	          file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The records of the cleared chunk are removed and all remaining records
+	 * can be retrieved
+	 */
+	result = libevtx_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "number_of_records",
+	 number_of_records,
+	 number_of_source_records - number_of_chunk_records );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = evtx_test_file_compare_record_identifiers(
+	          file,
+	          record_identifiers,
+	          number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memcpy_result = memory_copy(
+	                 &( test_data[ chunk_data_offset ] ),
+	                 &( source_data[ chunk_data_offset ] ),
+	                 65536 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "memcpy_result",
+	 memcpy_result );
+
+	result = libevtx_file_refresh(
+	          file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = evtx_test_file_compare_record_identifiers(
+	          file,
+	          record_identifiers,
+	          number_of_source_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a chunk that is reused, the first chunk is overwritten with the records of the second chunk
+	 */
+	if( last_chunk_index > 0 )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (evtx_chunk_header_t *) &( source_data[ 4096 + 65536 ] ) )->first_event_record_identifier,
+		 identifier );
+
+		for( reused_record_index = 0;
+		     reused_record_index < number_of_source_records;
+		     reused_record_index++ )
+		{
+			if( record_identifiers[ reused_record_index ] == identifier )
+			{
+				break;
+			}
+		}
+		EVTX_TEST_ASSERT_LESS_THAN_INT(
+		 "reused_record_index",
+		 reused_record_index,
+		 number_of_source_records );
+
+		memcpy_result = memory_copy(
+		                 &( test_data[ 4096 ] ),
+		                 &( source_data[ 4096 + 65536 ] ),
+		                 65536 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "memcpy_result",
+		 memcpy_result );
+
+		result = libevtx_file_refresh(
+		          file,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_file_get_number_of_records(
+		          file,
+		          &number_of_records,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* The first chunk previously contained the records before reused_record_index
+		 */
+		number_of_reused_records = number_of_records - number_of_source_records + reused_record_index;
+
+		EVTX_TEST_ASSERT_GREATER_THAN_INT(
+		 "number_of_reused_records",
+		 number_of_reused_records,
+		 0 );
+
+		/* All records can be retrieved after the refresh
+		 */
+		for( record_index = 0;
+		     record_index < number_of_records;
+		     record_index++ )
+		{
+			result = evtx_test_file_get_record_identifier(
+			          file,
+			          record_index,
+			          &identifier,
+			          &error );
+
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		/* The records of the reused chunk replace the records at the indexes of the chunk
+		 */
+		result = evtx_test_file_get_record_identifier(
+		          file,
+		          0,
+		          &identifier,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_EQUAL_UINT64(
+		 "identifier",
+		 identifier,
+		 record_identifiers[ reused_record_index ] );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* The records of the other chunks retain their order, if the reused chunk
+		 * contains fewer records they move to close the gap
+		 */
+		if( number_of_reused_records > reused_record_index )
+		{
+			number_of_reused_records = reused_record_index;
+		}
+		for( record_index = reused_record_index;
+		     record_index < number_of_source_records;
+		     record_index++ )
+		{
+			result = evtx_test_file_get_record_identifier(
+			          file,
+			          record_index - reused_record_index + number_of_reused_records,
+			          &identifier,
+			          &error );
+
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			EVTX_TEST_ASSERT_EQUAL_UINT64(
+			 "identifier",
+			 identifier,
+			 record_identifiers[ record_index ] );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+	}
+	/* Test error cases
 	 */
-	result = libevtx_file_signal_abort(
+	result = libevtx_file_get_number_of_records(
 	          file,
+	          &number_of_records,
 	          &error );
 
 	EVTX_TEST_ASSERT_EQUAL_INT(
@@ -1205,10 +2648,27 @@ int evtx_test_file_signal_abort(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libevtx_file_signal_abort(
-	          NULL,
+	result = evtx_test_file_get_record_identifier(
+	          file,
+	          number_of_records - 1,
+	          &last_identifier,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( test_data[ 40 ] ),
+	 8192 );
+
+	result = libevtx_file_refresh(
+	          file,
 	          &error );
 
 	EVTX_TEST_ASSERT_EQUAL_INT(
@@ -1223,6 +2683,65 @@ int evtx_test_file_signal_abort(
 	libcerror_error_free(
 	 &error );
 
+	/* A refresh that failed should not affect the records
+	 */
+	result = evtx_test_file_get_record_identifier(
+	          file,
+	          number_of_records - 1,
+	          &identifier,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "identifier",
+	 identifier,
+	 last_identifier );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = evtx_test_file_close_source(
+	          &file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = evtx_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 record_identifiers );
+
+	memory_free(
+	 test_data );
+
+	memory_free(
+	 source_data );
+
 	return( 1 );
 
 on_error:
@@ -1231,9 +2750,38 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( file != NULL )
+	{
+		evtx_test_file_close_source(
+		 &file,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		evtx_test_close_file_io_handle(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( record_identifiers != NULL )
+	{
+		memory_free(
+		 record_identifiers );
+	}
+	if( test_data != NULL )
+	{
+		memory_free(
+		 test_data );
+	}
+	if( source_data != NULL )
+	{
+		memory_free(
+		 source_data );
+	}
 	return( 0 );
 }
 
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
 /* Tests the libevtx_file_get_ascii_codepage function
  * Returns 1 if successful or 0 if not
  */
@@ -1972,6 +3520,108 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libevtx_file_get_statistics function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_get_statistics(
+     libevtx_file_t *file )
+{
+	libevtx_statistics_t statistics;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	statistics.size = sizeof( libevtx_statistics_t );
+
+	/* Test regular cases
+	 */
+	result = libevtx_file_get_statistics(
+	          file,
+	          &statistics,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The file header is read when the file is opened
+	 */
+	EVTX_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "statistics.number_of_bytes_read",
+	 (int64_t) statistics.number_of_bytes_read,
+	 (int64_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libevtx_file_get_statistics(
+	          NULL,
+	          &statistics,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_get_statistics(
+	          file,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	statistics.size = 0;
+
+	result = libevtx_file_get_statistics(
+	          file,
+	          &statistics,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -2117,6 +3767,20 @@ int main(
 		 evtx_test_file_open_close,
 		 source );
 
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_file_open_with_index_file",
+		 evtx_test_file_open_with_index_file,
+		 source );
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_file_refresh_changes",
+		 evtx_test_file_refresh_changes,
+		 file_io_handle );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
 		/* Initialize file for tests
 		 */
 		result = evtx_test_file_open_source(
@@ -2148,6 +3812,11 @@ int main(
 
 #endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
 
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_file_refresh",
+		 evtx_test_file_refresh,
+		 file );
+
 		/* TODO: add tests for libevtx_file_is_corrupted */
 
 		EVTX_TEST_RUN_WITH_ARGS(
@@ -2193,6 +3862,11 @@ int main(
 
 #endif /* defined( TODO ) */
 
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_file_get_statistics",
+		 evtx_test_file_get_statistics,
+		 file );
+
 		/* Clean up
 		 */
 		result = evtx_test_file_close_source(
@@ -0,0 +1,1705 @@
+/*
+ * Library index_file type test program
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <byte_stream.h>
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_functions.h"
+#include "evtx_test_libbfio.h"
+#include "evtx_test_libcerror.h"
+#include "evtx_test_libevtx.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_memory.h"
+#include "evtx_test_unused.h"
+
+#include "../libevtx/evtx_index_file.h"
+#include "../libevtx/libevtx_checksum.h"
+#include "../libevtx/libevtx_definitions.h"
+#include "../libevtx/libevtx_index_file.h"
+#include "../libevtx/libevtx_io_handle.h"
+#include "../libevtx/libevtx_record_index.h"
+
+#define EVTX_TEST_INDEX_FILE_CHUNKS_DATA_OFFSET	128
+#define EVTX_TEST_INDEX_FILE_CHUNK_SIZE		2048
+#define EVTX_TEST_INDEX_FILE_FILE_SIZE		( EVTX_TEST_INDEX_FILE_CHUNKS_DATA_OFFSET + ( 2 * EVTX_TEST_INDEX_FILE_CHUNK_SIZE ) )
+
+/* The index data of 2 chunks, 4 records and 2 recovered records
+ */
+#define EVTX_TEST_INDEX_FILE_INDEX_DATA_SIZE	( sizeof( evtx_index_file_header_t ) + ( 2 * sizeof( evtx_index_file_chunk_entry_t ) ) + ( 6 * sizeof( evtx_index_file_record_entry_t ) ) + 4 )
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+/* Tests the libevtx_index_file_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_index_file_initialize(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libevtx_index_file_t *index_file = NULL;
+	int result                       = 0;
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+	int number_of_malloc_fail_tests  = 1;
+	int number_of_memset_fail_tests  = 1;
+	int test_number                  = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libevtx_index_file_initialize(
+	          &index_file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "index_file",
+	 index_file );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_index_file_free(
+	          &index_file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "index_file",
+	 index_file );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_index_file_initialize(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	index_file = (libevtx_index_file_t *) 0x12345678UL;
+
+	result = libevtx_index_file_initialize(
+	          &index_file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	index_file = NULL;
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevtx_index_file_initialize with malloc failing
+		 */
+		evtx_test_malloc_attempts_before_fail = test_number;
+
+		result = libevtx_index_file_initialize(
+		          &index_file,
+		          &error );
+
+		if( evtx_test_malloc_attempts_before_fail != -1 )
+		{
+			evtx_test_malloc_attempts_before_fail = -1;
+
+			if( index_file != NULL )
+			{
+				libevtx_index_file_free(
+				 &index_file,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "index_file",
+			 index_file );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevtx_index_file_initialize with memset failing
+		 */
+		evtx_test_memset_attempts_before_fail = test_number;
+
+		result = libevtx_index_file_initialize(
+		          &index_file,
+		          &error );
+
+		if( evtx_test_memset_attempts_before_fail != -1 )
+		{
+			evtx_test_memset_attempts_before_fail = -1;
+
+			if( index_file != NULL )
+			{
+				libevtx_index_file_free(
+				 &index_file,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "index_file",
+			 index_file );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EVTX_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( index_file != NULL )
+	{
+		libevtx_index_file_free(
+		 &index_file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_index_file_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_index_file_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libevtx_index_file_free(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_index_file_copy_record_entries_to_data and
+ * libevtx_index_file_copy_record_entries_from_data functions
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_index_file_copy_record_entries(
+     void )
+{
+	uint8_t data[ 64 ];
+
+	libcerror_error_t *error                    = NULL;
+	libevtx_record_index_entry_t *entry         = NULL;
+	libevtx_record_index_t *copied_record_index = NULL;
+	libevtx_record_index_t *record_index        = NULL;
+	int entry_index                             = 0;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_record_index_initialize(
+	          &record_index,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "record_index",
+	 record_index );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_record_index_initialize(
+	          &copied_record_index,
+	          1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "copied_record_index",
+	 copied_record_index );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( entry_index = 0;
+	     entry_index < 8;
+	     entry_index++ )
+	{
+		result = libevtx_record_index_append_entry(
+		          record_index,
+		          (uint16_t) ( entry_index / 3 ),
+		          (size_t) ( 512 + ( entry_index * 64 ) ),
+		          (uint16_t) ( entry_index % 3 ),
+		          (uint16_t) ( entry_index % 2 ),
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test regular cases
+	 */
+	result = libevtx_index_file_copy_record_entries_to_data(
+	          record_index,
+	          data,
+	          64,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_index_file_copy_record_entries_from_data(
+	          copied_record_index,
+	          data,
+	          64,
+	          8,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "copied_record_index->number_of_entries",
+	 copied_record_index->number_of_entries,
+	 8 );
+
+	for( entry_index = 0;
+	     entry_index < 8;
+	     entry_index++ )
+	{
+		entry = &( copied_record_index->entries[ entry_index ] );
+
+		EVTX_TEST_ASSERT_EQUAL_UINT16(
+		 "entry->chunk_index",
+		 entry->chunk_index,
+		 (uint16_t) ( entry_index / 3 ) );
+
+		EVTX_TEST_ASSERT_EQUAL_UINT16(
+		 "entry->chunk_data_offset",
+		 entry->chunk_data_offset,
+		 (uint16_t) ( 512 + ( entry_index * 64 ) ) );
+
+		EVTX_TEST_ASSERT_EQUAL_UINT16(
+		 "entry->chunk_record_index",
+		 entry->chunk_record_index,
+		 (uint16_t) ( entry_index % 3 ) );
+
+		EVTX_TEST_ASSERT_EQUAL_UINT16(
+		 "entry->flags",
+		 entry->flags,
+		 (uint16_t) ( entry_index % 2 ) );
+	}
+	/* Test error cases
+	 */
+	result = libevtx_index_file_copy_record_entries_to_data(
+	          NULL,
+	          data,
+	          64,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_index_file_copy_record_entries_to_data(
+	          record_index,
+	          NULL,
+	          64,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_index_file_copy_record_entries_to_data(
+	          record_index,
+	          data,
+	          56,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_index_file_copy_record_entries_from_data(
+	          NULL,
+	          data,
+	          64,
+	          8,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_index_file_copy_record_entries_from_data(
+	          copied_record_index,
+	          data,
+	          64,
+	          -1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_index_file_copy_record_entries_from_data(
+	          copied_record_index,
+	          data,
+	          56,
+	          8,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_record_index_free(
+	          &copied_record_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_record_index_free(
+	          &record_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( copied_record_index != NULL )
+	{
+		libevtx_record_index_free(
+		 &copied_record_index,
+		 NULL );
+	}
+	if( record_index != NULL )
+	{
+		libevtx_record_index_free(
+		 &record_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_index_file_read_data function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_index_file_read_data(
+     void )
+{
+	uint8_t data[ 128 ];
+
+	libcerror_error_t *error         = NULL;
+	libevtx_index_file_t *index_file = NULL;
+	libevtx_io_handle_t *io_handle   = NULL;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_index_file_initialize(
+	          &index_file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "index_file",
+	 index_file );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->chunk_size = 65536;
+
+	memory_set(
+	 data,
+	 0,
+	 128 );
+
+	/* Test regular cases
+	 */
+	result = libevtx_index_file_read_data(
+	          index_file,
+	          io_handle,
+	          NULL,
+	          4096,
+	          data,
+	          128,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_index_file_read_data(
+	          index_file,
+	          io_handle,
+	          NULL,
+	          4096,
+	          data,
+	          8,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_index_file_read_data(
+	          NULL,
+	          io_handle,
+	          NULL,
+	          4096,
+	          data,
+	          128,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_index_file_read_data(
+	          index_file,
+	          NULL,
+	          NULL,
+	          4096,
+	          data,
+	          128,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_index_file_read_data(
+	          index_file,
+	          io_handle,
+	          NULL,
+	          4096,
+	          NULL,
+	          128,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_index_file_read_data(
+	          index_file,
+	          io_handle,
+	          NULL,
+	          4096,
+	          data,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_index_file_free(
+	          &index_file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libevtx_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	if( index_file != NULL )
+	{
+		libevtx_index_file_free(
+		 &index_file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_index_file_write and libevtx_index_file_read functions
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_index_file_write_read(
+     void )
+{
+	uint8_t file_data[ EVTX_TEST_INDEX_FILE_FILE_SIZE ];
+	uint8_t index_data[ EVTX_TEST_INDEX_FILE_INDEX_DATA_SIZE ];
+
+	libbfio_handle_t *file_io_handle                     = NULL;
+	libbfio_handle_t *index_file_io_handle               = NULL;
+	libcerror_error_t *error                             = NULL;
+	libevtx_index_file_chunk_entry_t *chunk_entry        = NULL;
+	libevtx_index_file_t *index_file                     = NULL;
+	libevtx_index_file_t *read_index_file                = NULL;
+	libevtx_io_handle_t *io_handle                       = NULL;
+	libevtx_record_index_entry_t *entry                  = NULL;
+	libevtx_record_index_entry_t *read_entry             = NULL;
+	libevtx_record_index_t *read_recovered_records_index = NULL;
+	libevtx_record_index_t *read_records_index           = NULL;
+	libevtx_record_index_t *recovered_records_index      = NULL;
+	libevtx_record_index_t *records_index                = NULL;
+	void *memset_result                                  = NULL;
+	size_t data_offset                                   = 0;
+	uint32_t checksum                                    = 0;
+	int chunk_entry_index                                = 0;
+	int entry_index                                      = 0;
+	int result                                           = 0;
+
+	/* Initialize test
+	 */
+	memset_result = memory_set(
+	                 file_data,
+	                 0,
+	                 sizeof( uint8_t ) * EVTX_TEST_INDEX_FILE_FILE_SIZE );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	memset_result = memory_set(
+	                 index_data,
+	                 0,
+	                 sizeof( uint8_t ) * EVTX_TEST_INDEX_FILE_INDEX_DATA_SIZE );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	result = libevtx_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->chunks_data_offset      = EVTX_TEST_INDEX_FILE_CHUNKS_DATA_OFFSET;
+	io_handle->chunk_size              = EVTX_TEST_INDEX_FILE_CHUNK_SIZE;
+	io_handle->chunks_data_size        = 2 * EVTX_TEST_INDEX_FILE_CHUNK_SIZE;
+	io_handle->file_header_checksum    = 0x12345678UL;
+	io_handle->first_record_identifier = 1;
+	io_handle->last_record_identifier  = 6;
+
+	result = libevtx_index_file_initialize(
+	          &index_file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "index_file",
+	 index_file );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_index_file_resize_chunk_entries(
+	          index_file,
+	          2,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The chunk entries refer to the header checksums of the chunks in the file data
+	 */
+	for( chunk_entry_index = 0;
+	     chunk_entry_index < 2;
+	     chunk_entry_index++ )
+	{
+		chunk_entry = &( index_file->chunk_entries[ chunk_entry_index ] );
+
+		chunk_entry->header_checksum         = 0xa0b0c0d0UL + (uint32_t) chunk_entry_index;
+		chunk_entry->flags                   = 0;
+		chunk_entry->first_record_identifier = 1 + ( (uint64_t) chunk_entry_index * 3 );
+		chunk_entry->last_record_identifier  = 3 + ( (uint64_t) chunk_entry_index * 3 );
+		chunk_entry->first_written_time      = 0x01d0000000000000ULL + (uint64_t) chunk_entry_index;
+		chunk_entry->last_written_time       = 0x01d0000000000010ULL + (uint64_t) chunk_entry_index;
+
+		data_offset = EVTX_TEST_INDEX_FILE_CHUNKS_DATA_OFFSET
+		            + ( chunk_entry_index * EVTX_TEST_INDEX_FILE_CHUNK_SIZE )
+		            + 124;
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( file_data[ data_offset ] ),
+		 chunk_entry->header_checksum );
+	}
+	index_file->number_of_chunk_entries = 2;
+
+	result = libevtx_record_index_initialize(
+	          &records_index,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_record_index_initialize(
+	          &recovered_records_index,
+	          1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( entry_index = 0;
+	     entry_index < 4;
+	     entry_index++ )
+	{
+		result = libevtx_record_index_append_entry(
+		          records_index,
+		          (uint16_t) ( entry_index / 2 ),
+		          (size_t) ( 512 + ( ( entry_index % 2 ) * 128 ) ),
+		          (uint16_t) ( entry_index % 2 ),
+		          0,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	for( entry_index = 0;
+	     entry_index < 2;
+	     entry_index++ )
+	{
+		result = libevtx_record_index_append_entry(
+		          recovered_records_index,
+		          (uint16_t) entry_index,
+		          (size_t) 1024,
+		          0,
+		          LIBEVTX_RECORD_INDEX_ENTRY_FLAG_IS_RECOVERED,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = evtx_test_open_file_io_handle(
+	          &file_io_handle,
+	          file_data,
+	          EVTX_TEST_INDEX_FILE_FILE_SIZE,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The index file IO handle is opened and closed by the index file functions
+	 */
+	result = libbfio_memory_range_initialize(
+	          &index_file_io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_set(
+	          index_file_io_handle,
+	          index_data,
+	          EVTX_TEST_INDEX_FILE_INDEX_DATA_SIZE,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test write
+	 */
+	result = libevtx_index_file_write(
+	          index_file,
+	          io_handle,
+	          EVTX_TEST_INDEX_FILE_FILE_SIZE,
+	          records_index,
+	          recovered_records_index,
+	          index_file_io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test read of the written index file
+	 */
+	result = libevtx_index_file_initialize(
+	          &read_index_file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_record_index_initialize(
+	          &read_records_index,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_record_index_initialize(
+	          &read_recovered_records_index,
+	          1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->chunks_data_size        = 0;
+	io_handle->first_record_identifier = 0;
+	io_handle->last_record_identifier  = 0;
+
+	result = libevtx_index_file_read(
+	          read_index_file,
+	          io_handle,
+	          file_io_handle,
+	          EVTX_TEST_INDEX_FILE_FILE_SIZE,
+	          read_records_index,
+	          read_recovered_records_index,
+	          index_file_io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "io_handle->chunks_data_size",
+	 io_handle->chunks_data_size,
+	 (uint64_t) ( 2 * EVTX_TEST_INDEX_FILE_CHUNK_SIZE ) );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "io_handle->first_record_identifier",
+	 io_handle->first_record_identifier,
+	 (uint64_t) 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "io_handle->last_record_identifier",
+	 io_handle->last_record_identifier,
+	 (uint64_t) 6 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "read_index_file->number_of_chunk_entries",
+	 read_index_file->number_of_chunk_entries,
+	 2 );
+
+	for( chunk_entry_index = 0;
+	     chunk_entry_index < 2;
+	     chunk_entry_index++ )
+	{
+		chunk_entry = &( read_index_file->chunk_entries[ chunk_entry_index ] );
+
+		EVTX_TEST_ASSERT_EQUAL_UINT32(
+		 "chunk_entry->header_checksum",
+		 chunk_entry->header_checksum,
+		 index_file->chunk_entries[ chunk_entry_index ].header_checksum );
+
+		EVTX_TEST_ASSERT_EQUAL_UINT64(
+		 "chunk_entry->first_record_identifier",
+		 chunk_entry->first_record_identifier,
+		 index_file->chunk_entries[ chunk_entry_index ].first_record_identifier );
+
+		EVTX_TEST_ASSERT_EQUAL_UINT64(
+		 "chunk_entry->last_record_identifier",
+		 chunk_entry->last_record_identifier,
+		 index_file->chunk_entries[ chunk_entry_index ].last_record_identifier );
+
+		EVTX_TEST_ASSERT_EQUAL_UINT64(
+		 "chunk_entry->first_written_time",
+		 chunk_entry->first_written_time,
+		 index_file->chunk_entries[ chunk_entry_index ].first_written_time );
+
+		EVTX_TEST_ASSERT_EQUAL_UINT64(
+		 "chunk_entry->last_written_time",
+		 chunk_entry->last_written_time,
+		 index_file->chunk_entries[ chunk_entry_index ].last_written_time );
+	}
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "read_records_index->number_of_entries",
+	 read_records_index->number_of_entries,
+	 records_index->number_of_entries );
+
+	for( entry_index = 0;
+	     entry_index < records_index->number_of_entries;
+	     entry_index++ )
+	{
+		entry      = &( records_index->entries[ entry_index ] );
+		read_entry = &( read_records_index->entries[ entry_index ] );
+
+		result = memory_compare(
+		          read_entry,
+		          entry,
+		          sizeof( libevtx_record_index_entry_t ) );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "read_recovered_records_index->number_of_entries",
+	 read_recovered_records_index->number_of_entries,
+	 recovered_records_index->number_of_entries );
+
+	for( entry_index = 0;
+	     entry_index < recovered_records_index->number_of_entries;
+	     entry_index++ )
+	{
+		entry      = &( recovered_records_index->entries[ entry_index ] );
+		read_entry = &( read_recovered_records_index->entries[ entry_index ] );
+
+		result = memory_compare(
+		          read_entry,
+		          entry,
+		          sizeof( libevtx_record_index_entry_t ) );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	result = libevtx_index_file_free(
+	          &read_index_file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_index_file_initialize(
+	          &read_index_file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test read of an index file that is stale since the file size changed
+	 */
+	result = libevtx_index_file_read_data(
+	          read_index_file,
+	          io_handle,
+	          file_io_handle,
+	          EVTX_TEST_INDEX_FILE_FILE_SIZE + 512,
+	          index_data,
+	          EVTX_TEST_INDEX_FILE_INDEX_DATA_SIZE,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test read of an index file that is stale since the file header changed
+	 */
+	io_handle->file_header_checksum += 1;
+
+	result = libevtx_index_file_read_data(
+	          read_index_file,
+	          io_handle,
+	          file_io_handle,
+	          EVTX_TEST_INDEX_FILE_FILE_SIZE,
+	          index_data,
+	          EVTX_TEST_INDEX_FILE_INDEX_DATA_SIZE,
+	          &error );
+
+	io_handle->file_header_checksum -= 1;
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test read of an index file that is stale since the header of the last chunk changed
+	 */
+	data_offset = EVTX_TEST_INDEX_FILE_CHUNKS_DATA_OFFSET
+	            + EVTX_TEST_INDEX_FILE_CHUNK_SIZE
+	            + 124;
+
+	file_data[ data_offset ] ^= 0xff;
+
+	result = libevtx_index_file_read_data(
+	          read_index_file,
+	          io_handle,
+	          file_io_handle,
+	          EVTX_TEST_INDEX_FILE_FILE_SIZE,
+	          index_data,
+	          EVTX_TEST_INDEX_FILE_INDEX_DATA_SIZE,
+	          &error );
+
+	file_data[ data_offset ] ^= 0xff;
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "read_index_file->number_of_chunk_entries",
+	 read_index_file->number_of_chunk_entries,
+	 0 );
+
+	/* Test read of an index file with a corrupted record entry
+	 */
+	data_offset = sizeof( evtx_index_file_header_t )
+	            + ( 2 * sizeof( evtx_index_file_chunk_entry_t ) );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 ( (evtx_index_file_record_entry_t *) &( index_data[ data_offset ] ) )->chunk_index,
+	 2 );
+
+	result = libevtx_index_file_read_data(
+	          read_index_file,
+	          io_handle,
+	          file_io_handle,
+	          EVTX_TEST_INDEX_FILE_FILE_SIZE,
+	          index_data,
+	          EVTX_TEST_INDEX_FILE_INDEX_DATA_SIZE,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test read of an index file with a corrupted record entry and a matching checksum
+	 */
+	result = libevtx_checksum_calculate_little_endian_crc32(
+	          &checksum,
+	          &( index_data[ sizeof( evtx_index_file_header_t ) ] ),
+	          EVTX_TEST_INDEX_FILE_INDEX_DATA_SIZE - sizeof( evtx_index_file_header_t ) - 4,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( index_data[ EVTX_TEST_INDEX_FILE_INDEX_DATA_SIZE - 4 ] ),
+	 checksum );
+
+	result = libevtx_index_file_read_data(
+	          read_index_file,
+	          io_handle,
+	          file_io_handle,
+	          EVTX_TEST_INDEX_FILE_FILE_SIZE,
+	          index_data,
+	          EVTX_TEST_INDEX_FILE_INDEX_DATA_SIZE,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "read_index_file->number_of_chunk_entries",
+	 read_index_file->number_of_chunk_entries,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libevtx_index_file_write(
+	          NULL,
+	          io_handle,
+	          EVTX_TEST_INDEX_FILE_FILE_SIZE,
+	          records_index,
+	          recovered_records_index,
+	          index_file_io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_index_file_read(
+	          NULL,
+	          io_handle,
+	          file_io_handle,
+	          EVTX_TEST_INDEX_FILE_FILE_SIZE,
+	          read_records_index,
+	          read_recovered_records_index,
+	          index_file_io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_handle_free(
+	          &index_file_io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = evtx_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_record_index_free(
+	          &read_recovered_records_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_record_index_free(
+	          &read_records_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_record_index_free(
+	          &recovered_records_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_record_index_free(
+	          &records_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_index_file_free(
+	          &read_index_file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_index_file_free(
+	          &index_file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( index_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &index_file_io_handle,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( read_recovered_records_index != NULL )
+	{
+		libevtx_record_index_free(
+		 &read_recovered_records_index,
+		 NULL );
+	}
+	if( read_records_index != NULL )
+	{
+		libevtx_record_index_free(
+		 &read_records_index,
+		 NULL );
+	}
+	if( recovered_records_index != NULL )
+	{
+		libevtx_record_index_free(
+		 &recovered_records_index,
+		 NULL );
+	}
+	if( records_index != NULL )
+	{
+		libevtx_record_index_free(
+		 &records_index,
+		 NULL );
+	}
+	if( read_index_file != NULL )
+	{
+		libevtx_index_file_free(
+		 &read_index_file,
+		 NULL );
+	}
+	if( index_file != NULL )
+	{
+		libevtx_index_file_free(
+		 &index_file,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libevtx_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+	EVTX_TEST_RUN(
+	 "libevtx_index_file_initialize",
+	 evtx_test_index_file_initialize );
+
+	EVTX_TEST_RUN(
+	 "libevtx_index_file_free",
+	 evtx_test_index_file_free );
+
+	/* TODO: add tests for libevtx_index_file_append_chunk_entry */
+
+	EVTX_TEST_RUN(
+	 "libevtx_index_file_copy_record_entries",
+	 evtx_test_index_file_copy_record_entries );
+
+	EVTX_TEST_RUN(
+	 "libevtx_index_file_read_data",
+	 evtx_test_index_file_read_data );
+
+	EVTX_TEST_RUN(
+	 "libevtx_index_file_write_read",
+	 evtx_test_index_file_write_read );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -20,13 +20,17 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
 #endif
 
+#include "evtx_test_getopt.h"
 #include "evtx_test_libcerror.h"
 #include "evtx_test_libevtx.h"
 #include "evtx_test_macros.h"
@@ -35,6 +39,10 @@
 
 #include "../libevtx/libevtx_record.h"
 
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER ) && SIZEOF_WCHAR_T != 2 && SIZEOF_WCHAR_T != 4
+#error Unsupported size of wchar_t
+#endif
+
 /* Tests the libevtx_record_free function
  * Returns 1 if successful or 0 if not
  */
@@ -73,20 +81,1623 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libevtx_record_get_utf8_strings_size and libevtx_record_get_utf8_strings functions
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_get_utf8_strings(
+     libevtx_file_t *file )
+{
+	libcerror_error_t *error    = NULL;
+	libevtx_record_t *record    = NULL;
+	size_t *utf8_string_offsets = NULL;
+	uint8_t *utf8_string        = NULL;
+	uint8_t *utf8_strings       = NULL;
+	size_t utf8_string_offset   = 0;
+	size_t utf8_string_size     = 0;
+	size_t utf8_strings_size    = 0;
+	int error_cases_tested      = 0;
+	int number_of_records       = 0;
+	int number_of_strings       = 0;
+	int record_index            = 0;
+	int result                  = 0;
+	int string_index            = 0;
+
+	result = libevtx_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		result = libevtx_file_get_record_by_index(
+		          file,
+		          record_index,
+		          &record,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_record_get_number_of_strings(
+		          record,
+		          &number_of_strings,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_record_get_utf8_strings_size(
+		          record,
+		          &utf8_strings_size,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( number_of_strings == 0 )
+		{
+			EVTX_TEST_ASSERT_EQUAL_SIZE(
+			 "utf8_strings_size",
+			 utf8_strings_size,
+			 (size_t) 0 );
+		}
+		else
+		{
+			utf8_strings = (uint8_t *) memory_allocate(
+			                            sizeof( uint8_t ) * utf8_strings_size );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "utf8_strings",
+			 utf8_strings );
+
+			utf8_string_offsets = (size_t *) memory_allocate(
+			                                  sizeof( size_t ) * number_of_strings );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "utf8_string_offsets",
+			 utf8_string_offsets );
+
+			/* Test regular cases
+			 */
+			result = libevtx_record_get_utf8_strings(
+			          record,
+			          utf8_strings,
+			          utf8_strings_size,
+			          utf8_string_offsets,
+			          number_of_strings,
+			          &error );
+
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			/* The strings are stored consecutively in the same order as
+			 * libevtx_record_get_utf8_string and a string without a value
+			 * is stored as an empty string
+			 */
+			utf8_string_offset = 0;
+
+			for( string_index = 0;
+			     string_index < number_of_strings;
+			     string_index++ )
+			{
+				EVTX_TEST_ASSERT_EQUAL_SIZE(
+				 "utf8_string_offsets[ string_index ]",
+				 utf8_string_offsets[ string_index ],
+				 utf8_string_offset );
+
+				result = libevtx_record_get_utf8_string_size(
+				          record,
+				          string_index,
+				          &utf8_string_size,
+				          &error );
+
+				EVTX_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				EVTX_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+
+				if( utf8_string_size == 0 )
+				{
+					EVTX_TEST_ASSERT_EQUAL_UINT8(
+					 "utf8_strings[ utf8_string_offset ]",
+					 utf8_strings[ utf8_string_offset ],
+					 0 );
+
+					utf8_string_size = 1;
+				}
+				else
+				{
+					utf8_string = (uint8_t *) memory_allocate(
+					                           sizeof( uint8_t ) * utf8_string_size );
+
+					EVTX_TEST_ASSERT_IS_NOT_NULL(
+					 "utf8_string",
+					 utf8_string );
+
+					result = libevtx_record_get_utf8_string(
+					          record,
+					          string_index,
+					          utf8_string,
+					          utf8_string_size,
+					          &error );
+
+					EVTX_TEST_ASSERT_EQUAL_INT(
+					 "result",
+					 result,
+					 1 );
+
+					EVTX_TEST_ASSERT_IS_NULL(
+					 "error",
+					 error );
+
+					result = memory_compare(
+					          &( utf8_strings[ utf8_string_offset ] ),
+					          utf8_string,
+					          sizeof( uint8_t ) * utf8_string_size );
+
+					EVTX_TEST_ASSERT_EQUAL_INT(
+					 "result",
+					 result,
+					 0 );
+
+					memory_free(
+					 utf8_string );
+
+					utf8_string = NULL;
+				}
+				utf8_string_offset += utf8_string_size;
+			}
+			EVTX_TEST_ASSERT_EQUAL_SIZE(
+			 "utf8_string_offset",
+			 utf8_string_offset,
+			 utf8_strings_size );
+
+			/* Test error cases
+			 */
+			if( error_cases_tested == 0 )
+			{
+				result = libevtx_record_get_utf8_strings(
+				          record,
+				          utf8_strings,
+				          utf8_strings_size - 1,
+				          utf8_string_offsets,
+				          number_of_strings,
+				          &error );
+
+				EVTX_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 -1 );
+
+				EVTX_TEST_ASSERT_IS_NOT_NULL(
+				 "error",
+				 error );
+
+				libcerror_error_free(
+				 &error );
+
+				result = libevtx_record_get_utf8_strings(
+				          record,
+				          utf8_strings,
+				          utf8_strings_size,
+				          utf8_string_offsets,
+				          number_of_strings - 1,
+				          &error );
+
+				EVTX_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 -1 );
+
+				EVTX_TEST_ASSERT_IS_NOT_NULL(
+				 "error",
+				 error );
+
+				libcerror_error_free(
+				 &error );
+
+				error_cases_tested = 1;
+			}
+			memory_free(
+			 utf8_string_offsets );
+
+			utf8_string_offsets = NULL;
+
+			memory_free(
+			 utf8_strings );
+
+			utf8_strings = NULL;
+		}
+		result = libevtx_record_free(
+		          &record,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( utf8_string != NULL )
+	{
+		memory_free(
+		 utf8_string );
+	}
+	if( utf8_string_offsets != NULL )
+	{
+		memory_free(
+		 utf8_string_offsets );
+	}
+	if( utf8_strings != NULL )
+	{
+		memory_free(
+		 utf8_strings );
+	}
+	if( record != NULL )
+	{
+		libevtx_record_free(
+		 &record,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_get_utf16_strings_size and libevtx_record_get_utf16_strings functions
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_get_utf16_strings(
+     libevtx_file_t *file )
+{
+	libcerror_error_t *error     = NULL;
+	libevtx_record_t *record     = NULL;
+	size_t *utf16_string_offsets = NULL;
+	uint16_t *utf16_string       = NULL;
+	uint16_t *utf16_strings      = NULL;
+	size_t utf16_string_offset   = 0;
+	size_t utf16_string_size     = 0;
+	size_t utf16_strings_size    = 0;
+	int error_cases_tested       = 0;
+	int number_of_records        = 0;
+	int number_of_strings        = 0;
+	int record_index             = 0;
+	int result                   = 0;
+	int string_index             = 0;
+
+	result = libevtx_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		result = libevtx_file_get_record_by_index(
+		          file,
+		          record_index,
+		          &record,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_record_get_number_of_strings(
+		          record,
+		          &number_of_strings,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_record_get_utf16_strings_size(
+		          record,
+		          &utf16_strings_size,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( number_of_strings == 0 )
+		{
+			EVTX_TEST_ASSERT_EQUAL_SIZE(
+			 "utf16_strings_size",
+			 utf16_strings_size,
+			 (size_t) 0 );
+		}
+		else
+		{
+			utf16_strings = (uint16_t *) memory_allocate(
+			                            sizeof( uint16_t ) * utf16_strings_size );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "utf16_strings",
+			 utf16_strings );
+
+			utf16_string_offsets = (size_t *) memory_allocate(
+			                                  sizeof( size_t ) * number_of_strings );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "utf16_string_offsets",
+			 utf16_string_offsets );
+
+			/* Test regular cases
+			 */
+			result = libevtx_record_get_utf16_strings(
+			          record,
+			          utf16_strings,
+			          utf16_strings_size,
+			          utf16_string_offsets,
+			          number_of_strings,
+			          &error );
+
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			/* The strings are stored consecutively in the same order as
+			 * libevtx_record_get_utf16_string and a string without a value
+			 * is stored as an empty string
+			 */
+			utf16_string_offset = 0;
+
+			for( string_index = 0;
+			     string_index < number_of_strings;
+			     string_index++ )
+			{
+				EVTX_TEST_ASSERT_EQUAL_SIZE(
+				 "utf16_string_offsets[ string_index ]",
+				 utf16_string_offsets[ string_index ],
+				 utf16_string_offset );
+
+				result = libevtx_record_get_utf16_string_size(
+				          record,
+				          string_index,
+				          &utf16_string_size,
+				          &error );
+
+				EVTX_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				EVTX_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+
+				if( utf16_string_size == 0 )
+				{
+					EVTX_TEST_ASSERT_EQUAL_UINT16(
+					 "utf16_strings[ utf16_string_offset ]",
+					 utf16_strings[ utf16_string_offset ],
+					 0 );
+
+					utf16_string_size = 1;
+				}
+				else
+				{
+					utf16_string = (uint16_t *) memory_allocate(
+					                           sizeof( uint16_t ) * utf16_string_size );
+
+					EVTX_TEST_ASSERT_IS_NOT_NULL(
+					 "utf16_string",
+					 utf16_string );
+
+					result = libevtx_record_get_utf16_string(
+					          record,
+					          string_index,
+					          utf16_string,
+					          utf16_string_size,
+					          &error );
+
+					EVTX_TEST_ASSERT_EQUAL_INT(
+					 "result",
+					 result,
+					 1 );
+
+					EVTX_TEST_ASSERT_IS_NULL(
+					 "error",
+					 error );
+
+					result = memory_compare(
+					          &( utf16_strings[ utf16_string_offset ] ),
+					          utf16_string,
+					          sizeof( uint16_t ) * utf16_string_size );
+
+					EVTX_TEST_ASSERT_EQUAL_INT(
+					 "result",
+					 result,
+					 0 );
+
+					memory_free(
+					 utf16_string );
+
+					utf16_string = NULL;
+				}
+				utf16_string_offset += utf16_string_size;
+			}
+			EVTX_TEST_ASSERT_EQUAL_SIZE(
+			 "utf16_string_offset",
+			 utf16_string_offset,
+			 utf16_strings_size );
+
+			/* Test error cases
+			 */
+			if( error_cases_tested == 0 )
+			{
+				result = libevtx_record_get_utf16_strings(
+				          record,
+				          utf16_strings,
+				          utf16_strings_size - 1,
+				          utf16_string_offsets,
+				          number_of_strings,
+				          &error );
+
+				EVTX_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 -1 );
+
+				EVTX_TEST_ASSERT_IS_NOT_NULL(
+				 "error",
+				 error );
+
+				libcerror_error_free(
+				 &error );
+
+				result = libevtx_record_get_utf16_strings(
+				          record,
+				          utf16_strings,
+				          utf16_strings_size,
+				          utf16_string_offsets,
+				          number_of_strings - 1,
+				          &error );
+
+				EVTX_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 -1 );
+
+				EVTX_TEST_ASSERT_IS_NOT_NULL(
+				 "error",
+				 error );
+
+				libcerror_error_free(
+				 &error );
+
+				error_cases_tested = 1;
+			}
+			memory_free(
+			 utf16_string_offsets );
+
+			utf16_string_offsets = NULL;
+
+			memory_free(
+			 utf16_strings );
+
+			utf16_strings = NULL;
+		}
+		result = libevtx_record_free(
+		          &record,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( utf16_string != NULL )
+	{
+		memory_free(
+		 utf16_string );
+	}
+	if( utf16_string_offsets != NULL )
+	{
+		memory_free(
+		 utf16_string_offsets );
+	}
+	if( utf16_strings != NULL )
+	{
+		memory_free(
+		 utf16_strings );
+	}
+	if( record != NULL )
+	{
+		libevtx_record_free(
+		 &record,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_get_utf8_xml_string_buffer function
+ * The same buffer is reused for the records with the smallest and largest XML string
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_get_utf8_xml_string_buffer(
+     libevtx_file_t *file )
+{
+	libcerror_error_t *error         = NULL;
+	libevtx_record_t *record         = NULL;
+	uint8_t *previous_utf8_string    = NULL;
+	uint8_t *utf8_string             = NULL;
+	uint8_t *utf8_xml_string         = NULL;
+	size_t maximum_string_size       = 0;
+	size_t minimum_string_size       = 0;
+	size_t previous_utf8_string_size = 0;
+	size_t utf8_string_length        = 0;
+	size_t utf8_string_size          = 0;
+	size_t utf8_xml_string_size      = 0;
+	int number_of_records            = 0;
+	int record_index                 = 0;
+	int record_indexes[ 3 ]          = { 0, 0, 0 };
+	int result                       = 0;
+	int test_index                   = 0;
+
+	result = libevtx_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( number_of_records == 0 )
+	{
+		return( 1 );
+	}
+	/* Determine the records with the smallest and largest XML string
+	 */
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		result = libevtx_file_get_record_by_index(
+		          file,
+		          record_index,
+		          &record,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_record_get_utf8_xml_string_size(
+		          record,
+		          &utf8_xml_string_size,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( ( record_index == 0 )
+		 || ( utf8_xml_string_size < minimum_string_size ) )
+		{
+			record_indexes[ 0 ] = record_index;
+			record_indexes[ 2 ] = record_index;
+			minimum_string_size = utf8_xml_string_size;
+		}
+		if( ( record_index == 0 )
+		 || ( utf8_xml_string_size > maximum_string_size ) )
+		{
+			record_indexes[ 1 ] = record_index;
+			maximum_string_size = utf8_xml_string_size;
+		}
+		result = libevtx_record_free(
+		          &record,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test regular cases
+	 */
+	for( test_index = 0;
+	     test_index < 3;
+	     test_index++ )
+	{
+		result = libevtx_file_get_record_by_index(
+		          file,
+		          record_indexes[ test_index ],
+		          &record,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_record_get_utf8_xml_string_size(
+		          record,
+		          &utf8_xml_string_size,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		utf8_xml_string = (uint8_t *) memory_allocate(
+		                               sizeof( uint8_t ) * utf8_xml_string_size );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "utf8_xml_string",
+		 utf8_xml_string );
+
+		result = libevtx_record_get_utf8_xml_string(
+		          record,
+		          utf8_xml_string,
+		          utf8_xml_string_size,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		previous_utf8_string      = utf8_string;
+		previous_utf8_string_size = utf8_string_size;
+
+		result = libevtx_record_get_utf8_xml_string_buffer(
+		          record,
+		          &utf8_string,
+		          &utf8_string_size,
+		          &utf8_string_length,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		EVTX_TEST_ASSERT_EQUAL_SIZE(
+		 "utf8_string_length",
+		 utf8_string_length,
+		 utf8_xml_string_size - 1 );
+
+		result = ( utf8_string_size >= utf8_xml_string_size ) ? 1 : 0;
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = memory_compare(
+		          utf8_string,
+		          utf8_xml_string,
+		          utf8_xml_string_size );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		/* The buffer was grown for the largest XML string and is reused as-is
+		 * for the smaller XML string
+		 */
+		if( test_index == 2 )
+		{
+			result = ( utf8_string == previous_utf8_string ) ? 1 : 0;
+
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			EVTX_TEST_ASSERT_EQUAL_SIZE(
+			 "utf8_string_size",
+			 utf8_string_size,
+			 previous_utf8_string_size );
+		}
+		memory_free(
+		 utf8_xml_string );
+
+		utf8_xml_string = NULL;
+
+		result = libevtx_record_free(
+		          &record,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Clean up
+	 */
+	memory_free(
+	 utf8_string );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( utf8_xml_string != NULL )
+	{
+		memory_free(
+		 utf8_xml_string );
+	}
+	if( record != NULL )
+	{
+		libevtx_record_free(
+		 &record,
+		 NULL );
+	}
+	if( utf8_string != NULL )
+	{
+		memory_free(
+		 utf8_string );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_get_utf16_xml_string_buffer function
+ * The same buffer is reused for the records with the smallest and largest XML string
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_get_utf16_xml_string_buffer(
+     libevtx_file_t *file )
+{
+	libcerror_error_t *error          = NULL;
+	libevtx_record_t *record          = NULL;
+	uint16_t *previous_utf16_string   = NULL;
+	uint16_t *utf16_string            = NULL;
+	uint16_t *utf16_xml_string        = NULL;
+	size_t maximum_string_size        = 0;
+	size_t minimum_string_size        = 0;
+	size_t previous_utf16_string_size = 0;
+	size_t utf16_string_length        = 0;
+	size_t utf16_string_size          = 0;
+	size_t utf16_xml_string_size      = 0;
+	int number_of_records             = 0;
+	int record_index                  = 0;
+	int record_indexes[ 3 ]           = { 0, 0, 0 };
+	int result                        = 0;
+	int test_index                    = 0;
+
+	result = libevtx_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( number_of_records == 0 )
+	{
+		return( 1 );
+	}
+	/* Determine the records with the smallest and largest XML string
+	 */
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		result = libevtx_file_get_record_by_index(
+		          file,
+		          record_index,
+		          &record,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_record_get_utf16_xml_string_size(
+		          record,
+		          &utf16_xml_string_size,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( ( record_index == 0 )
+		 || ( utf16_xml_string_size < minimum_string_size ) )
+		{
+			record_indexes[ 0 ] = record_index;
+			record_indexes[ 2 ] = record_index;
+			minimum_string_size = utf16_xml_string_size;
+		}
+		if( ( record_index == 0 )
+		 || ( utf16_xml_string_size > maximum_string_size ) )
+		{
+			record_indexes[ 1 ] = record_index;
+			maximum_string_size = utf16_xml_string_size;
+		}
+		result = libevtx_record_free(
+		          &record,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test regular cases
+	 */
+	for( test_index = 0;
+	     test_index < 3;
+	     test_index++ )
+	{
+		result = libevtx_file_get_record_by_index(
+		          file,
+		          record_indexes[ test_index ],
+		          &record,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_record_get_utf16_xml_string_size(
+		          record,
+		          &utf16_xml_string_size,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		utf16_xml_string = (uint16_t *) memory_allocate(
+		                               sizeof( uint16_t ) * utf16_xml_string_size );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "utf16_xml_string",
+		 utf16_xml_string );
+
+		result = libevtx_record_get_utf16_xml_string(
+		          record,
+		          utf16_xml_string,
+		          utf16_xml_string_size,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		previous_utf16_string      = utf16_string;
+		previous_utf16_string_size = utf16_string_size;
+
+		result = libevtx_record_get_utf16_xml_string_buffer(
+		          record,
+		          &utf16_string,
+		          &utf16_string_size,
+		          &utf16_string_length,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		EVTX_TEST_ASSERT_EQUAL_SIZE(
+		 "utf16_string_length",
+		 utf16_string_length,
+		 utf16_xml_string_size - 1 );
+
+		result = ( utf16_string_size >= utf16_xml_string_size ) ? 1 : 0;
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = memory_compare(
+		          utf16_string,
+		          utf16_xml_string,
+		          sizeof( uint16_t ) * utf16_xml_string_size );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		/* The buffer was grown for the largest XML string and is reused as-is
+		 * for the smaller XML string
+		 */
+		if( test_index == 2 )
+		{
+			result = ( utf16_string == previous_utf16_string ) ? 1 : 0;
+
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			EVTX_TEST_ASSERT_EQUAL_SIZE(
+			 "utf16_string_size",
+			 utf16_string_size,
+			 previous_utf16_string_size );
+		}
+		memory_free(
+		 utf16_xml_string );
+
+		utf16_xml_string = NULL;
+
+		result = libevtx_record_free(
+		          &record,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Clean up
+	 */
+	memory_free(
+	 utf16_string );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( utf16_xml_string != NULL )
+	{
+		memory_free(
+		 utf16_xml_string );
+	}
+	if( record != NULL )
+	{
+		libevtx_record_free(
+		 &record,
+		 NULL );
+	}
+	if( utf16_string != NULL )
+	{
+		memory_free(
+		 utf16_string );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_get_binary_data_pointer function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_get_binary_data_pointer(
+     libevtx_file_t *file )
+{
+	libcerror_error_t *error    = NULL;
+	libevtx_record_t *record    = NULL;
+	const uint8_t *data_pointer = NULL;
+	uint8_t *data               = NULL;
+	size_t data_pointer_size    = 0;
+	size_t data_size            = 0;
+	int data_result             = 0;
+	int error_cases_tested      = 0;
+	int number_of_records       = 0;
+	int record_index            = 0;
+	int result                  = 0;
+
+	result = libevtx_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		result = libevtx_file_get_record_by_index(
+		          file,
+		          record_index,
+		          &record,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		data_result = libevtx_record_get_data_size(
+		               record,
+		               &data_size,
+		               &error );
+
+		EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+		 "data_result",
+		 data_result,
+		 -1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test regular cases
+		 */
+		result = libevtx_record_get_binary_data_pointer(
+		          record,
+		          &data_pointer,
+		          &data_pointer_size,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 data_result );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( ( result != 0 )
+		 && ( data_size > 0 ) )
+		{
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "data_pointer",
+			 data_pointer );
+
+			EVTX_TEST_ASSERT_EQUAL_SIZE(
+			 "data_pointer_size",
+			 data_pointer_size,
+			 data_size );
+
+			data = (uint8_t *) memory_allocate(
+			                    sizeof( uint8_t ) * data_size );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "data",
+			 data );
+
+			result = libevtx_record_get_data(
+			          record,
+			          data,
+			          data_size,
+			          &error );
+
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = memory_compare(
+			          data_pointer,
+			          data,
+			          sizeof( uint8_t ) * data_size );
+
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+
+			memory_free(
+			 data );
+
+			data = NULL;
+		}
+		/* Test error cases
+		 */
+		if( error_cases_tested == 0 )
+		{
+			result = libevtx_record_get_binary_data_pointer(
+			          NULL,
+			          &data_pointer,
+			          &data_pointer_size,
+			          &error );
+
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+
+			error_cases_tested = 1;
+		}
+		result = libevtx_record_free(
+		          &record,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	if( record != NULL )
+	{
+		libevtx_record_free(
+		 &record,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_get_raw_data_pointer function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_get_raw_data_pointer(
+     libevtx_file_t *file )
+{
+	libcerror_error_t *error       = NULL;
+	libevtx_record_t *record       = NULL;
+	const uint8_t *raw_data        = NULL;
+	const uint8_t *cached_raw_data = NULL;
+	size_t cached_raw_data_size    = 0;
+	size_t raw_data_size           = 0;
+	uint32_t copy_of_size          = 0;
+	uint32_t size                  = 0;
+	int error_cases_tested         = 0;
+	int number_of_records          = 0;
+	int record_index               = 0;
+	int result                     = 0;
+
+	result = libevtx_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		result = libevtx_file_get_record_by_index(
+		          file,
+		          record_index,
+		          &record,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test regular cases
+		 */
+		result = libevtx_record_get_raw_data_pointer(
+		          record,
+		          &raw_data,
+		          &raw_data_size,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "raw_data",
+		 raw_data );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* The raw data contains at least the 24 bytes of the event record header
+		 * and the 4 bytes of the copy of the size
+		 */
+		result = ( raw_data_size >= 28 ) ? 1 : 0;
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = memory_compare(
+		          raw_data,
+		          "\x2a\x2a\x00\x00",
+		          4 );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( raw_data[ 4 ] ),
+		 size );
+
+		EVTX_TEST_ASSERT_EQUAL_SIZE(
+		 "size",
+		 (size_t) size,
+		 raw_data_size );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( raw_data[ raw_data_size - 4 ] ),
+		 copy_of_size );
+
+		EVTX_TEST_ASSERT_EQUAL_UINT32(
+		 "copy_of_size",
+		 copy_of_size,
+		 size );
+
+		/* The raw data is read once and owned by the record
+		 */
+		result = libevtx_record_get_raw_data_pointer(
+		          record,
+		          &cached_raw_data,
+		          &cached_raw_data_size,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = ( cached_raw_data == raw_data ) ? 1 : 0;
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_EQUAL_SIZE(
+		 "cached_raw_data_size",
+		 cached_raw_data_size,
+		 raw_data_size );
+
+		/* Test error cases
+		 */
+		if( error_cases_tested == 0 )
+		{
+			result = libevtx_record_get_raw_data_pointer(
+			          NULL,
+			          &raw_data,
+			          &raw_data_size,
+			          &error );
+
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+
+			result = libevtx_record_get_raw_data_pointer(
+			          record,
+			          NULL,
+			          &raw_data_size,
+			          &error );
+
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+
+			result = libevtx_record_get_raw_data_pointer(
+			          record,
+			          &raw_data,
+			          NULL,
+			          &error );
+
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+
+			error_cases_tested = 1;
+		}
+		result = libevtx_record_free(
+		          &record,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libevtx_record_free(
+		 &record,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 int wmain(
-     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
-     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+     int argc,
+     wchar_t * const argv[] )
 #else
 int main(
-     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
-     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+     int argc,
+     char * const argv[] )
 #endif
 {
-	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
-	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+	libcerror_error_t *error   = NULL;
+	libevtx_file_t *file       = NULL;
+	system_character_t *source = NULL;
+	system_integer_t option    = 0;
+	int result                 = 0;
+
+	while( ( option = evtx_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				return( EXIT_FAILURE );
+		}
+	}
+	if( optind < argc )
+	{
+		source = argv[ optind ];
+	}
 
 #if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
 
@@ -170,9 +1781,148 @@ int main(
 
 #endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
 
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+	if( source != NULL )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libevtx_check_file_signature_wide(
+		          source,
+		          &error );
+#else
+		result = libevtx_check_file_signature(
+		          source,
+		          &error );
+#endif
+		EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	if( result != 0 )
+	{
+		/* Initialize file for tests
+		 */
+		result = libevtx_file_initialize(
+		          &file,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "file",
+		 file );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libevtx_file_open_wide(
+		          file,
+		          source,
+		          LIBEVTX_OPEN_READ,
+		          &error );
+#else
+		result = libevtx_file_open(
+		          file,
+		          source,
+		          LIBEVTX_OPEN_READ,
+		          &error );
+#endif
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_record_get_utf8_strings",
+		 evtx_test_record_get_utf8_strings,
+		 file );
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_record_get_utf16_strings",
+		 evtx_test_record_get_utf16_strings,
+		 file );
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_record_get_utf8_xml_string_buffer",
+		 evtx_test_record_get_utf8_xml_string_buffer,
+		 file );
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_record_get_utf16_xml_string_buffer",
+		 evtx_test_record_get_utf16_xml_string_buffer,
+		 file );
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_record_get_binary_data_pointer",
+		 evtx_test_record_get_binary_data_pointer,
+		 file );
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_record_get_raw_data_pointer",
+		 evtx_test_record_get_raw_data_pointer,
+		 file );
+
+		/* Clean up
+		 */
+		result = libevtx_file_close(
+		          file,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_file_free(
+		          &file,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "file",
+		 file );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
 	return( EXIT_SUCCESS );
 
 on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libevtx_file_free(
+		 &file,
+		 NULL );
+	}
 	return( EXIT_FAILURE );
 }
 
@@ -0,0 +1,1454 @@
+/*
+ * Library record_index type test program
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_libcerror.h"
+#include "evtx_test_libevtx.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_memory.h"
+#include "evtx_test_unused.h"
+
+#include "../libevtx/libevtx_definitions.h"
+#include "../libevtx/libevtx_record_index.h"
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+/* Tests the libevtx_record_index_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_index_initialize(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libevtx_record_index_t *record_index = NULL;
+	int result                           = 0;
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+	int number_of_malloc_fail_tests      = 1;
+	int number_of_memset_fail_tests      = 1;
+	int test_number                      = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libevtx_record_index_initialize(
+	          &record_index,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "record_index",
+	 record_index );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_record_index_free(
+	          &record_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "record_index",
+	 record_index );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_record_index_initialize(
+	          NULL,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	record_index = (libevtx_record_index_t *) 0x12345678UL;
+
+	result = libevtx_record_index_initialize(
+	          &record_index,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	record_index = NULL;
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevtx_record_index_initialize with malloc failing
+		 */
+		evtx_test_malloc_attempts_before_fail = test_number;
+
+		result = libevtx_record_index_initialize(
+		          &record_index,
+		          0,
+		          &error );
+
+		if( evtx_test_malloc_attempts_before_fail != -1 )
+		{
+			evtx_test_malloc_attempts_before_fail = -1;
+
+			if( record_index != NULL )
+			{
+				libevtx_record_index_free(
+				 &record_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "record_index",
+			 record_index );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevtx_record_index_initialize with memset failing
+		 */
+		evtx_test_memset_attempts_before_fail = test_number;
+
+		result = libevtx_record_index_initialize(
+		          &record_index,
+		          0,
+		          &error );
+
+		if( evtx_test_memset_attempts_before_fail != -1 )
+		{
+			evtx_test_memset_attempts_before_fail = -1;
+
+			if( record_index != NULL )
+			{
+				libevtx_record_index_free(
+				 &record_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "record_index",
+			 record_index );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EVTX_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_index != NULL )
+	{
+		libevtx_record_index_free(
+		 &record_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_index_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_index_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libevtx_record_index_free(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_index_append_entry function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_index_append_entry(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libevtx_record_index_t *record_index = NULL;
+	int entry_index                      = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_record_index_initialize(
+	          &record_index,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "record_index",
+	 record_index );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( entry_index = 0;
+	     entry_index < ( 2 * LIBEVTX_RECORD_INDEX_INITIAL_NUMBER_OF_ENTRIES ) + 1;
+	     entry_index++ )
+	{
+		result = libevtx_record_index_append_entry(
+		          record_index,
+		          (uint16_t) ( entry_index / 100 ),
+		          (size_t) ( 512 + ( ( entry_index % 100 ) * 64 ) ),
+		          (uint16_t) ( entry_index % 100 ),
+		          0,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "record_index->number_of_entries",
+	 record_index->number_of_entries,
+	 ( 2 * LIBEVTX_RECORD_INDEX_INITIAL_NUMBER_OF_ENTRIES ) + 1 );
+
+	result = libevtx_record_index_append_entry(
+	          record_index,
+	          0,
+	          0xffff,
+	          0,
+	          LIBEVTX_RECORD_INDEX_ENTRY_FLAG_IS_RECOVERED,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_record_index_append_entry(
+	          NULL,
+	          0,
+	          512,
+	          0,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_index_append_entry(
+	          record_index,
+	          0,
+	          0x10000,
+	          0,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_record_index_free(
+	          &record_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "record_index",
+	 record_index );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_index != NULL )
+	{
+		libevtx_record_index_free(
+		 &record_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_index_get_number_of_entries function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_index_get_number_of_entries(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libevtx_record_index_t *record_index = NULL;
+	int number_of_entries                = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_record_index_initialize(
+	          &record_index,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "record_index",
+	 record_index );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevtx_record_index_get_number_of_entries(
+	          record_index,
+	          &number_of_entries,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_record_index_append_entry(
+	          record_index,
+	          0,
+	          512,
+	          0,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_record_index_get_number_of_entries(
+	          record_index,
+	          &number_of_entries,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_record_index_get_number_of_entries(
+	          NULL,
+	          &number_of_entries,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_index_get_number_of_entries(
+	          record_index,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_record_index_free(
+	          &record_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "record_index",
+	 record_index );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_index != NULL )
+	{
+		libevtx_record_index_free(
+		 &record_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_index_get_entry_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_index_get_entry_by_index(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libevtx_record_index_entry_t *entry  = NULL;
+	libevtx_record_index_t *record_index = NULL;
+	int entry_index                      = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_record_index_initialize(
+	          &record_index,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "record_index",
+	 record_index );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( entry_index = 0;
+	     entry_index < 1500;
+	     entry_index++ )
+	{
+		result = libevtx_record_index_append_entry(
+		          record_index,
+		          (uint16_t) ( entry_index / 100 ),
+		          (size_t) ( 512 + ( ( entry_index % 100 ) * 64 ) ),
+		          (uint16_t) ( entry_index % 100 ),
+		          ( entry_index % 2 ) == 0 ? 0 : LIBEVTX_RECORD_INDEX_ENTRY_FLAG_IS_RECOVERED,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test regular cases
+	 */
+	result = libevtx_record_index_get_entry_by_index(
+	          record_index,
+	          1234,
+	          &entry,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "entry",
+	 entry );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT16(
+	 "entry->chunk_index",
+	 entry->chunk_index,
+	 (uint16_t) 12 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT16(
+	 "entry->chunk_data_offset",
+	 entry->chunk_data_offset,
+	 (uint16_t) ( 512 + ( 34 * 64 ) ) );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT16(
+	 "entry->chunk_record_index",
+	 entry->chunk_record_index,
+	 (uint16_t) 34 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT16(
+	 "entry->flags",
+	 entry->flags,
+	 (uint16_t) 0 );
+
+	result = libevtx_record_index_get_entry_by_index(
+	          record_index,
+	          1499,
+	          &entry,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "entry",
+	 entry );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT16(
+	 "entry->flags",
+	 entry->flags,
+	 (uint16_t) LIBEVTX_RECORD_INDEX_ENTRY_FLAG_IS_RECOVERED );
+
+	/* Test error cases
+	 */
+	result = libevtx_record_index_get_entry_by_index(
+	          NULL,
+	          0,
+	          &entry,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_index_get_entry_by_index(
+	          record_index,
+	          -1,
+	          &entry,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_index_get_entry_by_index(
+	          record_index,
+	          1500,
+	          &entry,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_index_get_entry_by_index(
+	          record_index,
+	          0,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_record_index_free(
+	          &record_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "record_index",
+	 record_index );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_index != NULL )
+	{
+		libevtx_record_index_free(
+		 &record_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_index_get_number_of_entries_by_chunk_index,
+ * libevtx_record_index_remove_entries_by_chunk_index and
+ * libevtx_record_index_replace_entry functions
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_index_entries_by_chunk_index(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libevtx_record_index_t *record_index = NULL;
+	int entry_index                      = 0;
+	int number_of_entries                = 0;
+	int replace_entry_index              = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_record_index_initialize(
+	          &record_index,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "record_index",
+	 record_index );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( entry_index = 0;
+	     entry_index < 9;
+	     entry_index++ )
+	{
+		result = libevtx_record_index_append_entry(
+		          record_index,
+		          (uint16_t) ( entry_index % 3 ),
+		          (size_t) ( 512 + ( entry_index * 64 ) ),
+		          (uint16_t) ( entry_index / 3 ),
+		          0,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test regular cases
+	 */
+	result = libevtx_record_index_get_number_of_entries_by_chunk_index(
+	          record_index,
+	          1,
+	          &number_of_entries,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 3 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_record_index_remove_entries_by_chunk_index(
+	          record_index,
+	          1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The entries of the chunk are marked as removed, hence the other entries
+	 * retain their index
+	 */
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "record_index->number_of_entries",
+	 record_index->number_of_entries,
+	 9 );
+
+	for( entry_index = 0;
+	     entry_index < 9;
+	     entry_index++ )
+	{
+		EVTX_TEST_ASSERT_EQUAL_UINT16(
+		 "record_index->entries[ entry_index ].chunk_record_index",
+		 record_index->entries[ entry_index ].chunk_record_index,
+		 (uint16_t) ( entry_index / 3 ) );
+
+		EVTX_TEST_ASSERT_EQUAL_UINT16(
+		 "record_index->entries[ entry_index ].flags",
+		 record_index->entries[ entry_index ].flags,
+		 (uint16_t) ( ( ( entry_index % 3 ) == 1 ) ? LIBEVTX_RECORD_INDEX_ENTRY_FLAG_IS_REMOVED : 0 ) );
+	}
+	result = libevtx_record_index_get_number_of_entries_by_chunk_index(
+	          record_index,
+	          1,
+	          &number_of_entries,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The removed entries are replaced in place before new entries are appended
+	 */
+	replace_entry_index = 0;
+
+	for( entry_index = 0;
+	     entry_index < 4;
+	     entry_index++ )
+	{
+		result = libevtx_record_index_replace_entry(
+		          record_index,
+		          &replace_entry_index,
+		          1,
+		          (size_t) ( 1024 + ( entry_index * 64 ) ),
+		          (uint16_t) entry_index,
+		          0,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( entry_index < 3 )
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "replace_entry_index",
+			 replace_entry_index,
+			 ( entry_index * 3 ) + 2 );
+
+			EVTX_TEST_ASSERT_EQUAL_UINT16(
+			 "record_index->entries[ ( entry_index * 3 ) + 1 ].chunk_data_offset",
+			 record_index->entries[ ( entry_index * 3 ) + 1 ].chunk_data_offset,
+			 (uint16_t) ( 1024 + ( entry_index * 64 ) ) );
+
+			EVTX_TEST_ASSERT_EQUAL_UINT16(
+			 "record_index->entries[ ( entry_index * 3 ) + 1 ].flags",
+			 record_index->entries[ ( entry_index * 3 ) + 1 ].flags,
+			 0 );
+		}
+	}
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "record_index->number_of_entries",
+	 record_index->number_of_entries,
+	 10 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "replace_entry_index",
+	 replace_entry_index,
+	 10 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT16(
+	 "record_index->entries[ 9 ].chunk_index",
+	 record_index->entries[ 9 ].chunk_index,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT16(
+	 "record_index->entries[ 9 ].chunk_record_index",
+	 record_index->entries[ 9 ].chunk_record_index,
+	 3 );
+
+	result = libevtx_record_index_get_number_of_entries_by_chunk_index(
+	          record_index,
+	          1,
+	          &number_of_entries,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 4 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_record_index_get_number_of_entries_by_chunk_index(
+	          NULL,
+	          1,
+	          &number_of_entries,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_index_get_number_of_entries_by_chunk_index(
+	          record_index,
+	          1,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_index_remove_entries_by_chunk_index(
+	          NULL,
+	          1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_index_replace_entry(
+	          NULL,
+	          &replace_entry_index,
+	          1,
+	          512,
+	          0,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_index_replace_entry(
+	          record_index,
+	          NULL,
+	          1,
+	          512,
+	          0,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_index_replace_entry(
+	          record_index,
+	          &replace_entry_index,
+	          1,
+	          (size_t) UINT16_MAX + 1,
+	          0,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_record_index_free(
+	          &record_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "record_index",
+	 record_index );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_index != NULL )
+	{
+		libevtx_record_index_free(
+		 &record_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_index_compact function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_index_compact(
+     void )
+{
+	uint16_t expected_chunk_indexes[ 7 ] = { 0, 1, 2, 0, 2, 0, 2 };
+	libcerror_error_t *error             = NULL;
+	libevtx_record_index_t *record_index = NULL;
+	int entry_index                      = 0;
+	int replace_entry_index              = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_record_index_initialize(
+	          &record_index,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "record_index",
+	 record_index );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( entry_index = 0;
+	     entry_index < 9;
+	     entry_index++ )
+	{
+		result = libevtx_record_index_append_entry(
+		          record_index,
+		          (uint16_t) ( entry_index % 3 ),
+		          (size_t) ( 512 + ( entry_index * 64 ) ),
+		          (uint16_t) ( entry_index / 3 ),
+		          0,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libevtx_record_index_remove_entries_by_chunk_index(
+	          record_index,
+	          1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The reused chunk now contains fewer records than before
+	 */
+	result = libevtx_record_index_replace_entry(
+	          record_index,
+	          &replace_entry_index,
+	          1,
+	          1024,
+	          0,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevtx_record_index_compact(
+	          record_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "record_index->number_of_entries",
+	 record_index->number_of_entries,
+	 7 );
+
+	for( entry_index = 0;
+	     entry_index < 7;
+	     entry_index++ )
+	{
+		EVTX_TEST_ASSERT_EQUAL_UINT16(
+		 "record_index->entries[ entry_index ].chunk_index",
+		 record_index->entries[ entry_index ].chunk_index,
+		 expected_chunk_indexes[ entry_index ] );
+
+		EVTX_TEST_ASSERT_EQUAL_UINT16(
+		 "record_index->entries[ entry_index ].flags",
+		 record_index->entries[ entry_index ].flags,
+		 0 );
+	}
+	EVTX_TEST_ASSERT_EQUAL_UINT16(
+	 "record_index->entries[ 1 ].chunk_data_offset",
+	 record_index->entries[ 1 ].chunk_data_offset,
+	 1024 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT16(
+	 "record_index->entries[ 6 ].chunk_data_offset",
+	 record_index->entries[ 6 ].chunk_data_offset,
+	 512 + ( 8 * 64 ) );
+
+	/* Compacting an index without removed entries leaves it unchanged
+	 */
+	result = libevtx_record_index_compact(
+	          record_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "record_index->number_of_entries",
+	 record_index->number_of_entries,
+	 7 );
+
+	/* Test error cases
+	 */
+	result = libevtx_record_index_compact(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_record_index_free(
+	          &record_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "record_index",
+	 record_index );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_index != NULL )
+	{
+		libevtx_record_index_free(
+		 &record_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+	EVTX_TEST_RUN(
+	 "libevtx_record_index_initialize",
+	 evtx_test_record_index_initialize );
+
+	EVTX_TEST_RUN(
+	 "libevtx_record_index_free",
+	 evtx_test_record_index_free );
+
+	EVTX_TEST_RUN(
+	 "libevtx_record_index_append_entry",
+	 evtx_test_record_index_append_entry );
+
+	EVTX_TEST_RUN(
+	 "libevtx_record_index_get_number_of_entries",
+	 evtx_test_record_index_get_number_of_entries );
+
+	EVTX_TEST_RUN(
+	 "libevtx_record_index_get_entry_by_index",
+	 evtx_test_record_index_get_entry_by_index );
+
+	EVTX_TEST_RUN(
+	 "libevtx_record_index_entries_by_chunk_index",
+	 evtx_test_record_index_entries_by_chunk_index );
+
+	EVTX_TEST_RUN(
+	 "libevtx_record_index_compact",
+	 evtx_test_record_index_compact );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
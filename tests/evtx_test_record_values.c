@@ -21,18 +21,22 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
 #endif
 
+#include "evtx_test_functions.h"
+#include "evtx_test_libbfio.h"
 #include "evtx_test_libcerror.h"
 #include "evtx_test_libevtx.h"
 #include "evtx_test_macros.h"
 #include "evtx_test_memory.h"
 #include "evtx_test_unused.h"
 
+#include "../libevtx/libevtx_io_handle.h"
 #include "../libevtx/libevtx_record_values.h"
 
 #if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
@@ -3645,6 +3649,1124 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libevtx_record_values_get_utf8_xml_string_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_values_get_utf8_xml_string_buffer(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libevtx_record_values_t *record_values = NULL;
+	uint8_t *utf8_xml_string               = NULL;
+	size_t utf8_xml_string_length          = 0;
+	size_t utf8_xml_string_size            = 0;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_record_values_initialize(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_record_values_get_utf8_xml_string_buffer(
+	          NULL,
+	          &utf8_xml_string,
+	          &utf8_xml_string_size,
+	          &utf8_xml_string_length,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_values_get_utf8_xml_string_buffer(
+	          record_values,
+	          NULL,
+	          &utf8_xml_string_size,
+	          &utf8_xml_string_length,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_values_get_utf8_xml_string_buffer(
+	          record_values,
+	          &utf8_xml_string,
+	          NULL,
+	          &utf8_xml_string_length,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_values_get_utf8_xml_string_buffer(
+	          record_values,
+	          &utf8_xml_string,
+	          &utf8_xml_string_size,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_record_values_free(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_values != NULL )
+	{
+		libevtx_record_values_free(
+		 &record_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_values_get_utf16_xml_string_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_values_get_utf16_xml_string_buffer(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libevtx_record_values_t *record_values = NULL;
+	uint16_t *utf16_xml_string             = NULL;
+	size_t utf16_xml_string_length         = 0;
+	size_t utf16_xml_string_size           = 0;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_record_values_initialize(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_record_values_get_utf16_xml_string_buffer(
+	          NULL,
+	          &utf16_xml_string,
+	          &utf16_xml_string_size,
+	          &utf16_xml_string_length,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_values_get_utf16_xml_string_buffer(
+	          record_values,
+	          NULL,
+	          &utf16_xml_string_size,
+	          &utf16_xml_string_length,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_values_get_utf16_xml_string_buffer(
+	          record_values,
+	          &utf16_xml_string,
+	          NULL,
+	          &utf16_xml_string_length,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_values_get_utf16_xml_string_buffer(
+	          record_values,
+	          &utf16_xml_string,
+	          &utf16_xml_string_size,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_record_values_free(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_values != NULL )
+	{
+		libevtx_record_values_free(
+		 &record_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_values_get_utf8_strings_size function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_values_get_utf8_strings_size(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libevtx_record_values_t *record_values = NULL;
+	size_t utf8_strings_size               = 0;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_record_values_initialize(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_record_values_get_utf8_strings_size(
+	          NULL,
+	          NULL,
+	          &utf8_strings_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test record values without XML document
+	 */
+	result = libevtx_record_values_get_utf8_strings_size(
+	          record_values,
+	          NULL,
+	          &utf8_strings_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_record_values_free(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_values != NULL )
+	{
+		libevtx_record_values_free(
+		 &record_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_values_get_utf8_strings function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_values_get_utf8_strings(
+     void )
+{
+	uint8_t utf8_strings[ 64 ];
+	size_t utf8_string_offsets[ 4 ];
+
+	libcerror_error_t *error               = NULL;
+	libevtx_record_values_t *record_values = NULL;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_record_values_initialize(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_record_values_get_utf8_strings(
+	          NULL,
+	          NULL,
+	          utf8_strings,
+	          64,
+	          utf8_string_offsets,
+	          4,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test record values without XML document
+	 */
+	result = libevtx_record_values_get_utf8_strings(
+	          record_values,
+	          NULL,
+	          utf8_strings,
+	          64,
+	          utf8_string_offsets,
+	          4,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_record_values_free(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_values != NULL )
+	{
+		libevtx_record_values_free(
+		 &record_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_values_get_utf16_strings_size function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_values_get_utf16_strings_size(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libevtx_record_values_t *record_values = NULL;
+	size_t utf16_strings_size               = 0;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_record_values_initialize(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_record_values_get_utf16_strings_size(
+	          NULL,
+	          NULL,
+	          &utf16_strings_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test record values without XML document
+	 */
+	result = libevtx_record_values_get_utf16_strings_size(
+	          record_values,
+	          NULL,
+	          &utf16_strings_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_record_values_free(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_values != NULL )
+	{
+		libevtx_record_values_free(
+		 &record_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_values_get_utf16_strings function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_values_get_utf16_strings(
+     void )
+{
+	uint16_t utf16_strings[ 64 ];
+	size_t utf16_string_offsets[ 4 ];
+
+	libcerror_error_t *error               = NULL;
+	libevtx_record_values_t *record_values = NULL;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_record_values_initialize(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_record_values_get_utf16_strings(
+	          NULL,
+	          NULL,
+	          utf16_strings,
+	          64,
+	          utf16_string_offsets,
+	          4,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test record values without XML document
+	 */
+	result = libevtx_record_values_get_utf16_strings(
+	          record_values,
+	          NULL,
+	          utf16_strings,
+	          64,
+	          utf16_string_offsets,
+	          4,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_record_values_free(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_values != NULL )
+	{
+		libevtx_record_values_free(
+		 &record_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_values_read_raw_data function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_values_read_raw_data(
+     void )
+{
+	uint8_t data[ 48 ];
+
+	libbfio_handle_t *file_io_handle       = NULL;
+	libcerror_error_t *error               = NULL;
+	libevtx_io_handle_t *io_handle         = NULL;
+	libevtx_record_values_t *record_values = NULL;
+	uint8_t *raw_data                      = NULL;
+	void *memset_result                    = NULL;
+	size_t raw_data_size                   = 0;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	memset_result = memory_set(
+	                 data,
+	                 0,
+	                 sizeof( uint8_t ) * 48 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	/* An event record of 32 bytes at offset 16
+	 */
+	data[ 16 ] = (uint8_t) '*';
+	data[ 17 ] = (uint8_t) '*';
+	data[ 20 ] = 32;
+	data[ 44 ] = 32;
+
+	result = libevtx_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = evtx_test_open_file_io_handle(
+	          &file_io_handle,
+	          data,
+	          48,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_record_values_initialize(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test record values without data
+	 */
+	result = libevtx_record_values_read_raw_data(
+	          record_values,
+	          io_handle,
+	          file_io_handle,
+	          &raw_data,
+	          &raw_data_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "raw_data",
+	 raw_data );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	record_values->offset    = 16;
+	record_values->data_size = 32;
+
+	result = libevtx_record_values_read_raw_data(
+	          record_values,
+	          io_handle,
+	          file_io_handle,
+	          &raw_data,
+	          &raw_data_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "raw_data",
+	 raw_data );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "raw_data_size",
+	 raw_data_size,
+	 (size_t) 32 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          raw_data,
+	          &( data[ 16 ] ),
+	          32 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 raw_data );
+
+	raw_data = NULL;
+
+	/* Test error cases
+	 */
+	result = libevtx_record_values_read_raw_data(
+	          NULL,
+	          io_handle,
+	          file_io_handle,
+	          &raw_data,
+	          &raw_data_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_values_read_raw_data(
+	          record_values,
+	          NULL,
+	          file_io_handle,
+	          &raw_data,
+	          &raw_data_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "raw_data",
+	 raw_data );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_values_read_raw_data(
+	          record_values,
+	          io_handle,
+	          file_io_handle,
+	          NULL,
+	          &raw_data_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_values_read_raw_data(
+	          record_values,
+	          io_handle,
+	          file_io_handle,
+	          &raw_data,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the data no longer contains the event record
+	 */
+	record_values->offset = 8;
+
+	result = libevtx_record_values_read_raw_data(
+	          record_values,
+	          io_handle,
+	          file_io_handle,
+	          &raw_data,
+	          &raw_data_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "raw_data",
+	 raw_data );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the event record exceeds the data
+	 */
+	record_values->offset = 32;
+
+	result = libevtx_record_values_read_raw_data(
+	          record_values,
+	          io_handle,
+	          file_io_handle,
+	          &raw_data,
+	          &raw_data_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "raw_data",
+	 raw_data );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_record_values_free(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = evtx_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( raw_data != NULL )
+	{
+		memory_free(
+		 raw_data );
+	}
+	if( record_values != NULL )
+	{
+		libevtx_record_values_free(
+		 &record_values,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libevtx_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
 
 /* The main program
@@ -3676,6 +4798,34 @@ int main(
 	 "libevtx_record_values_clone",
 	 evtx_test_record_values_clone );
 
+	EVTX_TEST_RUN(
+	 "libevtx_record_values_get_utf8_xml_string_buffer",
+	 evtx_test_record_values_get_utf8_xml_string_buffer );
+
+	EVTX_TEST_RUN(
+	 "libevtx_record_values_get_utf16_xml_string_buffer",
+	 evtx_test_record_values_get_utf16_xml_string_buffer );
+
+	EVTX_TEST_RUN(
+	 "libevtx_record_values_get_utf8_strings_size",
+	 evtx_test_record_values_get_utf8_strings_size );
+
+	EVTX_TEST_RUN(
+	 "libevtx_record_values_get_utf8_strings",
+	 evtx_test_record_values_get_utf8_strings );
+
+	EVTX_TEST_RUN(
+	 "libevtx_record_values_get_utf16_strings_size",
+	 evtx_test_record_values_get_utf16_strings_size );
+
+	EVTX_TEST_RUN(
+	 "libevtx_record_values_get_utf16_strings",
+	 evtx_test_record_values_get_utf16_strings );
+
+	EVTX_TEST_RUN(
+	 "libevtx_record_values_read_raw_data",
+	 evtx_test_record_values_read_raw_data );
+
 #if defined( TODO )
 
 	/* TODO: add tests for libevtx_record_values_read_header */
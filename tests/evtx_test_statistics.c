@@ -0,0 +1,278 @@
+/*
+ * Library statistics functions test program
+ *
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_libcerror.h"
+#include "evtx_test_libevtx.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_unused.h"
+
+#include "../libevtx/libevtx_statistics.h"
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+/* Tests the libevtx_statistics_get_time function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_statistics_get_time(
+     void )
+{
+	uint64_t first_time  = 0;
+	uint64_t second_time = 0;
+
+	/* Test regular cases
+	 */
+	first_time  = libevtx_statistics_get_time();
+	second_time = libevtx_statistics_get_time();
+
+	/* The clock is monotonic
+	 */
+	EVTX_TEST_ASSERT_LESS_THAN_UINT64(
+	 "first_time",
+	 first_time,
+	 second_time + 1 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libevtx_statistics_counters_get_statistics function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_statistics_counters_get_statistics(
+     void )
+{
+	libevtx_statistics_counters_t statistics_counters;
+	libevtx_statistics_t statistics;
+
+	libcerror_error_t *error = NULL;
+	void *memset_result      = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	memset_result = memory_set(
+	                 &statistics_counters,
+	                 0,
+	                 sizeof( libevtx_statistics_counters_t ) );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	libevtx_statistics_counter_add(
+	 statistics_counters.number_of_chunks_read,
+	 2 );
+
+	libevtx_statistics_counter_add(
+	 statistics_counters.number_of_bytes_read,
+	 4096 + ( 2 * 65536 ) );
+
+	libevtx_statistics_counter_add(
+	 statistics_counters.number_of_chunk_lookups,
+	 5 );
+
+	libevtx_statistics_counter_add(
+	 statistics_counters.number_of_chunk_cache_misses,
+	 2 );
+
+	libevtx_statistics_counter_add(
+	 statistics_counters.number_of_record_lookups,
+	 3 );
+
+	libevtx_statistics_counter_add(
+	 statistics_counters.number_of_record_cache_misses,
+	 3 );
+
+	libevtx_statistics_counter_add(
+	 statistics_counters.number_of_xml_documents_read,
+	 3 );
+
+	statistics.size = sizeof( libevtx_statistics_t );
+
+	/* Test regular cases
+	 */
+	result = libevtx_statistics_counters_get_statistics(
+	          &statistics_counters,
+	          &statistics,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "statistics.size",
+	 statistics.size,
+	 (size_t) sizeof( libevtx_statistics_t ) );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics.number_of_chunks_read",
+	 statistics.number_of_chunks_read,
+	 (uint64_t) 2 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics.number_of_bytes_read",
+	 statistics.number_of_bytes_read,
+	 (uint64_t) 4096 + ( 2 * 65536 ) );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics.number_of_chunk_cache_hits",
+	 statistics.number_of_chunk_cache_hits,
+	 (uint64_t) 3 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics.number_of_chunk_cache_misses",
+	 statistics.number_of_chunk_cache_misses,
+	 (uint64_t) 2 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics.number_of_record_cache_hits",
+	 statistics.number_of_record_cache_hits,
+	 (uint64_t) 0 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics.number_of_record_cache_misses",
+	 statistics.number_of_record_cache_misses,
+	 (uint64_t) 3 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics.number_of_xml_documents_read",
+	 statistics.number_of_xml_documents_read,
+	 (uint64_t) 3 );
+
+	/* Test error cases
+	 */
+	result = libevtx_statistics_counters_get_statistics(
+	          NULL,
+	          &statistics,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_statistics_counters_get_statistics(
+	          &statistics_counters,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	statistics.size = sizeof( libevtx_statistics_t ) - 1;
+
+	result = libevtx_statistics_counters_get_statistics(
+	          &statistics_counters,
+	          &statistics,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+	EVTX_TEST_RUN(
+	 "libevtx_statistics_get_time",
+	 evtx_test_statistics_get_time );
+
+	EVTX_TEST_RUN(
+	 "libevtx_statistics_counters_get_statistics",
+	 evtx_test_statistics_counters_get_statistics );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
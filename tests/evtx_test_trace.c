@@ -0,0 +1,410 @@
+/*
+ * Library trace functions test program
+ *
+ *
+ * Copyright (C) 2011-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_libcerror.h"
+#include "evtx_test_libevtx.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_unused.h"
+
+#include "../libevtx/libevtx_io_handle.h"
+#include "../libevtx/libevtx_trace.h"
+
+typedef struct evtx_test_trace_values evtx_test_trace_values_t;
+
+struct evtx_test_trace_values
+{
+	/* The number of begin events
+	 */
+	int number_of_begin_events;
+
+	/* The number of end events
+	 */
+	int number_of_end_events;
+
+	/* The last event type
+	 */
+	int event_type;
+
+	/* The last chunk index
+	 */
+	int chunk_index;
+
+	/* The last offset
+	 */
+	off64_t offset;
+
+	/* The last size
+	 */
+	size64_t size;
+};
+
+/* The trace begin callback
+ */
+void evtx_test_trace_begin_callback(
+      int event_type,
+      int chunk_index,
+      off64_t offset,
+      size64_t size,
+      intptr_t *user_data )
+{
+	evtx_test_trace_values_t *trace_values = (evtx_test_trace_values_t *) user_data;
+
+	if( trace_values != NULL )
+	{
+		trace_values->number_of_begin_events += 1;
+		trace_values->event_type              = event_type;
+		trace_values->chunk_index             = chunk_index;
+		trace_values->offset                  = offset;
+		trace_values->size                    = size;
+	}
+}
+
+/* The trace end callback
+ */
+void evtx_test_trace_end_callback(
+      int event_type,
+      int chunk_index,
+      off64_t offset,
+      size64_t size,
+      intptr_t *user_data )
+{
+	evtx_test_trace_values_t *trace_values = (evtx_test_trace_values_t *) user_data;
+
+	if( trace_values != NULL )
+	{
+		trace_values->number_of_end_events += 1;
+		trace_values->event_type            = event_type;
+		trace_values->chunk_index           = chunk_index;
+		trace_values->offset                = offset;
+		trace_values->size                  = size;
+	}
+}
+
+/* Tests the libevtx_set_trace_callbacks function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_set_trace_callbacks(
+     void )
+{
+	evtx_test_trace_values_t trace_values;
+
+	libcerror_error_t *error = NULL;
+	void *memset_result      = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	memset_result = memory_set(
+	                 &trace_values,
+	                 0,
+	                 sizeof( evtx_test_trace_values_t ) );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	/* Test regular cases
+	 */
+	result = libevtx_set_trace_callbacks(
+	          &evtx_test_trace_begin_callback,
+	          &evtx_test_trace_end_callback,
+	          (intptr_t *) &trace_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+	libevtx_trace_begin(
+	 LIBEVTX_TRACE_EVENT_TYPE_CHUNK_READ,
+	 2,
+	 4096 + ( 2 * 65536 ),
+	 65536 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "trace_values.number_of_begin_events",
+	 trace_values.number_of_begin_events,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "trace_values.number_of_end_events",
+	 trace_values.number_of_end_events,
+	 0 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "trace_values.event_type",
+	 trace_values.event_type,
+	 LIBEVTX_TRACE_EVENT_TYPE_CHUNK_READ );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "trace_values.chunk_index",
+	 trace_values.chunk_index,
+	 2 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT64(
+	 "trace_values.offset",
+	 trace_values.offset,
+	 (int64_t) 4096 + ( 2 * 65536 ) );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "trace_values.size",
+	 trace_values.size,
+	 (uint64_t) 65536 );
+
+	libevtx_trace_end(
+	 LIBEVTX_TRACE_EVENT_TYPE_CHUNK_READ,
+	 2,
+	 4096 + ( 2 * 65536 ),
+	 65536 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "trace_values.number_of_begin_events",
+	 trace_values.number_of_begin_events,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "trace_values.number_of_end_events",
+	 trace_values.number_of_end_events,
+	 1 );
+
+	/* Test that a trace point is a single statement
+	 */
+	if( trace_values.number_of_begin_events == 0 )
+		libevtx_trace_begin(
+		 LIBEVTX_TRACE_EVENT_TYPE_RECORD_READ,
+		 0,
+		 0,
+		 0 );
+	else
+		libevtx_trace_end(
+		 LIBEVTX_TRACE_EVENT_TYPE_RECORD_READ,
+		 0,
+		 0,
+		 0 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "trace_values.number_of_begin_events",
+	 trace_values.number_of_begin_events,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "trace_values.number_of_end_events",
+	 trace_values.number_of_end_events,
+	 2 );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+	/* Test removing the callbacks
+	 */
+	result = libevtx_set_trace_callbacks(
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+	libevtx_trace_begin(
+	 LIBEVTX_TRACE_EVENT_TYPE_RECORD_READ,
+	 0,
+	 0,
+	 0 );
+
+	libevtx_trace_end(
+	 LIBEVTX_TRACE_EVENT_TYPE_RECORD_READ,
+	 0,
+	 0,
+	 0 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "trace_values.number_of_begin_events",
+	 trace_values.number_of_begin_events,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "trace_values.number_of_end_events",
+	 trace_values.number_of_end_events,
+	 2 );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	libevtx_set_trace_callbacks(
+	 NULL,
+	 NULL,
+	 NULL,
+	 NULL );
+
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+/* Tests the libevtx_trace_get_chunk_index function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_trace_get_chunk_index(
+     void )
+{
+	libevtx_io_handle_t io_handle;
+
+	void *memset_result = NULL;
+	int chunk_index     = 0;
+
+	/* Initialize test
+	 */
+	memset_result = memory_set(
+	                 &io_handle,
+	                 0,
+	                 sizeof( libevtx_io_handle_t ) );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	io_handle.chunks_data_offset = 4096;
+	io_handle.chunk_size         = 65536;
+
+	/* Test regular cases
+	 */
+	chunk_index = libevtx_trace_get_chunk_index(
+	               &io_handle,
+	               4096 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "chunk_index",
+	 chunk_index,
+	 0 );
+
+	chunk_index = libevtx_trace_get_chunk_index(
+	               &io_handle,
+	               4096 + ( 2 * 65536 ) + 512 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "chunk_index",
+	 chunk_index,
+	 2 );
+
+	/* Test error cases
+	 */
+	chunk_index = libevtx_trace_get_chunk_index(
+	               NULL,
+	               4096 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "chunk_index",
+	 chunk_index,
+	 -1 );
+
+	chunk_index = libevtx_trace_get_chunk_index(
+	               &io_handle,
+	               0 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "chunk_index",
+	 chunk_index,
+	 -1 );
+
+	io_handle.chunk_size = 0;
+
+	chunk_index = libevtx_trace_get_chunk_index(
+	               &io_handle,
+	               4096 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "chunk_index",
+	 chunk_index,
+	 -1 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+	EVTX_TEST_RUN(
+	 "libevtx_set_trace_callbacks",
+	 evtx_test_set_trace_callbacks );
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+	EVTX_TEST_RUN(
+	 "libevtx_trace_get_chunk_index",
+	 evtx_test_trace_get_chunk_index );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -141,6 +141,23 @@ class FileTypeTests(unittest.TestCase):
       with self.assertRaises(RuntimeError):
         evtx_file.set_ascii_codepage(codepage)
 
+  def test_get_statistics(self):
+    """Tests the get_statistics function and statistics property."""
+    if not unittest.source:
+      return
+
+    evtx_file = pyevtx.file()
+
+    evtx_file.open(unittest.source)
+
+    statistics = evtx_file.get_statistics()
+    self.assertIsNotNone(statistics)
+    self.assertGreater(statistics["number_of_bytes_read"], 0)
+
+    self.assertIsNotNone(evtx_file.statistics)
+
+    evtx_file.close()
+
 
 if __name__ == "__main__":
   argument_parser = argparse.ArgumentParser()
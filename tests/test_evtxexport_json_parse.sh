@@ -0,0 +1,120 @@
+#!/bin/bash
+# Export tool JSON output testing script
+# Tests that the JSON and JSON lines output, without stderr, can be parsed
+#
+# Version: 20181020
+
+EXIT_SUCCESS=0;
+EXIT_FAILURE=1;
+EXIT_IGNORE=77;
+
+INPUT_GLOB="*";
+
+if ! test -z ${SKIP_TOOLS_TESTS};
+then
+	exit ${EXIT_IGNORE};
+fi
+
+TEST_EXECUTABLE="../evtxtools/evtxexport";
+
+if ! test -x "${TEST_EXECUTABLE}";
+then
+	TEST_EXECUTABLE="../evtxtools/evtxexport.exe";
+fi
+
+if ! test -x "${TEST_EXECUTABLE}";
+then
+	echo "Missing test executable: ${TEST_EXECUTABLE}";
+
+	exit ${EXIT_FAILURE};
+fi
+
+PYTHON=`which python3 2> /dev/null`;
+
+if test -z "${PYTHON}";
+then
+	PYTHON=`which python 2> /dev/null`;
+fi
+
+if test -z "${PYTHON}";
+then
+	echo "Missing JSON parser: python";
+
+	exit ${EXIT_IGNORE};
+fi
+
+test_export_json_parse()
+{
+	local INPUT_FILE=$1;
+	local FORMAT=$2;
+	local TMPDIR=$3;
+
+	local INPUT_NAME=`basename "${INPUT_FILE}"`;
+	local OUTPUT_FILE="${TMPDIR}/${INPUT_NAME}.${FORMAT}";
+
+	${TEST_EXECUTABLE} -f${FORMAT} -mall "${INPUT_FILE}" > "${OUTPUT_FILE}" 2> /dev/null;
+	local RESULT=$?;
+
+	if test ${RESULT} -eq ${EXIT_SUCCESS};
+	then
+		if test "${FORMAT}" = "json";
+		then
+			${PYTHON} -c "import json, sys; json.load(open(sys.argv[1]))" "${OUTPUT_FILE}";
+			RESULT=$?;
+		else
+			${PYTHON} -c "import json, sys; [json.loads(line) for line in open(sys.argv[1])]" "${OUTPUT_FILE}";
+			RESULT=$?;
+		fi
+	fi
+	echo -n "Testing parsing evtxexport -f${FORMAT} output with input: ${INPUT_FILE} ";
+
+	if test ${RESULT} -ne ${EXIT_SUCCESS};
+	then
+		echo " (FAIL)";
+	else
+		echo " (PASS)";
+	fi
+	return ${RESULT};
+}
+
+TEST_INPUT_DIRECTORY="input";
+
+if ! test -d "${TEST_INPUT_DIRECTORY}";
+then
+	echo "Test input directory: ${TEST_INPUT_DIRECTORY} not found.";
+
+	exit ${EXIT_IGNORE};
+fi
+
+TMPDIR="tmp$$";
+
+rm -rf ${TMPDIR};
+mkdir ${TMPDIR};
+
+RESULT=${EXIT_IGNORE};
+
+for TEST_SET_INPUT_DIRECTORY in ${TEST_INPUT_DIRECTORY}/*;
+do
+	if ! test -d "${TEST_SET_INPUT_DIRECTORY}";
+	then
+		continue;
+	fi
+	for INPUT_FILE in `ls -1 ${TEST_SET_INPUT_DIRECTORY}/${INPUT_GLOB}`;
+	do
+		for FORMAT in json jsonl;
+		do
+			test_export_json_parse "${INPUT_FILE}" "${FORMAT}" "${TMPDIR}";
+			RESULT=$?;
+
+			if test ${RESULT} -ne ${EXIT_SUCCESS};
+			then
+				break 3;
+			fi
+		done
+	done
+done
+
+rm -rf ${TMPDIR};
+
+exit ${RESULT};
+
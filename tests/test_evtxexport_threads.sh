@@ -0,0 +1,109 @@
+#!/bin/bash
+# Export tool multi-threading testing script
+# Tests that the output with multiple threads is identical to the output with a single thread
+#
+# Version: 20181018
+
+EXIT_SUCCESS=0;
+EXIT_FAILURE=1;
+EXIT_IGNORE=77;
+
+FORMATS="json jsonl text xml";
+NUMBER_OF_THREADS=4;
+
+INPUT_GLOB="*";
+
+if ! test -z ${SKIP_TOOLS_TESTS};
+then
+	exit ${EXIT_IGNORE};
+fi
+
+TEST_EXECUTABLE="../evtxtools/evtxexport";
+
+if ! test -x "${TEST_EXECUTABLE}";
+then
+	TEST_EXECUTABLE="../evtxtools/evtxexport.exe";
+fi
+
+if ! test -x "${TEST_EXECUTABLE}";
+then
+	echo "Missing test executable: ${TEST_EXECUTABLE}";
+
+	exit ${EXIT_FAILURE};
+fi
+
+test_export_with_threads()
+{
+	local INPUT_FILE=$1;
+	local FORMAT=$2;
+	local TMPDIR=$3;
+
+	local INPUT_NAME=`basename "${INPUT_FILE}"`;
+	local SINGLE_THREAD_OUTPUT="${TMPDIR}/${INPUT_NAME}.${FORMAT}.j1";
+	local MULTI_THREAD_OUTPUT="${TMPDIR}/${INPUT_NAME}.${FORMAT}.j${NUMBER_OF_THREADS}";
+
+	${TEST_EXECUTABLE} -f${FORMAT} -mall -j1 "${INPUT_FILE}" > "${SINGLE_THREAD_OUTPUT}" 2> /dev/null;
+	local RESULT=$?;
+
+	if test ${RESULT} -eq ${EXIT_SUCCESS};
+	then
+		${TEST_EXECUTABLE} -f${FORMAT} -mall -j${NUMBER_OF_THREADS} "${INPUT_FILE}" > "${MULTI_THREAD_OUTPUT}" 2> /dev/null;
+		RESULT=$?;
+	fi
+	if test ${RESULT} -eq ${EXIT_SUCCESS};
+	then
+		cmp -s "${SINGLE_THREAD_OUTPUT}" "${MULTI_THREAD_OUTPUT}";
+		RESULT=$?;
+	fi
+	echo -n "Testing evtxexport -f${FORMAT} -j${NUMBER_OF_THREADS} with input: ${INPUT_FILE} ";
+
+	if test ${RESULT} -ne ${EXIT_SUCCESS};
+	then
+		echo " (FAIL)";
+	else
+		echo " (PASS)";
+	fi
+	return ${RESULT};
+}
+
+TEST_INPUT_DIRECTORY="input";
+
+if ! test -d "${TEST_INPUT_DIRECTORY}";
+then
+	echo "Test input directory: ${TEST_INPUT_DIRECTORY} not found.";
+
+	exit ${EXIT_IGNORE};
+fi
+
+TMPDIR="tmp$$";
+
+rm -rf ${TMPDIR};
+mkdir ${TMPDIR};
+
+RESULT=${EXIT_IGNORE};
+
+for TEST_SET_INPUT_DIRECTORY in ${TEST_INPUT_DIRECTORY}/*;
+do
+	if ! test -d "${TEST_SET_INPUT_DIRECTORY}";
+	then
+		continue;
+	fi
+	for INPUT_FILE in `ls -1 ${TEST_SET_INPUT_DIRECTORY}/${INPUT_GLOB}`;
+	do
+		for FORMAT in ${FORMATS};
+		do
+			test_export_with_threads "${INPUT_FILE}" "${FORMAT}" "${TMPDIR}";
+			RESULT=$?;
+
+			if test ${RESULT} -ne ${EXIT_SUCCESS};
+			then
+				break 3;
+			fi
+		done
+	done
+done
+
+rm -rf ${TMPDIR};
+
+exit ${RESULT};
+
@@ -6,8 +6,8 @@ $ExitSuccess = 0
 $ExitFailure = 1
 $ExitIgnore = 77
 
-$LibraryTests = "chunk chunks_table error io_handle notify record record_values template_definition"
-$LibraryTestsWithInput = "file support"
+$LibraryTests = "chunk chunks_table error event_data index_file io_handle json_string names_table notify record_index record_values statistics template_definition trace"
+$LibraryTestsWithInput = "file record support"
 
 Function GetTestToolDirectory
 {
@@ -0,0 +1,290 @@
+#!/bin/bash
+# Scaling testing script
+# Tests that the time and peak memory usage of opening a file and retrieving
+# all its records grow linearly with the size of the file
+#
+# The test is timing sensitive and therefore skipped by "make check" unless
+# ENABLE_SCALING_TESTS is set, e.g.:
+# ENABLE_SCALING_TESTS=1 make check
+#
+# Version: 20181018
+
+EXIT_SUCCESS=0;
+EXIT_FAILURE=1;
+EXIT_IGNORE=77;
+
+# The number of chunks of the smallest generated file
+BASE_NUMBER_OF_CHUNKS=32;
+
+# The sizes of the generated files relative to the smallest file
+SCALING_FACTORS="1 4 16";
+
+# The number of runs per file, the minimum of the runs is used
+NUMBER_OF_RUNS=${SCALING_NUMBER_OF_RUNS:-5};
+
+# The maximum allowed growth ratio relative to the scaling factor,
+# a quadratic regression at 16x results in a ratio of 16
+TIME_TOLERANCE=${SCALING_TIME_TOLERANCE:-3.0};
+MEMORY_TOLERANCE=${SCALING_MEMORY_TOLERANCE:-1.5};
+
+if ! test -z ${SKIP_TOOLS_TESTS};
+then
+	exit ${EXIT_IGNORE};
+fi
+
+if test -z ${ENABLE_SCALING_TESTS};
+then
+	exit ${EXIT_IGNORE};
+fi
+
+GENERATE_EXECUTABLE="../evtxtools/evtxgen";
+
+if ! test -x "${GENERATE_EXECUTABLE}";
+then
+	GENERATE_EXECUTABLE="../evtxtools/evtxgen.exe";
+fi
+
+if ! test -x "${GENERATE_EXECUTABLE}";
+then
+	echo "Missing test executable: ${GENERATE_EXECUTABLE}";
+
+	exit ${EXIT_FAILURE};
+fi
+
+TEST_EXECUTABLE="../evtxtools/evtxbench";
+
+if ! test -x "${TEST_EXECUTABLE}";
+then
+	TEST_EXECUTABLE="../evtxtools/evtxbench.exe";
+fi
+
+if ! test -x "${TEST_EXECUTABLE}";
+then
+	echo "Missing test executable: ${TEST_EXECUTABLE}";
+
+	exit ${EXIT_FAILURE};
+fi
+
+# Retrieves a value from the JSON output of evtxbench
+# The phase name is empty for top level values
+get_bench_value()
+{
+	local BENCH_OUTPUT=$1;
+	local PHASE_NAME=$2;
+	local VALUE_NAME=$3;
+
+	awk -v phase="${PHASE_NAME}" -v name="${VALUE_NAME}" '
+		BEGIN { in_phase = ( phase == "" ); }
+		phase != "" && $0 ~ "^\t\t\"" phase "\": {" { in_phase = 1; next; }
+		in_phase && $0 ~ "\"" name "\": " {
+			sub( /^.*": /, "" );
+			sub( /,$/, "" );
+			print;
+			exit;
+		}' "${BENCH_OUTPUT}";
+}
+
+# Measures opening a file and retrieving all its records
+# Prints the minimum elapsed time in nanoseconds and the minimum peak memory usage
+# in bytes of the runs
+measure_file()
+{
+	local INPUT_FILE=$1;
+	local TMPDIR=$2;
+
+	local BENCH_OUTPUT="${TMPDIR}/bench.json";
+	local MINIMUM_TIME="";
+	local MINIMUM_MEMORY="";
+	local RUN=0;
+
+	while test ${RUN} -lt ${NUMBER_OF_RUNS};
+	do
+		${TEST_EXECUTABLE} -fjson "${INPUT_FILE}" > "${BENCH_OUTPUT}" 2> /dev/null;
+
+		if test $? -ne ${EXIT_SUCCESS};
+		then
+			return ${EXIT_FAILURE};
+		fi
+		local OPEN_TIME=`get_bench_value "${BENCH_OUTPUT}" "open" "elapsed_time"`;
+		local RETRIEVAL_TIME=`get_bench_value "${BENCH_OUTPUT}" "record_retrieval" "elapsed_time"`;
+		local MEMORY=`get_bench_value "${BENCH_OUTPUT}" "" "peak_memory_usage"`;
+
+		if test -z "${OPEN_TIME}" || test -z "${RETRIEVAL_TIME}";
+		then
+			return ${EXIT_FAILURE};
+		fi
+		local TIME=$(( ${OPEN_TIME} + ${RETRIEVAL_TIME} ));
+
+		if test -z "${MINIMUM_TIME}" || test ${TIME} -lt ${MINIMUM_TIME};
+		then
+			MINIMUM_TIME=${TIME};
+		fi
+		if test "${MEMORY}" = "null" || test -z "${MEMORY}";
+		then
+			MINIMUM_MEMORY="null";
+
+		elif test -z "${MINIMUM_MEMORY}" || ( test "${MINIMUM_MEMORY}" != "null" && test ${MEMORY} -lt ${MINIMUM_MEMORY} );
+		then
+			MINIMUM_MEMORY=${MEMORY};
+		fi
+		RUN=$(( ${RUN} + 1 ));
+	done
+
+	echo "${MINIMUM_TIME} ${MINIMUM_MEMORY}";
+
+	return ${EXIT_SUCCESS};
+}
+
+# Checks if a growth ratio is within the tolerance of the scaling factor
+# Returns 0 if within the tolerance or 1 otherwise
+check_growth_ratio()
+{
+	local BASE_VALUE=$1;
+	local VALUE=$2;
+	local SCALING_FACTOR=$3;
+	local TOLERANCE=$4;
+
+	awk -v base="${BASE_VALUE}" -v value="${VALUE}" -v factor="${SCALING_FACTOR}" -v tolerance="${TOLERANCE}" '
+		BEGIN {
+			if( base <= 0 ) {
+				base = 1;
+			}
+			exit ( ( value / base ) > ( factor * tolerance ) );
+		}';
+}
+
+test_scaling()
+{
+	local TMPDIR=$1;
+
+	local BASE_TIME="";
+	local BASE_MEMORY="";
+	local EMPTY_MEMORY="";
+	local MEASUREMENT="";
+	local RESULT=${EXIT_SUCCESS};
+
+	# The memory growth is compared over the peak memory usage of a file
+	# without chunks, which contains the fixed overhead of the library
+	local INPUT_FILE="${TMPDIR}/scaling_empty.evtx";
+
+	${GENERATE_EXECUTABLE} -c1 -s1 "${INPUT_FILE}.tmp" > /dev/null 2>&1;
+	RESULT=$?;
+
+	if test ${RESULT} -ne ${EXIT_SUCCESS};
+	then
+		echo "Unable to generate empty test file (FAIL)";
+
+		return ${RESULT};
+	fi
+	# Only keep the 4096 bytes of the file header
+	dd if="${INPUT_FILE}.tmp" of="${INPUT_FILE}" bs=4096 count=1 > /dev/null 2>&1;
+	RESULT=$?;
+
+	rm -f "${INPUT_FILE}.tmp";
+
+	if test ${RESULT} -ne ${EXIT_SUCCESS};
+	then
+		echo "Unable to generate empty test file (FAIL)";
+
+		return ${RESULT};
+	fi
+	MEASUREMENT=`measure_file "${INPUT_FILE}" "${TMPDIR}"`;
+	RESULT=$?;
+
+	rm -f "${INPUT_FILE}";
+
+	if test ${RESULT} -ne ${EXIT_SUCCESS};
+	then
+		echo "Unable to measure empty test file (FAIL)";
+
+		return ${RESULT};
+	fi
+	EMPTY_MEMORY=`echo "${MEASUREMENT}" | cut -d ' ' -f 2`;
+
+	for SCALING_FACTOR in ${SCALING_FACTORS};
+	do
+		local NUMBER_OF_CHUNKS=$(( ${BASE_NUMBER_OF_CHUNKS} * ${SCALING_FACTOR} ));
+		local INPUT_FILE="${TMPDIR}/scaling_${SCALING_FACTOR}x.evtx";
+
+		${GENERATE_EXECUTABLE} -c${NUMBER_OF_CHUNKS} -s1 "${INPUT_FILE}" > /dev/null 2>&1;
+		RESULT=$?;
+
+		if test ${RESULT} -ne ${EXIT_SUCCESS};
+		then
+			echo "Unable to generate test file with ${NUMBER_OF_CHUNKS} chunks (FAIL)";
+
+			break;
+		fi
+		MEASUREMENT=`measure_file "${INPUT_FILE}" "${TMPDIR}"`;
+		RESULT=$?;
+
+		rm -f "${INPUT_FILE}";
+
+		if test ${RESULT} -ne ${EXIT_SUCCESS};
+		then
+			echo "Unable to measure test file with ${NUMBER_OF_CHUNKS} chunks (FAIL)";
+
+			break;
+		fi
+		local TIME=`echo "${MEASUREMENT}" | cut -d ' ' -f 1`;
+		local MEMORY=`echo "${MEASUREMENT}" | cut -d ' ' -f 2`;
+
+		if test "${MEMORY}" != "null" && test "${EMPTY_MEMORY}" != "null";
+		then
+			MEMORY=$(( ${MEMORY} - ${EMPTY_MEMORY} ));
+		else
+			MEMORY="null";
+		fi
+
+		if test -z "${BASE_TIME}";
+		then
+			BASE_TIME=${TIME};
+			BASE_MEMORY=${MEMORY};
+
+			continue;
+		fi
+		echo -n "Testing time growth of ${SCALING_FACTOR}x file (${BASE_TIME} ns to ${TIME} ns) ";
+
+		check_growth_ratio "${BASE_TIME}" "${TIME}" "${SCALING_FACTOR}" "${TIME_TOLERANCE}";
+		RESULT=$?;
+
+		if test ${RESULT} -ne ${EXIT_SUCCESS};
+		then
+			echo " (FAIL)";
+
+			break;
+		fi
+		echo " (PASS)";
+
+		if test "${BASE_MEMORY}" = "null" || test "${MEMORY}" = "null";
+		then
+			continue;
+		fi
+		echo -n "Testing peak memory growth of ${SCALING_FACTOR}x file over empty file (${BASE_MEMORY} bytes to ${MEMORY} bytes) ";
+
+		check_growth_ratio "${BASE_MEMORY}" "${MEMORY}" "${SCALING_FACTOR}" "${MEMORY_TOLERANCE}";
+		RESULT=$?;
+
+		if test ${RESULT} -ne ${EXIT_SUCCESS};
+		then
+			echo " (FAIL)";
+
+			break;
+		fi
+		echo " (PASS)";
+	done
+	return ${RESULT};
+}
+
+TMPDIR="tmp$$";
+
+rm -rf ${TMPDIR};
+mkdir ${TMPDIR};
+
+test_scaling "${TMPDIR}";
+RESULT=$?;
+
+rm -rf ${TMPDIR};
+
+exit ${RESULT};
+